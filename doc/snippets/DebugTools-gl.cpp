@@ -24,6 +24,7 @@
 */
 
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 
@@ -53,6 +54,8 @@
 #include "Magnum/GL/BufferImage.h"
 #endif
 
+#define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
+
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
 
@@ -161,6 +164,30 @@ DebugTools::FrameProfilerGL _profiler{
 /* [FrameProfilerGL-usage] */
 }
 
+{
+/* [FrameProfilerGL-scopes] */
+enum: UnsignedInt { ShadowPass, ShadowCascade0, ShadowCascade1, GBuffer };
+
+DebugTools::FrameProfilerGL profiler{
+    DebugTools::FrameProfilerGL::Value::GpuDuration,
+    {"Shadow pass", "  Cascade 0", "  Cascade 1", "G-buffer"}, 50};
+
+profiler.beginFrame();
+profiler.beginScope(ShadowPass);
+    profiler.beginScope(ShadowCascade0);
+    DOXYGEN_ELLIPSIS()
+    profiler.endScope();
+    profiler.beginScope(ShadowCascade1);
+    DOXYGEN_ELLIPSIS()
+    profiler.endScope();
+profiler.endScope();
+profiler.beginScope(GBuffer);
+DOXYGEN_ELLIPSIS()
+profiler.endScope();
+profiler.endFrame();
+/* [FrameProfilerGL-scopes] */
+}
+
 {
 GL::Texture2D texture;
 Range2Di rect;
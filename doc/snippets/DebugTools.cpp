@@ -24,6 +24,7 @@
 */
 
 #include <chrono>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -32,10 +33,18 @@
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/TimestepScheduler.h"
 #include "Magnum/DebugTools/CompareImage.h"
 #include "Magnum/DebugTools/FrameProfiler.h"
+#include "Magnum/DebugTools/FrameProfilerTrade.h"
+#include "Magnum/DebugTools/Rasterizer.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 
 using namespace Magnum;
 
@@ -166,4 +175,78 @@ DebugTools::FrameProfiler profiler{{
 /* [FrameProfiler-setup-immediate] */
 }
 
+{
+TimestepScheduler scheduler;
+UnsignedInt physicsRate = scheduler.addRate(Nanoseconds{8333333});
+/* [TimestepScheduler-profiling] */
+struct Profiled {
+    TimestepScheduler& scheduler;
+    UnsignedInt rate;
+} profiled{scheduler, physicsRate};
+
+DebugTools::FrameProfiler profiler{{
+    DebugTools::FrameProfiler::Measurement{"Frame jitter",
+        DebugTools::FrameProfiler::Units::Nanoseconds,
+        [](void*) {},
+        [](void* state) {
+            return UnsignedLong(Long(
+                static_cast<Profiled*>(state)->scheduler.frameJitter()));
+        }, &profiled},
+    DebugTools::FrameProfiler::Measurement{"Physics steps",
+        DebugTools::FrameProfiler::Units::Count,
+        [](void*) {},
+        [](void* state) {
+            const Profiled& p = *static_cast<Profiled*>(state);
+            return UnsignedLong(p.scheduler.stepCount(p.rate));
+        }, &profiled},
+    DebugTools::FrameProfiler::Measurement{"Physics dropped time",
+        DebugTools::FrameProfiler::Units::Nanoseconds,
+        [](void*) {},
+        [](void* state) {
+            const Profiled& p = *static_cast<Profiled*>(state);
+            return UnsignedLong(Long(p.scheduler.droppedDuration(p.rate)));
+        }, &profiled}
+}, 50};
+/* [TimestepScheduler-profiling] */
+}
+
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+Containers::Pointer<Trade::AbstractImporter> importer = manager.loadAndInstantiate("SomethingWhatever");
+/* [FrameProfilerTrade-usage] */
+Trade::PluginStatistics statistics;
+importer->setStatistics(&statistics);
+
+DebugTools::FrameProfilerTrade profiler{statistics,
+    DebugTools::FrameProfilerTrade::Value::ImportDuration|
+    DebugTools::FrameProfilerTrade::Value::ImportOutputSize, 50};
+
+// in the draw event, importing meshes and images on demand …
+profiler.beginFrame();
+Containers::Optional<Trade::MeshData> mesh = importer->mesh("chair");
+profiler.endFrame();
+/* [FrameProfilerTrade-usage] */
+}
+
+{
+using namespace Math::Literals;
+PluginManager::Manager<Trade::AbstractImporter> manager;
+Containers::Pointer<Trade::AbstractImporter> importer = manager.loadAndInstantiate("SomethingWhatever");
+PluginManager::Manager<Trade::AbstractImageConverter> converterManager;
+Containers::Pointer<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate("SomethingWhatever");
+/* [Rasterizer-usage] */
+Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+Containers::Optional<Trade::MaterialData> material = importer->material(0);
+
+DebugTools::Rasterizer rasterizer{{256, 256}};
+rasterizer
+    .setProjectionMatrix(Matrix4::perspectiveProjection(35.0_degf, 1.0f, 0.01f, 100.0f))
+    .setTransformationMatrix(Matrix4::translation(Vector3::zAxis(-5.0f)))
+    .clear(0x1f1f1fff_rgbaf)
+    .draw(*mesh, *material, DebugTools::Rasterizer::Shading::Phong);
+
+converter->convertToFile(rasterizer.image(), "thumbnail.png");
+/* [Rasterizer-usage] */
+}
+
 }
@@ -30,6 +30,8 @@
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/TimestepScheduler.h"
 #include "Magnum/VertexFormat.h"
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/ResourceManager.h"
@@ -385,4 +387,88 @@ PixelFormat rgbFormat = pixelFormat(
 static_cast<void>(rgbFormat);
 }
 
+{
+struct {
+    void step(Nanoseconds) {}
+    void interpolate(Float) {}
+} physics, ai;
+/* [TimestepScheduler-usage] */
+using namespace Math::Literals;
+
+TimestepScheduler scheduler;
+UnsignedInt physicsRate = scheduler.addRate(1.0_sec/120);
+UnsignedInt aiRate = scheduler.addRate(100.0_msec, 2);
+scheduler.start();
+
+DOXYGEN_ELLIPSIS()
+
+// In each frame
+scheduler.nextFrame();
+
+for(UnsignedInt i = 0; i != scheduler.stepCount(physicsRate); ++i)
+    physics.step(scheduler.period(physicsRate));
+for(UnsignedInt i = 0; i != scheduler.stepCount(aiRate); ++i)
+    ai.step(scheduler.period(aiRate));
+
+// Render the physics state interpolated between the last two steps
+physics.interpolate(scheduler.alpha(physicsRate));
+/* [TimestepScheduler-usage] */
+}
+
+{
+Containers::StridedArrayView1D<Vector3> positions;
+Matrix4 transformation;
+/* [ThreadPool] */
+ThreadPool pool{ThreadPool::hardwareThreadCount() - 1};
+
+/* Transform the positions in chunks of 4096 */
+pool.parallelFor(positions.size(), 4096, [&](std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i)
+        positions[i] = transformation.transformPoint(positions[i]);
+});
+/* [ThreadPool] */
+}
+
+{
+/* [ThreadPool-global] */
+ThreadPool pool{ThreadPool::hardwareThreadCount() - 1};
+ThreadPool::setGlobal(&pool);
+
+DOXYGEN_ELLIPSIS()
+
+/* Reset back before the pool gets destroyed */
+ThreadPool::setGlobal(nullptr);
+/* [ThreadPool-global] */
+}
+
+{
+struct JobSystem {
+    void runAndWait(std::size_t, void(*)(void*, std::size_t), void*) {}
+} myJobSystem;
+/* [ThreadPool-dispatch] */
+ThreadPool pool{0};
+pool.setDispatchCallback([](std::size_t jobCount, ThreadPool::JobFunction job, void* jobState, void* userData) {
+    static_cast<JobSystem*>(userData)->runAndWait(jobCount, job, jobState);
+}, &myJobSystem);
+/* [ThreadPool-dispatch] */
+}
+
+{
+ThreadPool pool{0};
+void(*loadMesh)(void*) = nullptr;
+void(*loadTextures)(void*) = nullptr;
+void(*upload)(void*) = nullptr;
+void* state = nullptr;
+/* [TaskGraph] */
+TaskGraph graph;
+UnsignedInt mesh = graph.addTask(loadMesh, state);
+UnsignedInt textures = graph.addTask(loadTextures, state);
+graph.addTask(upload, state, {mesh, textures});
+
+/* Loads the mesh and the textures in parallel, uploads after both are
+   done */
+pool.run(graph);
+/* [TaskGraph] */
+}
+
 }
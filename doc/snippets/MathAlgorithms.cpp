@@ -30,6 +30,7 @@
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Algorithms/KahanSum.h"
 #include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Packing.h"
 
 using namespace Magnum;
@@ -84,4 +85,15 @@ Math::RectangularMatrix<cols, rows, Double> w =
 static_cast<void>(w);
 }
 
+{
+Matrix4 transformation;
+/* [svdJacobi-polar] */
+Containers::Triple<Matrix3x3, Vector3, Matrix3x3> uwv =
+    Math::Algorithms::svdJacobi(transformation.rotationScaling());
+
+Matrix3x3 rotation = uwv.first()*uwv.third().transposed();
+/* [svdJacobi-polar] */
+static_cast<void>(rotation);
+}
+
 }
@@ -35,6 +35,12 @@
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/Trade/MeshData.h"
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/ComputeGL.h"
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <tuple>
 #include <vector>
@@ -58,6 +64,26 @@ GL::Mesh mesh = MeshTools::compile(meshData, indices, vertices);
 /* [compile-external] */
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+Trade::MeshData meshData{MeshPrimitive::Triangles, 5};
+/* [ComputeGL] */
+GL::Buffer indices{meshData.indexData()};
+GL::Buffer vertices{meshData.vertexData()};
+
+/* Transform the mesh, regenerate its normals and calculate its bounds without
+   a roundtrip through the CPU */
+MeshTools::ComputeGL compute;
+compute.transform3DInPlace(meshData, vertices, Matrix4::scaling(Vector3{2.0f}));
+compute.generateSmoothNormalsInto(meshData, indices, vertices);
+Range3D bounds = compute.boundingRange(meshData, vertices);
+
+GL::Mesh mesh = MeshTools::compile(meshData, indices, vertices);
+/* [ComputeGL] */
+static_cast<void>(bounds);
+}
+#endif
+
 {
 Trade::MeshData meshData{MeshPrimitive::Lines, 5};
 /* [compile-external-attributes] */
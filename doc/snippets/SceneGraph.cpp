@@ -25,6 +25,7 @@
 
 #include <algorithm> /* std::sort() */
 
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Intersection.h"
 #include "Magnum/SceneGraph/Animable.h"
@@ -321,6 +322,25 @@ DOXYGEN_ELLIPSIS()
 /* [Animable-usage] */
 }
 
+{
+Scene3D scene;
+/* [Animable-parallel] */
+ThreadPool pool{ThreadPool::hardwareThreadCount() - 1};
+ThreadPool::setGlobal(&pool);
+
+SceneGraph::AnimableGroup3D animables;
+
+/* The objects are leaves not sharing any state, so the animation step can be
+   called in parallel */
+for(std::size_t i = 0; i != 10000; ++i)
+    (new AnimableObject(&scene, &animables))
+        ->setThreadSafe(true)
+        .setState(SceneGraph::AnimationState::Running);
+/* [Animable-parallel] */
+
+ThreadPool::setGlobal(nullptr);
+}
+
 {
 SceneGraph::Object<SceneGraph::MatrixTransformation2D> cameraObject;
 /* [Camera-2D] */
@@ -27,6 +27,7 @@
 #include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Triple.h>
 
@@ -36,6 +37,7 @@
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Filter.h"
 #include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/RuntimeScene.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -164,4 +166,25 @@ for(const Containers::Pair<UnsignedInt, Int>& parent:
 }
 /* [parentsBreadthFirst-transformations] */
 }
+
+{
+Matrix4 transformation;
+/* [RuntimeScene-usage] */
+Trade::SceneData data = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+SceneTools::RuntimeScene scene{data};
+
+/* Change a transformation of an object, identified by its original ID */
+if(Containers::Optional<UnsignedInt> object = scene.findObject(17))
+    scene.setTransformation(*object, transformation);
+
+/* Recalculate absolute transformations of dirty subtrees, then use them for
+   all drawables */
+scene.update();
+for(std::size_t i = 0; i != scene.drawableCount(); ++i) {
+    const Matrix4& absolute =
+        scene.absoluteTransformations()[scene.drawableObjects()[i]];
+    DOXYGEN_ELLIPSIS(static_cast<void>(absolute);)
+}
+/* [RuntimeScene-usage] */
+}
 }
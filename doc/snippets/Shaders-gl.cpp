@@ -1184,6 +1184,37 @@ shader
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+GL::Mesh mesh;
+Matrix4 projectionMatrix;
+Vector2i viewportSize;
+Containers::Array<Shaders::PhongLightUniform> lights;
+GL::Buffer projectionUniform, materialUniform, transformationUniform,
+    drawUniform;
+/* [PhongGL-clustered] */
+/* Lights with camera-relative positions, with a finite range */
+GL::Buffer lightStorage{lights};
+
+/* 16x9 screen-space tiles, 24 depth slices between 0.1 and 100 units */
+const Vector3ui clusterCount{16, 9, 24};
+GL::Buffer clusterStorage{Shaders::phongLightClusters(projectionMatrix,
+    clusterCount, 0.1f, 100.0f, lights)};
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::ShaderStorageBuffers|
+              Shaders::PhongGL::Flag::ClusteredLighting)
+    .setLightCount(lights.size(), 32)};
+shader
+    .setLightClusterGrid(clusterCount, viewportSize, 0.1f, 100.0f)
+    .bindLightBuffer(lightStorage)
+    .bindLightClusterBuffer(clusterStorage)
+    // bind projection, material, transformation and draw buffers ...
+    .draw(mesh);
+/* [PhongGL-clustered] */
+}
+#endif
+
 #if !defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG) || __GNUC__ >= 5
 {
 /* [VectorGL-usage1] */
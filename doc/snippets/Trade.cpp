@@ -54,6 +54,7 @@
 #include "Magnum/Trade/AbstractSceneConverter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageTileCache.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -61,6 +62,7 @@
 #include "Magnum/Trade/PbrSpecularGlossinessMaterialData.h"
 #include "Magnum/Trade/PbrMetallicRoughnessMaterialData.h"
 #include "Magnum/Trade/PhongMaterialData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -192,6 +194,25 @@ if(!image) Fatal{} << "Importing the image failed";
 /* [AbstractImporter-usage] */
 }
 
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [ImageTileCache-usage] */
+Containers::Optional<Vector2i> size = importer->image2DSize(0);
+if(!size) Fatal{} << "Can't query the image size";
+
+/* Keep at most 16 tiles of 512x512 pixels in memory */
+Trade::ImageTileCache cache{*importer, 0, 0, *size, {512, 512}, 16};
+for(Int y = 0; y != cache.tileCount().y(); ++y) {
+    for(Int x = 0; x != cache.tileCount().x(); ++x) {
+        Containers::Optional<ImageView2D> tile = cache.tile({x, y});
+        if(!tile) Fatal{} << "Importing tile" << Debug::packed << Vector2i{x, y} << "failed";
+
+        // process the tile ...
+    }
+}
+/* [ImageTileCache-usage] */
+}
+
 {
 /* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
    the converter pointer. I don't care, I just want you to check compilation
@@ -277,6 +298,33 @@ importer->setFileCallback([](const std::string& filename,
 /* [AbstractImporter-setFileCallback-template] */
 }
 
+{
+/* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
+   the converter pointer. I don't care, I just want you to check compilation
+   errors, not more! */
+PluginManager::Manager<Trade::AbstractImporter> importerManager;
+PluginManager::Manager<Trade::AbstractSceneConverter> converterManager;
+Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate("SomethingWhatever");
+Containers::Pointer<Trade::AbstractSceneConverter> converter = converterManager.loadAndInstantiate("SomethingWhatever");
+/* [PluginStatistics-usage] */
+Trade::PluginStatistics statistics;
+importer->setStatistics(&statistics);
+converter->setStatistics(&statistics);
+
+importer->openFile("scene.gltf");
+converter->beginFile("scene.ply");
+for(UnsignedInt i = 0; i != importer->meshCount(); ++i)
+    if(Containers::Optional<Trade::MeshData> mesh = importer->mesh(i))
+        converter->add(*mesh);
+converter->endFile();
+
+const Trade::PluginOperationStatistics& meshes =
+    statistics[Trade::PluginOperation::Mesh];
+Debug{} << "Imported" << meshes.count << "meshes with" << meshes.outputSize
+    << "bytes in" << Float(Seconds{meshes.duration}) << "seconds";
+/* [PluginStatistics-usage] */
+}
+
 {
 struct: Trade::AbstractImporter {
     Trade::ImporterFeatures doFeatures() const override { return {}; }
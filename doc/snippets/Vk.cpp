@@ -40,6 +40,7 @@
 #include "Magnum/Vk/CommandBuffer.h"
 #include "Magnum/Vk/CommandPoolCreateInfo.h"
 #include "Magnum/Vk/ComputePipelineCreateInfo.h"
+#include "Magnum/Vk/DescriptorAllocator.h"
 #include "Magnum/Vk/DescriptorPoolCreateInfo.h"
 #include "Magnum/Vk/DescriptorSet.h"
 #include "Magnum/Vk/DescriptorSetLayoutCreateInfo.h"
@@ -68,6 +69,7 @@
 #include "Magnum/Vk/SamplerCreateInfo.h"
 #include "Magnum/Vk/ShaderCreateInfo.h"
 #include "Magnum/Vk/ShaderSet.h"
+#include "Magnum/Vk/UploadManager.h"
 #include "MagnumExternal/Vulkan/flextVkGlobal.h"
 
 /* [wrapping-include-createinfo] */
@@ -336,6 +338,49 @@ Vk::DescriptorPool pool{device, Vk::DescriptorPoolCreateInfo{8, {
 /* [DescriptorPool-creation] */
 }
 
+{
+Vk::Device device{NoCreate};
+Vk::DescriptorSetLayout layout{NoCreate};
+VkBuffer uniforms{}, instanceData{};
+/* [DescriptorAllocator-usage] */
+Vk::DescriptorAllocator allocator{device, 3, 64, {
+    {Vk::DescriptorType::UniformBuffer, 128},
+    {Vk::DescriptorType::CombinedImageSampler, 64}
+}};
+
+/* Each frame, after waiting on the fence for the frame that's being reused */
+allocator.nextFrame();
+
+Containers::Pair<VkDescriptorSet, bool> set = allocator.allocateCached(layout,
+    {UnsignedLong(uniforms), UnsignedLong(instanceData)});
+if(set.second()) {
+    /* Newly allocated, write the descriptors */
+    DOXYGEN_ELLIPSIS()
+}
+/* [DescriptorAllocator-usage] */
+}
+
+{
+Vk::Device device{NoCreate};
+Vk::Queue transferQueue{NoCreate};
+UnsignedInt transferQueueFamily{};
+Vk::Buffer vertices{NoCreate};
+Containers::ArrayView<const char> vertexData;
+/* [UploadManager-usage] */
+Vk::UploadManager uploadManager{device, transferQueue, transferQueueFamily,
+    16*1024*1024};
+
+uploadManager.uploadBuffer(vertexData, vertices);
+DOXYGEN_ELLIPSIS()
+UnsignedLong ticket = uploadManager.submit();
+
+/* Later, before using the buffer for drawing */
+if(uploadManager.isComplete(ticket)) {
+    DOXYGEN_ELLIPSIS()
+}
+/* [UploadManager-usage] */
+}
+
 {
 /* [DescriptorSet-allocation] */
 Vk::DescriptorSetLayout layout{DOXYGEN_ELLIPSIS(NoCreate)};
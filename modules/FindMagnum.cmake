@@ -377,6 +377,14 @@ if(NOT TARGET Magnum::Magnum)
     # Dependent libraries
     set_property(TARGET Magnum::Magnum APPEND PROPERTY INTERFACE_LINK_LIBRARIES
          Corrade::Utility)
+    # ThreadPool.cpp is using std::thread, not on Emscripten where it executes
+    # everything on the calling thread
+    if(NOT CORRADE_TARGET_EMSCRIPTEN)
+        set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+        find_package(Threads REQUIRED)
+        set_property(TARGET Magnum::Magnum APPEND PROPERTY INTERFACE_LINK_LIBRARIES
+            Threads::Threads)
+    endif()
 else()
     set(MAGNUM_LIBRARY Magnum::Magnum)
 endif()
@@ -449,12 +457,20 @@ if(MAGNUM_TARGET_GL)
     set(_MAGNUM_DebugTools_GL_DEPENDENCY_IS_OPTIONAL ON)
 endif()
 
-set(_MAGNUM_MaterialTools_DEPENDENCIES Trade)
+set(_MAGNUM_MaterialTools_DEPENDENCIES TextureTools Trade)
+if(MAGNUM_TARGET_GL)
+    # GL not required by MaterialTools themselves, but transitively by
+    # TextureTools
+    list(APPEND _MAGNUM_MaterialTools_DEPENDENCIES GL)
+endif()
 
 set(_MAGNUM_MeshTools_DEPENDENCIES Trade)
 if(MAGNUM_TARGET_GL)
     list(APPEND _MAGNUM_MeshTools_DEPENDENCIES GL)
 endif()
+if(MAGNUM_TARGET_VK)
+    list(APPEND _MAGNUM_MeshTools_DEPENDENCIES Vk)
+endif()
 
 set(_MAGNUM_OpenGLTester_DEPENDENCIES GL)
 if(MAGNUM_TARGET_EGL)
@@ -523,6 +539,7 @@ set(_MAGNUM_WglContext_DEPENDENCIES GL)
 
 set(_MAGNUM_MagnumFont_DEPENDENCIES Trade TgaImporter GL) # and below
 set(_MAGNUM_MagnumFontConverter_DEPENDENCIES Trade TgaImageConverter) # and below
+set(_MAGNUM_AnyImageImporter_DEPENDENCIES TextureTools) # and below
 set(_MAGNUM_ObjImporter_DEPENDENCIES MeshTools) # and below
 foreach(_component ${_MAGNUM_PLUGIN_COMPONENTS})
     if(_component MATCHES ".+AudioImporter")
@@ -947,8 +964,6 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         elseif(_component STREQUAL Primitives)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Cube.h)
 
-        # No special setup for SceneGraph library
-
         # SceneTools library
         elseif(_component STREQUAL SceneTools)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Hierarchy.h)
@@ -42,6 +42,8 @@ namespace Magnum { namespace DebugTools {
 class CORRADE_DEPRECATED("use FrameProfiler instead") Profiler;
 #endif
 class FrameProfiler;
+class FrameProfilerTrade;
+class Rasterizer;
 
 #ifdef MAGNUM_TARGET_GL
 class FrameProfilerGL;
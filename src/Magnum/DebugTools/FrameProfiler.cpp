@@ -439,10 +439,26 @@ struct FrameProfilerGL::State {
     UnsignedShort vertexFetchRatioIndex = 0xffff,
         primitiveClipRatioIndex = 0xffff;
     #endif
+    UnsignedShort scopeIndex = 0xffff;
     UnsignedLong frameTimeStartFrame[2];
     UnsignedLong cpuDurationStartFrame;
 
     enum: std::size_t { QueryCount = 3 };
+
+    /* Passed as the state pointer to the scope measurements, which is why
+       the scope array is never resized after setup() */
+    struct Scope {
+        Containers::StaticArray<QueryCount, GL::TimeQuery> beginQueries{DirectInit, NoCreate};
+        Containers::StaticArray<QueryCount, GL::TimeQuery> endQueries{DirectInit, NoCreate};
+        UnsignedInt id;
+        UnsignedInt current;
+        bool measured[QueryCount];
+        bool inFrame;
+        bool open;
+    };
+    Containers::Array<Scope> scopes;
+    Containers::Array<UnsignedInt> openScopes;
+
     Containers::StaticArray<QueryCount, GL::TimeQuery> timeQueries{DirectInit, NoCreate};
     #ifndef MAGNUM_TARGET_GLES
     Containers::StaticArray<QueryCount, GL::PipelineStatisticsQuery> verticesSubmittedQueries{DirectInit, NoCreate};
@@ -459,6 +475,11 @@ FrameProfilerGL::FrameProfilerGL(const Values values, const UnsignedInt maxFrame
     setup(values, maxFrameCount);
 }
 
+FrameProfilerGL::FrameProfilerGL(const Values values, const Containers::StringIterable& scopes, const UnsignedInt maxFrameCount): FrameProfilerGL{}
+{
+    setup(values, scopes, maxFrameCount);
+}
+
 FrameProfilerGL::FrameProfilerGL(FrameProfilerGL&&) noexcept = default;
 
 FrameProfilerGL& FrameProfilerGL::operator=(FrameProfilerGL&&) noexcept = default;
@@ -466,6 +487,10 @@ FrameProfilerGL& FrameProfilerGL::operator=(FrameProfilerGL&&) noexcept = defaul
 FrameProfilerGL::~FrameProfilerGL() = default;
 
 void FrameProfilerGL::setup(const Values values, const UnsignedInt maxFrameCount) {
+    setup(values, Containers::StringIterable{}, maxFrameCount);
+}
+
+void FrameProfilerGL::setup(const Values values, const Containers::StringIterable& scopes, const UnsignedInt maxFrameCount) {
     UnsignedShort index = 0;
     Containers::Array<Measurement> measurements;
     if(values & Value::FrameTime) {
@@ -573,6 +598,45 @@ void FrameProfilerGL::setup(const Values values, const UnsignedInt maxFrameCount
         _state->primitiveClipRatioIndex = index++;
     }
     #endif
+
+    /* Each scope is a pair of timestamp queries in a ring of QueryCount
+       frames. The scope state is reset at the beginning of every frame so
+       scopes that weren't measured in given frame report zero. */
+    _state->scopes = Containers::Array<State::Scope>{ValueInit, scopes.size()};
+    arrayResize(_state->openScopes, NoInit, 0); /** @todo arrayClear() */
+    _state->scopeIndex = scopes.isEmpty() ? 0xffff : index;
+    for(std::size_t i = 0; i != scopes.size(); ++i) {
+        State::Scope& scope = _state->scopes[i];
+        scope.id = i;
+        for(GL::TimeQuery& q: scope.beginQueries)
+            q = GL::TimeQuery{GL::TimeQuery::Target::Timestamp};
+        for(GL::TimeQuery& q: scope.endQueries)
+            q = GL::TimeQuery{GL::TimeQuery::Target::Timestamp};
+        arrayAppend(measurements, InPlaceInit,
+            scopes[i], Units::Nanoseconds,
+            UnsignedInt(State::QueryCount),
+            [](void* state, UnsignedInt current) {
+                State::Scope& scope = *static_cast<State::Scope*>(state);
+                scope.current = current;
+                scope.measured[current] = false;
+                scope.inFrame = true;
+            },
+            [](void* state, UnsignedInt) {
+                State::Scope& scope = *static_cast<State::Scope*>(state);
+                CORRADE_ASSERT(!scope.open,
+                    "DebugTools::FrameProfilerGL::endFrame(): scope" << scope.id << "not ended", );
+                scope.inFrame = false;
+            },
+            [](void* state, UnsignedInt previous, UnsignedInt) {
+                const State::Scope& scope = *static_cast<State::Scope*>(state);
+                if(!scope.measured[previous]) return UnsignedLong{};
+
+                return scope.endQueries[previous].result<UnsignedLong>() -
+                    scope.beginQueries[previous].result<UnsignedLong>();
+            }, &scope);
+        ++index;
+    }
+
     setup(Utility::move(measurements), maxFrameCount);
 }
 
@@ -637,6 +701,55 @@ Double FrameProfilerGL::primitiveClipRatioMean() const {
 }
 #endif
 
+UnsignedInt FrameProfilerGL::scopeCount() const {
+    return _state->scopes.size();
+}
+
+UnsignedInt FrameProfilerGL::scopeMeasurementId(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->scopes.size(),
+        "DebugTools::FrameProfilerGL::scopeMeasurementId(): index" << id << "out of range for" << _state->scopes.size() << "scopes", {});
+    return _state->scopeIndex + id;
+}
+
+UnsignedInt FrameProfilerGL::scopeDepth() const {
+    return _state->openScopes.size();
+}
+
+void FrameProfilerGL::beginScope(const UnsignedInt id) {
+    if(!isEnabled()) return;
+
+    CORRADE_ASSERT(id < _state->scopes.size(),
+        "DebugTools::FrameProfilerGL::beginScope(): index" << id << "out of range for" << _state->scopes.size() << "scopes", );
+    State::Scope& scope = _state->scopes[id];
+    CORRADE_ASSERT(scope.inFrame,
+        "DebugTools::FrameProfilerGL::beginScope(): expected begin of frame", );
+    CORRADE_ASSERT(!scope.open && !scope.measured[scope.current],
+        "DebugTools::FrameProfilerGL::beginScope(): scope" << id << "already measured in this frame", );
+
+    scope.beginQueries[scope.current].timestamp();
+    scope.open = true;
+    arrayAppend(_state->openScopes, id);
+}
+
+void FrameProfilerGL::endScope() {
+    if(!isEnabled()) return;
+
+    CORRADE_ASSERT(!_state->openScopes.isEmpty(),
+        "DebugTools::FrameProfilerGL::endScope(): no scope open", );
+    State::Scope& scope = _state->scopes[_state->openScopes.back()];
+    arrayRemoveSuffix(_state->openScopes);
+
+    scope.endQueries[scope.current].timestamp();
+    scope.open = false;
+    scope.measured[scope.current] = true;
+}
+
+Double FrameProfilerGL::scopeDurationMean(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->scopes.size(),
+        "DebugTools::FrameProfilerGL::scopeDurationMean(): index" << id << "out of range for" << _state->scopes.size() << "scopes", {});
+    return measurementMean(_state->scopeIndex + id);
+}
+
 namespace {
 
 constexpr const char* FrameProfilerGLValueNames[] {
@@ -525,6 +525,17 @@ If none if @ref Value::GpuDuration, @ref Value::VertexFetchRatio and
 @ref Value::PrimitiveClipRatio is not enabled, the class can operate without an
 active OpenGL context.
 
+@section DebugTools-FrameProfilerGL-scopes GPU scopes
+
+Besides whole-frame measurements, the profiler can measure GPU time spent in
+particular parts of the frame, such as a shadow pass or a G-buffer fill. Pass
+a list of scope names to the constructor or to @ref setup() and then wrap the
+corresponding rendering code in @ref beginScope() and @ref endScope() calls.
+Scopes can be nested, leading whitespace in the names can be used to indent
+them in the @ref statistics() output:
+
+@snippet DebugTools-gl.cpp FrameProfilerGL-scopes
+
 @experimental
 */
 class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
@@ -611,6 +622,16 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
          */
         explicit FrameProfilerGL(Values values, UnsignedInt maxFrameCount);
 
+        /**
+         * @brief Construct with GPU scopes
+         * @m_since_latest
+         *
+         * Equivalent to default-constructing an instance and calling
+         * @ref setup(Values, const Containers::StringIterable&, UnsignedInt)
+         * afterwards.
+         */
+        explicit FrameProfilerGL(Values values, const Containers::StringIterable& scopes, UnsignedInt maxFrameCount);
+
         /** @brief Copying is not allowed */
         FrameProfilerGL(const FrameProfilerGL&) = delete;
 
@@ -637,6 +658,36 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
          */
         void setup(Values values, UnsignedInt maxFrameCount);
 
+        /**
+         * @brief Setup measured values and GPU scopes
+         * @param values        List of measuremed values
+         * @param scopes        Names of GPU scopes to measure
+         * @param maxFrameCount Max frame count over which to calculate a
+         *      moving average. Expected to be at least @cpp 1 @ce.
+         * @m_since_latest
+         *
+         * In addition to @p values, a measurement is added for each item in
+         * @p scopes, in order. Each scope measures GPU time spent between a
+         * @ref beginScope() and a corresponding @ref endScope() call using
+         * a pair of timestamp queries, reported in @ref Units::Nanoseconds
+         * with a delay of 3 frames. The scope names are used as measurement
+         * names in @ref measurementName() and @ref statistics(), so you can
+         * for example indent nested scopes to make the hierarchy apparent in
+         * the printed output. Scopes require an active OpenGL context.
+         *
+         * Calling @ref setup() on an already set up profiler will replace
+         * existing measurements and reset @ref measuredFrameCount() back to
+         * @cpp 0 @ce.
+         * @requires_gl33 Extension @gl_extension{ARB,timer_query} if
+         *      @p scopes is non-empty
+         * @requires_es_extension Extension @gl_extension{EXT,disjoint_timer_query}
+         *      if @p scopes is non-empty
+         * @requires_webgl_extension Extension @webgl_extension{EXT,disjoint_timer_query}
+         *      on WebGL 1, @webgl_extension{EXT,disjoint_timer_query_webgl2}
+         *      on WebGL 2 if @p scopes is non-empty
+         */
+        void setup(Values values, const Containers::StringIterable& scopes, UnsignedInt maxFrameCount);
+
         /**
          * @brief Measured values
          *
@@ -709,6 +760,71 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
         Double primitiveClipRatioMean() const;
         #endif
 
+        /**
+         * @brief GPU scope count
+         * @m_since_latest
+         *
+         * Corresponds to the size of the @p scopes parameter passed to
+         * @ref FrameProfilerGL(Values, const Containers::StringIterable&, UnsignedInt)
+         * or @ref setup(Values, const Containers::StringIterable&, UnsignedInt).
+         */
+        UnsignedInt scopeCount() const;
+
+        /**
+         * @brief Measurement ID corresponding to a GPU scope
+         * @m_since_latest
+         *
+         * Can be used to query the scope name or its per-frame data using
+         * @ref measurementName(), @ref measurementData() and other
+         * @ref FrameProfiler APIs. Expects that @p id is less than
+         * @ref scopeCount().
+         */
+        UnsignedInt scopeMeasurementId(UnsignedInt id) const;
+
+        /**
+         * @brief Count of currently open GPU scopes
+         * @m_since_latest
+         *
+         * Incremented by each @ref beginScope() call and decremented by each
+         * @ref endScope() call.
+         */
+        UnsignedInt scopeDepth() const;
+
+        /**
+         * @brief Begin a GPU scope
+         * @m_since_latest
+         *
+         * Expects that @p id is less than @ref scopeCount() and that it's
+         * called between @ref beginFrame() and @ref endFrame(). Scopes can be
+         * nested, each scope can be measured at most once per frame. If a
+         * scope isn't measured in a particular frame, zero is recorded for it.
+         * If the profiler is disabled, the function does nothing.
+         * @see @ref endScope(), @ref scopeDepth(), @ref isEnabled()
+         */
+        void beginScope(UnsignedInt id);
+
+        /**
+         * @brief End the innermost GPU scope
+         * @m_since_latest
+         *
+         * Expects that there's at least one scope open. All scopes are
+         * expected to be ended before @ref endFrame() is called. If the
+         * profiler is disabled, the function does nothing.
+         * @see @ref beginScope(), @ref isEnabled()
+         */
+        void endScope();
+
+        /**
+         * @brief Mean GPU duration of a scope in nanoseconds
+         * @m_since_latest
+         *
+         * Expects that @p id is less than @ref scopeCount() and that
+         * measurement data is available.
+         * @see @ref isMeasurementAvailable(), @ref scopeMeasurementId(),
+         *      @ref measurementMean()
+         */
+        Double scopeDurationMean(UnsignedInt id) const;
+
     private:
         using FrameProfiler::setup;
 
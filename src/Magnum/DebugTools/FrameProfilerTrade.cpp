@@ -0,0 +1,245 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrameProfilerTrade.h"
+
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/PluginStatistics.h"
+
+namespace Magnum { namespace DebugTools {
+
+using namespace Containers::Literals;
+
+namespace {
+
+constexpr Trade::PluginOperation ImportOperations[]{
+    Trade::PluginOperation::OpenData,
+    Trade::PluginOperation::OpenFile,
+    Trade::PluginOperation::Mesh,
+    Trade::PluginOperation::Image1D,
+    Trade::PluginOperation::Image2D,
+    Trade::PluginOperation::Image3D
+};
+
+constexpr Trade::PluginOperation ConversionOperations[]{
+    Trade::PluginOperation::Convert,
+    Trade::PluginOperation::ConvertToData,
+    Trade::PluginOperation::ConvertToFile,
+    Trade::PluginOperation::Add
+};
+
+template<std::size_t size> UnsignedLong sumDuration(const Trade::PluginStatistics& statistics, const Trade::PluginOperation(&operations)[size]) {
+    UnsignedLong out = 0;
+    for(const Trade::PluginOperation operation: operations)
+        out += Long(statistics[operation].duration);
+    return out;
+}
+
+template<std::size_t size> UnsignedLong sumOutputSize(const Trade::PluginStatistics& statistics, const Trade::PluginOperation(&operations)[size]) {
+    UnsignedLong out = 0;
+    for(const Trade::PluginOperation operation: operations)
+        out += statistics[operation].outputSize;
+    return out;
+}
+
+}
+
+struct FrameProfilerTrade::State {
+    const Trade::PluginStatistics* statistics{};
+    UnsignedByte importDurationIndex = 0xff,
+        importOutputSizeIndex = 0xff,
+        conversionDurationIndex = 0xff,
+        conversionOutputSizeIndex = 0xff;
+    /* Cumulative values at the time beginFrame() was called, the measurement
+       is a difference to them at endFrame(). The statistics can get reset
+       in the middle of a frame, in which case the whole current value is
+       taken instead of wrapping around. */
+    UnsignedLong importDurationStartFrame,
+        importOutputSizeStartFrame,
+        conversionDurationStartFrame,
+        conversionOutputSizeStartFrame;
+};
+
+FrameProfilerTrade::FrameProfilerTrade(): _state{InPlaceInit} {}
+
+FrameProfilerTrade::FrameProfilerTrade(const Trade::PluginStatistics& statistics, const Values values, const UnsignedInt maxFrameCount): FrameProfilerTrade{} {
+    setup(statistics, values, maxFrameCount);
+}
+
+FrameProfilerTrade::FrameProfilerTrade(FrameProfilerTrade&&) noexcept = default;
+
+FrameProfilerTrade& FrameProfilerTrade::operator=(FrameProfilerTrade&&) noexcept = default;
+
+FrameProfilerTrade::~FrameProfilerTrade() = default;
+
+void FrameProfilerTrade::setup(const Trade::PluginStatistics& statistics, const Values values, const UnsignedInt maxFrameCount) {
+    _state->statistics = &statistics;
+    _state->importDurationIndex = 0xff;
+    _state->importOutputSizeIndex = 0xff;
+    _state->conversionDurationIndex = 0xff;
+    _state->conversionOutputSizeIndex = 0xff;
+
+    UnsignedByte index = 0;
+    Containers::Array<Measurement> measurements;
+    if(values & Value::ImportDuration) {
+        arrayAppend(measurements, InPlaceInit,
+            "Import duration"_s, Units::Nanoseconds,
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                self.importDurationStartFrame = sumDuration(*self.statistics, ImportOperations);
+            },
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                const UnsignedLong value = sumDuration(*self.statistics, ImportOperations);
+                return value >= self.importDurationStartFrame ? value - self.importDurationStartFrame : value;
+            }, _state.get());
+        _state->importDurationIndex = index++;
+    }
+    if(values & Value::ImportOutputSize) {
+        arrayAppend(measurements, InPlaceInit,
+            "Import output size"_s, Units::Bytes,
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                self.importOutputSizeStartFrame = sumOutputSize(*self.statistics, ImportOperations);
+            },
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                const UnsignedLong value = sumOutputSize(*self.statistics, ImportOperations);
+                return value >= self.importOutputSizeStartFrame ? value - self.importOutputSizeStartFrame : value;
+            }, _state.get());
+        _state->importOutputSizeIndex = index++;
+    }
+    if(values & Value::ConversionDuration) {
+        arrayAppend(measurements, InPlaceInit,
+            "Conversion duration"_s, Units::Nanoseconds,
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                self.conversionDurationStartFrame = sumDuration(*self.statistics, ConversionOperations);
+            },
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                const UnsignedLong value = sumDuration(*self.statistics, ConversionOperations);
+                return value >= self.conversionDurationStartFrame ? value - self.conversionDurationStartFrame : value;
+            }, _state.get());
+        _state->conversionDurationIndex = index++;
+    }
+    if(values & Value::ConversionOutputSize) {
+        arrayAppend(measurements, InPlaceInit,
+            "Conversion output size"_s, Units::Bytes,
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                self.conversionOutputSizeStartFrame = sumOutputSize(*self.statistics, ConversionOperations);
+            },
+            [](void* state) {
+                auto& self = *static_cast<State*>(state);
+                const UnsignedLong value = sumOutputSize(*self.statistics, ConversionOperations);
+                return value >= self.conversionOutputSizeStartFrame ? value - self.conversionOutputSizeStartFrame : value;
+            }, _state.get());
+        _state->conversionOutputSizeIndex = index++;
+    }
+
+    setup(Utility::move(measurements), maxFrameCount);
+}
+
+auto FrameProfilerTrade::values() const -> Values {
+    Values values;
+    if(_state->importDurationIndex != 0xff) values |= Value::ImportDuration;
+    if(_state->importOutputSizeIndex != 0xff) values |= Value::ImportOutputSize;
+    if(_state->conversionDurationIndex != 0xff) values |= Value::ConversionDuration;
+    if(_state->conversionOutputSizeIndex != 0xff) values |= Value::ConversionOutputSize;
+    return values;
+}
+
+bool FrameProfilerTrade::isMeasurementAvailable(const Value value) const {
+    const UnsignedByte* index = nullptr;
+    switch(value) {
+        case Value::ImportDuration: index = &_state->importDurationIndex; break;
+        case Value::ImportOutputSize: index = &_state->importOutputSizeIndex; break;
+        case Value::ConversionDuration: index = &_state->conversionDurationIndex; break;
+        case Value::ConversionOutputSize: index = &_state->conversionOutputSizeIndex; break;
+    }
+    CORRADE_INTERNAL_ASSERT(index);
+    CORRADE_ASSERT(*index < measurementCount(),
+        "DebugTools::FrameProfilerTrade::isMeasurementAvailable():" << value << "not enabled", {});
+    return isMeasurementAvailable(*index);
+}
+
+Double FrameProfilerTrade::importDurationMean() const {
+    CORRADE_ASSERT(_state->importDurationIndex < measurementCount(),
+        "DebugTools::FrameProfilerTrade::importDurationMean(): not enabled", {});
+    return measurementMean(_state->importDurationIndex);
+}
+
+Double FrameProfilerTrade::importOutputSizeMean() const {
+    CORRADE_ASSERT(_state->importOutputSizeIndex < measurementCount(),
+        "DebugTools::FrameProfilerTrade::importOutputSizeMean(): not enabled", {});
+    return measurementMean(_state->importOutputSizeIndex);
+}
+
+Double FrameProfilerTrade::conversionDurationMean() const {
+    CORRADE_ASSERT(_state->conversionDurationIndex < measurementCount(),
+        "DebugTools::FrameProfilerTrade::conversionDurationMean(): not enabled", {});
+    return measurementMean(_state->conversionDurationIndex);
+}
+
+Double FrameProfilerTrade::conversionOutputSizeMean() const {
+    CORRADE_ASSERT(_state->conversionOutputSizeIndex < measurementCount(),
+        "DebugTools::FrameProfilerTrade::conversionOutputSizeMean(): not enabled", {});
+    return measurementMean(_state->conversionOutputSizeIndex);
+}
+
+namespace {
+
+constexpr const char* FrameProfilerTradeValueNames[] {
+    "ImportDuration",
+    "ImportOutputSize",
+    "ConversionDuration",
+    "ConversionOutputSize"
+};
+
+}
+
+Debug& operator<<(Debug& debug, const FrameProfilerTrade::Value value) {
+    debug << "DebugTools::FrameProfilerTrade::Value" << Debug::nospace;
+
+    const UnsignedInt bit = Math::log2(UnsignedByte(value));
+    if(1 << bit == UnsignedByte(value))
+        return debug << "::" << Debug::nospace << FrameProfilerTradeValueNames[bit];
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const FrameProfilerTrade::Values value) {
+    return Containers::enumSetDebugOutput(debug, value, "DebugTools::FrameProfilerTrade::Values{}", {
+        FrameProfilerTrade::Value::ImportDuration,
+        FrameProfilerTrade::Value::ImportOutputSize,
+        FrameProfilerTrade::Value::ConversionDuration,
+        FrameProfilerTrade::Value::ConversionOutputSize});
+}
+
+}}
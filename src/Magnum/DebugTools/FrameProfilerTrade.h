@@ -0,0 +1,243 @@
+#ifndef Magnum_DebugTools_FrameProfilerTrade_h
+#define Magnum_DebugTools_FrameProfilerTrade_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::FrameProfilerTrade
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/DebugTools/FrameProfiler.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Importer and converter plugin frame profiler
+@m_since_latest
+
+A @ref FrameProfiler showing per-frame values gathered by a
+@ref Trade::PluginStatistics instance. Useful for example for applications
+that stream assets in during rendering, where it shows how much time each frame
+spends in importer and converter plugins. Attach the statistics to plugin
+instances, instantiate the profiler with a desired subset of measured values
+and then continue the same way as described in the
+@ref DebugTools-FrameProfiler-usage "FrameProfiler usage documentation":
+
+@snippet DebugTools.cpp FrameProfilerTrade-usage
+
+The profiler only reads the statistics instance, so it can be shared with
+other code or reset at any point. The statistics instance is expected to stay
+in scope for the whole lifetime of the profiler.
+
+This class is available only if Magnum is compiled with
+@ref MAGNUM_WITH_TRADE enabled (done by default). See @ref building-features
+for more information.
+@experimental
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerTrade: public FrameProfiler {
+    public:
+        /**
+         * @brief Measured value
+         *
+         * @see @ref Values,
+         *      @ref FrameProfilerTrade(const Trade::PluginStatistics&, Values, UnsignedInt),
+         *      @ref setup()
+         */
+        enum class Value: UnsignedByte {
+            /**
+             * Time spent in importer plugins during a frame, i.e. a sum of
+             * @ref Trade::PluginOperation::OpenData,
+             * @relativeref{Trade::PluginOperation,OpenFile},
+             * @relativeref{Trade::PluginOperation,Mesh},
+             * @relativeref{Trade::PluginOperation,Image1D},
+             * @relativeref{Trade::PluginOperation,Image2D} and
+             * @relativeref{Trade::PluginOperation,Image3D} durations recorded
+             * between @ref beginFrame() and @ref endFrame(). Reported in
+             * @ref Units::Nanoseconds with no delay.
+             */
+            ImportDuration = 1 << 0,
+
+            /**
+             * Count of bytes produced by importer plugins during a frame,
+             * i.e. a sum of output sizes of the same operations as in
+             * @ref Value::ImportDuration. Reported in @ref Units::Bytes with
+             * no delay.
+             */
+            ImportOutputSize = 1 << 1,
+
+            /**
+             * Time spent in converter plugins during a frame, i.e. a sum of
+             * @ref Trade::PluginOperation::Convert,
+             * @relativeref{Trade::PluginOperation,ConvertToData},
+             * @relativeref{Trade::PluginOperation,ConvertToFile} and
+             * @relativeref{Trade::PluginOperation,Add} durations recorded
+             * between @ref beginFrame() and @ref endFrame(). Reported in
+             * @ref Units::Nanoseconds with no delay.
+             */
+            ConversionDuration = 1 << 2,
+
+            /**
+             * Count of bytes produced by converter plugins during a frame,
+             * i.e. a sum of output sizes of the same operations as in
+             * @ref Value::ConversionDuration. Reported in @ref Units::Bytes
+             * with no delay.
+             */
+            ConversionOutputSize = 1 << 3
+        };
+
+        /**
+         * @brief Measured values
+         *
+         * @see @ref FrameProfilerTrade(const Trade::PluginStatistics&, Values, UnsignedInt),
+         *      @ref setup()
+         */
+        typedef Containers::EnumSet<Value> Values;
+
+        /**
+         * @brief Default constructor
+         *
+         * Call @ref setup() to populate the profiler with measurements.
+         */
+        explicit FrameProfilerTrade();
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to default-constructing an instance and calling
+         * @ref setup() afterwards.
+         */
+        explicit FrameProfilerTrade(const Trade::PluginStatistics& statistics, Values values, UnsignedInt maxFrameCount);
+
+        /** @brief Copying is not allowed */
+        FrameProfilerTrade(const FrameProfilerTrade&) = delete;
+
+        /** @brief Move constructor */
+        FrameProfilerTrade(FrameProfilerTrade&&) noexcept;
+
+        /** @brief Copying is not allowed */
+        FrameProfilerTrade& operator=(const FrameProfilerTrade&) = delete;
+
+        /** @brief Move assignment */
+        FrameProfilerTrade& operator=(FrameProfilerTrade&&) noexcept;
+
+        ~FrameProfilerTrade();
+
+        /**
+         * @brief Setup measured values
+         * @param statistics    Statistics to measure
+         * @param values        List of measuremed values
+         * @param maxFrameCount Max frame count over which to calculate a
+         *      moving average. Expected to be at least @cpp 1 @ce.
+         *
+         * Calling @ref setup() on an already set up profiler will replace
+         * existing measurements and reset @ref measuredFrameCount() back to
+         * @cpp 0 @ce.
+         */
+        void setup(const Trade::PluginStatistics& statistics, Values values, UnsignedInt maxFrameCount);
+
+        /**
+         * @brief Measured values
+         *
+         * Corresponds to the @p values parameter passed to
+         * @ref FrameProfilerTrade(const Trade::PluginStatistics&, Values, UnsignedInt)
+         * or @ref setup().
+         */
+        Values values() const;
+
+        /**
+         * @brief Whether given measurement is available
+         *
+         * Returns @cpp true @ce if enough frames was captured to calculate
+         * given @p value, @cpp false @ce otherwise. Expects that @p value was
+         * enabled.
+         */
+        bool isMeasurementAvailable(Value value) const;
+
+        using FrameProfiler::isMeasurementAvailable;
+
+        /**
+         * @brief Mean import duration in nanoseconds
+         *
+         * Expects that @ref Value::ImportDuration was enabled, and that
+         * measurement data is available.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double importDurationMean() const;
+
+        /**
+         * @brief Mean import output size in bytes
+         *
+         * Expects that @ref Value::ImportOutputSize was enabled, and that
+         * measurement data is available.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double importOutputSizeMean() const;
+
+        /**
+         * @brief Mean conversion duration in nanoseconds
+         *
+         * Expects that @ref Value::ConversionDuration was enabled, and that
+         * measurement data is available.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double conversionDurationMean() const;
+
+        /**
+         * @brief Mean conversion output size in bytes
+         *
+         * Expects that @ref Value::ConversionOutputSize was enabled, and that
+         * measurement data is available.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double conversionOutputSizeMean() const;
+
+    private:
+        using FrameProfiler::setup;
+
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+CORRADE_ENUMSET_OPERATORS(FrameProfilerTrade::Values)
+
+/**
+@debugoperatorclassenum{FrameProfilerTrade,FrameProfilerTrade::Value}
+@m_since_latest
+*/
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, FrameProfilerTrade::Value value);
+
+/**
+@debugoperatorclassenum{FrameProfilerTrade,FrameProfilerTrade::Values}
+@m_since_latest
+*/
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, FrameProfilerTrade::Values value);
+
+}}
+
+#endif
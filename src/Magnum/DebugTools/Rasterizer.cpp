@@ -0,0 +1,499 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Rasterizer.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/FlatMaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PhongMaterialData.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+/* Output of the vertex stage. Position is in clip space, the rest is what
+   the fragment stage interpolates. */
+struct Vertex {
+    Vector4 position;
+    Vector3 cameraPosition;
+    Vector3 normal;
+    Color4 color;
+};
+
+Vertex lerp(const Vertex& a, const Vertex& b, const Float t) {
+    return {Math::lerp(a.position, b.position, t),
+            Math::lerp(a.cameraPosition, b.cameraPosition, t),
+            Math::lerp(a.normal, b.normal, t),
+            Math::lerp(a.color, b.color, t)};
+}
+
+/* Triangle after clipping and the viewport transform. The window position
+   has X and Y in pixels and Z in the [0, 1] depth range, the vertices are
+   ordered counterclockwise. */
+struct Triangle {
+    Vertex vertices[3];
+    Vector3 window[3];
+    Float inverseW[3];
+    Range2Di bounds;
+};
+
+/* Clips a triangle against the near plane (z >= -w) and appends the result,
+   which is zero, one or two triangles, to the output */
+void clipAndAppend(Containers::Array<Triangle>& out, const Vertex(&in)[3], const Vector2i& size) {
+    /* Trivially reject triangles that are fully outside of any side of the
+       view frustum. Partially visible triangles are clipped only against the
+       near plane, the rest is handled by the bounds and depth test. */
+    for(std::size_t axis = 0; axis != 3; ++axis) {
+        if(in[0].position[axis] > in[0].position.w() &&
+           in[1].position[axis] > in[1].position.w() &&
+           in[2].position[axis] > in[2].position.w()) return;
+        if(in[0].position[axis] < -in[0].position.w() &&
+           in[1].position[axis] < -in[1].position.w() &&
+           in[2].position[axis] < -in[2].position.w()) return;
+    }
+
+    /* Sutherland-Hodgman against a single plane, producing at most four
+       vertices */
+    Vertex polygon[4];
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Vertex& a = in[i];
+        const Vertex& b = in[(i + 1) % 3];
+        const Float da = a.position.z() + a.position.w();
+        const Float db = b.position.z() + b.position.w();
+        if(da >= 0.0f) polygon[count++] = a;
+        if((da >= 0.0f) != (db >= 0.0f))
+            polygon[count++] = lerp(a, b, da/(da - db));
+    }
+
+    /* Triangulate the polygon as a fan */
+    for(std::size_t i = 2; i < count; ++i) {
+        Triangle triangle;
+        triangle.vertices[0] = polygon[0];
+        triangle.vertices[1] = polygon[i - 1];
+        triangle.vertices[2] = polygon[i];
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const Vector4& position = triangle.vertices[j].position;
+            triangle.inverseW[j] = 1.0f/position.w();
+            const Vector3 ndc = position.xyz()*triangle.inverseW[j];
+            triangle.window[j] = Vector3{(ndc.xy()*0.5f + Vector2{0.5f})*Vector2{size},
+                                  ndc.z()*0.5f + 0.5f};
+        }
+
+        /* Make the winding counterclockwise, skip degenerate triangles. No
+           face culling is done, same as default OpenGL state. */
+        const Vector2 e1 = triangle.window[1].xy() - triangle.window[0].xy();
+        const Vector2 e2 = triangle.window[2].xy() - triangle.window[0].xy();
+        const Float area = Math::cross(e1, e2);
+        if(area == 0.0f) continue;
+        if(area < 0.0f) {
+            Utility::swap(triangle.vertices[1], triangle.vertices[2]);
+            Utility::swap(triangle.window[1], triangle.window[2]);
+            Utility::swap(triangle.inverseW[1], triangle.inverseW[2]);
+        }
+
+        /* Pixels whose centers can be covered by the triangle, clamped to the
+           framebuffer. Clamping the floats first to avoid overflows when
+           converting to integers. */
+        const Vector2 min = Math::clamp(Math::min(Math::min(triangle.window[0].xy(), triangle.window[1].xy()), triangle.window[2].xy()) - Vector2{0.5f}, Vector2{0.0f}, Vector2{size});
+        const Vector2 max = Math::clamp(Math::max(Math::max(triangle.window[0].xy(), triangle.window[1].xy()), triangle.window[2].xy()) - Vector2{0.5f}, Vector2{-1.0f}, Vector2{size} - Vector2{1.0f});
+        triangle.bounds = {Vector2i{Math::ceil(min)}, Vector2i{Math::floor(max)} + Vector2i{1}};
+        if(triangle.bounds.sizeX() <= 0 || triangle.bounds.sizeY() <= 0)
+            continue;
+
+        arrayAppend(out, triangle);
+    }
+}
+
+/* Fragment stages. Get the triangle and perspective-corrected barycentric
+   coordinates, return the final color. */
+struct FlatShader {
+    Color4 operator()(const Triangle&, const Vector3&) const {
+        return color;
+    }
+
+    Color4 color;
+};
+
+struct VertexColorShader {
+    Color4 operator()(const Triangle& triangle, const Vector3& barycentric) const {
+        return triangle.vertices[0].color*barycentric[0] +
+               triangle.vertices[1].color*barycentric[1] +
+               triangle.vertices[2].color*barycentric[2];
+    }
+};
+
+/* Matches the Phong.frag calculation without textures and vertex colors */
+struct PhongShader {
+    Color4 operator()(const Triangle& triangle, const Vector3& barycentric) const {
+        const Vector3 position =
+            triangle.vertices[0].cameraPosition*barycentric[0] +
+            triangle.vertices[1].cameraPosition*barycentric[1] +
+            triangle.vertices[2].cameraPosition*barycentric[2];
+        const Vector3 normal = (
+            triangle.vertices[0].normal*barycentric[0] +
+            triangle.vertices[1].normal*barycentric[1] +
+            triangle.vertices[2].normal*barycentric[2]).normalized();
+        const Vector3 cameraDirection = (-position).normalized();
+
+        Color4 out = ambientColor;
+        for(std::size_t i = 0; i != lightPositions.size(); ++i) {
+            const Vector4& lightPosition = lightPositions[i];
+            const Vector3 lightDirection = lightPosition.xyz() - position*lightPosition.w();
+
+            /* Attenuation, directional lights have the distance zero */
+            const Float length = lightDirection.length();
+            const Float distance = length*lightPosition.w();
+            Float attenuation = Math::clamp(1.0f - Math::pow(distance/Math::max(lightRanges[i], 0.0001f), 4.0f), 0.0f, 1.0f);
+            attenuation = attenuation*attenuation/(1.0f + distance*distance);
+
+            const Vector3 normalizedLightDirection = lightDirection/length;
+            const Float intensity = Math::max(0.0f, Math::dot(normal, normalizedLightDirection))*attenuation;
+            out.rgb() += diffuseColor.rgb()*lightColors[i]*intensity;
+
+            if(intensity > 0.001f) {
+                const Vector3 reflection = 2.0f*Math::dot(normalizedLightDirection, normal)*normal - normalizedLightDirection;
+                const Float specularity = Math::clamp(Math::pow(Math::max(0.0f, Math::dot(cameraDirection, reflection)), shininess), 0.0f, 1.0f)*attenuation;
+                out += Color4{specularColor.rgb()*lightSpecularColors[i]*specularity, specularColor.a()};
+            }
+        }
+
+        out.a() += diffuseColor.a();
+        return out;
+    }
+
+    Color4 ambientColor, diffuseColor, specularColor;
+    Float shininess;
+    Containers::ArrayView<const Vector4> lightPositions;
+    Containers::ArrayView<const Color3> lightColors, lightSpecularColors;
+    Containers::ArrayView<const Float> lightRanges;
+};
+
+/* Edge function of the a -> b edge, positive for points on its left side,
+   which is the inside for counterclockwise triangles. Evaluated at pixel
+   (x, y) it's x*dx + y*dy + offset. */
+struct Edge {
+    explicit Edge(const Vector2& a, const Vector2& b): dx{a.y() - b.y()}, dy{b.x() - a.x()}, offset{a.x()*b.y() - a.y()*b.x()},
+        /* Top-left fill rule, for a counterclockwise triangle in a Y-up
+           coordinate system a left edge goes down and a top edge goes left */
+        topLeft{b.y() < a.y() || (b.y() == a.y() && b.x() < a.x())} {}
+
+    Float dx, dy, offset;
+    bool topLeft;
+};
+
+/* Whether the four edge function values are inside the triangle, taking
+   the fill rule into account */
+inline BitVector4 inside(const Edge& edge, const Vector4& value) {
+    return edge.topLeft ? value >= Vector4{0.0f} : value > Vector4{0.0f};
+}
+
+template<class Shader> void rasterize(const Triangle& triangle, const Range2Di& tile, const Containers::StridedArrayView2D<Color4ub>& color, const Containers::StridedArrayView2D<Float>& depth, const Shader& shader) {
+    const Range2Di bounds = Math::intersect(triangle.bounds, tile);
+    if(bounds.sizeX() <= 0 || bounds.sizeY() <= 0) return;
+
+    /* Edge opposite to given vertex, i.e. the barycentric coordinate of
+       given vertex */
+    const Edge edges[3]{
+        Edge{triangle.window[1].xy(), triangle.window[2].xy()},
+        Edge{triangle.window[2].xy(), triangle.window[0].xy()},
+        Edge{triangle.window[0].xy(), triangle.window[1].xy()}
+    };
+    const Float inverseArea = 1.0f/(edges[0].dx*triangle.window[0].x() + edges[0].dy*triangle.window[0].y() + edges[0].offset);
+
+    /* Four horizontally adjacent pixels are processed at once. The edge
+       functions are evaluated directly for each pixel instead of being
+       accumulated incrementally, so the result doesn't depend on where the
+       tile starts. */
+    const Vector4 lane{0.5f, 1.5f, 2.5f, 3.5f};
+    for(Int y = bounds.min().y(); y != bounds.max().y(); ++y) {
+        const Containers::StridedArrayView1D<Color4ub> colorRow = color[y];
+        const Containers::StridedArrayView1D<Float> depthRow = depth[y];
+
+        Vector4 rowValue[3];
+        for(std::size_t j = 0; j != 3; ++j)
+            rowValue[j] = Vector4{edges[j].dy*(Float(y) + 0.5f) + edges[j].offset};
+
+        for(Int x = bounds.min().x(); x < bounds.max().x(); x += 4) {
+            const Vector4 pixelX = Vector4{Float(x)} + lane;
+            const Vector4 value[3]{
+                pixelX*edges[0].dx + rowValue[0],
+                pixelX*edges[1].dx + rowValue[1],
+                pixelX*edges[2].dx + rowValue[2]
+            };
+            const BitVector4 mask =
+                inside(edges[0], value[0]) &
+                inside(edges[1], value[1]) &
+                inside(edges[2], value[2]);
+
+            if(mask.any()) for(Int i = 0; i != 4 && x + i < bounds.max().x(); ++i) {
+                if(!mask[i]) continue;
+
+                const Vector3 barycentric = Vector3{value[0][i], value[1][i], value[2][i]}*inverseArea;
+
+                /* Window-space depth is linear in screen space. Fragments
+                   beyond the near and far plane are discarded, which is
+                   equivalent to clipping. */
+                const Float z = Math::dot(barycentric, Vector3{
+                    triangle.window[0].z(),
+                    triangle.window[1].z(),
+                    triangle.window[2].z()});
+                Float& pixelDepth = depthRow[x + i];
+                if(z < 0.0f || z > 1.0f || !(z < pixelDepth)) continue;
+
+                /* The rest is perspective-correct */
+                const Vector3 perspective = barycentric*Vector3::from(triangle.inverseW);
+                pixelDepth = z;
+                colorRow[x + i] = Math::pack<Color4ub>(Math::clamp(shader(triangle, perspective/perspective.sum()), 0.0f, 1.0f));
+            }
+        }
+    }
+}
+
+template<class Shader> void rasterizeTiles(const Containers::ArrayView<const Triangle> triangles, const Vector2i& size, const Vector2i& tileSize, const Containers::StridedArrayView2D<Color4ub>& color, const Containers::StridedArrayView2D<Float>& depth, const Shader& shader) {
+    const Vector2i tileCount = (size + tileSize - Vector2i{1})/tileSize;
+
+    /* Binning pass, each tile gets a list of triangles overlapping it, in
+       submission order */
+    Containers::Array<Containers::Array<UnsignedInt>> bins{std::size_t(tileCount.product())};
+    for(std::size_t i = 0; i != triangles.size(); ++i) {
+        const Range2Di& bounds = triangles[i].bounds;
+        const Vector2i min = bounds.min()/tileSize;
+        const Vector2i max = (bounds.max() - Vector2i{1})/tileSize;
+        for(Int y = min.y(); y <= max.y(); ++y)
+            for(Int x = min.x(); x <= max.x(); ++x)
+                arrayAppend(bins[y*tileCount.x() + x], UnsignedInt(i));
+    }
+
+    /* Each tile is a separate job, writing only to its own pixels */
+    ThreadPool::global().parallelFor(bins.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const Vector2i tileMin = Vector2i{Int(i % tileCount.x()), Int(i / tileCount.x())}*tileSize;
+            const Range2Di tile{tileMin, Math::min(tileMin + tileSize, size)};
+            for(const UnsignedInt triangle: bins[i])
+                rasterize(triangles[triangle], tile, color, depth, shader);
+        }
+    });
+}
+
+}
+
+Rasterizer::Rasterizer(const Vector2i& size): _size{size}, _color{ValueInit, std::size_t(size.product())}, _depth{DirectInit, std::size_t(size.product()), 1.0f}, _lightPositions{InPlaceInit, {{0.0f, 0.0f, 1.0f, 0.0f}}}, _lightColors{InPlaceInit, {Color3{1.0f}}}, _lightSpecularColors{InPlaceInit, {Color3{1.0f}}}, _lightRanges{InPlaceInit, {Constants::inf()}} {}
+
+Rasterizer::Rasterizer(Rasterizer&&) noexcept = default;
+
+Rasterizer::~Rasterizer() = default;
+
+Rasterizer& Rasterizer::operator=(Rasterizer&&) noexcept = default;
+
+Rasterizer& Rasterizer::setTileSize(const Vector2i& size) {
+    CORRADE_ASSERT((size > Vector2i{0}).all(),
+        "DebugTools::Rasterizer::setTileSize(): expected a positive size, got" << Debug::packed << size, *this);
+    _tileSize = size;
+    return *this;
+}
+
+Rasterizer& Rasterizer::setTransformationMatrix(const Matrix4& matrix) {
+    _transformationMatrix = matrix;
+    return *this;
+}
+
+Rasterizer& Rasterizer::setProjectionMatrix(const Matrix4& matrix) {
+    _projectionMatrix = matrix;
+    return *this;
+}
+
+Rasterizer& Rasterizer::setLightPositions(const Containers::ArrayView<const Vector4> positions) {
+    _lightPositions = Containers::Array<Vector4>{NoInit, positions.size()};
+    Utility::copy(positions, _lightPositions);
+    _lightColors = Containers::Array<Color3>{DirectInit, positions.size(), Color3{1.0f}};
+    _lightSpecularColors = Containers::Array<Color3>{DirectInit, positions.size(), Color3{1.0f}};
+    _lightRanges = Containers::Array<Float>{DirectInit, positions.size(), Constants::inf()};
+    return *this;
+}
+
+Rasterizer& Rasterizer::setLightPositions(const std::initializer_list<Vector4> positions) {
+    return setLightPositions(Containers::arrayView(positions));
+}
+
+Rasterizer& Rasterizer::setLightColors(const Containers::ArrayView<const Color3> colors) {
+    CORRADE_ASSERT(colors.size() == _lightColors.size(),
+        "DebugTools::Rasterizer::setLightColors(): expected" << _lightColors.size() << "items but got" << colors.size(), *this);
+    Utility::copy(colors, _lightColors);
+    return *this;
+}
+
+Rasterizer& Rasterizer::setLightColors(const std::initializer_list<Color3> colors) {
+    return setLightColors(Containers::arrayView(colors));
+}
+
+Rasterizer& Rasterizer::setLightSpecularColors(const Containers::ArrayView<const Color3> colors) {
+    CORRADE_ASSERT(colors.size() == _lightSpecularColors.size(),
+        "DebugTools::Rasterizer::setLightSpecularColors(): expected" << _lightSpecularColors.size() << "items but got" << colors.size(), *this);
+    Utility::copy(colors, _lightSpecularColors);
+    return *this;
+}
+
+Rasterizer& Rasterizer::setLightSpecularColors(const std::initializer_list<Color3> colors) {
+    return setLightSpecularColors(Containers::arrayView(colors));
+}
+
+Rasterizer& Rasterizer::setLightRanges(const Containers::ArrayView<const Float> ranges) {
+    CORRADE_ASSERT(ranges.size() == _lightRanges.size(),
+        "DebugTools::Rasterizer::setLightRanges(): expected" << _lightRanges.size() << "items but got" << ranges.size(), *this);
+    Utility::copy(ranges, _lightRanges);
+    return *this;
+}
+
+Rasterizer& Rasterizer::setLightRanges(const std::initializer_list<Float> ranges) {
+    return setLightRanges(Containers::arrayView(ranges));
+}
+
+Rasterizer& Rasterizer::clear(const Color4& color) {
+    const Color4ub packed = Math::pack<Color4ub>(Math::clamp(color, 0.0f, 1.0f));
+    for(Color4ub& i: _color) i = packed;
+    for(Float& i: _depth) i = 1.0f;
+    return *this;
+}
+
+Rasterizer& Rasterizer::draw(const Trade::MeshData& mesh, const Trade::MaterialData& material, const Shading shading) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "DebugTools::Rasterizer::draw(): expected a triangle mesh, got" << mesh.primitive(), *this);
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "DebugTools::Rasterizer::draw(): the mesh has no positions", *this);
+    CORRADE_ASSERT(shading != Shading::VertexColor || mesh.hasAttribute(Trade::MeshAttribute::Color),
+        "DebugTools::Rasterizer::draw():" << shading << "requires the mesh to have vertex colors", *this);
+    CORRADE_ASSERT(shading != Shading::Phong || mesh.hasAttribute(Trade::MeshAttribute::Normal),
+        "DebugTools::Rasterizer::draw():" << shading << "requires the mesh to have normals", *this);
+
+    /* Vertex stage */
+    const Matrix4 transformationProjectionMatrix = _projectionMatrix*_transformationMatrix;
+    const Matrix3x3 normalMatrix = _transformationMatrix.normalMatrix();
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    Containers::Array<Vertex> vertices{ValueInit, positions.size()};
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        vertices[i].position = transformationProjectionMatrix*Vector4{positions[i], 1.0f};
+        vertices[i].cameraPosition = _transformationMatrix.transformPoint(positions[i]);
+    }
+    if(shading == Shading::VertexColor) {
+        const Containers::Array<Color4> colors = mesh.colorsAsArray();
+        for(std::size_t i = 0; i != colors.size(); ++i)
+            vertices[i].color = colors[i];
+    } else if(shading == Shading::Phong) {
+        const Containers::Array<Vector3> normals = mesh.normalsAsArray();
+        for(std::size_t i = 0; i != normals.size(); ++i)
+            vertices[i].normal = normalMatrix*normals[i];
+    }
+
+    /* Primitive assembly, clipping and viewport transform */
+    Containers::Array<UnsignedInt> indices;
+    if(mesh.isIndexed()) indices = mesh.indicesAsArray();
+    else {
+        indices = Containers::Array<UnsignedInt>{NoInit, mesh.vertexCount()};
+        for(UnsignedInt i = 0; i != indices.size(); ++i) indices[i] = i;
+    }
+    Containers::Array<Triangle> triangles;
+    arrayReserve(triangles, indices.size()/3);
+    for(std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const Vertex triangle[]{
+            vertices[indices[i + 0]],
+            vertices[indices[i + 1]],
+            vertices[indices[i + 2]]
+        };
+        clipAndAppend(triangles, triangle, _size);
+    }
+
+    /* Binning and per-tile rasterization with the fragment stage */
+    const Containers::StridedArrayView2D<Color4ub> color{_color, {std::size_t(_size.y()), std::size_t(_size.x())}};
+    const Containers::StridedArrayView2D<Float> depth{_depth, {std::size_t(_size.y()), std::size_t(_size.x())}};
+    switch(shading) {
+        case Shading::Flat:
+            rasterizeTiles(triangles, _size, _tileSize, color, depth, FlatShader{material.as<Trade::FlatMaterialData>().color()});
+            break;
+        case Shading::VertexColor:
+            rasterizeTiles(triangles, _size, _tileSize, color, depth, VertexColorShader{});
+            break;
+        case Shading::Phong: {
+            const auto& phong = material.as<Trade::PhongMaterialData>();
+            rasterizeTiles(triangles, _size, _tileSize, color, depth, PhongShader{
+                phong.ambientColor(),
+                phong.diffuseColor(),
+                phong.specularColor(),
+                phong.shininess(),
+                _lightPositions, _lightColors, _lightSpecularColors, _lightRanges});
+        } break;
+    }
+
+    return *this;
+}
+
+ImageView2D Rasterizer::color() const {
+    return ImageView2D{PixelFormat::RGBA8Unorm, _size, Containers::arrayCast<const char>(_color)};
+}
+
+Containers::StridedArrayView2D<const Float> Rasterizer::depth() const {
+    return {_depth, {std::size_t(_size.y()), std::size_t(_size.x())}};
+}
+
+Image2D Rasterizer::image() const {
+    Containers::Array<char> data{NoInit, _color.size()*sizeof(Color4ub)};
+    Utility::copy(Containers::arrayCast<const char>(_color), data);
+    return Image2D{PixelFormat::RGBA8Unorm, _size, Utility::move(data)};
+}
+
+Debug& operator<<(Debug& debug, const Rasterizer::Shading value) {
+    const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
+
+    if(!packed)
+        debug << "DebugTools::Rasterizer::Shading" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case Rasterizer::Shading::value: return debug << (packed ? "" : "::") << Debug::nospace << #value;
+        _c(Flat)
+        _c(VertexColor)
+        _c(Phong)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << (packed ? "" : ")");
+}
+
+}}
@@ -0,0 +1,314 @@
+#ifndef Magnum_DebugTools_Rasterizer_h
+#define Magnum_DebugTools_Rasterizer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::Rasterizer
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Software rasterizer
+@m_since_latest
+
+Renders @ref Trade::MeshData with shading equivalent to
+@ref Shaders::FlatGL, @ref Shaders::VertexColorGL and @ref Shaders::PhongGL
+on the CPU, without needing a GPU or an OpenGL context. Meant for generating
+thumbnails and reference images in environments where no GPU is available,
+such as CI machines or server render farms. The output is an RGBA8
+@ref Image2D with an associated depth buffer:
+
+@snippet DebugTools.cpp Rasterizer-usage
+
+@section DebugTools-Rasterizer-semantics Rendering semantics
+
+The rasterizer follows default OpenGL state --- vertex positions are
+transformed by @ref projectionMatrix() and @ref transformationMatrix() into
+clip space with the @f$ [-w, w] @f$ depth range, triangles are clipped against
+the near plane, depth test passes if the fragment is closer than what's in
+the depth buffer, and no face culling or blending is done. Pixel centers are
+at half-integer coordinates and a top-left fill rule is used, so triangles
+sharing an edge don't leave gaps or overdraw pixels. All vertex attributes
+are interpolated in a perspective-correct way. Only
+@ref MeshPrimitive::Triangles is supported.
+
+The shading is picked with the @ref Shading parameter to @ref draw(), taking
+material colors from @ref Trade::FlatMaterialData or
+@ref Trade::PhongMaterialData. Textures, alpha masking, vertex color
+multiplication in the flat and Phong shading and instancing aren't
+implemented.
+
+@section DebugTools-Rasterizer-threading Tiling and multithreading
+
+The framebuffer is split into tiles of @ref tileSize(). In each
+@ref draw() call, triangles are first binned to tiles they overlap and then
+each tile is rasterized as a separate job on @ref ThreadPool::global(), in
+the order the triangles were submitted. As every tile is owned by exactly one
+job, the output is the same regardless of how many threads are used. Coverage
+of each triangle is evaluated with edge functions for four
+horizontally adjacent pixels at a time.
+
+This class is available only if Magnum is compiled with
+@ref MAGNUM_WITH_TRADE enabled (done by default). See @ref building-features
+for more information.
+@experimental
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT Rasterizer {
+    public:
+        /**
+         * @brief Shading
+         *
+         * @see @ref draw()
+         */
+        enum class Shading: UnsignedByte {
+            /**
+             * Equivalent to @ref Shaders::FlatGL. Uses
+             * @ref Trade::FlatMaterialData::color() for all fragments.
+             */
+            Flat,
+
+            /**
+             * Equivalent to @ref Shaders::VertexColorGL. Uses interpolated
+             * @ref Trade::MeshAttribute::Color, the material is ignored.
+             * Expects that the mesh has vertex colors.
+             */
+            VertexColor,
+
+            /**
+             * Equivalent to @ref Shaders::PhongGL. Uses
+             * @ref Trade::PhongMaterialData::ambientColor(),
+             * @relativeref{Trade::PhongMaterialData,diffuseColor()},
+             * @relativeref{Trade::PhongMaterialData,specularColor()} and
+             * @relativeref{Trade::PhongMaterialData,shininess()} together
+             * with lights set by @ref setLightPositions() and related APIs.
+             * Expects that the mesh has normals.
+             */
+            Phong
+        };
+
+        /**
+         * @brief Constructor
+         * @param size      Framebuffer size
+         *
+         * The color buffer is initialized to @cpp 0x00000000_rgba @ce and
+         * depth buffer to @cpp 1.0f @ce. Tile size is set to
+         * @cpp {64, 64} @ce, the transformation and projection matrices to
+         * identity. There's a single white directional light at
+         * @cpp {0.0f, 0.0f, 1.0f, 0.0f} @ce, same as default in
+         * @ref Shaders::PhongGL.
+         */
+        explicit Rasterizer(const Vector2i& size);
+
+        /** @brief Copying is not allowed */
+        Rasterizer(const Rasterizer&) = delete;
+
+        /** @brief Move constructor */
+        Rasterizer(Rasterizer&&) noexcept;
+
+        ~Rasterizer();
+
+        /** @brief Copying is not allowed */
+        Rasterizer& operator=(const Rasterizer&) = delete;
+
+        /** @brief Move assignment */
+        Rasterizer& operator=(Rasterizer&&) noexcept;
+
+        /** @brief Framebuffer size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Tile size */
+        Vector2i tileSize() const { return _tileSize; }
+
+        /**
+         * @brief Set tile size
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that both dimensions are positive. Smaller tiles result in
+         * a better distribution of work across threads at the cost of
+         * larger binning overhead. Doesn't affect the rendered output.
+         */
+        Rasterizer& setTileSize(const Vector2i& size);
+
+        /** @brief Transformation matrix */
+        Matrix4 transformationMatrix() const { return _transformationMatrix; }
+
+        /**
+         * @brief Set transformation matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @ref Shaders::PhongGL::setTransformationMatrix(). The
+         * normal matrix is calculated from it. Initial value is an identity
+         * matrix.
+         */
+        Rasterizer& setTransformationMatrix(const Matrix4& matrix);
+
+        /** @brief Projection matrix */
+        Matrix4 projectionMatrix() const { return _projectionMatrix; }
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @ref Shaders::PhongGL::setProjectionMatrix(). Initial
+         * value is an identity matrix.
+         */
+        Rasterizer& setProjectionMatrix(const Matrix4& matrix);
+
+        /** @brief Light count */
+        UnsignedInt lightCount() const { return _lightPositions.size(); }
+
+        /**
+         * @brief Set light positions
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @ref Shaders::PhongGL::setLightPositions(), with
+         * positions in camera space and the fourth component being
+         * @cpp 0.0f @ce for directional lights and @cpp 1.0f @ce for point
+         * lights. Changes @ref lightCount() to the size of @p positions and
+         * resets all light colors and specular colors to
+         * @cpp 0xffffff_rgbf @ce and ranges to
+         * @ref Constants::inf(). Used only by @ref Shading::Phong.
+         */
+        Rasterizer& setLightPositions(Containers::ArrayView<const Vector4> positions);
+
+        /** @overload */
+        Rasterizer& setLightPositions(std::initializer_list<Vector4> positions);
+
+        /**
+         * @brief Set light colors
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @ref Shaders::PhongGL::setLightColors(). Expects
+         * that the size of @p colors matches @ref lightCount().
+         */
+        Rasterizer& setLightColors(Containers::ArrayView<const Color3> colors);
+
+        /** @overload */
+        Rasterizer& setLightColors(std::initializer_list<Color3> colors);
+
+        /**
+         * @brief Set light specular colors
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @ref Shaders::PhongGL::setLightSpecularColors().
+         * Expects that the size of @p colors matches @ref lightCount().
+         */
+        Rasterizer& setLightSpecularColors(Containers::ArrayView<const Color3> colors);
+
+        /** @overload */
+        Rasterizer& setLightSpecularColors(std::initializer_list<Color3> colors);
+
+        /**
+         * @brief Set light attenuation ranges
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @ref Shaders::PhongGL::setLightRanges(). Expects
+         * that the size of @p ranges matches @ref lightCount().
+         */
+        Rasterizer& setLightRanges(Containers::ArrayView<const Float> ranges);
+
+        /** @overload */
+        Rasterizer& setLightRanges(std::initializer_list<Float> ranges);
+
+        /**
+         * @brief Clear the framebuffer
+         * @return Reference to self (for method chaining)
+         *
+         * Sets all pixels of the color buffer to @p color and the depth
+         * buffer to @cpp 1.0f @ce.
+         */
+        Rasterizer& clear(const Color4& color = {});
+
+        /**
+         * @brief Draw a mesh
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p mesh is a @ref MeshPrimitive::Triangles mesh with
+         * a @ref Trade::MeshAttribute::Position attribute, and additionally
+         * with @ref Trade::MeshAttribute::Color for
+         * @ref Shading::VertexColor and with
+         * @ref Trade::MeshAttribute::Normal for @ref Shading::Phong. See
+         * @ref DebugTools-Rasterizer-semantics and
+         * @ref DebugTools-Rasterizer-threading for more information.
+         */
+        Rasterizer& draw(const Trade::MeshData& mesh, const Trade::MaterialData& material, Shading shading);
+
+        /**
+         * @brief Color buffer
+         *
+         * An @ref PixelFormat::RGBA8Unorm view on the color buffer, with the
+         * first row being the bottom one, same as in an OpenGL framebuffer.
+         * @see @ref image()
+         */
+        ImageView2D color() const;
+
+        /**
+         * @brief Depth buffer
+         *
+         * Window-space depth values in range @f$ [0, 1] @f$, size is
+         * @ref size() with the first dimension being Y. The first row is the
+         * bottom one.
+         */
+        Containers::StridedArrayView2D<const Float> depth() const;
+
+        /**
+         * @brief Copy of the color buffer
+         *
+         * Equivalent to copying the contents of @ref color() to a new
+         * @ref Image2D.
+         */
+        Image2D image() const;
+
+    private:
+        Vector2i _size, _tileSize{64};
+        Containers::Array<Color4ub> _color;
+        Containers::Array<Float> _depth;
+        Matrix4 _transformationMatrix, _projectionMatrix;
+        Containers::Array<Vector4> _lightPositions;
+        Containers::Array<Color3> _lightColors, _lightSpecularColors;
+        Containers::Array<Float> _lightRanges;
+};
+
+/**
+@debugoperatorclassenum{Rasterizer,Rasterizer::Shading}
+@m_since_latest
+*/
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, Rasterizer::Shading value);
+
+}}
+
+#endif
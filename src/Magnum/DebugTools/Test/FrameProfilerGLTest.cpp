@@ -23,7 +23,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/System.h>
 
 #include "Magnum/DebugTools/FrameProfiler.h"
@@ -49,6 +52,8 @@ struct FrameProfilerGLTest: GL::OpenGLTester {
     explicit FrameProfilerGLTest();
 
     void test();
+    void scopes();
+    void scopesInvalid();
     #ifndef MAGNUM_TARGET_GLES
     void vertexFetchRatioDivisionByZero();
     void primitiveClipRatioDivisionByZero();
@@ -75,6 +80,9 @@ FrameProfilerGLTest::FrameProfilerGLTest() {
     addInstancedTests({&FrameProfilerGLTest::test},
         Containers::arraySize(Data));
 
+    addTests({&FrameProfilerGLTest::scopes,
+              &FrameProfilerGLTest::scopesInvalid});
+
     #ifndef MAGNUM_TARGET_GLES
     addTests({&FrameProfilerGLTest::vertexFetchRatioDivisionByZero,
               &FrameProfilerGLTest::primitiveClipRatioDivisionByZero,
@@ -197,6 +205,102 @@ void FrameProfilerGLTest::test() {
     #endif
 }
 
+void FrameProfilerGLTest::scopes() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::timer_query>())
+        CORRADE_SKIP(GL::Extensions::ARB::timer_query::string() << "is not supported.");
+    #elif defined(MAGNUM_TARGET_WEBGL) && !defined(MAGNUM_TARGET_GLES2)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query_webgl2>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query_webgl2::string() << "is not supported.");
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query::string() << "is not supported.");
+    #endif
+
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    GL::Renderbuffer color;
+    color.setStorage(
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        GL::RenderbufferFormat::RGBA8,
+        #else
+        GL::RenderbufferFormat::RGBA4,
+        #endif
+        Vector2i{32});
+    GL::Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    GL::Mesh mesh = MeshTools::compile(Primitives::cubeSolid());
+    Shaders::FlatGL3D shader;
+
+    FrameProfilerGL profiler{FrameProfilerGL::Value::CpuDuration, {"Outer", "  Inner", "Unused"}, 4};
+    CORRADE_COMPARE(profiler.measurementCount(), 4);
+    CORRADE_COMPARE(profiler.scopeCount(), 3);
+    CORRADE_COMPARE(profiler.scopeMeasurementId(0), 1);
+    CORRADE_COMPARE(profiler.scopeMeasurementId(2), 3);
+    CORRADE_COMPARE(profiler.measurementName(profiler.scopeMeasurementId(1)), "  Inner");
+    CORRADE_COMPARE(profiler.measurementUnits(profiler.scopeMeasurementId(1)), FrameProfiler::Units::Nanoseconds);
+    CORRADE_COMPARE(profiler.measurementDelay(profiler.scopeMeasurementId(1)), 3);
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        profiler.beginFrame();
+        profiler.beginScope(0);
+        CORRADE_COMPARE(profiler.scopeDepth(), 1);
+        shader.draw(mesh);
+        profiler.beginScope(1);
+        CORRADE_COMPARE(profiler.scopeDepth(), 2);
+        shader.draw(mesh);
+        profiler.endScope();
+        profiler.endScope();
+        CORRADE_COMPARE(profiler.scopeDepth(), 0);
+        profiler.endFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Can't test upper bounds, the timing is too unpredictable on CIs. The
+       outer scope contains the inner one, so it should take at least as
+       long, the unused scope should report a zero. */
+    CORRADE_VERIFY(profiler.isMeasurementAvailable(profiler.scopeMeasurementId(0)));
+    CORRADE_VERIFY(profiler.isMeasurementAvailable(profiler.scopeMeasurementId(1)));
+    CORRADE_COMPARE_AS(profiler.scopeDurationMean(1), 0.0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(profiler.scopeDurationMean(0), profiler.scopeDurationMean(1),
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(profiler.scopeDurationMean(2), 0.0);
+}
+
+void FrameProfilerGLTest::scopesInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::timer_query>())
+        CORRADE_SKIP(GL::Extensions::ARB::timer_query::string() << "is not supported.");
+    #elif defined(MAGNUM_TARGET_WEBGL) && !defined(MAGNUM_TARGET_GLES2)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query_webgl2>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query_webgl2::string() << "is not supported.");
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query::string() << "is not supported.");
+    #endif
+
+    FrameProfilerGL profiler{{}, {"A", "B"}, 4};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    profiler.beginScope(1);
+    profiler.beginFrame();
+    profiler.beginScope(1);
+    profiler.endScope();
+    profiler.beginScope(1);
+    profiler.beginScope(0);
+    profiler.endFrame();
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::FrameProfilerGL::beginScope(): expected begin of frame\n"
+        "DebugTools::FrameProfilerGL::beginScope(): scope 1 already measured in this frame\n"
+        "DebugTools::FrameProfilerGL::endFrame(): scope 0 not ended\n");
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void FrameProfilerGLTest::vertexFetchRatioDivisionByZero() {
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::pipeline_statistics_query>())
@@ -64,6 +64,7 @@ struct FrameProfilerTest: TestSuite::Tester {
     #ifdef MAGNUM_TARGET_GL
     void gl();
     void glNotEnabled();
+    void glScopeInvalid();
     #endif
 
     void debugUnits();
@@ -143,6 +144,7 @@ FrameProfilerTest::FrameProfilerTest() {
     addTests({
               #ifdef MAGNUM_TARGET_GL
               &FrameProfilerTest::glNotEnabled,
+              &FrameProfilerTest::glScopeInvalid,
               #endif
 
               &FrameProfilerTest::debugUnits,
@@ -1171,6 +1173,29 @@ void FrameProfilerTest::glNotEnabled() {
         "DebugTools::FrameProfilerGL::cpuDurationMean(): not enabled\n"
         "DebugTools::FrameProfilerGL::gpuDurationMean(): not enabled\n");
 }
+
+void FrameProfilerTest::glScopeInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* No scopes, so this can work without a GL context */
+    FrameProfilerGL profiler{FrameProfilerGL::Value::CpuDuration, 5};
+    CORRADE_COMPARE(profiler.scopeCount(), 0);
+    CORRADE_COMPARE(profiler.scopeDepth(), 0);
+
+    profiler.beginFrame();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    profiler.scopeMeasurementId(0);
+    profiler.beginScope(0);
+    profiler.endScope();
+    profiler.scopeDurationMean(0);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::FrameProfilerGL::scopeMeasurementId(): index 0 out of range for 0 scopes\n"
+        "DebugTools::FrameProfilerGL::beginScope(): index 0 out of range for 0 scopes\n"
+        "DebugTools::FrameProfilerGL::endScope(): no scope open\n"
+        "DebugTools::FrameProfilerGL::scopeDurationMean(): index 0 out of range for 0 scopes\n");
+}
 #endif
 
 void FrameProfilerTest::debugUnits() {
@@ -0,0 +1,180 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/DebugTools/FrameProfilerTrade.h"
+#include "Magnum/Trade/PluginStatistics.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+struct FrameProfilerTradeTest: TestSuite::Tester {
+    explicit FrameProfilerTradeTest();
+
+    void test();
+    void statisticsResetInFrame();
+    void notEnabled();
+
+    void debugValue();
+    void debugValues();
+};
+
+using namespace Math::Literals;
+
+struct {
+    const char* name;
+    FrameProfilerTrade::Values values;
+    UnsignedInt measurementCount;
+} Data[]{
+    {"empty", {}, 0},
+    {"import duration", FrameProfilerTrade::Value::ImportDuration, 1},
+    {"import duration + output size", FrameProfilerTrade::Value::ImportDuration|FrameProfilerTrade::Value::ImportOutputSize, 2},
+    {"conversion output size", FrameProfilerTrade::Value::ConversionOutputSize, 1},
+    {"everything", FrameProfilerTrade::Value::ImportDuration|FrameProfilerTrade::Value::ImportOutputSize|FrameProfilerTrade::Value::ConversionDuration|FrameProfilerTrade::Value::ConversionOutputSize, 4}
+};
+
+FrameProfilerTradeTest::FrameProfilerTradeTest() {
+    addInstancedTests({&FrameProfilerTradeTest::test},
+        Containers::arraySize(Data));
+
+    addTests({&FrameProfilerTradeTest::statisticsResetInFrame,
+              &FrameProfilerTradeTest::notEnabled,
+
+              &FrameProfilerTradeTest::debugValue,
+              &FrameProfilerTradeTest::debugValues});
+}
+
+void FrameProfilerTradeTest::test() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::PluginStatistics statistics;
+
+    /* Test that we use the right state pointers to survive a move */
+    Containers::Pointer<FrameProfilerTrade> profiler_{InPlaceInit, statistics, data.values, 2u};
+    FrameProfilerTrade profiler = Utility::move(*profiler_);
+    profiler_ = nullptr;
+    CORRADE_COMPARE(profiler.values(), data.values);
+    CORRADE_COMPARE(profiler.maxFrameCount(), 2);
+    CORRADE_COMPARE(profiler.measurementCount(), data.measurementCount);
+
+    /* Values recorded before the first frame shouldn't be counted */
+    statistics[Trade::PluginOperation::OpenData].duration += 1000_nsec;
+    statistics[Trade::PluginOperation::OpenData].inputSize += 100;
+
+    /* First frame imports a mesh and an image, converts an image */
+    profiler.beginFrame();
+    statistics[Trade::PluginOperation::Mesh].duration += 30_nsec;
+    statistics[Trade::PluginOperation::Mesh].outputSize += 300;
+    statistics[Trade::PluginOperation::Image2D].duration += 10_nsec;
+    statistics[Trade::PluginOperation::Image2D].outputSize += 100;
+    statistics[Trade::PluginOperation::ConvertToData].duration += 50_nsec;
+    statistics[Trade::PluginOperation::ConvertToData].outputSize += 40;
+    profiler.endFrame();
+
+    /* Nothing recorded outside of a frame either */
+    statistics[Trade::PluginOperation::Add].duration += 1000_nsec;
+
+    /* Second frame only opens a file and adds a mesh to a converter */
+    profiler.beginFrame();
+    statistics[Trade::PluginOperation::OpenFile].duration += 20_nsec;
+    statistics[Trade::PluginOperation::Add].duration += 10_nsec;
+    profiler.endFrame();
+
+    if(data.values & FrameProfilerTrade::Value::ImportDuration) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerTrade::Value::ImportDuration));
+        CORRADE_COMPARE(profiler.importDurationMean(), 30.0);
+    }
+    if(data.values & FrameProfilerTrade::Value::ImportOutputSize) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerTrade::Value::ImportOutputSize));
+        CORRADE_COMPARE(profiler.importOutputSizeMean(), 200.0);
+    }
+    if(data.values & FrameProfilerTrade::Value::ConversionDuration) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerTrade::Value::ConversionDuration));
+        CORRADE_COMPARE(profiler.conversionDurationMean(), 30.0);
+    }
+    if(data.values & FrameProfilerTrade::Value::ConversionOutputSize) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerTrade::Value::ConversionOutputSize));
+        CORRADE_COMPARE(profiler.conversionOutputSizeMean(), 20.0);
+    }
+}
+
+void FrameProfilerTradeTest::statisticsResetInFrame() {
+    Trade::PluginStatistics statistics;
+    statistics[Trade::PluginOperation::Image2D].outputSize += 1000;
+
+    FrameProfilerTrade profiler{statistics, FrameProfilerTrade::Value::ImportOutputSize, 1};
+
+    /* If the statistics get reset in the middle of a frame, the value
+       recorded after the reset is taken instead of wrapping around */
+    profiler.beginFrame();
+    statistics.reset();
+    statistics[Trade::PluginOperation::Image2D].outputSize += 30;
+    profiler.endFrame();
+
+    CORRADE_COMPARE(profiler.measurementData(0, 0), 30);
+}
+
+void FrameProfilerTradeTest::notEnabled() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::PluginStatistics statistics;
+    FrameProfilerTrade profiler{statistics, {}, 5};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    profiler.isMeasurementAvailable(FrameProfilerTrade::Value::ImportOutputSize);
+    profiler.importDurationMean();
+    profiler.importOutputSizeMean();
+    profiler.conversionDurationMean();
+    profiler.conversionOutputSizeMean();
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::FrameProfilerTrade::isMeasurementAvailable(): DebugTools::FrameProfilerTrade::Value::ImportOutputSize not enabled\n"
+        "DebugTools::FrameProfilerTrade::importDurationMean(): not enabled\n"
+        "DebugTools::FrameProfilerTrade::importOutputSizeMean(): not enabled\n"
+        "DebugTools::FrameProfilerTrade::conversionDurationMean(): not enabled\n"
+        "DebugTools::FrameProfilerTrade::conversionOutputSizeMean(): not enabled\n");
+}
+
+void FrameProfilerTradeTest::debugValue() {
+    std::ostringstream out;
+
+    Debug{&out} << FrameProfilerTrade::Value::ConversionDuration << FrameProfilerTrade::Value(0xf0);
+    CORRADE_COMPARE(out.str(), "DebugTools::FrameProfilerTrade::Value::ConversionDuration DebugTools::FrameProfilerTrade::Value(0xf0)\n");
+}
+
+void FrameProfilerTradeTest::debugValues() {
+    std::ostringstream out;
+
+    Debug{&out} << (FrameProfilerTrade::Value::ImportOutputSize|FrameProfilerTrade::Value::ImportDuration) << FrameProfilerTrade::Values{};
+    CORRADE_COMPARE(out.str(), "DebugTools::FrameProfilerTrade::Value::ImportDuration|DebugTools::FrameProfilerTrade::Value::ImportOutputSize DebugTools::FrameProfilerTrade::Values{}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::FrameProfilerTradeTest)
@@ -0,0 +1,468 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <type_traits>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/DebugTools/Rasterizer.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+struct RasterizerTest: TestSuite::Tester {
+    explicit RasterizerTest();
+
+    void construct();
+    void constructMove();
+    void clear();
+
+    void flat();
+    void fillRule();
+    void depthTest();
+    void vertexColor();
+    void phong();
+    void clipNearPlane();
+    void tiles();
+
+    void setTileSizeZero();
+    void setLightsWrongCount();
+    void drawInvalid();
+
+    void debugShading();
+    void debugShadingPacked();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Vector2i tileSize;
+    UnsignedInt threadCount;
+} TilesData[]{
+    {"single tile", {64, 64}, 0},
+    {"single tile, 3 threads", {64, 64}, 3},
+    {"one pixel tiles", {1, 1}, 0},
+    {"4x3 tiles, 3 threads", {4, 3}, 3},
+    {"16x16 tiles, 3 threads", {16, 16}, 3},
+    {"wide tiles, 2 threads", {128, 2}, 2}
+};
+
+RasterizerTest::RasterizerTest() {
+    addTests({&RasterizerTest::construct,
+              &RasterizerTest::constructMove,
+              &RasterizerTest::clear,
+
+              &RasterizerTest::flat,
+              &RasterizerTest::fillRule,
+              &RasterizerTest::depthTest,
+              &RasterizerTest::vertexColor,
+              &RasterizerTest::phong,
+              &RasterizerTest::clipNearPlane});
+
+    addInstancedTests({&RasterizerTest::tiles},
+        Containers::arraySize(TilesData));
+
+    addTests({&RasterizerTest::setTileSizeZero,
+              &RasterizerTest::setLightsWrongCount,
+              &RasterizerTest::drawInvalid,
+
+              &RasterizerTest::debugShading,
+              &RasterizerTest::debugShadingPacked});
+}
+
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Color4 color;
+};
+
+/* A quad covering the whole viewport with an identity projection, facing
+   +Z. Left vertices red, right vertices blue. */
+const Vertex QuadVertices[]{
+    {{-1.0f, -1.0f, 0.0f}, Vector3::zAxis(), 0xff0000ff_rgbaf},
+    {{ 1.0f, -1.0f, 0.0f}, Vector3::zAxis(), 0x0000ffff_rgbaf},
+    {{ 1.0f,  1.0f, 0.0f}, Vector3::zAxis(), 0x0000ffff_rgbaf},
+    {{-1.0f,  1.0f, 0.0f}, Vector3::zAxis(), 0xff0000ff_rgbaf}
+};
+
+const UnsignedShort QuadIndices[]{
+    0, 1, 2,
+    0, 2, 3
+};
+
+Trade::MeshData mesh(Containers::ArrayView<const Vertex> vertices, Containers::ArrayView<const UnsignedShort> indices) {
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::color)}
+        }};
+}
+
+Trade::MeshData quad() {
+    return mesh(QuadVertices, QuadIndices);
+}
+
+Trade::MaterialData flatMaterial(const Color4& color) {
+    return Trade::MaterialData{Trade::MaterialType::Flat, {
+        {Trade::MaterialAttribute::BaseColor, color}
+    }};
+}
+
+std::size_t coveredPixelCount(const Rasterizer& rasterizer, Color4ub background) {
+    std::size_t count = 0;
+    for(const Containers::StridedArrayView1D<const Color4ub> row: rasterizer.color().pixels<Color4ub>())
+        for(const Color4ub& pixel: row)
+            if(pixel != background) ++count;
+    return count;
+}
+
+void RasterizerTest::construct() {
+    Rasterizer rasterizer{{8, 4}};
+    CORRADE_COMPARE(rasterizer.size(), (Vector2i{8, 4}));
+    CORRADE_COMPARE(rasterizer.tileSize(), (Vector2i{64}));
+    CORRADE_COMPARE(rasterizer.transformationMatrix(), Matrix4{});
+    CORRADE_COMPARE(rasterizer.projectionMatrix(), Matrix4{});
+    CORRADE_COMPARE(rasterizer.lightCount(), 1);
+
+    ImageView2D color = rasterizer.color();
+    CORRADE_COMPARE(color.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(color.size(), (Vector2i{8, 4}));
+    CORRADE_COMPARE(color.pixels<Color4ub>()[3][7], 0x00000000_rgba);
+    CORRADE_COMPARE(rasterizer.depth().size(), (Containers::Size2D{4, 8}));
+    CORRADE_COMPARE(rasterizer.depth()[3][7], 1.0f);
+}
+
+void RasterizerTest::constructMove() {
+    Rasterizer a{{8, 4}};
+    a.setTileSize({2, 3})
+     .clear(0x3366ccff_rgbaf);
+
+    Rasterizer b = Utility::move(a);
+    CORRADE_COMPARE(b.size(), (Vector2i{8, 4}));
+    CORRADE_COMPARE(b.tileSize(), (Vector2i{2, 3}));
+    CORRADE_COMPARE(b.color().pixels<Color4ub>()[2][5], 0x3366ccff_rgba);
+
+    Rasterizer c{{2, 2}};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), (Vector2i{8, 4}));
+    CORRADE_COMPARE(c.color().pixels<Color4ub>()[2][5], 0x3366ccff_rgba);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<Rasterizer>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<Rasterizer>::value);
+}
+
+void RasterizerTest::clear() {
+    Rasterizer rasterizer{{3, 2}};
+    rasterizer.draw(quad(), flatMaterial(0xffffffff_rgbaf), Rasterizer::Shading::Flat);
+    CORRADE_COMPARE(rasterizer.depth()[1][2], 0.5f);
+
+    /* Values outside of the range get clamped */
+    rasterizer.clear({0.2f, 0.4f, 0.8f, 1.5f});
+    CORRADE_COMPARE(rasterizer.depth()[1][2], 1.0f);
+
+    Image2D image = rasterizer.image();
+    CORRADE_COMPARE(image.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image.size(), (Vector2i{3, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(image.data()), Containers::arrayView<Color4ub>({
+        0x3366ccff_rgba, 0x3366ccff_rgba, 0x3366ccff_rgba,
+        0x3366ccff_rgba, 0x3366ccff_rgba, 0x3366ccff_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void RasterizerTest::flat() {
+    Rasterizer rasterizer{{5, 3}};
+    rasterizer.draw(quad(), flatMaterial(0x3366ccff_rgbaf), Rasterizer::Shading::Flat);
+    CORRADE_COMPARE(coveredPixelCount(rasterizer, 0x00000000_rgba), 15);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[0][0], 0x3366ccff_rgba);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[2][4], 0x3366ccff_rgba);
+
+    /* Material defaults to white */
+    rasterizer.clear()
+        .draw(quad(), Trade::MaterialData{Trade::MaterialType::Flat, {}}, Rasterizer::Shading::Flat);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][2], 0xffffffff_rgba);
+}
+
+void RasterizerTest::fillRule() {
+    /* The two triangles of the quad share a diagonal that goes exactly
+       through the centers of the diagonal pixels. With the top-left rule
+       these should be rasterized exactly once. */
+    Rasterizer rasterizer{{8, 8}};
+
+    rasterizer.draw(mesh(QuadVertices, Containers::arrayView(QuadIndices).prefix(3)), flatMaterial(0xff0000ff_rgbaf), Rasterizer::Shading::Flat);
+    const std::size_t first = coveredPixelCount(rasterizer, 0x00000000_rgba);
+
+    rasterizer.clear()
+        .draw(mesh(QuadVertices, Containers::arrayView(QuadIndices).exceptPrefix(3)), flatMaterial(0xff0000ff_rgbaf), Rasterizer::Shading::Flat);
+    const std::size_t second = coveredPixelCount(rasterizer, 0x00000000_rgba);
+
+    CORRADE_COMPARE(first + second, 64);
+    /* The diagonal is a left edge of the first triangle, thus included */
+    CORRADE_COMPARE(first, 36);
+    CORRADE_COMPARE(second, 28);
+}
+
+void RasterizerTest::depthTest() {
+    const Vertex vertices[]{
+        {{-1.0f, -1.0f, -0.5f}, {}, {}},
+        {{ 1.0f, -1.0f, -0.5f}, {}, {}},
+        {{ 1.0f,  1.0f, -0.5f}, {}, {}},
+        {{-1.0f,  1.0f, -0.5f}, {}, {}},
+        {{-1.0f, -1.0f,  0.5f}, {}, {}},
+        {{ 1.0f, -1.0f,  0.5f}, {}, {}},
+        {{ 1.0f,  1.0f,  0.5f}, {}, {}},
+        {{-1.0f,  1.0f,  0.5f}, {}, {}},
+    };
+    const UnsignedShort near[]{0, 1, 2, 0, 2, 3};
+    const UnsignedShort far[]{4, 5, 6, 4, 6, 7};
+
+    /* The near quad wins regardless of the draw order */
+    Rasterizer rasterizer{{4, 4}};
+    rasterizer
+        .draw(mesh(vertices, near), flatMaterial(0xff0000ff_rgbaf), Rasterizer::Shading::Flat)
+        .draw(mesh(vertices, far), flatMaterial(0x0000ffff_rgbaf), Rasterizer::Shading::Flat);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[2][1], 0xff0000ff_rgba);
+    CORRADE_COMPARE(rasterizer.depth()[2][1], 0.25f);
+
+    rasterizer.clear()
+        .draw(mesh(vertices, far), flatMaterial(0x0000ffff_rgbaf), Rasterizer::Shading::Flat)
+        .draw(mesh(vertices, near), flatMaterial(0xff0000ff_rgbaf), Rasterizer::Shading::Flat);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[2][1], 0xff0000ff_rgba);
+    CORRADE_COMPARE(rasterizer.depth()[2][1], 0.25f);
+}
+
+void RasterizerTest::vertexColor() {
+    Rasterizer rasterizer{{8, 2}};
+    rasterizer.draw(quad(), Trade::MaterialData{{}, {}}, Rasterizer::Shading::VertexColor);
+
+    /* Interpolated at pixel centers, 1/16 and 15/16 */
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[0][0], 0xef0010ff_rgba);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][0], 0xef0010ff_rgba);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[0][7], 0x1000efff_rgba);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][7], 0x1000efff_rgba);
+}
+
+void RasterizerTest::phong() {
+    const Trade::MaterialData material{Trade::MaterialType::Phong, {
+        {Trade::MaterialAttribute::AmbientColor, 0x111111ff_rgbaf},
+        {Trade::MaterialAttribute::DiffuseColor, 0x3366ccff_rgbaf}
+    }};
+
+    /* The default light is directional, pointing along the normal. The
+       camera looks along the surface, thus there's no specular highlight. */
+    Rasterizer rasterizer{{4, 4}};
+    rasterizer.draw(quad(), material, Rasterizer::Shading::Phong);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][2], 0x4477ddff_rgba);
+
+    /* Light color gets multiplied with the diffuse color */
+    rasterizer.setLightColors({0xff0000_rgbf})
+        .clear()
+        .draw(quad(), material, Rasterizer::Shading::Phong);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][2], 0x441111ff_rgba);
+
+    /* A point light with the range too short to reach the surface has only
+       the ambient color left */
+    rasterizer.setLightPositions({{0.0f, 0.0f, 1.0f, 1.0f}})
+        .setLightRanges({0.5f})
+        .clear()
+        .draw(quad(), material, Rasterizer::Shading::Phong);
+    CORRADE_COMPARE(rasterizer.lightCount(), 1);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][2], 0x111111ff_rgba);
+
+    /* Zero lights is ambient-only as well */
+    rasterizer.setLightPositions(Containers::ArrayView<const Vector4>{})
+        .clear()
+        .draw(quad(), material, Rasterizer::Shading::Phong);
+    CORRADE_COMPARE(rasterizer.lightCount(), 0);
+    CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[1][2], 0x111111ff_rgba);
+}
+
+void RasterizerTest::clipNearPlane() {
+    /* A floor below the camera, extending behind it. Without near plane
+       clipping the parts behind the camera would get projected upside
+       down. */
+    const Vertex vertices[]{
+        {{-10.0f, -0.5f,  10.0f}, {}, {}},
+        {{ 10.0f, -0.5f,  10.0f}, {}, {}},
+        {{ 10.0f, -0.5f, -10.0f}, {}, {}},
+        {{-10.0f, -0.5f, -10.0f}, {}, {}},
+        /* A triangle fully behind the camera */
+        {{-1.0f, -1.0f, 1.0f}, {}, {}},
+        {{ 1.0f, -1.0f, 1.0f}, {}, {}},
+        {{ 0.0f,  1.0f, 1.0f}, {}, {}},
+    };
+    const UnsignedShort floor[]{0, 1, 2, 0, 2, 3};
+    const UnsignedShort behind[]{4, 5, 6};
+
+    Rasterizer rasterizer{{8, 8}};
+    rasterizer.setProjectionMatrix(Matrix4::perspectiveProjection(90.0_degf, 1.0f, 0.1f, 100.0f))
+        .draw(mesh(vertices, floor), flatMaterial(0xffffffff_rgbaf), Rasterizer::Shading::Flat);
+
+    /* The bottom half is covered, the top half (above the horizon) not */
+    CORRADE_COMPARE(coveredPixelCount(rasterizer, 0x00000000_rgba), 32);
+    for(Int y: {0, 3})
+        for(Int x: {0, 7})
+            CORRADE_COMPARE(rasterizer.color().pixels<Color4ub>()[y][x], 0xffffffff_rgba);
+
+    rasterizer.clear()
+        .draw(mesh(vertices, behind), flatMaterial(0xffffffff_rgbaf), Rasterizer::Shading::Flat);
+    CORRADE_COMPARE(coveredPixelCount(rasterizer, 0x00000000_rgba), 0);
+}
+
+void RasterizerTest::tiles() {
+    auto&& data = TilesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Several overlapping and intersecting triangles with a perspective
+       projection, rendered to a non-power-of-two size */
+    const Vertex vertices[]{
+        {{-1.5f, -1.0f, -2.0f}, Vector3::zAxis(), 0xff0000ff_rgbaf},
+        {{ 1.2f, -0.8f, -3.0f}, Vector3::zAxis(), 0x00ff00ff_rgbaf},
+        {{ 0.1f,  1.4f, -2.5f}, Vector3::zAxis(), 0x0000ffff_rgbaf},
+        {{-0.3f,  1.1f, -1.5f}, Vector3::xAxis(), 0xffff00ff_rgbaf},
+        {{ 1.6f,  0.2f, -3.5f}, Vector3::yAxis(), 0x00ffffff_rgbaf},
+        {{-1.1f, -1.3f, -2.2f}, Vector3::xAxis(), 0xff00ffff_rgbaf},
+        {{ 0.0f,  0.0f, -1.8f}, Vector3::zAxis(), 0xffffffff_rgbaf},
+    };
+    const UnsignedShort indices[]{
+        0, 1, 2,
+        3, 4, 5,
+        6, 0, 4,
+        2, 6, 5
+    };
+
+    Rasterizer reference{{37, 23}};
+    reference.setProjectionMatrix(Matrix4::perspectiveProjection(60.0_degf, 37.0f/23.0f, 0.1f, 10.0f))
+        .draw(mesh(vertices, indices), Trade::MaterialData{{}, {}}, Rasterizer::Shading::VertexColor);
+    CORRADE_VERIFY(coveredPixelCount(reference, 0x00000000_rgba));
+
+    ThreadPool pool{data.threadCount};
+    ThreadPool::setGlobal(&pool);
+
+    Rasterizer rasterizer{{37, 23}};
+    rasterizer.setTileSize(data.tileSize)
+        .setProjectionMatrix(Matrix4::perspectiveProjection(60.0_degf, 37.0f/23.0f, 0.1f, 10.0f))
+        .draw(mesh(vertices, indices), Trade::MaterialData{{}, {}}, Rasterizer::Shading::VertexColor);
+
+    ThreadPool::setGlobal(nullptr);
+
+    Image2D image = rasterizer.image();
+    Image2D expected = reference.image();
+    CORRADE_COMPARE_AS(
+        Containers::arrayCast<const Color4ub>(image.data()),
+        Containers::arrayCast<const Color4ub>(expected.data()),
+        TestSuite::Compare::Container);
+}
+
+void RasterizerTest::setTileSizeZero() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Rasterizer rasterizer{{4, 4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    rasterizer.setTileSize({16, 0});
+    rasterizer.setTileSize({-16, -16});
+    rasterizer.setTileSize({16, -1});
+    CORRADE_COMPARE(rasterizer.tileSize(), (Vector2i{64}));
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::Rasterizer::setTileSize(): expected a positive size, got {16, 0}\n"
+        "DebugTools::Rasterizer::setTileSize(): expected a positive size, got {-16, -16}\n"
+        "DebugTools::Rasterizer::setTileSize(): expected a positive size, got {16, -1}\n");
+}
+
+void RasterizerTest::setLightsWrongCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Rasterizer rasterizer{{4, 4}};
+    rasterizer.setLightPositions({{}, {}});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    rasterizer.setLightColors({0xff3366_rgbf});
+    rasterizer.setLightSpecularColors({0xff3366_rgbf, 0xff3366_rgbf, 0xff3366_rgbf});
+    rasterizer.setLightRanges({1.0f});
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::Rasterizer::setLightColors(): expected 2 items but got 1\n"
+        "DebugTools::Rasterizer::setLightSpecularColors(): expected 2 items but got 3\n"
+        "DebugTools::Rasterizer::setLightRanges(): expected 2 items but got 1\n");
+}
+
+void RasterizerTest::drawInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const Trade::MeshData lines{MeshPrimitive::Lines, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+    const Trade::MeshData noPositions{MeshPrimitive::Triangles, 3};
+    const Trade::MeshData positionsOnly{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Rasterizer rasterizer{{4, 4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    rasterizer.draw(lines, Trade::MaterialData{{}, {}}, Rasterizer::Shading::Flat);
+    rasterizer.draw(noPositions, Trade::MaterialData{{}, {}}, Rasterizer::Shading::Flat);
+    rasterizer.draw(positionsOnly, Trade::MaterialData{{}, {}}, Rasterizer::Shading::VertexColor);
+    rasterizer.draw(positionsOnly, Trade::MaterialData{{}, {}}, Rasterizer::Shading::Phong);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::Rasterizer::draw(): expected a triangle mesh, got MeshPrimitive::Lines\n"
+        "DebugTools::Rasterizer::draw(): the mesh has no positions\n"
+        "DebugTools::Rasterizer::draw(): DebugTools::Rasterizer::Shading::VertexColor requires the mesh to have vertex colors\n"
+        "DebugTools::Rasterizer::draw(): DebugTools::Rasterizer::Shading::Phong requires the mesh to have normals\n");
+}
+
+void RasterizerTest::debugShading() {
+    std::ostringstream out;
+    Debug{&out} << Rasterizer::Shading::Phong << Rasterizer::Shading(0xde);
+    CORRADE_COMPARE(out.str(), "DebugTools::Rasterizer::Shading::Phong DebugTools::Rasterizer::Shading(0xde)\n");
+}
+
+void RasterizerTest::debugShadingPacked() {
+    std::ostringstream out;
+    /* Second is not packed, the first should not make any flags persistent */
+    Debug{&out} << Debug::packed << Rasterizer::Shading::VertexColor << Debug::packed << Rasterizer::Shading(0xde) << Rasterizer::Shading::Flat;
+    CORRADE_COMPARE(out.str(), "VertexColor 0xde DebugTools::Rasterizer::Shading::Flat\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::RasterizerTest)
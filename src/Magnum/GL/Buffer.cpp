@@ -209,6 +209,14 @@ Buffer::~Buffer() {
     for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i)
         if(bindings[i] == _id) bindings[i] = 0;
 
+    /* Deleting the buffer detaches it from vertex attributes that use it.
+       Make sure the next draw respecifies them instead of assuming a new
+       buffer with the same ID is still attached. */
+    #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+    for(Implementation::MeshState::VertexAttribute& attribute: Context::current().state().mesh.vertexAttributes)
+        if(attribute.buffer == _id) attribute.buffer = 0;
+    #endif
+
     glDeleteBuffers(1, &_id);
 }
 
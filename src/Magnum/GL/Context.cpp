@@ -26,12 +26,17 @@
 #include "Context.h"
 
 #include <algorithm> /* std::lower_bound() */
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <mutex>
+#endif
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
 
 #include "Magnum/GL/AbstractFramebuffer.h"
@@ -624,6 +629,62 @@ const Extension* findExtension(const Containers::StringView extension, const std
     return {};
 }
 
+/* Extension support remembered for a particular driver, used with
+   Context::Configuration::Flag::CacheExtensions */
+struct ExtensionCacheEntry {
+    Containers::String key;
+    Math::BitVector<Implementation::ExtensionCount> status;
+    #ifdef MAGNUM_BUILD_DEPRECATED
+    Containers::Array<Extension> supported;
+    #endif
+};
+
+struct ExtensionCache {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    std::mutex mutex;
+    #endif
+    Containers::Array<ExtensionCacheEntry> entries;
+};
+
+ExtensionCache& extensionCache() {
+    /* A function-local static to ensure it's only initialized once without any
+       race conditions among threads */
+    static ExtensionCache cache;
+    return cache;
+}
+
+/* Besides the vendor, renderer and version strings the key contains also the
+   context flags and the extension count, which distinguish for example
+   debug / no-error contexts or core and compatibility profiles on drivers
+   that report the same version string for both. There's no extension count
+   query on GL 2.1 and ES2, the whole extension string is used instead. */
+Containers::String extensionCacheKey(const Context& context) {
+    #ifndef MAGNUM_TARGET_WEBGL
+    const GLint flags = GLint(context.flags());
+    #else
+    const GLint flags = 0;
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    if(context.isVersionSupported(Version::GL300))
+    #endif
+    {
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        return Utility::format("{}\n{}\n{}\n{}\n{}", context.vendorString(), context.rendererString(), context.versionString(), flags, extensionCount);
+    }
+    #ifndef MAGNUM_TARGET_GLES
+    else
+    #endif
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+    {
+        return Utility::format("{}\n{}\n{}\n{}\n{}", context.vendorString(), context.rendererString(), context.versionString(), flags, Containers::StringView{reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS))});
+    }
+    #endif
+}
+
 }
 
 Containers::ArrayView<const Extension> Extension::extensions(Version version) {
@@ -841,6 +902,10 @@ bool Context::tryCreate(const Configuration& configuration) {
     if(configuration.flags() & Configuration::Flag::Windowless)
         _configurationFlags |= Configuration::Flag::Windowless;
 
+    /* And for extension caching */
+    if(configuration.flags() & Configuration::Flag::CacheExtensions)
+        _configurationFlags |= Configuration::Flag::CacheExtensions;
+
     /* Driver workarounds get merged. Not using disableDriverWorkaround() here
        since the Configuration already contains the internal string views. */
     for(const Containers::StringView workaround: configuration.disabledWorkarounds())
@@ -969,19 +1034,60 @@ bool Context::tryCreate(const Configuration& configuration) {
     while(KnownExtensionsForVersion[future].version != Version::None && isVersionSupported(KnownExtensionsForVersion[future].version))
         ++future;
 
-    /* Mark all extensions from past versions as supported */
-    for(std::size_t i = 0; i != future; ++i)
-        for(const Extension& extension: KnownExtensionsForVersion[i].extensions)
-            _extensionStatus.set(extension.index(), true);
+    /* If extension caching is enabled and a context for the same driver was
+       created before, reuse its extension support instead of going through
+       all extension strings again */
+    Containers::String cacheKey;
+    bool extensionsCached = false;
+    if(_configurationFlags & Configuration::Flag::CacheExtensions) {
+        cacheKey = extensionCacheKey(*this);
+
+        ExtensionCache& cache = extensionCache();
+        #ifdef CORRADE_BUILD_MULTITHREADED
+        std::lock_guard<std::mutex> lock{cache.mutex};
+        #endif
+        for(const ExtensionCacheEntry& entry: cache.entries) {
+            if(entry.key != cacheKey) continue;
 
-    /* Check for presence of future and vendor extensions */
-    const Containers::Array<Containers::StringView> extensions = extensionStrings();
-    for(const Containers::StringView extension: extensions) {
-        if(const Extension* found = findExtension(extension, future)) {
+            _extensionStatus = entry.status;
+            #ifdef MAGNUM_BUILD_DEPRECATED
+            arrayAppend(_supportedExtensions, entry.supported);
+            #endif
+            extensionsCached = true;
+            break;
+        }
+    }
+
+    if(!extensionsCached) {
+        /* Mark all extensions from past versions as supported */
+        for(std::size_t i = 0; i != future; ++i)
+            for(const Extension& extension: KnownExtensionsForVersion[i].extensions)
+                _extensionStatus.set(extension.index(), true);
+
+        /* Check for presence of future and vendor extensions */
+        const Containers::Array<Containers::StringView> extensions = extensionStrings();
+        for(const Containers::StringView extension: extensions) {
+            if(const Extension* found = findExtension(extension, future)) {
+                #ifdef MAGNUM_BUILD_DEPRECATED
+                arrayAppend(_supportedExtensions, *found);
+                #endif
+                _extensionStatus.set(found->index(), true);
+            }
+        }
+
+        /* Remember the result for next time. If two threads miss the cache
+           at the same time, both add an entry, which is harmless. */
+        if(_configurationFlags & Configuration::Flag::CacheExtensions) {
+            ExtensionCache& cache = extensionCache();
+            #ifdef CORRADE_BUILD_MULTITHREADED
+            std::lock_guard<std::mutex> lock{cache.mutex};
+            #endif
+            ExtensionCacheEntry& entry = arrayAppend(cache.entries, InPlaceInit);
+            entry.key = Utility::move(cacheKey);
+            entry.status = _extensionStatus;
             #ifdef MAGNUM_BUILD_DEPRECATED
-            arrayAppend(_supportedExtensions, *found);
+            arrayAppend(entry.supported, _supportedExtensions);
             #endif
-            _extensionStatus.set(found->index(), true);
         }
     }
 
@@ -70,6 +70,7 @@ namespace Implementation {
        Context before the Configuration class is defined, it has to be here */
     enum class ContextConfigurationFlag: UnsignedLong {
         /* Keeping the 32-bit range reserved for actual GL context flags */
+        CacheExtensions = 1ull << 58,
         Windowless = 1ull << 59,
         QuietLog = 1ull << 60,
         VerboseLog = 1ull << 61,
@@ -978,6 +979,28 @@ class MAGNUM_GL_EXPORT Context::Configuration {
             /* Docs only, keep in sync with
                Implementation::ContextConfigurationFlag please */
 
+            /**
+             * Remember the set of extensions supported by the driver and reuse
+             * it for subsequently created contexts instead of querying and
+             * looking up all extension strings again. The cache is
+             * process-wide and keyed on @ref Context::vendorString(),
+             * @relativeref{Context,rendererString()},
+             * @relativeref{Context,versionString()},
+             * @relativeref{Context,flags()} and the extension count, so
+             * contexts on different drivers or with a different setup don't
+             * affect each other. Useful for
+             * applications and test suites creating many short-lived
+             * contexts, where the extension queries are a significant part
+             * of the startup time.
+             *
+             * Extensions disabled through @ref addDisabledExtensions() or the
+             * `--magnum-disable-extensions`
+             * @ref GL-Context-usage-command-line "command-line option" and
+             * driver workarounds are still applied separately for each
+             * context.
+             */
+            CacheExtensions = 1ull << 58,
+
             /**
              * Treat the context as windowless, assume there's no default
              * framebuffer and thus don't initialize or touch
@@ -543,6 +543,16 @@ MeshState::~MeshState() {
 
 void MeshState::reset() {
     currentVAO = State::DisengagedBinding;
+
+    #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+    /* The attribute state is unknown now. Marking everything as enabled with
+       no buffer causes the next draw to respecify all attributes it uses and
+       disable all others. */
+    for(VertexAttribute& attribute: vertexAttributes) {
+        attribute.buffer = 0;
+        attribute.enabled = true;
+    }
+    #endif
 }
 
 }}}
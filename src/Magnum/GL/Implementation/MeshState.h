@@ -101,6 +101,27 @@ struct MeshState {
     #endif
 
     GLuint currentVAO;
+
+    #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+    /* Vertex attribute state last specified by the non-VAO code path,
+       indexed by attribute location. Consecutive draws of meshes with the
+       same attribute layout skip the glVertexAttribPointer() calls, meshes
+       with the same format but different buffers respecify just what
+       changed. Allocated on the first draw, see
+       Mesh::bindImplementationDefault(). */
+    struct VertexAttribute {
+        GLuint buffer;
+        GLuint divisor;
+        UnsignedLong offsetStride;
+        UnsignedShort type;
+        UnsignedByte kindSize;
+        bool enabled;
+        /* Value of vertexAttributeGeneration when last used by a draw */
+        UnsignedInt generation;
+    };
+    Containers::Array<VertexAttribute> vertexAttributes;
+    UnsignedInt vertexAttributeGeneration{};
+    #endif
     #if !defined(MAGNUM_TARGET_WEBGL) && !defined(MAGNUM_TARGET_GLES2)
     GLint maxVertexAttributeStride{};
     #endif
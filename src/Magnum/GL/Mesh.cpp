@@ -34,6 +34,7 @@
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/GL/AbstractShaderProgram.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
@@ -47,10 +48,6 @@
 #include "Magnum/GL/Implementation/MeshState.h"
 #include "Magnum/GL/Implementation/State.h"
 
-#ifdef MAGNUM_BUILD_DEPRECATED
-#include "Magnum/GL/AbstractShaderProgram.h"
-#endif
-
 namespace Magnum { namespace GL {
 
 namespace {
@@ -1300,9 +1297,76 @@ void Mesh::bindIndexBufferImplementationVAODSA(Mesh& self, Buffer& buffer) {
 #endif
 
 void Mesh::bindImplementationDefault(Mesh& self) {
-    /* Specify vertex attributes */
+    /* The attribute state cache exists only on targets where this
+       implementation can get used, on ES3 and WebGL 2 VAOs are always
+       available */
+    #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+    Implementation::MeshState& state = Context::current().state().mesh;
+
+    /* Allocate the attribute state cache on first use */
+    if(state.vertexAttributes.isEmpty())
+        state.vertexAttributes = Containers::Array<Implementation::MeshState::VertexAttribute>{ValueInit, std::size_t(AbstractShaderProgram::maxVertexAttributes())};
+    const UnsignedInt generation = ++state.vertexAttributeGeneration;
+
+    /* Specify vertex attributes, skipping those that are exactly the same as
+       what a previous draw specified */
+    for(AttributeLayout& attribute: self._attributes) {
+        /* Locations over the limit are a GL error, nothing to cache there */
+        if(attribute.location >= state.vertexAttributes.size()) {
+            self.vertexAttribPointer(attribute);
+            continue;
+        }
+
+        Implementation::MeshState::VertexAttribute& cached = state.vertexAttributes[attribute.location];
+        cached.generation = generation;
+        if(cached.enabled &&
+           cached.buffer == attribute.buffer.id() &&
+           cached.offsetStride == attribute.offsetStride &&
+           cached.type == attribute.type &&
+           cached.kindSize == attribute.kindSize &&
+           cached.divisor == attribute.divisor)
+            continue;
+
+        /* vertexAttribPointer() sets the divisor only if it's non-zero, reset
+           it if a previous draw used an instanced attribute here */
+        if(cached.divisor && !attribute.divisor) {
+            #ifndef MAGNUM_TARGET_GLES2
+            glVertexAttribDivisor(attribute.location, 0);
+            #else
+            state.vertexAttribDivisorImplementation(self, attribute.location, 0);
+            #endif
+        }
+
+        self.vertexAttribPointer(attribute);
+        cached.buffer = attribute.buffer.id();
+        cached.divisor = attribute.divisor;
+        cached.offsetStride = attribute.offsetStride;
+        cached.type = attribute.type;
+        cached.kindSize = attribute.kindSize;
+        cached.enabled = true;
+    }
+
+    /* Disable attributes enabled by previous draws that this mesh doesn't
+       use, resetting also their divisor so it doesn't affect other draws */
+    for(std::size_t i = 0; i != state.vertexAttributes.size(); ++i) {
+        Implementation::MeshState::VertexAttribute& cached = state.vertexAttributes[i];
+        if(!cached.enabled || cached.generation == generation) continue;
+
+        glDisableVertexAttribArray(i);
+        if(cached.divisor) {
+            #ifndef MAGNUM_TARGET_GLES2
+            glVertexAttribDivisor(i, 0);
+            #else
+            state.vertexAttribDivisorImplementation(self, i, 0);
+            #endif
+            cached.divisor = 0;
+        }
+        cached.enabled = false;
+    }
+    #else
     for(AttributeLayout& attribute: self._attributes)
         self.vertexAttribPointer(attribute);
+    #endif
 
     /* Bind index buffer, if the mesh is indexed */
     if(self._indexBuffer.id()) self._indexBuffer.bindInternal(Buffer::TargetHint::ElementArray);
@@ -1313,18 +1377,17 @@ void Mesh::bindImplementationVAO(Mesh& self) {
 }
 
 void Mesh::unbindImplementationDefault(Mesh& self) {
+    /* Attributes are left enabled so the next draw can reuse them if it has
+       the same layout, attributes it doesn't use get disabled in
+       bindImplementationDefault() */
+    #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+    static_cast<void>(self);
+    #else
     for(const AttributeLayout& attribute: self._attributes) {
         glDisableVertexAttribArray(attribute.location);
-
-        /* Reset also the divisor back so it doesn't affect  */
-        if(attribute.divisor) {
-            #ifndef MAGNUM_TARGET_GLES2
-            glVertexAttribDivisor(attribute.location, 0);
-            #else
-            Context::current().state().mesh.vertexAttribDivisorImplementation(self, attribute.location, 0);
-            #endif
-        }
+        if(attribute.divisor) glVertexAttribDivisor(attribute.location, 0);
     }
+    #endif
 }
 
 void Mesh::unbindImplementationVAO(Mesh&) {}
@@ -427,6 +427,17 @@ and @fn_gl_keyword{UseProgram}. Mesh limits and implementation-defined values
 (such as @ref maxElementIndex()) are cached, so repeated queries don't result
 in repeated @fn_gl{Get} calls.
 
+If VAOs are not available or are disabled, the engine tracks vertex attribute
+state set by the last draw instead. Attributes that have the same buffer,
+format, offset, stride and divisor as in the previous draw aren't specified
+again and only attributes enabled by previous draws but not used by the
+current one are disabled. Drawing meshes sharing the same vertex
+layout one after another thus results in just a
+@fn_gl_keyword{VertexAttribPointer} call for each attribute whose buffer or
+offset changed. A side effect is that attributes used by the last drawn mesh
+stay enabled after the draw. See @ref opengl-state-tracking for how to reset
+the state tracker when interacting with third-party code.
+
 If @gl_extension{ARB,direct_state_access} desktop extension and VAOs are
 available, DSA functions are used for specifying attribute locations to avoid
 unnecessary calls to @fn_gl{BindBuffer} and @fn_gl{BindVertexArray}. See
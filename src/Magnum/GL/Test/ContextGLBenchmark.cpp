@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/ScopeGuard.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Platform/GLContext.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+/* Measures context startup time. The create() case measures just the
+   Magnum-side setup on top of an already existing GL context, the
+   createWindowless() case creates a whole new windowless GL context the same
+   way Platform::WindowlessApplication does. */
+struct ContextGLBenchmark: OpenGLTester {
+    explicit ContextGLBenchmark();
+
+    void create();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void createWindowless();
+    #endif
+};
+
+const struct {
+    const char* name;
+    bool cacheExtensions;
+} CreateData[]{
+    {"", false},
+    {"cached extensions", true}
+};
+
+ContextGLBenchmark::ContextGLBenchmark() {
+    addInstancedBenchmarks({&ContextGLBenchmark::create}, 10,
+        Containers::arraySize(CreateData));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addInstancedBenchmarks({&ContextGLBenchmark::createWindowless}, 10,
+        Containers::arraySize(CreateData));
+    #endif
+}
+
+void ContextGLBenchmark::create() {
+    auto&& data = CreateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Context* current = &Context::current();
+    Context::makeCurrent(nullptr);
+    Containers::ScopeGuard resetCurrent{current, Context::makeCurrent};
+
+    Context::Configuration configuration;
+    configuration.setFlags(Context::Configuration::Flag::QuietLog|
+                           Context::Configuration::Flag::Windowless);
+    if(data.cacheExtensions)
+        configuration.addFlags(Context::Configuration::Flag::CacheExtensions);
+
+    bool succeeded = true;
+    CORRADE_BENCHMARK(10) {
+        Platform::GLContext context{NoCreate};
+        succeeded = succeeded && context.tryCreate(configuration);
+    }
+
+    CORRADE_VERIFY(succeeded);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ContextGLBenchmark::createWindowless() {
+    auto&& data = CreateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The new context is created and made current in a separate thread in
+       order to not disturb the context the tester is running on, which works
+       only if the current context is thread-local */
+    #ifndef CORRADE_BUILD_MULTITHREADED
+    CORRADE_SKIP("CORRADE_BUILD_MULTITHREADED is not enabled, can't test.");
+    #endif
+
+    Platform::WindowlessGLContext::Configuration configuration;
+    configuration.addFlags(Platform::WindowlessGLContext::Configuration::Flag::QuietLog);
+    if(data.cacheExtensions)
+        configuration.addFlags(Platform::WindowlessGLContext::Configuration::Flag::CacheExtensions);
+
+    bool succeeded = true;
+    CORRADE_BENCHMARK(1) {
+        std::thread t{[&configuration, &succeeded]{
+            /* Same destruction order as in Platform::WindowlessApplication,
+               the Magnum context has to go away before the GL context */
+            Platform::WindowlessGLContext glContext{configuration};
+            Platform::GLContext magnumContext{NoCreate};
+            succeeded = succeeded &&
+                glContext.isCreated() &&
+                glContext.makeCurrent() &&
+                magnumContext.tryCreate(configuration);
+        }};
+        t.join();
+    }
+
+    CORRADE_VERIFY(succeeded);
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::ContextGLBenchmark)
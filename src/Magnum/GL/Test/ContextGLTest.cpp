@@ -64,6 +64,8 @@ struct ContextGLTest: OpenGLTester {
     void supportedVersion();
     void isExtensionSupported();
     void isExtensionDisabled();
+
+    void cacheExtensions();
 };
 
 using namespace Containers::Literals;
@@ -204,7 +206,9 @@ ContextGLTest::ContextGLTest() {
         #endif
         &ContextGLTest::supportedVersion,
         &ContextGLTest::isExtensionSupported,
-        &ContextGLTest::isExtensionDisabled});
+        &ContextGLTest::isExtensionDisabled,
+
+        &ContextGLTest::cacheExtensions});
 }
 
 void ContextGLTest::stringFlags() {
@@ -518,6 +522,31 @@ void ContextGLTest::isExtensionDisabled() {
     #endif
 }
 
+void ContextGLTest::cacheExtensions() {
+    CORRADE_VERIFY(Context::hasCurrent());
+    Context* current = &Context::current();
+
+    Context::makeCurrent(nullptr);
+    Containers::ScopeGuard resetCurrent{current, Context::makeCurrent};
+
+    /* The first context fills the cache, the second one reuses it. Both
+       should report the same as the context that was created without it. */
+    for(std::size_t i: {0, 1}) {
+        CORRADE_ITERATION(i);
+
+        Platform::GLContext ctx{Context::Configuration{}
+            .setFlags(Context::Configuration::Flag::QuietLog|
+                      Context::Configuration::Flag::CacheExtensions)
+        };
+
+        CORRADE_COMPARE(ctx.version(), current->version());
+        for(const Extension& extension: Extension::extensions(Version::None)) {
+            CORRADE_ITERATION(extension.string());
+            CORRADE_COMPARE(ctx.isExtensionSupported(extension), current->isExtensionSupported(extension));
+        }
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::ContextGLTest)
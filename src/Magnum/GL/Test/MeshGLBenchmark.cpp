@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StringView.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Attribute.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Version.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+/* Measures CPU overhead of drawing many small meshes. To compare the VAO and
+   non-VAO code paths, run with
+   --magnum-disable-extensions "GL_ARB_vertex_array_object" (or
+   GL_OES_vertex_array_object on ES2 / WebGL 1). */
+struct MeshGLBenchmark: OpenGLTester {
+    explicit MeshGLBenchmark();
+
+    void draw();
+
+    private:
+        Renderbuffer _color{NoCreate};
+        Framebuffer _framebuffer{NoCreate};
+};
+
+enum class Layout {
+    /* All meshes use the same buffer with the same offset */
+    SharedBuffer,
+    /* All meshes use the same attribute format but each has its own buffer */
+    SeparateBuffers,
+    /* Every other mesh has a different format */
+    AlternatingFormat
+};
+
+const struct {
+    const char* name;
+    Layout layout;
+} DrawData[]{
+    {"shared buffer", Layout::SharedBuffer},
+    {"separate buffers", Layout::SeparateBuffers},
+    {"alternating format", Layout::AlternatingFormat}
+};
+
+constexpr std::size_t MeshCount = 10000;
+
+struct BenchmarkShader: AbstractShaderProgram {
+    typedef Attribute<0, Vector2> Position;
+    typedef Attribute<1, Float> Value;
+
+    explicit BenchmarkShader();
+};
+
+BenchmarkShader::BenchmarkShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    Shader vert(
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        , Shader::Type::Vertex);
+    Shader frag(
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        , Shader::Type::Fragment);
+    #elif defined(MAGNUM_TARGET_GLES2)
+    Shader vert(Version::GLES200, Shader::Type::Vertex);
+    Shader frag(Version::GLES200, Shader::Type::Fragment);
+    #else
+    Shader vert(Version::GLES300, Shader::Type::Vertex);
+    Shader frag(Version::GLES300, Shader::Type::Fragment);
+    #endif
+
+    vert.addSource(
+        "#if !defined(GL_ES) && __VERSION__ == 120\n"
+        "#define mediump\n"
+        "#endif\n"
+        "#if (defined(GL_ES) && __VERSION__ < 300) || __VERSION__ == 120\n"
+        "#define in attribute\n"
+        "#define out varying\n"
+        "#endif\n"
+        "in mediump vec2 position;\n"
+        "in mediump float value;\n"
+        "out mediump float valueInterpolated;\n"
+        "void main() {\n"
+        "    valueInterpolated = value;\n"
+        "    gl_PointSize = 1.0;\n"
+        "    gl_Position = vec4(position, 0.0, 1.0);\n"
+        "}\n");
+    frag.addSource(
+        "#if !defined(GL_ES) && __VERSION__ == 120\n"
+        "#define mediump\n"
+        "#endif\n"
+        "#if (defined(GL_ES) && __VERSION__ < 300) || __VERSION__ == 120\n"
+        "#define in varying\n"
+        "#define result gl_FragColor\n"
+        "#endif\n"
+        "in mediump float valueInterpolated;\n"
+        "#if (defined(GL_ES) && __VERSION__ >= 300) || (!defined(GL_ES) && __VERSION__ >= 130)\n"
+        "out mediump vec4 result;\n"
+        "#endif\n"
+        "void main() { result = vec4(valueInterpolated); }\n");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile() && frag.compile());
+
+    attachShaders({vert, frag});
+
+    bindAttributeLocation(Position::Location, "position");
+    bindAttributeLocation(Value::Location, "value");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+}
+
+MeshGLBenchmark::MeshGLBenchmark() {
+    addInstancedBenchmarks({&MeshGLBenchmark::draw}, 10,
+        Containers::arraySize(DrawData),
+        BenchmarkType::CpuTime);
+
+    _color = Renderbuffer{};
+    _color.setStorage(
+        #ifndef MAGNUM_TARGET_GLES2
+        RenderbufferFormat::RGBA8,
+        #else
+        RenderbufferFormat::RGBA4,
+        #endif
+        Vector2i{1});
+    _framebuffer = Framebuffer{{{}, Vector2i{1}}};
+    _framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, _color);
+}
+
+void MeshGLBenchmark::draw() {
+    auto&& data = DrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Interleaved position and value, a single point per mesh */
+    const Float vertexData[]{0.0f, 0.0f, 1.0f, 0.5f};
+
+    Containers::Array<Buffer> buffers{ValueInit, data.layout == Layout::SharedBuffer ? 1 : MeshCount};
+    for(Buffer& buffer: buffers)
+        buffer.setData(vertexData, BufferUsage::StaticDraw);
+
+    Containers::Array<Mesh> meshes{ValueInit, MeshCount};
+    for(std::size_t i = 0; i != MeshCount; ++i) {
+        Buffer& buffer = buffers[data.layout == Layout::SharedBuffer ? 0 : i];
+        meshes[i].setPrimitive(MeshPrimitive::Points)
+            .setCount(1);
+        if(data.layout == Layout::AlternatingFormat && i % 2)
+            meshes[i].addVertexBuffer(buffer, 0, BenchmarkShader::Position{}, 4, BenchmarkShader::Value{});
+        else
+            meshes[i].addVertexBuffer(buffer, 0, BenchmarkShader::Position{}, BenchmarkShader::Value{});
+    }
+
+    BenchmarkShader shader;
+    _framebuffer.bind();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_BENCHMARK(1) {
+        for(Mesh& mesh: meshes)
+            shader.draw(mesh);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::MeshGLBenchmark)
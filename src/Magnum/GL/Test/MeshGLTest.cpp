@@ -130,6 +130,9 @@ struct MeshGLTest: OpenGLTester {
     void addVertexBufferMultiple();
     void addVertexBufferMultipleGaps();
 
+    void drawSameLayout();
+    void drawSameLayoutBufferRecreated();
+
     void addVertexBufferMovedOutInstance();
     void addVertexBufferTransferOwnwership();
     void addVertexBufferInstancedTransferOwnwership();
@@ -622,6 +625,9 @@ MeshGLTest::MeshGLTest() {
     addTests({&MeshGLTest::addVertexBufferMultiple,
               &MeshGLTest::addVertexBufferMultipleGaps,
 
+              &MeshGLTest::drawSameLayout,
+              &MeshGLTest::drawSameLayoutBufferRecreated,
+
               &MeshGLTest::addVertexBufferMovedOutInstance,
               &MeshGLTest::addVertexBufferTransferOwnwership,
               &MeshGLTest::addVertexBufferInstancedTransferOwnwership,
@@ -2307,6 +2313,89 @@ void MeshGLTest::addVertexBufferMultipleGaps() {
     #endif
 }
 
+void MeshGLTest::drawSameLayout() {
+    /* Values representable in RGBA4 as well, to not need to special-case
+       ES2 */
+    const Float dataA[]{0.0f, Math::unpack<Float, UnsignedByte>(85)};
+    const Float dataB[]{0.0f, 0.0f, Math::unpack<Float, UnsignedByte>(170)};
+    Buffer bufferA, bufferB;
+    bufferA.setData(dataA, BufferUsage::StaticDraw);
+    bufferB.setData(dataB, BufferUsage::StaticDraw);
+
+    /* Same attribute format, different buffers and offsets. If VAOs are not
+       used, drawing these after each other only respecifies the buffer and
+       offset, verify that nothing from the previous draw leaks through. */
+    Mesh a, b, c;
+    a.setBaseVertex(1)
+        .addVertexBuffer(bufferA, 0, Attribute<0, Float>{});
+    b.setBaseVertex(1)
+        .addVertexBuffer(bufferB, 4, Attribute<0, Float>{});
+    /* Same buffer and offset as the first */
+    c.setBaseVertex(1)
+        .addVertexBuffer(bufferA, 0, Attribute<0, Float>{});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    for(Mesh* mesh: {&a, &b, &a, &c, &b}) {
+        const auto value = Checker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+            #ifndef MAGNUM_TARGET_GLES2
+            RenderbufferFormat::RGBA8,
+            #else
+            RenderbufferFormat::RGBA4,
+            #endif
+            *mesh).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(value, mesh == &b ? 170 : 85);
+    }
+}
+
+void MeshGLTest::drawSameLayoutBufferRecreated() {
+    const Float dataA[]{0.0f, Math::unpack<Float, UnsignedByte>(85)};
+    const Float dataB[]{0.0f, Math::unpack<Float, UnsignedByte>(170)};
+
+    {
+        Buffer buffer;
+        buffer.setData(dataA, BufferUsage::StaticDraw);
+
+        Mesh mesh;
+        mesh.setBaseVertex(1)
+            .addVertexBuffer(buffer, 0, Attribute<0, Float>{});
+
+        const auto value = Checker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+            #ifndef MAGNUM_TARGET_GLES2
+            RenderbufferFormat::RGBA8,
+            #else
+            RenderbufferFormat::RGBA4,
+            #endif
+            mesh).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(value, 85);
+    }
+
+    /* The buffer is likely to get the same ID as the deleted one, with
+       exactly the same layout. The attribute has to be specified again
+       because deleting the buffer detached it. */
+    Buffer buffer;
+    buffer.setData(dataB, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setBaseVertex(1)
+        .addVertexBuffer(buffer, 0, Attribute<0, Float>{});
+
+    const auto value = Checker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        #ifndef MAGNUM_TARGET_GLES2
+        RenderbufferFormat::RGBA8,
+        #else
+        RenderbufferFormat::RGBA4,
+        #endif
+        mesh).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, 170);
+}
+
 void MeshGLTest::addVertexBufferMovedOutInstance() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
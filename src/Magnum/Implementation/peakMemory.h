@@ -0,0 +1,76 @@
+#ifndef Magnum_Implementation_peakMemory_h
+#define Magnum_Implementation_peakMemory_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Used by BenchmarkTester and the magnum-sceneconverter profiler, both of
+   which are compiled directly into executables, so the functions are inline
+   instead of exported */
+
+#ifdef __linux__
+/* Resets the peak resident memory reported by memoryStatus("VmHWM:") to the
+   current resident memory. Writing 5 to clear_refs is available since Linux
+   4.0, if it fails, the peak from earlier in the process lifetime may leak
+   into subsequent measurements. */
+inline void resetPeakMemory() {
+    if(std::FILE* f = std::fopen("/proc/self/clear_refs", "w")) {
+        std::fputs("5", f);
+        std::fclose(f);
+    }
+}
+
+/* Memory value of given key from /proc/self/status in bytes, such as
+   "VmHWM:" for the peak resident memory or "VmRSS:" for the current resident
+   memory. Returns 0 if the file can't be opened or the key isn't found. */
+inline UnsignedLong memoryStatus(const char* const key) {
+    std::FILE* f = std::fopen("/proc/self/status", "r");
+    if(!f) return 0;
+
+    UnsignedLong value = 0;
+    const std::size_t keySize = std::strlen(key);
+    char line[256];
+    while(std::fgets(line, sizeof(line), f)) {
+        if(std::strncmp(line, key, keySize) != 0) continue;
+        /* The value is always in kB */
+        value = std::strtoull(line + keySize, nullptr, 10)*1024;
+        break;
+    }
+
+    std::fclose(f);
+    return value;
+}
+#endif
+
+}}
+
+#endif
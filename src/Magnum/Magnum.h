@@ -1377,6 +1377,8 @@ enum class SamplerFilter: UnsignedInt;
 enum class SamplerMipmap: UnsignedInt;
 enum class SamplerWrapping: UnsignedInt;
 
+class TaskGraph;
+class ThreadPool;
 class Timeline;
 #endif
 
@@ -0,0 +1,261 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PackTextureArrays.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/TextureTools/Atlas.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/TextureData.h"
+
+namespace Magnum { namespace MaterialTools {
+
+using namespace Containers::Literals;
+
+namespace {
+
+struct Group {
+    /* Texture from which the sampler properties are taken, and the image
+       from which the format is taken */
+    UnsignedInt texture, image;
+    /* Set only if the group contains images of a single size */
+    Vector2i size;
+    bool packable;
+    /* Unique images in the group, their offsets in the output and the
+       resulting layer size and count */
+    Containers::Array<UnsignedInt> images;
+    Containers::Array<Vector3i> offsets;
+    Vector2i layerSize;
+    Int layerCount;
+};
+
+bool isTextureReference(const Trade::MaterialData& material, const UnsignedInt layer, const UnsignedInt id) {
+    return material.attributeType(layer, id) == Trade::MaterialAttributeType::UnsignedInt && material.attributeName(layer, id).hasSuffix("Texture"_s);
+}
+
+}
+
+Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> packTextureArrays(const Containers::Iterable<const Trade::MaterialData>& materials, const Containers::Iterable<const Trade::TextureData>& textures, const Containers::Iterable<const Trade::ImageData2D>& images) {
+    /* Group and item index for each input texture, ~UnsignedInt{} for
+       textures that aren't referenced by any material */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> textureMapping{DirectInit, textures.size(), ~UnsignedInt{}, ~UnsignedInt{}};
+    Containers::Array<Group> groups;
+    for(std::size_t i = 0; i != materials.size(); ++i) {
+        const Trade::MaterialData& material = materials[i];
+        for(UnsignedInt layer = 0; layer != material.layerCount(); ++layer) {
+            for(UnsignedInt j = 0; j != material.attributeCount(layer); ++j) {
+                if(!isTextureReference(material, layer, j)) continue;
+
+                const UnsignedInt textureId = material.attribute<UnsignedInt>(layer, j);
+                CORRADE_ASSERT(textureId < textures.size(),
+                    "MaterialTools::packTextureArrays(): material" << i << "attribute" << material.attributeName(layer, j) << "references texture" << textureId << "but got only" << textures.size() << "textures", {});
+                if(textureMapping[textureId].first() != ~UnsignedInt{})
+                    continue;
+
+                const Trade::TextureData& texture = textures[textureId];
+                if(texture.type() != Trade::TextureType::Texture2D) {
+                    Error{} << "MaterialTools::packTextureArrays(): expected texture" << textureId << "to be" << Trade::TextureType::Texture2D << "but got" << texture.type();
+                    return {};
+                }
+                CORRADE_ASSERT(texture.image() < images.size(),
+                    "MaterialTools::packTextureArrays(): texture" << textureId << "references image" << texture.image() << "but got only" << images.size() << "images", {});
+                const Trade::ImageData2D& image = images[texture.image()];
+                const Vector2i size = image.size();
+                const bool packable = !image.isCompressed() && size.x() == size.y() && Math::isPowerOfTwo(size.x());
+                const bool clamped =
+                    texture.wrapping()[0] == SamplerWrapping::ClampToEdge &&
+                    texture.wrapping()[1] == SamplerWrapping::ClampToEdge;
+
+                /* Find a compatible group. Images that can't be packed always
+                   get a group of their own. */
+                std::size_t groupId = packable ? 0 : groups.size();
+                for(; groupId != groups.size(); ++groupId) {
+                    const Group& group = groups[groupId];
+                    if(!group.packable) continue;
+
+                    const Trade::TextureData& groupTexture = textures[group.texture];
+                    if(groupTexture.minificationFilter() != texture.minificationFilter() ||
+                       groupTexture.magnificationFilter() != texture.magnificationFilter() ||
+                       groupTexture.mipmapFilter() != texture.mipmapFilter() ||
+                       groupTexture.wrapping() != texture.wrapping())
+                        continue;
+
+                    const Trade::ImageData2D& groupImage = images[group.image];
+                    if(groupImage.format() != image.format() ||
+                       groupImage.formatExtra() != image.formatExtra() ||
+                       groupImage.pixelSize() != image.pixelSize())
+                        continue;
+
+                    /* Clamped groups contain all sizes, the others just one */
+                    if(group.size != (clamped ? Vector2i{} : size))
+                        continue;
+
+                    break;
+                }
+                if(groupId == groups.size()) {
+                    Group group{};
+                    group.texture = textureId;
+                    group.image = texture.image();
+                    group.size = packable && clamped ? Vector2i{} : size;
+                    group.packable = packable;
+                    arrayAppend(groups, Utility::move(group));
+                }
+
+                /* Put the image into the group if not there already */
+                Group& group = groups[groupId];
+                std::size_t itemId = 0;
+                for(; itemId != group.images.size(); ++itemId)
+                    if(group.images[itemId] == texture.image()) break;
+                if(itemId == group.images.size())
+                    arrayAppend(group.images, texture.image());
+
+                textureMapping[textureId] = {UnsignedInt(groupId), UnsignedInt(itemId)};
+            }
+        }
+    }
+
+    /* Pack each group into a single image */
+    Containers::Array<Trade::TextureData> outputTextures;
+    Containers::Array<Trade::ImageData3D> outputImages;
+    arrayReserve(outputTextures, groups.size());
+    arrayReserve(outputImages, groups.size());
+    for(std::size_t i = 0; i != groups.size(); ++i) {
+        Group& group = groups[i];
+        const Trade::ImageData2D& groupImage = images[group.image];
+
+        group.offsets = Containers::Array<Vector3i>{ValueInit, group.images.size()};
+        if(group.packable) {
+            Containers::Array<Vector2i> sizes{NoInit, group.images.size()};
+            for(std::size_t j = 0; j != group.images.size(); ++j) {
+                sizes[j] = images[group.images[j]].size();
+                group.layerSize = Math::max(group.layerSize, sizes[j]);
+            }
+            group.layerCount = TextureTools::atlasArrayPowerOfTwo(group.layerSize, sizes, group.offsets);
+        } else {
+            group.layerSize = groupImage.size();
+            group.layerCount = 1;
+        }
+
+        const Vector3i size{group.layerSize, group.layerCount};
+        if(groupImage.isCompressed()) {
+            Containers::Array<char> data{NoInit, groupImage.data().size()};
+            Utility::copy(groupImage.data(), data);
+            arrayAppend(outputImages, InPlaceInit, groupImage.compressedStorage(), groupImage.compressedFormat(), size, Utility::move(data), ImageFlag3D::Array);
+        } else {
+            /* Tightly packed to not have to calculate row padding */
+            Containers::Array<char> data{ValueInit, std::size_t(size.product())*groupImage.pixelSize()};
+            Trade::ImageData3D image{PixelStorage{}.setAlignment(1), groupImage.format(), groupImage.formatExtra(), groupImage.pixelSize(), size, Utility::move(data), ImageFlag3D::Array};
+            for(std::size_t j = 0; j != group.images.size(); ++j) {
+                const Trade::ImageData2D& item = images[group.images[j]];
+                const Vector3i& offset = group.offsets[j];
+                Utility::copy(item.pixels(), image.mutablePixels()[offset.z()].sliceSize(
+                    {std::size_t(offset.y()), std::size_t(offset.x()), 0},
+                    {std::size_t(item.size().y()), std::size_t(item.size().x()), item.pixelSize()}));
+            }
+            arrayAppend(outputImages, Utility::move(image));
+        }
+
+        const Trade::TextureData& groupTexture = textures[group.texture];
+        arrayAppend(outputTextures, InPlaceInit, Trade::TextureType::Texture2DArray, groupTexture.minificationFilter(), groupTexture.magnificationFilter(), groupTexture.mipmapFilter(), groupTexture.wrapping(), UnsignedInt(i));
+    }
+
+    /* Rewrite the materials to reference the array textures */
+    Containers::Array<Trade::MaterialData> outputMaterials;
+    arrayReserve(outputMaterials, materials.size());
+    for(const Trade::MaterialData& material: materials) {
+        Containers::Array<Trade::MaterialAttributeData> attributes;
+        arrayReserve(attributes, material.attributeData().size());
+        Containers::Array<UnsignedInt> layers{NoInit, material.layerCount()};
+        for(UnsignedInt layer = 0; layer != material.layerCount(); ++layer) {
+            for(UnsignedInt j = 0; j != material.attributeCount(layer); ++j) {
+                const Containers::StringView name = material.attributeName(layer, j);
+
+                /* Texture matrix and layer attributes of texture references
+                   are replaced below */
+                if(name.hasSuffix("Matrix"_s) || name.hasSuffix("Layer"_s)) {
+                    const Containers::StringView textureName = name.exceptSuffix(name.hasSuffix("Matrix"_s) ? 6 : 5);
+                    if(const Containers::Optional<UnsignedInt> textureId = material.findAttributeId(layer, textureName))
+                        if(isTextureReference(material, layer, *textureId))
+                            continue;
+                }
+
+                if(!isTextureReference(material, layer, j)) {
+                    arrayAppend(attributes, material.attributeData(layer, j));
+                    continue;
+                }
+
+                const Containers::Pair<UnsignedInt, UnsignedInt> mapping = textureMapping[material.attribute<UnsignedInt>(layer, j)];
+                const Group& group = groups[mapping.first()];
+                const Vector3i& offset = group.offsets[mapping.second()];
+
+                /* The original matrix is the texture-specific one, or the
+                   layer-global or the base layer-global as a fallback */
+                Matrix3 matrix;
+                bool hasMatrix = true;
+                if(const Containers::Optional<Matrix3> value = material.findAttribute<Matrix3>(layer, name + "Matrix"_s))
+                    matrix = *value;
+                else if(const Containers::Optional<Matrix3> value = material.findAttribute<Matrix3>(layer, Trade::MaterialAttribute::TextureMatrix))
+                    matrix = *value;
+                else if(const Containers::Optional<Matrix3> value = material.findAttribute<Matrix3>(0, Trade::MaterialAttribute::TextureMatrix))
+                    matrix = *value;
+                else
+                    hasMatrix = false;
+                matrix = TextureTools::atlasTextureCoordinateTransformation(group.layerSize, images[group.images[mapping.second()]].size(), offset.xy())*matrix;
+
+                /* The texture-specific matrix is always written if the input
+                   had any matrix, even if it's an identity. Otherwise the
+                   texture would pick up the layer-global or base layer-global
+                   matrix that's preserved in the output. */
+                arrayAppend(attributes, InPlaceInit, name, mapping.first());
+                arrayAppend(attributes, InPlaceInit, name + "Layer"_s, UnsignedInt(offset.z()));
+                if(hasMatrix || matrix != Matrix3{})
+                    arrayAppend(attributes, InPlaceInit, name + "Matrix"_s, matrix);
+            }
+
+            layers[layer] = attributes.size();
+        }
+
+        /* Convert back to a default deleter to make the data usable outside
+           of this library */
+        arrayShrink(attributes, DefaultInit);
+        arrayAppend(outputMaterials, InPlaceInit, material.types(), Utility::move(attributes), Utility::move(layers));
+    }
+
+    return Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>{Utility::move(outputMaterials), Utility::move(outputTextures), Utility::move(outputImages)};
+}
+
+}}
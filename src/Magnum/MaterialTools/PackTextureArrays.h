@@ -0,0 +1,95 @@
+#ifndef Magnum_MaterialTools_PackTextureArrays_h
+#define Magnum_MaterialTools_PackTextureArrays_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+/** @file
+ * @brief Function @ref Magnum::MaterialTools::packTextureArrays()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/MaterialTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MaterialTools {
+
+/**
+@brief Pack material textures into texture arrays
+@param materials    Materials referencing @p textures
+@param textures     Textures referencing @p images
+@param images       2D images
+@return Materials referencing the output textures, 2D array textures
+    referencing the output images and the output 3D images, or
+    @relativeref{Corrade,Containers::NullOpt} on failure
+@m_since_latest
+
+Meant to reduce the number of texture binds needed to render a whole scene,
+for example with @ref Shaders::PhongGL::Flag::TextureArrays together with
+@ref Shaders::PhongGL::Flag::MultiDraw.
+
+All @ref Trade::MaterialAttributeType::UnsignedInt attributes named
+@cpp "*Texture" @ce in all material layers are treated as texture references.
+Textures referenced by the materials are put into groups based on their pixel
+format and sampler properties and each group is then packed into a single
+@ref Trade::TextureType::Texture2DArray texture:
+
+-   Square power-of-two uncompressed images are packed using
+    @ref TextureTools::atlasArrayPowerOfTwo(), with the layer size being the
+    size of the largest image in the group. Textures that have both X and Y
+    wrapping set to @ref SamplerWrapping::ClampToEdge are assumed to be used
+    with texture coordinates in the @f$ [0, 1] @f$ range only and are packed
+    together regardless of their size. Textures with any other wrapping mode
+    are grouped only with textures of the same size, in order to have each
+    occupy a whole layer and thus preserve the wrapping behavior.
+-   Other images, such as compressed or non-power-of-two ones, are put into a
+    single-layer array of their original size each.
+
+Each texture reference in the output materials then points to the output array
+texture, @cpp "*TextureLayer" @ce is set to the layer in the array and
+@cpp "*TextureMatrix" @ce, if not an identity, to the transformation calculated
+with @ref TextureTools::atlasTextureCoordinateTransformation(), multiplied with
+the texture matrix that was originally applied to the texture, if any. Other
+attributes are passed through unchanged. Texture references that aren't used
+by any material are dropped, images referenced by more than one texture in the
+same group are put into the output just once.
+
+As different textures of a single material can end up in different layers
+or with different transformations, the output may not satisfy
+@ref Trade::PhongMaterialData::hasCommonTextureTransformation() and
+@relativeref{Trade::PhongMaterialData,hasCommonTextureLayer()} even if the
+input did. Mip levels aren't generated for the output images.
+
+Expects that all texture references in @p materials are in bounds for
+@p textures and all images referenced by @p textures are in bounds for
+@p images. If any of the referenced textures is not a
+@ref Trade::TextureType::Texture2D, prints a message to
+@relativeref{Magnum,Error} and returns @relativeref{Corrade,Containers::NullOpt}.
+*/
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> packTextureArrays(const Containers::Iterable<const Trade::MaterialData>& materials, const Containers::Iterable<const Trade::TextureData>& textures, const Containers::Iterable<const Trade::ImageData2D>& images);
+
+}}
+
+#endif
@@ -0,0 +1,456 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream> /** @todo remove once Debug is stream-free */
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/CompareMaterial.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/MaterialTools/PackTextureArrays.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/TextureData.h"
+
+namespace Magnum { namespace MaterialTools { namespace Test { namespace {
+
+struct PackTextureArraysTest: TestSuite::Tester {
+    explicit PackTextureArraysTest();
+
+    void empty();
+    void powerOfTwo();
+    void groups();
+    void notPackable();
+    void identityTextureMatrix();
+
+    void notTexture2D();
+    void textureOutOfRange();
+    void imageOutOfRange();
+};
+
+PackTextureArraysTest::PackTextureArraysTest() {
+    addTests({&PackTextureArraysTest::empty,
+              &PackTextureArraysTest::powerOfTwo,
+              &PackTextureArraysTest::groups,
+              &PackTextureArraysTest::notPackable,
+              &PackTextureArraysTest::identityTextureMatrix,
+
+              &PackTextureArraysTest::notTexture2D,
+              &PackTextureArraysTest::textureOutOfRange,
+              &PackTextureArraysTest::imageOutOfRange});
+}
+
+Trade::ImageData2D image(PixelFormat format, const Vector2i& size, char value) {
+    Containers::Array<char> data{DirectInit, std::size_t(size.product())*pixelFormatSize(format), value};
+    return Trade::ImageData2D{PixelStorage{}.setAlignment(1), format, size, Utility::move(data)};
+}
+
+Trade::TextureData texture(SamplerWrapping wrapping, UnsignedInt image) {
+    return Trade::TextureData{Trade::TextureType::Texture2D, SamplerFilter::Linear, SamplerFilter::Linear, SamplerMipmap::Linear, wrapping, image};
+}
+
+void PackTextureArraysTest::empty() {
+    Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> out = packTextureArrays({}, {}, {});
+    CORRADE_VERIFY(out);
+    CORRADE_VERIFY(out->first().isEmpty());
+    CORRADE_VERIFY(out->second().isEmpty());
+    CORRADE_VERIFY(out->third().isEmpty());
+}
+
+void PackTextureArraysTest::powerOfTwo() {
+    const Trade::ImageData2D images[]{
+        image(PixelFormat::R8Unorm, {4, 4}, '\x11'),
+        image(PixelFormat::R8Unorm, {2, 2}, '\x22'),
+        image(PixelFormat::R8Unorm, {2, 2}, '\x33'),
+        /* Not referenced by anything */
+        image(PixelFormat::R8Unorm, {2, 2}, '\x44'),
+    };
+
+    const Trade::TextureData textures[]{
+        texture(SamplerWrapping::ClampToEdge, 0),
+        texture(SamplerWrapping::ClampToEdge, 1),
+        texture(SamplerWrapping::ClampToEdge, 2),
+        /* References the same image as texture 1, should be packed just
+           once */
+        texture(SamplerWrapping::ClampToEdge, 1),
+        /* Not referenced by any material */
+        texture(SamplerWrapping::ClampToEdge, 3),
+    };
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, {
+            {Trade::MaterialAttribute::BaseColorTexture, 0u},
+            {Trade::MaterialAttribute::NormalTexture, 1u},
+            {Trade::MaterialAttribute::NormalTextureMatrix, Matrix3::scaling(Vector2{0.5f})},
+            /* Stale layer on a 2D texture, gets replaced */
+            {Trade::MaterialAttribute::NormalTextureLayer, 7u},
+            {Trade::MaterialAttribute::Roughness, 0.3f},
+        }},
+        Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness|Trade::MaterialType::PbrClearCoat, {
+            {Trade::MaterialAttribute::EmissiveTexture, 2u},
+            {Trade::MaterialAttribute::TextureMatrix, Matrix3::translation({0.25f, 0.0f})},
+            {Trade::MaterialLayer::ClearCoat},
+            {Trade::MaterialAttribute::LayerFactorTexture, 3u},
+            {"customTexture", 0u},
+            /* Not a texture reference, left untouched */
+            {"notATexture", 1.0f},
+        }, {2, 6}},
+    };
+
+    Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> out = packTextureArrays(materials, textures, images);
+    CORRADE_VERIFY(out);
+
+    /* All images are packed into a single array, the 4x4 occupying the first
+       layer and the two 2x2 next to each other in the second */
+    CORRADE_COMPARE(out->second().size(), 1);
+    CORRADE_COMPARE(out->second()[0].type(), Trade::TextureType::Texture2DArray);
+    CORRADE_COMPARE(out->second()[0].minificationFilter(), SamplerFilter::Linear);
+    CORRADE_COMPARE(out->second()[0].mipmapFilter(), SamplerMipmap::Linear);
+    CORRADE_COMPARE(out->second()[0].wrapping(), Math::Vector3<SamplerWrapping>{SamplerWrapping::ClampToEdge});
+    CORRADE_COMPARE(out->second()[0].image(), 0);
+
+    CORRADE_COMPARE(out->third().size(), 1);
+    CORRADE_COMPARE(out->third()[0].format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out->third()[0].size(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE(out->third()[0].flags(), ImageFlag3D::Array);
+    CORRADE_COMPARE_AS(out->third()[0].data(), Containers::arrayView<char>({
+        '\x11', '\x11', '\x11', '\x11',
+        '\x11', '\x11', '\x11', '\x11',
+        '\x11', '\x11', '\x11', '\x11',
+        '\x11', '\x11', '\x11', '\x11',
+
+        '\x22', '\x22', '\x33', '\x33',
+        '\x22', '\x22', '\x33', '\x33',
+        '\x00', '\x00', '\x00', '\x00',
+        '\x00', '\x00', '\x00', '\x00',
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(out->first().size(), 2);
+    CORRADE_COMPARE_AS(out->first()[0], (Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, {
+        {Trade::MaterialAttribute::BaseColorTexture, 0u},
+        /* Covers the whole layer, so no matrix */
+        {Trade::MaterialAttribute::BaseColorTextureLayer, 0u},
+        {Trade::MaterialAttribute::NormalTexture, 0u},
+        {Trade::MaterialAttribute::NormalTextureLayer, 1u},
+        {Trade::MaterialAttribute::NormalTextureMatrix,
+            Matrix3::scaling(Vector2{0.5f})*
+            Matrix3::scaling(Vector2{0.5f})},
+        {Trade::MaterialAttribute::Roughness, 0.3f},
+    }}), DebugTools::CompareMaterial);
+    CORRADE_COMPARE_AS(out->first()[1], (Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness|Trade::MaterialType::PbrClearCoat, {
+        {Trade::MaterialAttribute::EmissiveTexture, 0u},
+        {Trade::MaterialAttribute::EmissiveTextureLayer, 1u},
+        /* The base layer texture matrix is applied first */
+        {Trade::MaterialAttribute::EmissiveTextureMatrix,
+            Matrix3::translation({0.5f, 0.0f})*
+            Matrix3::scaling(Vector2{0.5f})*
+            Matrix3::translation({0.25f, 0.0f})},
+        {Trade::MaterialAttribute::TextureMatrix, Matrix3::translation({0.25f, 0.0f})},
+        {Trade::MaterialLayer::ClearCoat},
+        {Trade::MaterialAttribute::LayerFactorTexture, 0u},
+        {Trade::MaterialAttribute::LayerFactorTextureLayer, 1u},
+        /* The base layer texture matrix is used as a fallback for other
+           layers as well */
+        {Trade::MaterialAttribute::LayerFactorTextureMatrix,
+            Matrix3::scaling(Vector2{0.5f})*
+            Matrix3::translation({0.25f, 0.0f})},
+        {"customTexture", 0u},
+        {"customTextureLayer", 0u},
+        {"customTextureMatrix", Matrix3::translation({0.25f, 0.0f})},
+        {"notATexture", 1.0f},
+    }, {4, 12}}), DebugTools::CompareMaterial);
+}
+
+void PackTextureArraysTest::groups() {
+    const Trade::ImageData2D images[]{
+        image(PixelFormat::R8Unorm, {2, 2}, '\x11'),
+        image(PixelFormat::R8Unorm, {4, 4}, '\x22'),
+        image(PixelFormat::R8Unorm, {2, 2}, '\x33'),
+        image(PixelFormat::RG8Unorm, {2, 2}, '\x44'),
+    };
+
+    const Trade::TextureData textures[]{
+        /* Repeated textures of the same size go to the same array, each
+           occupying a whole layer */
+        texture(SamplerWrapping::Repeat, 0),
+        texture(SamplerWrapping::Repeat, 1),
+        texture(SamplerWrapping::Repeat, 2),
+        /* Clamped texture of a different format goes to a separate array */
+        texture(SamplerWrapping::ClampToEdge, 3),
+        /* Same image as texture 0 but a different sampler, goes to a
+           separate array as well */
+        texture(SamplerWrapping::ClampToEdge, 0),
+    };
+
+    /* Attributes are sorted, so the textures are discovered in order 0, 3, 1,
+       2, 4 */
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::AmbientTexture, 0u},
+            {Trade::MaterialAttribute::DiffuseTexture, 3u},
+            {Trade::MaterialAttribute::NormalTexture, 1u},
+            {Trade::MaterialAttribute::SpecularTexture, 2u},
+        }},
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::DiffuseTexture, 4u},
+        }},
+    };
+
+    Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> out = packTextureArrays(materials, textures, images);
+    CORRADE_VERIFY(out);
+
+    CORRADE_COMPARE(out->second().size(), 4);
+    CORRADE_COMPARE(out->second()[0].wrapping(), Math::Vector3<SamplerWrapping>{SamplerWrapping::Repeat});
+    CORRADE_COMPARE(out->second()[0].image(), 0);
+    CORRADE_COMPARE(out->second()[1].wrapping(), Math::Vector3<SamplerWrapping>{SamplerWrapping::ClampToEdge});
+    CORRADE_COMPARE(out->second()[1].image(), 1);
+    CORRADE_COMPARE(out->second()[2].wrapping(), Math::Vector3<SamplerWrapping>{SamplerWrapping::Repeat});
+    CORRADE_COMPARE(out->second()[2].image(), 2);
+    CORRADE_COMPARE(out->second()[3].wrapping(), Math::Vector3<SamplerWrapping>{SamplerWrapping::ClampToEdge});
+    CORRADE_COMPARE(out->second()[3].image(), 3);
+
+    CORRADE_COMPARE(out->third().size(), 4);
+    CORRADE_COMPARE(out->third()[0].format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out->third()[0].size(), (Vector3i{2, 2, 2}));
+    CORRADE_COMPARE(out->third()[1].format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(out->third()[1].size(), (Vector3i{2, 2, 1}));
+    CORRADE_COMPARE(out->third()[2].format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out->third()[2].size(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(out->third()[3].format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out->third()[3].size(), (Vector3i{2, 2, 1}));
+
+    CORRADE_COMPARE(out->first().size(), 2);
+    CORRADE_COMPARE_AS(out->first()[0], (Trade::MaterialData{Trade::MaterialType::Phong, {
+        {Trade::MaterialAttribute::AmbientTexture, 0u},
+        {Trade::MaterialAttribute::AmbientTextureLayer, 0u},
+        {Trade::MaterialAttribute::DiffuseTexture, 1u},
+        {Trade::MaterialAttribute::DiffuseTextureLayer, 0u},
+        {Trade::MaterialAttribute::NormalTexture, 2u},
+        {Trade::MaterialAttribute::NormalTextureLayer, 0u},
+        {Trade::MaterialAttribute::SpecularTexture, 0u},
+        {Trade::MaterialAttribute::SpecularTextureLayer, 1u},
+    }}), DebugTools::CompareMaterial);
+    CORRADE_COMPARE_AS(out->first()[1], (Trade::MaterialData{Trade::MaterialType::Phong, {
+        {Trade::MaterialAttribute::DiffuseTexture, 3u},
+        {Trade::MaterialAttribute::DiffuseTextureLayer, 0u},
+    }}), DebugTools::CompareMaterial);
+}
+
+void PackTextureArraysTest::notPackable() {
+    const char compressedData[8]{'\x01', '\x02', '\x03', '\x04', '\x05', '\x06', '\x07', '\x08'};
+    const Trade::ImageData2D images[]{
+        /* Not square */
+        image(PixelFormat::R8Unorm, {4, 2}, '\x11'),
+        /* Not power-of-two */
+        image(PixelFormat::R8Unorm, {3, 3}, '\x22'),
+        Trade::ImageData2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, Trade::DataFlags{}, compressedData},
+        image(PixelFormat::R8Unorm, {2, 2}, '\x33'),
+    };
+
+    const Trade::TextureData textures[]{
+        texture(SamplerWrapping::ClampToEdge, 0),
+        texture(SamplerWrapping::ClampToEdge, 1),
+        texture(SamplerWrapping::ClampToEdge, 2),
+        texture(SamplerWrapping::ClampToEdge, 3),
+    };
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::AmbientTexture, 0u},
+            {Trade::MaterialAttribute::DiffuseTexture, 1u},
+            {Trade::MaterialAttribute::NormalTexture, 2u},
+            {Trade::MaterialAttribute::SpecularTexture, 3u},
+        }},
+    };
+
+    Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> out = packTextureArrays(materials, textures, images);
+    CORRADE_VERIFY(out);
+
+    /* Each image that can't be packed is put into a single-layer array of its
+       own */
+    CORRADE_COMPARE(out->second().size(), 4);
+    CORRADE_COMPARE(out->third().size(), 4);
+    CORRADE_COMPARE(out->third()[0].size(), (Vector3i{4, 2, 1}));
+    CORRADE_COMPARE_AS(out->third()[0].data(), Containers::arrayView<char>({
+        '\x11', '\x11', '\x11', '\x11',
+        '\x11', '\x11', '\x11', '\x11',
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(out->third()[1].size(), (Vector3i{3, 3, 1}));
+    CORRADE_VERIFY(out->third()[2].isCompressed());
+    CORRADE_COMPARE(out->third()[2].compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(out->third()[2].size(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(out->third()[2].flags(), ImageFlag3D::Array);
+    CORRADE_COMPARE_AS(out->third()[2].data(),
+        Containers::arrayView(compressedData),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out->third()[3].size(), (Vector3i{2, 2, 1}));
+
+    CORRADE_COMPARE_AS(out->first()[0], (Trade::MaterialData{Trade::MaterialType::Phong, {
+        {Trade::MaterialAttribute::AmbientTexture, 0u},
+        {Trade::MaterialAttribute::AmbientTextureLayer, 0u},
+        {Trade::MaterialAttribute::DiffuseTexture, 1u},
+        {Trade::MaterialAttribute::DiffuseTextureLayer, 0u},
+        {Trade::MaterialAttribute::NormalTexture, 2u},
+        {Trade::MaterialAttribute::NormalTextureLayer, 0u},
+        {Trade::MaterialAttribute::SpecularTexture, 3u},
+        {Trade::MaterialAttribute::SpecularTextureLayer, 0u},
+    }}), DebugTools::CompareMaterial);
+}
+
+void PackTextureArraysTest::identityTextureMatrix() {
+    const Trade::ImageData2D images[]{
+        image(PixelFormat::R8Unorm, {2, 2}, '\x11'),
+    };
+
+    const Trade::TextureData textures[]{
+        texture(SamplerWrapping::ClampToEdge, 0),
+    };
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::Phong|Trade::MaterialType::PbrClearCoat, {
+            {Trade::MaterialAttribute::DiffuseTexture, 0u},
+            /* Explicit identity overriding the global matrix */
+            {Trade::MaterialAttribute::DiffuseTextureMatrix, Matrix3{}},
+            {Trade::MaterialAttribute::NormalTexture, 0u},
+            {Trade::MaterialAttribute::TextureMatrix, Matrix3::translation({0.25f, 0.0f})},
+            {Trade::MaterialLayer::ClearCoat},
+            {Trade::MaterialAttribute::LayerFactorTexture, 0u},
+            {Trade::MaterialAttribute::LayerFactorTextureMatrix, Matrix3{}},
+            {Trade::MaterialAttribute::TextureMatrix, Matrix3::translation({0.0f, 0.5f})},
+        }, {4, 8}},
+    };
+
+    Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> out = packTextureArrays(materials, textures, images);
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(out->third().size(), 1);
+    CORRADE_COMPARE(out->third()[0].size(), (Vector3i{2, 2, 1}));
+
+    /* The image covers the whole layer so the atlas transformation is an
+       identity. The explicit identity matrices have to be preserved, otherwise
+       the textures would pick up the global matrices instead. */
+    CORRADE_COMPARE(out->first().size(), 1);
+    CORRADE_COMPARE_AS(out->first()[0], (Trade::MaterialData{Trade::MaterialType::Phong|Trade::MaterialType::PbrClearCoat, {
+        {Trade::MaterialAttribute::DiffuseTexture, 0u},
+        {Trade::MaterialAttribute::DiffuseTextureLayer, 0u},
+        {Trade::MaterialAttribute::DiffuseTextureMatrix, Matrix3{}},
+        {Trade::MaterialAttribute::NormalTexture, 0u},
+        {Trade::MaterialAttribute::NormalTextureLayer, 0u},
+        {Trade::MaterialAttribute::NormalTextureMatrix, Matrix3::translation({0.25f, 0.0f})},
+        {Trade::MaterialAttribute::TextureMatrix, Matrix3::translation({0.25f, 0.0f})},
+        {Trade::MaterialLayer::ClearCoat},
+        {Trade::MaterialAttribute::LayerFactorTexture, 0u},
+        {Trade::MaterialAttribute::LayerFactorTextureLayer, 0u},
+        {Trade::MaterialAttribute::LayerFactorTextureMatrix, Matrix3{}},
+        {Trade::MaterialAttribute::TextureMatrix, Matrix3::translation({0.0f, 0.5f})},
+    }, {7, 12}}), DebugTools::CompareMaterial);
+}
+
+void PackTextureArraysTest::notTexture2D() {
+    const Trade::ImageData2D images[]{
+        image(PixelFormat::R8Unorm, {2, 2}, '\x11'),
+    };
+
+    const Trade::TextureData textures[]{
+        texture(SamplerWrapping::ClampToEdge, 0),
+        Trade::TextureData{Trade::TextureType::CubeMap, SamplerFilter::Linear, SamplerFilter::Linear, SamplerMipmap::Linear, SamplerWrapping::ClampToEdge, 0},
+    };
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::BaseColorTexture, 0u},
+        }},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::EmissiveTexture, 1u},
+        }},
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!packTextureArrays(materials, textures, images));
+    CORRADE_COMPARE(out.str(), "MaterialTools::packTextureArrays(): expected texture 1 to be Trade::TextureType::Texture2D but got Trade::TextureType::CubeMap\n");
+}
+
+void PackTextureArraysTest::textureOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::ImageData2D images[]{
+        image(PixelFormat::R8Unorm, {2, 2}, '\x11'),
+    };
+
+    const Trade::TextureData textures[]{
+        texture(SamplerWrapping::ClampToEdge, 0),
+        texture(SamplerWrapping::ClampToEdge, 0),
+    };
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::BaseColorTexture, 0u},
+        }},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialLayer::ClearCoat},
+            {Trade::MaterialAttribute::LayerFactorTexture, 2u},
+        }, {0, 2}},
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    packTextureArrays(materials, textures, images);
+    CORRADE_COMPARE(out.str(), "MaterialTools::packTextureArrays(): material 1 attribute LayerFactorTexture references texture 2 but got only 2 textures\n");
+}
+
+void PackTextureArraysTest::imageOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::ImageData2D images[]{
+        image(PixelFormat::R8Unorm, {2, 2}, '\x11'),
+    };
+
+    const Trade::TextureData textures[]{
+        texture(SamplerWrapping::ClampToEdge, 0),
+        texture(SamplerWrapping::ClampToEdge, 1),
+    };
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::BaseColorTexture, 0u},
+            {Trade::MaterialAttribute::EmissiveTexture, 1u},
+        }},
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    packTextureArrays(materials, textures, images);
+    CORRADE_COMPARE(out.str(), "MaterialTools::packTextureArrays(): texture 1 references image 1 but got only 1 images\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::PackTextureArraysTest)
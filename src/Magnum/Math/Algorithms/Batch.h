@@ -0,0 +1,165 @@
+#ifndef Magnum_Math_Algorithms_Batch_h
+#define Magnum_Math_Algorithms_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::svdInto(), @ref Magnum::Math::Algorithms::qrInto(), @ref Magnum::Math::Algorithms::gaussJordanInvertedInto(), @ref Magnum::Math::Algorithms::gramSchmidtOrthonormalizeInPlace(const Corrade::Containers::StridedArrayView1D<Matrix<size, T>>&)
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Math/Algorithms/Qr.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* Used to make the input views not participate in template argument
+   deduction, so views of derived types such as Matrix3 or Vector3 can be
+   passed there as well */
+template<class T> struct BatchNonDeduced { typedef T Type; };
+
+template<class T> inline const Matrix<3, T>& batchMatrix3x3(const Matrix<3, T>& matrix) { return matrix; }
+template<class T> inline Matrix<3, T> batchMatrix3x3(const Matrix4<T>& matrix) { return matrix.rotationScaling(); }
+
+template<class T, class U> void svdInto(const Containers::StridedArrayView1D<const U>& matrices, const Containers::StridedArrayView1D<Matrix<3, T>>& u, const Containers::StridedArrayView1D<Vector<3, T>>& w, const Containers::StridedArrayView1D<Matrix<3, T>>& v) {
+    CORRADE_ASSERT(u.size() == matrices.size() && w.size() == matrices.size() && v.size() == matrices.size(),
+        "Math::Algorithms::svdInto(): expected U, W and V views to have a size of" << matrices.size() << "but got" << u.size() << Utility::Debug::nospace << "," << w.size() << "and" << v.size(), );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i) {
+        const Containers::Triple<Matrix<3, T>, Vector<3, T>, Matrix<3, T>> uwv = svdJacobi(batchMatrix3x3(matrices[i]));
+        u[i] = uwv.first();
+        w[i] = uwv.second();
+        v[i] = uwv.third();
+    }
+}
+
+}
+
+/**
+@brief Batch Singular Value Decomposition of 3x3 matrices
+@param[in]  matrices    Input matrices
+@param[out] u           Where to put the @f$ \boldsymbol{U} @f$ matrices
+@param[out] w           Where to put diagonals of @f$ \boldsymbol{\Sigma} @f$
+@param[out] v           Where to put the non-transposed @f$ \boldsymbol{V} @f$
+    matrices
+@m_since_latest
+
+Performs @ref svdJacobi() on each matrix in @p matrices and puts the results
+into @p u, @p w and @p v, which are all expected to have the same size as
+@p matrices. As the decomposition is done with a fixed amount of work and
+without data-dependent branches, the loop can be reasonably well optimized by
+the compiler. The function has no internal state, so to spread the work
+across multiple threads, split the views into disjoint slices and process
+each in a separate thread.
+
+The scalar type is deduced from @p u. Views of types derived from
+@ref Matrix3x3 and @ref Vector3, such as @ref Matrix3, can be passed to
+@p matrices and @p w.
+@see @ref svd()
+*/
+template<class T> void svdInto(const Containers::StridedArrayView1D<const typename Implementation::BatchNonDeduced<Matrix<3, T>>::Type>& matrices, const Containers::StridedArrayView1D<Matrix<3, T>>& u, const Containers::StridedArrayView1D<typename Implementation::BatchNonDeduced<Vector<3, T>>::Type>& w, const Containers::StridedArrayView1D<Matrix<3, T>>& v) {
+    Implementation::svdInto(matrices, u, w, v);
+}
+
+/**
+@brief Batch Singular Value Decomposition of 3D transformation matrices
+@m_since_latest
+
+Same as above, but decomposes @ref Matrix4::rotationScaling() of each matrix
+in @p matrices, which is the common case for decomposing transformations.
+*/
+template<class T> void svdInto(const Containers::StridedArrayView1D<const typename Implementation::BatchNonDeduced<Matrix4<T>>::Type>& matrices, const Containers::StridedArrayView1D<Matrix<3, T>>& u, const Containers::StridedArrayView1D<typename Implementation::BatchNonDeduced<Vector<3, T>>::Type>& w, const Containers::StridedArrayView1D<Matrix<3, T>>& v) {
+    Implementation::svdInto(matrices, u, w, v);
+}
+
+/**
+@brief Batch QR decomposition
+@param[in]  matrices    Input matrices
+@param[out] q           Where to put the @f$ \boldsymbol{Q} @f$ matrices
+@param[out] r           Where to put the @f$ \boldsymbol{R} @f$ matrices
+@m_since_latest
+
+Performs @ref qr() on each matrix in @p matrices and puts the results into
+@p q and @p r, which are both expected to have the same size as
+@p matrices. The scalar type and matrix size is deduced from @p q. See
+@ref svdInto() for notes about multithreading.
+*/
+template<std::size_t size, class T> void qrInto(const Containers::StridedArrayView1D<const typename Implementation::BatchNonDeduced<Matrix<size, T>>::Type>& matrices, const Containers::StridedArrayView1D<Matrix<size, T>>& q, const Containers::StridedArrayView1D<typename Implementation::BatchNonDeduced<Matrix<size, T>>::Type>& r) {
+    CORRADE_ASSERT(q.size() == matrices.size() && r.size() == matrices.size(),
+        "Math::Algorithms::qrInto(): expected Q and R views to have a size of" << matrices.size() << "but got" << q.size() << "and" << r.size(), );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i) {
+        const Containers::Pair<Matrix<size, T>, Matrix<size, T>> qr = Algorithms::qr(matrices[i]);
+        q[i] = qr.first();
+        r[i] = qr.second();
+    }
+}
+
+/**
+@brief Batch Gauss-Jordan matrix inversion
+@param[in]  matrices    Input matrices
+@param[out] inverted    Where to put the inverted matrices
+@m_since_latest
+
+Performs @ref gaussJordanInverted() on each matrix in @p matrices and puts
+the results into @p inverted, which is expected to have the same size as
+@p matrices. Expects that all matrices are invertible. The scalar type and
+matrix size is deduced from @p inverted. See @ref svdInto() for notes about
+multithreading.
+*/
+template<std::size_t size, class T> void gaussJordanInvertedInto(const Containers::StridedArrayView1D<const typename Implementation::BatchNonDeduced<Matrix<size, T>>::Type>& matrices, const Containers::StridedArrayView1D<Matrix<size, T>>& inverted) {
+    CORRADE_ASSERT(inverted.size() == matrices.size(),
+        "Math::Algorithms::gaussJordanInvertedInto(): expected output view to have a size of" << matrices.size() << "but got" << inverted.size(), );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        inverted[i] = gaussJordanInverted(matrices[i]);
+}
+
+/**
+@brief Batch in-place Gram-Schmidt matrix orthonormalization
+@param[in,out] matrices Matrices to perform orthonormalization on
+@m_since_latest
+
+Performs @ref gramSchmidtOrthonormalizeInPlace(RectangularMatrix<cols, rows, T>&)
+on each matrix in @p matrices, useful for example for re-orthonormalizing
+tangent frames. The modified Gram-Schmidt process doesn't contain any
+data-dependent branches, so the loop can be reasonably well optimized by the
+compiler. See @ref svdInto() for notes about multithreading.
+*/
+template<std::size_t size, class T> void gramSchmidtOrthonormalizeInPlace(const Containers::StridedArrayView1D<Matrix<size, T>>& matrices) {
+    for(Matrix<size, T>& matrix: matrices)
+        gramSchmidtOrthonormalizeInPlace(matrix);
+}
+
+}}}
+
+#endif
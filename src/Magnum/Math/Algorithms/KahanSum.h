@@ -60,6 +60,10 @@ with some row padding or when the inputs are generated / converted from other
 values):
 
 @snippet MathAlgorithms.cpp kahanSum-iterative
+
+For large strided views, @ref Math::sum(const Containers::StridedArrayView1D<const Float>&)
+and related functions in @ref Magnum/Math/ReductionBatch.h provide a
+compensated and optionally multi-threaded alternative.
 */
 template<class Iterator, class T = typename std::decay<decltype(*std::declval<Iterator>())>::type> T kahanSum(Iterator begin, Iterator end, T sum = T(0), T* compensation = nullptr) {
     T c = compensation ? *compensation : T(0);
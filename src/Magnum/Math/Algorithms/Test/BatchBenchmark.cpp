@@ -0,0 +1,178 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Algorithms/Batch.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct BatchBenchmark: TestSuite::Tester {
+    explicit BatchBenchmark();
+
+    void svd();
+    void svdJacobi();
+    void svdInto();
+
+    void inverted();
+    void gaussJordanInverted();
+    void gaussJordanInvertedInto();
+
+    void gramSchmidtOrthonormalize();
+    void gramSchmidtOrthonormalizeInPlaceBatch();
+};
+
+using Magnum::Matrix3x3;
+using Magnum::Vector3;
+
+enum: std::size_t { Count = 10000 };
+
+BatchBenchmark::BatchBenchmark() {
+    addBenchmarks({&BatchBenchmark::svd,
+                   &BatchBenchmark::svdJacobi,
+                   &BatchBenchmark::svdInto,
+
+                   &BatchBenchmark::inverted,
+                   &BatchBenchmark::gaussJordanInverted,
+                   &BatchBenchmark::gaussJordanInvertedInto,
+
+                   &BatchBenchmark::gramSchmidtOrthonormalize,
+                   &BatchBenchmark::gramSchmidtOrthonormalizeInPlaceBatch}, 10);
+}
+
+/* Random well-conditioned matrices, default-seeded to have the results
+   reproducible */
+Containers::Array<Matrix3x3> matrices() {
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> d{-1.0f, 1.0f};
+    Containers::Array<Matrix3x3> out{NoInit, Count};
+    for(Matrix3x3& i: out) i =
+        Matrix3x3{Vector3{d(g), d(g), d(g)},
+                  Vector3{d(g), d(g), d(g)},
+                  Vector3{d(g), d(g), d(g)}} + Matrix3x3{IdentityInit, 3.0f};
+    return out;
+}
+
+void BatchBenchmark::svd() {
+    Containers::Array<Matrix3x3> input = matrices();
+    Containers::Array<Vector3> w{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != Count; ++i)
+            w[i] = Algorithms::svd(input[i])->second();
+    }
+
+    CORRADE_VERIFY(!w.front().isZero());
+}
+
+void BatchBenchmark::svdJacobi() {
+    Containers::Array<Matrix3x3> input = matrices();
+    Containers::Array<Vector3> w{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != Count; ++i)
+            w[i] = Algorithms::svdJacobi(input[i]).second();
+    }
+
+    CORRADE_VERIFY(!w.front().isZero());
+}
+
+void BatchBenchmark::svdInto() {
+    Containers::Array<Matrix3x3> input = matrices();
+    Containers::Array<Matrix3x3> u{NoInit, Count};
+    Containers::Array<Vector3> w{NoInit, Count};
+    Containers::Array<Matrix3x3> v{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        Algorithms::svdInto(Containers::stridedArrayView(input), Containers::stridedArrayView(u), Containers::stridedArrayView(w), Containers::stridedArrayView(v));
+    }
+
+    CORRADE_VERIFY(!w.front().isZero());
+}
+
+void BatchBenchmark::inverted() {
+    Containers::Array<Matrix3x3> input = matrices();
+    Containers::Array<Matrix3x3> out{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = input[i].inverted();
+    }
+
+    CORRADE_COMPARE(out.front()*input.front(), Matrix3x3{});
+}
+
+void BatchBenchmark::gaussJordanInverted() {
+    Containers::Array<Matrix3x3> input = matrices();
+    Containers::Array<Matrix3x3> out{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Algorithms::gaussJordanInverted(input[i]);
+    }
+
+    CORRADE_COMPARE(out.front()*input.front(), Matrix3x3{});
+}
+
+void BatchBenchmark::gaussJordanInvertedInto() {
+    Containers::Array<Matrix3x3> input = matrices();
+    Containers::Array<Matrix3x3> out{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        Algorithms::gaussJordanInvertedInto(Containers::stridedArrayView(input), Containers::stridedArrayView(out));
+    }
+
+    CORRADE_COMPARE(out.front()*input.front(), Matrix3x3{});
+}
+
+void BatchBenchmark::gramSchmidtOrthonormalize() {
+    Containers::Array<Matrix3x3> data = matrices();
+
+    CORRADE_BENCHMARK(1) {
+        for(Matrix3x3& i: data)
+            i = Algorithms::gramSchmidtOrthonormalize(i);
+    }
+
+    CORRADE_VERIFY(data.front().isOrthogonal());
+}
+
+void BatchBenchmark::gramSchmidtOrthonormalizeInPlaceBatch() {
+    Containers::Array<Matrix3x3> data = matrices();
+
+    CORRADE_BENCHMARK(1) {
+        Algorithms::gramSchmidtOrthonormalizeInPlace(Containers::stridedArrayView(data));
+    }
+
+    CORRADE_VERIFY(data.front().isOrthogonal());
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchBenchmark)
@@ -0,0 +1,212 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Algorithms/Batch.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct BatchTest: TestSuite::Tester {
+    explicit BatchTest();
+
+    void svdInto();
+    void svdIntoMatrix4();
+    void svdIntoInvalidSize();
+
+    void qrInto();
+    void qrIntoInvalidSize();
+
+    void gaussJordanInvertedInto();
+    void gaussJordanInvertedIntoInvalidSize();
+
+    void gramSchmidtOrthonormalizeInPlace();
+};
+
+using namespace Math::Literals;
+
+using Magnum::Matrix3;
+using Magnum::Matrix3x3;
+using Magnum::Matrix4;
+using Magnum::Vector3;
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::svdInto,
+              &BatchTest::svdIntoMatrix4,
+              &BatchTest::svdIntoInvalidSize,
+
+              &BatchTest::qrInto,
+              &BatchTest::qrIntoInvalidSize,
+
+              &BatchTest::gaussJordanInvertedInto,
+              &BatchTest::gaussJordanInvertedIntoInvalidSize,
+
+              &BatchTest::gramSchmidtOrthonormalizeInPlace});
+}
+
+const Matrix3 Matrices[]{
+    Matrix3::rotation(35.0_degf)*Matrix3::scaling({1.5f, 2.0f}),
+    Matrix3::scaling({1.5f, 2.0f})*Matrix3::rotation(-60.0_degf),
+    Matrix3{Vector3{2.0f, -1.0f, 0.5f},
+            Vector3{0.5f, 3.0f, -1.0f},
+            Vector3{1.0f, 0.0f, 1.5f}},
+};
+
+void BatchTest::svdInto() {
+    /* Interleaved output to test strides */
+    struct Output {
+        Matrix3x3 u;
+        Vector3 w;
+        Matrix3x3 v;
+    } out[Containers::arraySize(Matrices)];
+    Containers::StridedArrayView1D<Matrix3x3> u = Containers::stridedArrayView(out).slice(&Output::u);
+    Containers::StridedArrayView1D<Vector3> w = Containers::stridedArrayView(out).slice(&Output::w);
+    Containers::StridedArrayView1D<Matrix3x3> v = Containers::stridedArrayView(out).slice(&Output::v);
+
+    /* Passing a Matrix3 view is allowed because it's a Matrix3x3 subclass */
+    Algorithms::svdInto(Containers::stridedArrayView(Matrices), u, w, v);
+
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Triple<Matrix3x3, Vector3, Matrix3x3> expected{svdJacobi(Matrices[i])};
+        CORRADE_COMPARE(u[i], expected.first());
+        CORRADE_COMPARE(w[i], expected.second());
+        CORRADE_COMPARE(v[i], expected.third());
+        CORRADE_COMPARE(u[i]*Matrix3x3::fromDiagonal(w[i])*v[i].transposed(), Matrices[i]);
+    }
+}
+
+void BatchTest::svdIntoMatrix4() {
+    const Matrix4 matrices[]{
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(35.0_degf)*Matrix4::scaling({1.5f, 2.0f, 1.0f}),
+        Matrix4::scaling({1.5f, 2.0f, 1.0f})*Matrix4::rotationX(-60.0_degf),
+    };
+
+    Matrix3x3 u[2];
+    Vector3 w[2];
+    Matrix3x3 v[2];
+    Algorithms::svdInto(Containers::stridedArrayView(matrices), Containers::stridedArrayView(u), Containers::stridedArrayView(w), Containers::stridedArrayView(v));
+
+    /* Translation is ignored */
+    CORRADE_COMPARE(w[0], (Vector3{2.0f, 1.5f, 1.0f}));
+    CORRADE_COMPARE(u[0]*v[0].transposed(), Matrix4::rotationZ(35.0_degf).rotationScaling());
+    CORRADE_COMPARE(w[1], (Vector3{2.0f, 1.5f, 1.0f}));
+    CORRADE_COMPARE(u[1]*v[1].transposed(), Matrix4::rotationX(-60.0_degf).rotationScaling());
+}
+
+void BatchTest::svdIntoInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Matrix3x3 matrices[3];
+    Matrix3x3 u[3];
+    Vector3 w[3];
+    Matrix3x3 v[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Algorithms::svdInto(Containers::stridedArrayView(matrices), Containers::stridedArrayView(u).exceptSuffix(1), Containers::stridedArrayView(w), Containers::stridedArrayView(v));
+    Algorithms::svdInto(Containers::stridedArrayView(matrices), Containers::stridedArrayView(u), Containers::stridedArrayView(w).exceptSuffix(1), Containers::stridedArrayView(v));
+    Algorithms::svdInto(Containers::stridedArrayView(matrices), Containers::stridedArrayView(u), Containers::stridedArrayView(w), Containers::stridedArrayView(v).exceptSuffix(1));
+    CORRADE_COMPARE(out.str(),
+        "Math::Algorithms::svdInto(): expected U, W and V views to have a size of 3 but got 2, 3 and 3\n"
+        "Math::Algorithms::svdInto(): expected U, W and V views to have a size of 3 but got 3, 2 and 3\n"
+        "Math::Algorithms::svdInto(): expected U, W and V views to have a size of 3 but got 3, 3 and 2\n");
+}
+
+void BatchTest::qrInto() {
+    Matrix3x3 q[Containers::arraySize(Matrices)];
+    Matrix3x3 r[Containers::arraySize(Matrices)];
+    Algorithms::qrInto(Containers::stridedArrayView(Matrices), Containers::stridedArrayView(q), Containers::stridedArrayView(r));
+
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Pair<Matrix3x3, Matrix3x3> expected = qr(Matrix3x3{Matrices[i]});
+        CORRADE_COMPARE(q[i], expected.first());
+        CORRADE_COMPARE(r[i], expected.second());
+        CORRADE_COMPARE(q[i]*r[i], Matrices[i]);
+    }
+}
+
+void BatchTest::qrIntoInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Matrix3x3 matrices[3];
+    Matrix3x3 q[3];
+    Matrix3x3 r[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Algorithms::qrInto(Containers::stridedArrayView(matrices), Containers::stridedArrayView(q), Containers::stridedArrayView(r));
+    CORRADE_COMPARE(out.str(),
+        "Math::Algorithms::qrInto(): expected Q and R views to have a size of 3 but got 3 and 2\n");
+}
+
+void BatchTest::gaussJordanInvertedInto() {
+    Matrix3x3 inverted[Containers::arraySize(Matrices)];
+    Algorithms::gaussJordanInvertedInto(Containers::stridedArrayView(Matrices), Containers::stridedArrayView(inverted));
+
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(inverted[i], Matrices[i].inverted());
+    }
+}
+
+void BatchTest::gaussJordanInvertedIntoInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Matrix3x3 matrices[3];
+    Matrix3x3 inverted[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Algorithms::gaussJordanInvertedInto(Containers::stridedArrayView(matrices), Containers::stridedArrayView(inverted));
+    CORRADE_COMPARE(out.str(),
+        "Math::Algorithms::gaussJordanInvertedInto(): expected output view to have a size of 3 but got 4\n");
+}
+
+void BatchTest::gramSchmidtOrthonormalizeInPlace() {
+    Matrix3x3 matrices[Containers::arraySize(Matrices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i)
+        matrices[i] = Matrices[i];
+
+    /* Every second item to test strides */
+    Algorithms::gramSchmidtOrthonormalizeInPlace(Containers::stridedArrayView(matrices).every(2));
+
+    CORRADE_COMPARE(matrices[0], gramSchmidtOrthonormalize(Matrix3x3{Matrices[0]}));
+    CORRADE_VERIFY(matrices[0].isOrthogonal());
+    CORRADE_COMPARE(matrices[1], Matrices[1]);
+    CORRADE_VERIFY(!matrices[1].isOrthogonal());
+    CORRADE_COMPARE(matrices[2], gramSchmidtOrthonormalize(Matrix3x3{Matrices[2]}));
+    CORRADE_VERIFY(matrices[2].isOrthogonal());
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchTest)
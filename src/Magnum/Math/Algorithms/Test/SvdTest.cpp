@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <random>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Algorithms/Svd.h"
@@ -36,6 +38,13 @@ struct SvdTest: TestSuite::Tester {
     template<class T> void test();
     void decomposeRotationScaling();
     void decomposeRotationShear();
+
+    template<class T> void jacobi();
+    void jacobiReflection();
+    void jacobiRankDeficient();
+    void jacobiZero();
+    template<class T> void jacobiAccuracy();
+    void jacobiDecomposeRotationShear();
 };
 
 template<class T> using Matrix5x8 = RectangularMatrix<5, 8, T>;
@@ -48,7 +57,16 @@ SvdTest::SvdTest() {
     addTests({&SvdTest::test<Float>,
               &SvdTest::test<Double>,
               &SvdTest::decomposeRotationScaling,
-              &SvdTest::decomposeRotationShear});
+              &SvdTest::decomposeRotationShear,
+
+              &SvdTest::jacobi<Float>,
+              &SvdTest::jacobi<Double>,
+              &SvdTest::jacobiReflection,
+              &SvdTest::jacobiRankDeficient,
+              &SvdTest::jacobiZero,
+              &SvdTest::jacobiAccuracy<Float>,
+              &SvdTest::jacobiAccuracy<Double>,
+              &SvdTest::jacobiDecomposeRotationShear});
 }
 
 template<class T> void SvdTest::test() {
@@ -133,6 +151,138 @@ void SvdTest::decomposeRotationShear() {
     CORRADE_COMPARE(Matrix4::from(uwv.first()*uwv.third().transposed(), {}), Matrix4::rotationZ(35.0_degf));
 }
 
+template<class T> void SvdTest::jacobi() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3x3<T> a{
+        Vector<3, T>{T(2.0), T(-1.0), T( 0.5)},
+        Vector<3, T>{T(0.5), T( 3.0), T(-1.0)},
+        Vector<3, T>{T(1.0), T( 0.0), T( 1.5)}};
+
+    Containers::Triple<Matrix3x3<T>, Vector<3, T>, Matrix3x3<T>> uwv = Algorithms::svdJacobi(a);
+
+    /* Test composition */
+    CORRADE_COMPARE(uwv.first()*Matrix3x3<T>::fromDiagonal(uwv.second())*uwv.third().transposed(), a);
+
+    /* Both U and V are rotations */
+    CORRADE_VERIFY(uwv.first().isOrthogonal());
+    CORRADE_VERIFY(uwv.third().isOrthogonal());
+    CORRADE_COMPARE(uwv.first().determinant(), T(1.0));
+    CORRADE_COMPARE(uwv.third().determinant(), T(1.0));
+
+    /* The singular values are sorted and match the generic implementation,
+       which doesn't sort them */
+    Containers::Optional<Containers::Triple<Matrix3x3<T>, Vector<3, T>, Matrix3x3<T>>> expected = Algorithms::svd(a);
+    CORRADE_VERIFY(expected);
+    Vector<3, T> expectedW = expected->second();
+    if(expectedW[0] < expectedW[1]) std::swap(expectedW[0], expectedW[1]);
+    if(expectedW[0] < expectedW[2]) std::swap(expectedW[0], expectedW[2]);
+    if(expectedW[1] < expectedW[2]) std::swap(expectedW[1], expectedW[2]);
+    CORRADE_COMPARE(uwv.second(), expectedW);
+}
+
+void SvdTest::jacobiReflection() {
+    using Magnum::Matrix3x3;
+    using Magnum::Vector3;
+
+    /* The determinant is negative, so the smallest singular value is
+       negative in order to have both U and V rotations */
+    Matrix3x3 a = Matrix3x3::fromDiagonal({2.0f, -3.0f, 1.0f});
+
+    Containers::Triple<Matrix3x3, Vector3, Matrix3x3> uwv{Algorithms::svdJacobi(a)};
+    CORRADE_COMPARE(uwv.second(), (Vector3{3.0f, 2.0f, -1.0f}));
+    CORRADE_COMPARE(uwv.first()*Matrix3x3::fromDiagonal(uwv.second())*uwv.third().transposed(), a);
+    CORRADE_COMPARE(uwv.first().determinant(), 1.0f);
+    CORRADE_COMPARE(uwv.third().determinant(), 1.0f);
+}
+
+void SvdTest::jacobiRankDeficient() {
+    using Magnum::Matrix3x3;
+    using Magnum::Vector3;
+
+    /* Third column is a multiple of the first */
+    Matrix3x3 a{Vector3{1.0f, 2.0f, -1.0f},
+                Vector3{0.5f, 0.0f, 3.0f},
+                Vector3{2.0f, 4.0f, -2.0f}};
+
+    Containers::Triple<Matrix3x3, Vector3, Matrix3x3> uwv{Algorithms::svdJacobi(a)};
+    CORRADE_COMPARE(uwv.first()*Matrix3x3::fromDiagonal(uwv.second())*uwv.third().transposed(), a);
+    CORRADE_COMPARE(uwv.second()[2], 0.0f);
+    CORRADE_VERIFY(uwv.first().isOrthogonal());
+    CORRADE_VERIFY(uwv.third().isOrthogonal());
+}
+
+void SvdTest::jacobiZero() {
+    using Magnum::Matrix3x3;
+    using Magnum::Vector3;
+
+    /* Shouldn't produce any NaNs */
+    Containers::Triple<Matrix3x3, Vector3, Matrix3x3> uwv{Algorithms::svdJacobi(Matrix3x3{Math::ZeroInit})};
+    CORRADE_COMPARE(uwv.second(), Vector3{});
+    CORRADE_VERIFY(uwv.first().isOrthogonal());
+    CORRADE_VERIFY(uwv.third().isOrthogonal());
+}
+
+template<class T> void SvdTest::jacobiAccuracy() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Default-seeded to have the test reproducible */
+    std::mt19937 g;
+    std::uniform_real_distribution<T> d{T(-1.0), T(1.0)};
+
+    T maxReconstructionError{}, maxOrthogonalityError{};
+    for(std::size_t i = 0; i != 10000; ++i) {
+        Matrix3x3<T> a{
+            Vector<3, T>{d(g), d(g), d(g)},
+            Vector<3, T>{d(g), d(g), d(g)},
+            Vector<3, T>{d(g), d(g), d(g)}};
+        /* Make every fifth matrix singular */
+        if(i % 5 == 0) a[2] = a[0]*d(g);
+
+        Containers::Triple<Matrix3x3<T>, Vector<3, T>, Matrix3x3<T>> uwv = Algorithms::svdJacobi(a);
+
+        const Matrix3x3<T> reconstructed = uwv.first()*Matrix3x3<T>::fromDiagonal(uwv.second())*uwv.third().transposed();
+        const Matrix3x3<T> uu = uwv.first().transposed()*uwv.first();
+        const Matrix3x3<T> vv = uwv.third().transposed()*uwv.third();
+        for(std::size_t col = 0; col != 3; ++col) for(std::size_t row = 0; row != 3; ++row) {
+            const T identity = col == row ? T(1.0) : T(0.0);
+            maxReconstructionError = Math::max(maxReconstructionError, std::abs(reconstructed[col][row] - a[col][row]));
+            maxOrthogonalityError = Math::max(maxOrthogonalityError, std::abs(uu[col][row] - identity));
+            maxOrthogonalityError = Math::max(maxOrthogonalityError, std::abs(vv[col][row] - identity));
+        }
+
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(uwv.second()[0], std::abs(uwv.second()[1]),
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE_AS(std::abs(uwv.second()[1]), std::abs(uwv.second()[2]),
+            TestSuite::Compare::GreaterOrEqual);
+    }
+
+    CORRADE_INFO("Max reconstruction error:" << maxReconstructionError << Debug::newline << "        Max orthogonality error:" << maxOrthogonalityError);
+    CORRADE_COMPARE_AS(maxReconstructionError, T(10.0)*TypeTraits<T>::epsilon(),
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(maxOrthogonalityError, T(10.0)*TypeTraits<T>::epsilon(),
+        TestSuite::Compare::Less);
+}
+
+void SvdTest::jacobiDecomposeRotationShear() {
+    using Magnum::Matrix4;
+    using Magnum::Matrix3x3;
+    using Magnum::Vector3;
+
+    using namespace Math::Literals;
+
+    /* Compared to decomposeRotationShear(), both U and V are rotations,
+       which means U*V^T is the polar decomposition rotation directly without
+       having to fix any signs. The singular values are sorted. */
+    Matrix4 a = Matrix4::scaling({1.5f, 2.0f, 1.0f})*Matrix4::rotationZ(35.0_degf);
+
+    Containers::Triple<Matrix3x3, Vector3, Matrix3x3> uwv{Algorithms::svdJacobi(a.rotationScaling())};
+    CORRADE_COMPARE(uwv.first()*Matrix3x3::fromDiagonal(uwv.second())*uwv.third().transposed(), a.rotationScaling());
+    CORRADE_COMPARE(uwv.second(), (Vector3{2.0f, 1.5f, 1.0f}));
+    CORRADE_COMPARE(Matrix4::from(uwv.first()*uwv.third().transposed(), {}), Matrix4::rotationZ(35.0_degf));
+}
+
 }}}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdTest)
@@ -0,0 +1,204 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ReductionBatch.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* The result depends only on these two and not on the thread count, which
+   is what makes the reductions reproducible. The block size is a multiple of
+   the lane count so each element always ends up in the same lane. */
+constexpr std::size_t BlockSize = 4096;
+constexpr std::size_t LaneCount = 4;
+
+/* Compensated sum, the true value is sum + compensation */
+template<class T> struct Sum {
+    T sum;
+    T compensation;
+};
+
+/* Knuth's branchless TwoSum, which unlike Kahan's original algorithm works
+   also when the addend is larger than the sum */
+template<class T> inline void add(Sum<T>& a, const T& value) {
+    const T t = a.sum + value;
+    const T z = t - a.sum;
+    a.compensation += (a.sum - (t - z)) + (value - z);
+    a.sum = t;
+}
+
+template<class T> inline void add(Sum<T>& a, const Sum<T>& b) {
+    add(a, b.sum);
+    a.compensation += b.compensation;
+}
+
+/* Welford's online mean and variance, m2 is the sum of squared differences
+   from the mean */
+template<class T> struct Welford {
+    std::size_t count;
+    T mean;
+    T m2;
+};
+
+template<class S, class T> inline void add(Welford<T>& a, const T& value) {
+    ++a.count;
+    const T delta = value - a.mean;
+    a.mean += delta/S(a.count);
+    a.m2 += delta*(value - a.mean);
+}
+
+/* Chan et al. parallel combination of two partial results */
+template<class S, class T> inline void add(Welford<T>& a, const Welford<T>& b) {
+    if(!b.count) return;
+    if(!a.count) {
+        a = b;
+        return;
+    }
+
+    const std::size_t count = a.count + b.count;
+    const T delta = b.mean - a.mean;
+    a.mean += delta*(S(b.count)/S(count));
+    a.m2 += b.m2 + delta*delta*(S(a.count)*S(b.count)/S(count));
+    a.count = count;
+}
+
+inline Float dotProduct(const Float a, const Float b) { return a*b; }
+inline Double dotProduct(const Double a, const Double b) { return a*b; }
+template<std::size_t size, class T> inline T dotProduct(const Vector<size, T>& a, const Vector<size, T>& b) { return Math::dot(a, b); }
+
+/* Reduces each block with the reduce function, distributing the blocks
+   across the global thread pool, and returns the per-block results in
+   order */
+template<class Result, class State> Containers::Array<Result> reduceBlocks(const std::size_t count, Result(*const reduce)(const State&, std::size_t, std::size_t), const State& state) {
+    const std::size_t blockCount = (count + BlockSize - 1)/BlockSize;
+    Containers::Array<Result> results{ValueInit, blockCount};
+    ThreadPool::global().parallelFor(blockCount, 1, [&](const std::size_t blockBegin, const std::size_t blockEnd) {
+        for(std::size_t i = blockBegin; i != blockEnd; ++i)
+            results[i] = reduce(state, i*BlockSize, Math::min((i + 1)*BlockSize, count));
+    });
+    return results;
+}
+
+template<class T> Sum<T> sumBlock(const Containers::StridedArrayView1D<const T>& values, const std::size_t begin, const std::size_t end) {
+    Sum<T> lanes[LaneCount]{};
+    for(std::size_t i = begin; i != end; ++i)
+        add(lanes[i % LaneCount], values[i]);
+
+    /* Combine the lanes pairwise in a fixed order */
+    add(lanes[0], lanes[1]);
+    add(lanes[2], lanes[3]);
+    add(lanes[0], lanes[2]);
+    return lanes[0];
+}
+
+template<class T> Sum<T> sumImplementation(const Containers::StridedArrayView1D<const T>& values) {
+    Sum<T> out{};
+    for(const Sum<T>& block: reduceBlocks(values.size(), sumBlock<T>, values))
+        add(out, block);
+    return out;
+}
+
+template<class S, class T> struct DotState {
+    Containers::StridedArrayView1D<const T> a;
+    Containers::StridedArrayView1D<const T> b;
+};
+
+template<class S, class T> Sum<S> dotBlock(const DotState<S, T>& state, const std::size_t begin, const std::size_t end) {
+    Sum<S> lanes[LaneCount]{};
+    for(std::size_t i = begin; i != end; ++i)
+        add(lanes[i % LaneCount], dotProduct(state.a[i], state.b[i]));
+
+    add(lanes[0], lanes[1]);
+    add(lanes[2], lanes[3]);
+    add(lanes[0], lanes[2]);
+    return lanes[0];
+}
+
+template<class S, class T> S dotImplementation(const Containers::StridedArrayView1D<const T>& a, const Containers::StridedArrayView1D<const T>& b) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::dot(): expected views to have the same size but got" << a.size() << "and" << b.size(), {});
+
+    Sum<S> out{};
+    for(const Sum<S>& block: reduceBlocks(a.size(), dotBlock<S, T>, DotState<S, T>{a, b}))
+        add(out, block);
+    return out.sum + out.compensation;
+}
+
+template<class S, class T> Welford<T> meanVarianceBlock(const Containers::StridedArrayView1D<const T>& values, const std::size_t begin, const std::size_t end) {
+    Welford<T> lanes[LaneCount]{};
+    for(std::size_t i = begin; i != end; ++i)
+        add<S>(lanes[i % LaneCount], values[i]);
+
+    add<S>(lanes[0], lanes[1]);
+    add<S>(lanes[2], lanes[3]);
+    add<S>(lanes[0], lanes[2]);
+    return lanes[0];
+}
+
+template<class S, class T> Containers::Pair<T, T> meanVarianceImplementation(const Containers::StridedArrayView1D<const T>& values) {
+    Welford<T> out{};
+    for(const Welford<T>& block: reduceBlocks(values.size(), meanVarianceBlock<S, T>, values))
+        add<S>(out, block);
+    if(!out.count) return {};
+    return {out.mean, out.m2/S(out.count)};
+}
+
+}
+
+#define MAGNUM_REDUCTION_IMPLEMENTATION(S, T)                               \
+    T sum(const Containers::StridedArrayView1D<const T>& values) {          \
+        const Sum<T> out = sumImplementation(values);                       \
+        return out.sum + out.compensation;                                  \
+    }                                                                       \
+    S dot(const Containers::StridedArrayView1D<const T>& a, const Containers::StridedArrayView1D<const T>& b) { \
+        return dotImplementation<S>(a, b);                                  \
+    }                                                                       \
+    T mean(const Containers::StridedArrayView1D<const T>& values) {         \
+        if(values.isEmpty()) return {};                                     \
+        const Sum<T> out = sumImplementation(values);                       \
+        return (out.sum + out.compensation)/S(values.size());               \
+    }                                                                       \
+    Containers::Pair<T, T> meanVariance(const Containers::StridedArrayView1D<const T>& values) { \
+        return meanVarianceImplementation<S>(values);                       \
+    }
+MAGNUM_REDUCTION_IMPLEMENTATION(Float, Float)
+MAGNUM_REDUCTION_IMPLEMENTATION(Double, Double)
+MAGNUM_REDUCTION_IMPLEMENTATION(Float, Vector2<Float>)
+MAGNUM_REDUCTION_IMPLEMENTATION(Float, Vector3<Float>)
+MAGNUM_REDUCTION_IMPLEMENTATION(Float, Vector4<Float>)
+MAGNUM_REDUCTION_IMPLEMENTATION(Double, Vector2<Double>)
+MAGNUM_REDUCTION_IMPLEMENTATION(Double, Vector3<Double>)
+MAGNUM_REDUCTION_IMPLEMENTATION(Double, Vector4<Double>)
+#undef MAGNUM_REDUCTION_IMPLEMENTATION
+
+}}
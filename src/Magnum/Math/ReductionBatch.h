@@ -0,0 +1,291 @@
+#ifndef Magnum_Math_ReductionBatch_h
+#define Magnum_Math_ReductionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::sum(), @ref Magnum::Math::dot(const Corrade::Containers::StridedArrayView1D<const Float>&, const Corrade::Containers::StridedArrayView1D<const Float>&), @ref Magnum::Math::mean(), @ref Magnum::Math::meanVariance()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch reduction functions
+
+These functions reduce an unbounded range of values to a single value, with
+compensation for floating-point roundoff error and spreading the work across
+threads of the @ref ThreadPool::global() "global thread pool".
+
+The input is split into fixed-size blocks, each of which is reduced using
+four independent compensated accumulators interleaved over the elements.
+That shortens the dependency chains and allows the compiler to make use of
+SIMD units. The per-block results are then combined in a fixed order.
+Because the block size doesn't depend on the thread count, the threads only
+decide which blocks get processed where, and the result is bit-exact for any
+@ref ThreadPool configuration.
+
+The compensation relies on strict IEEE 754 floating-point semantics and thus
+won't have any effect if the code is compiled with `-ffast-math` or
+equivalent.
+*/
+
+/**
+@brief Compensated sum of a range of values
+@param values       Values to sum
+@m_since_latest
+
+Compared to a plain loop or @ref Algorithms::kahanSum() the sum is processed
+in blocks and combined in a deterministic order as described above,
+resulting in a significantly lower error for large inputs while being
+reproducible for any thread count. Vector types are summed component-wise.
+If @p values is empty, returns zero.
+@see @ref mean()
+*/
+MAGNUM_EXPORT Float sum(const Containers::StridedArrayView1D<const Float>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double sum(const Containers::StridedArrayView1D<const Double>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector2<Float> sum(const Containers::StridedArrayView1D<const Vector2<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector3<Float> sum(const Containers::StridedArrayView1D<const Vector3<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector4<Float> sum(const Containers::StridedArrayView1D<const Vector4<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector2<Double> sum(const Containers::StridedArrayView1D<const Vector2<Double>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector3<Double> sum(const Containers::StridedArrayView1D<const Vector3<Double>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector4<Double> sum(const Containers::StridedArrayView1D<const Vector4<Double>>& values);
+
+/**
+@brief Compensated dot product of two ranges of values
+@param a            First range
+@param b            Second range
+@m_since_latest
+
+Calculates a compensated sum of @f$ a_i b_i @f$, or of
+@f$ \boldsymbol{a}_i \cdot \boldsymbol{b}_i @f$ for vector types, in the
+same way as @ref sum(). Expects that both ranges have the same size. If the
+ranges are empty, returns zero.
+*/
+MAGNUM_EXPORT Float dot(const Containers::StridedArrayView1D<const Float>& a, const Containers::StridedArrayView1D<const Float>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double dot(const Containers::StridedArrayView1D<const Double>& a, const Containers::StridedArrayView1D<const Double>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Float dot(const Containers::StridedArrayView1D<const Vector2<Float>>& a, const Containers::StridedArrayView1D<const Vector2<Float>>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Float dot(const Containers::StridedArrayView1D<const Vector3<Float>>& a, const Containers::StridedArrayView1D<const Vector3<Float>>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Float dot(const Containers::StridedArrayView1D<const Vector4<Float>>& a, const Containers::StridedArrayView1D<const Vector4<Float>>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double dot(const Containers::StridedArrayView1D<const Vector2<Double>>& a, const Containers::StridedArrayView1D<const Vector2<Double>>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double dot(const Containers::StridedArrayView1D<const Vector3<Double>>& a, const Containers::StridedArrayView1D<const Vector3<Double>>& b);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double dot(const Containers::StridedArrayView1D<const Vector4<Double>>& a, const Containers::StridedArrayView1D<const Vector4<Double>>& b);
+
+/**
+@brief Mean of a range of values
+@param values       Values to calculate the mean of
+@m_since_latest
+
+Calculates @ref sum() of @p values divided by their count. Vector types are
+processed component-wise. If @p values is empty, returns zero.
+@see @ref meanVariance()
+*/
+MAGNUM_EXPORT Float mean(const Containers::StridedArrayView1D<const Float>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double mean(const Containers::StridedArrayView1D<const Double>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector2<Float> mean(const Containers::StridedArrayView1D<const Vector2<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector3<Float> mean(const Containers::StridedArrayView1D<const Vector3<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector4<Float> mean(const Containers::StridedArrayView1D<const Vector4<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector2<Double> mean(const Containers::StridedArrayView1D<const Vector2<Double>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector3<Double> mean(const Containers::StridedArrayView1D<const Vector3<Double>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Vector4<Double> mean(const Containers::StridedArrayView1D<const Vector4<Double>>& values);
+
+/**
+@brief Mean and variance of a range of values
+@param values       Values to calculate the mean and variance of
+@m_since_latest
+
+Uses [Welford's online algorithm](https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford's_online_algorithm),
+with partial results from the lanes and blocks combined using the parallel
+algorithm by Chan et al. Compared to calculating the variance from a sum of
+squares it doesn't suffer from catastrophic cancellation. Returns the mean
+and the population variance, to get the sample variance multiply it by
+@f$ \frac{n}{n - 1} @f$. Vector types are processed component-wise. If
+@p values is empty, returns zeros.
+@see @ref mean()
+*/
+MAGNUM_EXPORT Containers::Pair<Float, Float> meanVariance(const Containers::StridedArrayView1D<const Float>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Double, Double> meanVariance(const Containers::StridedArrayView1D<const Double>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Vector2<Float>, Vector2<Float>> meanVariance(const Containers::StridedArrayView1D<const Vector2<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Vector3<Float>, Vector3<Float>> meanVariance(const Containers::StridedArrayView1D<const Vector3<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Vector4<Float>, Vector4<Float>> meanVariance(const Containers::StridedArrayView1D<const Vector4<Float>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Vector2<Double>, Vector2<Double>> meanVariance(const Containers::StridedArrayView1D<const Vector2<Double>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Vector3<Double>, Vector3<Double>> meanVariance(const Containers::StridedArrayView1D<const Vector3<Double>>& values);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Containers::Pair<Vector4<Double>, Vector4<Double>> meanVariance(const Containers::StridedArrayView1D<const Vector4<Double>>& values);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
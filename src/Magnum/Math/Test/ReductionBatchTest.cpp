@@ -0,0 +1,260 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/ReductionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct ReductionBatchTest: TestSuite::Tester {
+    explicit ReductionBatchTest();
+
+    template<class T> void sum();
+    void sumVector();
+    void sumEmpty();
+    void sumStrided();
+    void sumCompensated();
+
+    template<class T> void dot();
+    void dotVector();
+    void dotInvalidSize();
+
+    template<class T> void mean();
+    void meanVector();
+    void meanEmpty();
+
+    template<class T> void meanVariance();
+    void meanVarianceVector();
+    void meanVarianceEmpty();
+    void meanVarianceStable();
+
+    void workerCountReproducible();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt workerCount;
+} SumCompensatedData[]{
+    {"", 0},
+    {"two workers", 2},
+    {"seven workers", 7}
+};
+
+ReductionBatchTest::ReductionBatchTest() {
+    addTests<ReductionBatchTest>({
+        &ReductionBatchTest::sum<Float>,
+        &ReductionBatchTest::sum<Double>,
+        &ReductionBatchTest::sumVector,
+        &ReductionBatchTest::sumEmpty,
+        &ReductionBatchTest::sumStrided});
+
+    addInstancedTests({&ReductionBatchTest::sumCompensated},
+        Containers::arraySize(SumCompensatedData));
+
+    addTests<ReductionBatchTest>({
+        &ReductionBatchTest::dot<Float>,
+        &ReductionBatchTest::dot<Double>,
+        &ReductionBatchTest::dotVector,
+        &ReductionBatchTest::dotInvalidSize,
+
+        &ReductionBatchTest::mean<Float>,
+        &ReductionBatchTest::mean<Double>,
+        &ReductionBatchTest::meanVector,
+        &ReductionBatchTest::meanEmpty,
+
+        &ReductionBatchTest::meanVariance<Float>,
+        &ReductionBatchTest::meanVariance<Double>,
+        &ReductionBatchTest::meanVarianceVector,
+        &ReductionBatchTest::meanVarianceEmpty,
+        &ReductionBatchTest::meanVarianceStable,
+
+        &ReductionBatchTest::workerCountReproducible});
+}
+
+template<class T> void ReductionBatchTest::sum() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const T values[]{T(1.0), T(-2.5), T(3.25), T(4.0), T(0.75)};
+    CORRADE_COMPARE(Math::sum(Containers::stridedArrayView(values)), T(6.5));
+}
+
+void ReductionBatchTest::sumVector() {
+    const Vector3<Float> values[]{
+        {1.0f, 2.0f, -3.0f},
+        {0.5f, -1.0f, 4.0f},
+        {2.0f, 0.25f, 1.0f}
+    };
+    CORRADE_COMPARE(Math::sum(Containers::stridedArrayView(values)), (Vector3<Float>{3.5f, 1.25f, 2.0f}));
+}
+
+void ReductionBatchTest::sumEmpty() {
+    CORRADE_COMPARE(Math::sum(Containers::StridedArrayView1D<const Float>{}), 0.0f);
+    CORRADE_COMPARE(Math::sum(Containers::StridedArrayView1D<const Vector4<Double>>{}), Vector4<Double>{});
+}
+
+void ReductionBatchTest::sumStrided() {
+    const Float values[]{1.0f, 100.0f, 2.0f, 100.0f, 3.0f, 100.0f};
+    CORRADE_COMPARE(Math::sum(Containers::stridedArrayView(values).every(2)), 6.0f);
+}
+
+void ReductionBatchTest::sumCompensated() {
+    auto&& data = SumCompensatedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A naive float sum would stay at 1.0 as every addend is below the
+       precision of the sum */
+    Containers::Array<Float> values{DirectInit, 1000001, 1.0e-8f};
+    values[0] = 1.0f;
+
+    Float naive = 0.0f;
+    for(Float i: values) naive += i;
+    CORRADE_COMPARE(naive, 1.0f);
+
+    ThreadPool pool{data.workerCount};
+    ThreadPool::setGlobal(&pool);
+    const Float sum = Math::sum(Containers::stridedArrayView(values));
+    ThreadPool::setGlobal(nullptr);
+
+    CORRADE_COMPARE(sum, 1.01f);
+}
+
+template<class T> void ReductionBatchTest::dot() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const T a[]{T(1.0), T(2.0), T(-3.0)};
+    const T b[]{T(4.0), T(0.5), T(2.0)};
+    CORRADE_COMPARE(Math::dot(Containers::stridedArrayView(a), Containers::stridedArrayView(b)), T(-1.0));
+}
+
+void ReductionBatchTest::dotVector() {
+    const Vector2<Double> a[]{{1.0, 2.0}, {-3.0, 0.5}};
+    const Vector2<Double> b[]{{4.0, 0.5}, {2.0, 2.0}};
+    CORRADE_COMPARE(Math::dot(Containers::stridedArrayView(a), Containers::stridedArrayView(b)), 0.0);
+}
+
+void ReductionBatchTest::dotInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Float a[3]{};
+    const Float b[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Math::dot(Containers::stridedArrayView(a), Containers::stridedArrayView(b));
+    CORRADE_COMPARE(out.str(), "Math::dot(): expected views to have the same size but got 3 and 2\n");
+}
+
+template<class T> void ReductionBatchTest::mean() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const T values[]{T(2.0), T(4.0), T(4.0), T(4.0), T(5.0), T(5.0), T(7.0), T(9.0)};
+    CORRADE_COMPARE(Math::mean(Containers::stridedArrayView(values)), T(5.0));
+}
+
+void ReductionBatchTest::meanVector() {
+    const Vector2<Float> values[]{{1.0f, -2.0f}, {3.0f, 2.0f}, {5.0f, 3.0f}};
+    CORRADE_COMPARE(Math::mean(Containers::stridedArrayView(values)), (Vector2<Float>{3.0f, 1.0f}));
+}
+
+void ReductionBatchTest::meanEmpty() {
+    CORRADE_COMPARE(Math::mean(Containers::StridedArrayView1D<const Double>{}), 0.0);
+    CORRADE_COMPARE(Math::mean(Containers::StridedArrayView1D<const Vector3<Float>>{}), Vector3<Float>{});
+}
+
+template<class T> void ReductionBatchTest::meanVariance() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const T values[]{T(2.0), T(4.0), T(4.0), T(4.0), T(5.0), T(5.0), T(7.0), T(9.0)};
+    Containers::Pair<T, T> out = Math::meanVariance(Containers::stridedArrayView(values));
+    CORRADE_COMPARE(out.first(), T(5.0));
+    CORRADE_COMPARE(out.second(), T(4.0));
+}
+
+void ReductionBatchTest::meanVarianceVector() {
+    const Vector2<Float> values[]{{1.0f, 2.0f}, {3.0f, 2.0f}, {5.0f, 2.0f}};
+    Containers::Pair<Vector2<Float>, Vector2<Float>> out = Math::meanVariance(Containers::stridedArrayView(values));
+    CORRADE_COMPARE(out.first(), (Vector2<Float>{3.0f, 2.0f}));
+    CORRADE_COMPARE(out.second(), (Vector2<Float>{8.0f/3.0f, 0.0f}));
+}
+
+void ReductionBatchTest::meanVarianceEmpty() {
+    Containers::Pair<Float, Float> out = Math::meanVariance(Containers::StridedArrayView1D<const Float>{});
+    CORRADE_COMPARE(out.first(), 0.0f);
+    CORRADE_COMPARE(out.second(), 0.0f);
+}
+
+void ReductionBatchTest::meanVarianceStable() {
+    /* Calculating the variance as E[x^2] - E[x]^2 would lose all precision
+       with such a large offset */
+    const Double values[]{1.0e9 + 4.0, 1.0e9 + 7.0, 1.0e9 + 13.0, 1.0e9 + 16.0};
+    Containers::Pair<Double, Double> out = Math::meanVariance(Containers::stridedArrayView(values));
+    CORRADE_COMPARE(out.first(), 1.0e9 + 10.0);
+    CORRADE_COMPARE(out.second(), 22.5);
+}
+
+void ReductionBatchTest::workerCountReproducible() {
+    /* Default-seeded to have the test reproducible, large enough to span
+       several blocks with the last one incomplete */
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> d{-1000.0f, 1000.0f};
+    Containers::Array<Vector3<Float>> values{NoInit, 100003};
+    for(Vector3<Float>& i: values) i = {d(g), d(g), d(g)};
+
+    /* The builtin global pool has no workers */
+    const Vector3<Float> expectedSum = Math::sum(Containers::stridedArrayView(values));
+    const Float expectedDot = Math::dot(Containers::stridedArrayView(values), Containers::stridedArrayView(values));
+    const Containers::Pair<Vector3<Float>, Vector3<Float>> expectedMeanVariance = Math::meanVariance(Containers::stridedArrayView(values));
+    for(UnsignedInt workerCount: {1u, 2u, 6u, 63u}) {
+        CORRADE_ITERATION(workerCount);
+
+        ThreadPool pool{workerCount};
+        ThreadPool::setGlobal(&pool);
+        const Vector3<Float> sum = Math::sum(Containers::stridedArrayView(values));
+        const Float dot = Math::dot(Containers::stridedArrayView(values), Containers::stridedArrayView(values));
+        const Containers::Pair<Vector3<Float>, Vector3<Float>> meanVariance = Math::meanVariance(Containers::stridedArrayView(values));
+        ThreadPool::setGlobal(nullptr);
+
+        /* Verifying bit-exact equality, Vector::operator==() does a fuzzy
+           compare */
+        for(std::size_t i = 0; i != 3; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_VERIFY(sum[i] == expectedSum[i]);
+            CORRADE_VERIFY(meanVariance.first()[i] == expectedMeanVariance.first()[i]);
+            CORRADE_VERIFY(meanVariance.second()[i] == expectedMeanVariance.second()[i]);
+        }
+        CORRADE_VERIFY(dot == expectedDot);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::ReductionBatchTest)
@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CompileVk.h"
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Vk/Buffer.h"
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/Mesh.h"
+#include "Magnum/Vk/MeshLayout.h"
+#include "Magnum/Vk/UploadManager.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Matching Shaders::GenericGL, the index is the location */
+constexpr Trade::MeshAttribute GenericAttributes[]{
+    Trade::MeshAttribute::Position,
+    Trade::MeshAttribute::TextureCoordinates,
+    Trade::MeshAttribute::Color,
+    Trade::MeshAttribute::Tangent,
+    Trade::MeshAttribute::Bitangent,
+    Trade::MeshAttribute::Normal
+};
+
+}
+
+Vk::Mesh compile(Vk::Device& device, Vk::UploadManager& uploadManager, const Trade::MeshData& meshData) {
+    /* Pick the first attribute of each known name. Bindings and locations
+       have to be added in a monotonically increasing order, which is the
+       case here as binding == location. */
+    UnsignedInt attributeIds[Containers::arraySize(GenericAttributes)];
+    Vk::MeshLayout layout{meshData.primitive()};
+    for(UnsignedInt location = 0; location != Containers::arraySize(GenericAttributes); ++location) {
+        const Containers::Optional<UnsignedInt> id = meshData.findAttributeId(GenericAttributes[location]);
+        attributeIds[location] = id ? *id : ~UnsignedInt{};
+        if(!id) continue;
+
+        const Int stride = meshData.attributeStride(*id);
+        CORRADE_ASSERT(stride > 0,
+            "MeshTools::compile():" << meshData.attributeName(*id) << "stride of" << stride << "bytes isn't supported by Vulkan", Vk::Mesh{layout});
+
+        layout.addBinding(location, stride)
+              .addAttribute(location, location, meshData.attributeFormat(*id), 0);
+    }
+
+    for(UnsignedInt i = 0; i != meshData.attributeCount(); ++i) {
+        bool used = false;
+        for(const UnsignedInt id: attributeIds) if(id == i) {
+            used = true;
+            break;
+        }
+        if(!used)
+            Warning{} << "MeshTools::compile(): ignoring unknown/unsupported attribute" << meshData.attributeName(i);
+    }
+
+    Vk::Mesh mesh{Utility::move(layout)};
+
+    /* Vertex data, shared by all bindings. The last binding takes over the
+       ownership. Vulkan doesn't allow zero-sized buffers, so if there's no
+       vertex data or no known attribute to use them for, no buffer is
+       created. */
+    UnsignedInt lastLocation = ~UnsignedInt{};
+    for(UnsignedInt location = 0; location != Containers::arraySize(GenericAttributes); ++location)
+        if(attributeIds[location] != ~UnsignedInt{}) lastLocation = location;
+    if(lastLocation != ~UnsignedInt{} && !meshData.vertexData().isEmpty()) {
+        Vk::Buffer vertices{device, Vk::BufferCreateInfo{
+            Vk::BufferUsage::TransferDestination|Vk::BufferUsage::VertexBuffer,
+            meshData.vertexData().size()
+        }, Vk::MemoryFlag::DeviceLocal};
+        uploadManager.uploadBuffer(meshData.vertexData(), vertices);
+
+        for(UnsignedInt location = 0; location != Containers::arraySize(GenericAttributes); ++location) {
+            const UnsignedInt id = attributeIds[location];
+            if(id == ~UnsignedInt{}) continue;
+            if(location == lastLocation)
+                mesh.addVertexBuffer(location, Utility::move(vertices), meshData.attributeOffset(id));
+            else
+                mesh.addVertexBuffer(location, vertices, meshData.attributeOffset(id));
+        }
+    }
+
+    if(meshData.isIndexed()) {
+        CORRADE_ASSERT(isMeshIndexTypeImplementationSpecific(meshData.indexType()) || Short(meshIndexTypeSize(meshData.indexType())) == meshData.indexStride(),
+            "MeshTools::compile():" << meshData.indexType() << "with stride of" << meshData.indexStride() << "bytes isn't supported by Vulkan", mesh);
+
+        /* Again no zero-sized buffer, the mesh has nothing to draw in that
+           case anyway */
+        if(!meshData.indexData().isEmpty()) {
+            Vk::Buffer indices{device, Vk::BufferCreateInfo{
+                Vk::BufferUsage::TransferDestination|Vk::BufferUsage::IndexBuffer,
+                meshData.indexData().size()
+            }, Vk::MemoryFlag::DeviceLocal};
+            uploadManager.uploadBuffer(meshData.indexData(), indices);
+
+            mesh.setIndexBuffer(Utility::move(indices), meshData.indexOffset(), meshData.indexType());
+        }
+
+        mesh.setCount(meshData.indexCount());
+    } else mesh.setCount(meshData.vertexCount());
+
+    return mesh;
+}
+
+}}
@@ -0,0 +1,85 @@
+#ifndef Magnum_MeshTools_CompileVk_h
+#define Magnum_MeshTools_CompileVk_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::compile(Vk::Device&, Vk::UploadManager&, const Trade::MeshData&)
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#ifdef MAGNUM_TARGET_VK
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Vk/Vk.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Compile mesh data for Vulkan
+@param device           Vulkan device to create the buffers on
+@param uploadManager    Upload manager to upload the data through
+@param mesh             Mesh data
+@m_since_latest
+
+Vulkan counterpart to @ref compile(const Trade::MeshData&, CompileFlags).
+Creates a @ref Vk::MemoryFlag::DeviceLocal vertex buffer with the whole
+@ref Trade::MeshData::vertexData() and, if the mesh is indexed, an index
+buffer with the whole @ref Trade::MeshData::indexData(), and records their
+uploads via @p uploadManager. The returned @ref Vk::Mesh owns the buffers. As
+Vulkan doesn't allow zero-sized buffers, the vertex buffer isn't created if
+the vertex data are empty or if the mesh has no recognized attributes, and
+the index buffer isn't created if the index data are empty.
+
+Recognized attributes are bound to the same locations as their OpenGL
+counterparts in @ref Shaders::GenericGL, each attribute to a binding of the
+same index:
+
+-   @ref Trade::MeshAttribute::Position to location @cpp 0 @ce
+-   @ref Trade::MeshAttribute::TextureCoordinates to location @cpp 1 @ce
+-   @ref Trade::MeshAttribute::Color to location @cpp 2 @ce
+-   @ref Trade::MeshAttribute::Tangent to location @cpp 3 @ce
+-   @ref Trade::MeshAttribute::Bitangent to location @cpp 4 @ce
+-   @ref Trade::MeshAttribute::Normal to location @cpp 5 @ce
+
+Only the first attribute of each name is used, other attributes are ignored
+with a warning. Attribute strides are expected to be positive and the index
+buffer is expected to be contiguous.
+
+The uploads are only recorded, it's the caller responsibility to call
+@ref Vk::UploadManager::submit() and wait for the submission to finish before
+using the mesh for drawing.
+*/
+MAGNUM_MESHTOOLS_EXPORT Vk::Mesh compile(Vk::Device& device, Vk::UploadManager& uploadManager, const Trade::MeshData& mesh);
+
+}}
+#else
+#error this header is available only in the Vulkan build
+#endif
+
+#endif
@@ -0,0 +1,372 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2020 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+#include "ComputeGL.h"
+
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Version.h"
+#include "Magnum/Trade/MeshData.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importMeshToolsResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumMeshTools_RESOURCES)
+}
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+using namespace Containers::Literals;
+
+namespace {
+
+/* Has to match the local size in ComputeGL.comp */
+constexpr UnsignedInt LocalSize = 64;
+
+class ComputeShader: public GL::AbstractShaderProgram {
+    public:
+        explicit ComputeShader(Containers::StringView kernel);
+
+        ComputeShader& setCount(UnsignedInt count) {
+            setUniform(0, count);
+            return *this;
+        }
+
+        ComputeShader& setAttribute(UnsignedInt offset, UnsignedInt stride) {
+            setUniform(1, offset);
+            setUniform(2, stride);
+            return *this;
+        }
+
+        ComputeShader& setNormalAttribute(UnsignedInt offset, UnsignedInt stride) {
+            setUniform(3, offset);
+            setUniform(4, stride);
+            return *this;
+        }
+
+        ComputeShader& setIndices(UnsignedInt offset, UnsignedInt typeSize) {
+            setUniform(5, offset);
+            setUniform(6, typeSize);
+            return *this;
+        }
+
+        ComputeShader& setTransformation(const Matrix4& transformation, Float w) {
+            setUniform(7, transformation);
+            setUniform(11, w);
+            return *this;
+        }
+
+        /* Dispatches one invocation per item. The workgroup count in a single
+           dimension is guaranteed to be at least 65535, if there's more
+           items, the dispatch spills over to the second dimension. */
+        void dispatch(UnsignedInt count) {
+            const UnsignedInt workgroupCount = (count + LocalSize - 1)/LocalSize;
+            const UnsignedInt x = Math::min(workgroupCount, 65535u);
+            dispatchCompute({x, (workgroupCount + x - 1)/x, 1});
+        }
+};
+
+ComputeShader::ComputeShader(const Containers::StringView kernel) {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumMeshTools"_s))
+        importMeshToolsResources();
+    #endif
+    Utility::Resource rs{"MagnumMeshTools"_s};
+
+    GL::Shader shader{
+        #ifndef MAGNUM_TARGET_GLES
+        GL::Version::GL430,
+        #else
+        GL::Version::GLES310,
+        #endif
+        GL::Shader::Type::Compute};
+    shader.addSource(Utility::format("#define {}\n", kernel))
+        .addSource(rs.getString("ComputeGL.comp"_s));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(shader.compile());
+
+    attachShader(shader);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+}
+
+/* The shaders access the buffers as arrays of 32-bit words, so offsets and
+   strides have to be aligned to that */
+bool isWordAligned(std::size_t value) {
+    return value % 4 == 0;
+}
+
+}
+
+struct ComputeGL::State {
+    Containers::Optional<ComputeShader> clearNormals,
+        accumulateNormals,
+        normalizeNormals,
+        transform,
+        boundingRange;
+    GL::Buffer boundingRangeBuffer{NoCreate};
+    GL::Buffer indexBuffer{NoCreate};
+};
+
+ComputeGL::ComputeGL(): _state{InPlaceInit} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL430);
+    #else
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES310);
+    #endif
+}
+
+ComputeGL::ComputeGL(NoCreateT) noexcept {}
+
+ComputeGL::ComputeGL(ComputeGL&&) noexcept = default;
+
+ComputeGL::~ComputeGL() = default;
+
+ComputeGL& ComputeGL::operator=(ComputeGL&&) noexcept = default;
+
+void ComputeGL::generateSmoothNormalsInto(const Trade::MeshData& mesh, GL::Buffer& indices, GL::Buffer& vertices) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), );
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): the mesh is not indexed", );
+    CORRADE_ASSERT(mesh.indexCount() % 3 == 0,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): can't process an implementation-specific index type" << mesh.indexType(), );
+    const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+    CORRADE_ASSERT(positionAttributeId,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): the mesh has no positions", );
+    CORRADE_ASSERT(mesh.attributeFormat(*positionAttributeId) == VertexFormat::Vector3,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected" << VertexFormat::Vector3 << "positions but got" << mesh.attributeFormat(*positionAttributeId), );
+    const Containers::Optional<UnsignedInt> normalAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Normal);
+    CORRADE_ASSERT(normalAttributeId,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): the mesh has no normals", );
+    CORRADE_ASSERT(mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected" << VertexFormat::Vector3 << "normals but got" << mesh.attributeFormat(*normalAttributeId), );
+    CORRADE_ASSERT(
+        isWordAligned(mesh.attributeOffset(*positionAttributeId)) &&
+        mesh.attributeStride(*positionAttributeId) > 0 &&
+        isWordAligned(mesh.attributeStride(*positionAttributeId)) &&
+        isWordAligned(mesh.attributeOffset(*normalAttributeId)) &&
+        mesh.attributeStride(*normalAttributeId) > 0 &&
+        isWordAligned(mesh.attributeStride(*normalAttributeId)),
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected positive four-byte aligned attribute offsets and strides", );
+    CORRADE_ASSERT(mesh.indexOffset() % meshIndexTypeSize(mesh.indexType()) == 0,
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected the index offset to be aligned to the index type size", );
+
+    const UnsignedInt positionOffset = mesh.attributeOffset(*positionAttributeId)/4;
+    const UnsignedInt positionStride = mesh.attributeStride(*positionAttributeId)/4;
+    const UnsignedInt normalOffset = mesh.attributeOffset(*normalAttributeId)/4;
+    const UnsignedInt normalStride = mesh.attributeStride(*normalAttributeId)/4;
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    const UnsignedInt triangleCount = mesh.indexCount()/3;
+    if(!vertexCount) return;
+
+    State& state = *_state;
+    if(!state.clearNormals) {
+        state.clearNormals.emplace("CLEAR_NORMALS"_s);
+        state.accumulateNormals.emplace("ACCUMULATE_NORMALS"_s);
+        state.normalizeNormals.emplace("NORMALIZE_NORMALS"_s);
+    }
+
+    /* The shader reads indices as 32-bit words. If the index data don't end
+       at a four-byte boundary, the last word could reach past the end of the
+       buffer, so copy them to a scratch buffer with the size rounded up. */
+    const UnsignedInt indexTypeSize = meshIndexTypeSize(mesh.indexType());
+    const std::size_t indexDataSize = mesh.indexCount()*indexTypeSize;
+    UnsignedInt indexOffset = mesh.indexOffset();
+    GL::Buffer* indexBuffer = &indices;
+    if(!isWordAligned(indexOffset + indexDataSize)) {
+        if(!state.indexBuffer.id())
+            state.indexBuffer = GL::Buffer{GL::Buffer::TargetHint::ShaderStorage};
+        state.indexBuffer.setData({nullptr, (indexDataSize + 3) & ~std::size_t{3}}, GL::BufferUsage::DynamicCopy);
+        GL::Buffer::copy(indices, state.indexBuffer, indexOffset, 0, indexDataSize);
+        indexOffset = 0;
+        indexBuffer = &state.indexBuffer;
+    }
+
+    vertices.bind(GL::Buffer::Target::ShaderStorage, 0);
+    indexBuffer->bind(GL::Buffer::Target::ShaderStorage, 1);
+
+    /* Zero-initialize the output, accumulate angle-weighted face normals
+       into it and normalize */
+    state.clearNormals->setCount(vertexCount)
+        .setAttribute(normalOffset, normalStride)
+        .dispatch(vertexCount);
+    GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::ShaderStorage);
+
+    if(triangleCount) {
+        state.accumulateNormals->setCount(triangleCount)
+            .setAttribute(positionOffset, positionStride)
+            .setNormalAttribute(normalOffset, normalStride)
+            .setIndices(indexOffset, indexTypeSize)
+            .dispatch(triangleCount);
+        GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::ShaderStorage);
+    }
+
+    state.normalizeNormals->setCount(vertexCount)
+        .setAttribute(normalOffset, normalStride)
+        .dispatch(vertexCount);
+    GL::Renderer::setMemoryBarrier(
+        GL::Renderer::MemoryBarrier::ShaderStorage|
+        GL::Renderer::MemoryBarrier::VertexAttributeArray|
+        GL::Renderer::MemoryBarrier::BufferUpdate);
+}
+
+void ComputeGL::transform3DInPlace(const Trade::MeshData& mesh, GL::Buffer& vertices, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId) {
+    const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position, id, morphTargetId);
+    #ifndef CORRADE_NO_ASSERT
+    if(morphTargetId == -1) CORRADE_ASSERT(positionAttributeId,
+        "MeshTools::ComputeGL::transform3DInPlace(): the mesh has no positions with index" << id, );
+    else CORRADE_ASSERT(positionAttributeId,
+        "MeshTools::ComputeGL::transform3DInPlace(): the mesh has no positions with index" << id << "in morph target" << morphTargetId, );
+    #endif
+    CORRADE_ASSERT(mesh.attributeFormat(*positionAttributeId) == VertexFormat::Vector3,
+        "MeshTools::ComputeGL::transform3DInPlace(): expected" << VertexFormat::Vector3 << "positions but got" << mesh.attributeFormat(*positionAttributeId), );
+    const Containers::Optional<UnsignedInt> tangentAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Tangent, id, morphTargetId);
+    CORRADE_ASSERT(!tangentAttributeId || mesh.attributeFormat(*tangentAttributeId) == VertexFormat::Vector3 || mesh.attributeFormat(*tangentAttributeId) == VertexFormat::Vector4,
+        "MeshTools::ComputeGL::transform3DInPlace(): expected" << VertexFormat::Vector3 << "or" << VertexFormat::Vector4 << "tangents but got" << mesh.attributeFormat(*tangentAttributeId), );
+    const Containers::Optional<UnsignedInt> bitangentAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Bitangent, id, morphTargetId);
+    CORRADE_ASSERT(!bitangentAttributeId || mesh.attributeFormat(*bitangentAttributeId) == VertexFormat::Vector3,
+        "MeshTools::ComputeGL::transform3DInPlace(): expected" << VertexFormat::Vector3 << "bitangents but got" << mesh.attributeFormat(*bitangentAttributeId), );
+    const Containers::Optional<UnsignedInt> normalAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Normal, id, morphTargetId);
+    CORRADE_ASSERT(!normalAttributeId || mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3,
+        "MeshTools::ComputeGL::transform3DInPlace(): expected" << VertexFormat::Vector3 << "normals but got" << mesh.attributeFormat(*normalAttributeId), );
+    #ifndef CORRADE_NO_ASSERT
+    for(const Containers::Optional<UnsignedInt>& attributeId: {positionAttributeId, tangentAttributeId, bitangentAttributeId, normalAttributeId}) {
+        if(!attributeId) continue;
+        CORRADE_ASSERT(
+            isWordAligned(mesh.attributeOffset(*attributeId)) &&
+            mesh.attributeStride(*attributeId) > 0 &&
+            isWordAligned(mesh.attributeStride(*attributeId)),
+            "MeshTools::ComputeGL::transform3DInPlace(): expected positive four-byte aligned attribute offsets and strides", );
+    }
+    #endif
+
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    if(!vertexCount) return;
+
+    State& state = *_state;
+    if(!state.transform)
+        state.transform.emplace("TRANSFORM"_s);
+
+    vertices.bind(GL::Buffer::Target::ShaderStorage, 0);
+
+    state.transform->setCount(vertexCount)
+        .setAttribute(mesh.attributeOffset(*positionAttributeId)/4, mesh.attributeStride(*positionAttributeId)/4)
+        .setTransformation(transformation, 1.0f)
+        .dispatch(vertexCount);
+
+    /* The remaining attributes are all transformed with the normal matrix.
+       As they're at different locations than positions, there's no need for
+       a barrier between the dispatches. For four-component tangents only the
+       first three components get touched. */
+    if(tangentAttributeId || bitangentAttributeId || normalAttributeId) {
+        state.transform->setTransformation(Matrix4{transformation.normalMatrix()}, 0.0f);
+        for(const Containers::Optional<UnsignedInt>& attributeId: {tangentAttributeId, bitangentAttributeId, normalAttributeId}) {
+            if(!attributeId) continue;
+            state.transform->setAttribute(mesh.attributeOffset(*attributeId)/4, mesh.attributeStride(*attributeId)/4)
+                .dispatch(vertexCount);
+        }
+    }
+
+    GL::Renderer::setMemoryBarrier(
+        GL::Renderer::MemoryBarrier::ShaderStorage|
+        GL::Renderer::MemoryBarrier::VertexAttributeArray|
+        GL::Renderer::MemoryBarrier::BufferUpdate);
+}
+
+Range3D ComputeGL::boundingRange(const Trade::MeshData& mesh, GL::Buffer& vertices) {
+    const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+    CORRADE_ASSERT(positionAttributeId,
+        "MeshTools::ComputeGL::boundingRange(): the mesh has no positions", {});
+    CORRADE_ASSERT(mesh.attributeFormat(*positionAttributeId) == VertexFormat::Vector3,
+        "MeshTools::ComputeGL::boundingRange(): expected" << VertexFormat::Vector3 << "positions but got" << mesh.attributeFormat(*positionAttributeId), {});
+    CORRADE_ASSERT(
+        isWordAligned(mesh.attributeOffset(*positionAttributeId)) &&
+        mesh.attributeStride(*positionAttributeId) > 0 &&
+        isWordAligned(mesh.attributeStride(*positionAttributeId)),
+        "MeshTools::ComputeGL::boundingRange(): expected positive four-byte aligned attribute offsets and strides", {});
+
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    if(!vertexCount) return {};
+
+    State& state = *_state;
+    if(!state.boundingRange) {
+        state.boundingRange.emplace("BOUNDING_RANGE"_s);
+        state.boundingRangeBuffer = GL::Buffer{GL::Buffer::TargetHint::ShaderStorage};
+    }
+
+    /* Min keys start at the highest possible value and max keys at the
+       lowest */
+    const UnsignedInt initial[]{
+        0xffffffffu, 0xffffffffu, 0xffffffffu,
+        0u, 0u, 0u
+    };
+    state.boundingRangeBuffer.setData(initial, GL::BufferUsage::DynamicRead);
+
+    vertices.bind(GL::Buffer::Target::ShaderStorage, 0);
+    state.boundingRangeBuffer.bind(GL::Buffer::Target::ShaderStorage, 2);
+
+    state.boundingRange->setCount(vertexCount)
+        .setAttribute(mesh.attributeOffset(*positionAttributeId)/4, mesh.attributeStride(*positionAttributeId)/4)
+        .dispatch(vertexCount);
+    GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::BufferUpdate);
+
+    /* Convert the order-preserving keys back to floats. If all positions
+       were NaN, the keys stay at their initial values, which map to NaNs. */
+    UnsignedInt keys[6];
+    {
+        const Containers::ArrayView<const char> mapped = state.boundingRangeBuffer.mapRead(0, sizeof(keys));
+        CORRADE_INTERNAL_ASSERT(mapped.size() == sizeof(keys));
+        std::memcpy(keys, mapped.data(), sizeof(keys));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(state.boundingRangeBuffer.unmap());
+    }
+    Float values[6];
+    for(std::size_t i = 0; i != 6; ++i) {
+        const UnsignedInt bits = keys[i] & 0x80000000u ? keys[i] & 0x7fffffffu : ~keys[i];
+        std::memcpy(values + i, &bits, 4);
+    }
+
+    return {Vector3::from(values), Vector3::from(values + 3)};
+}
+
+}}
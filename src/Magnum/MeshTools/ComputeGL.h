@@ -0,0 +1,200 @@
+#ifndef Magnum_MeshTools_ComputeGL_h
+#define Magnum_MeshTools_ComputeGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::ComputeGL
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#ifdef MAGNUM_TARGET_GL
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/MeshTools/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief GPU mesh processing using compute shaders
+@m_since_latest
+
+Compute shader implementations of a subset of @ref MeshTools algorithms, for
+meshes whose data are already resident in @ref GL::Buffer instances and which
+would otherwise have to be downloaded, processed on the CPU and uploaded again.
+Similarly to @ref compile(const Trade::MeshData&, GL::Buffer&, GL::Buffer&),
+a @ref Trade::MeshData instance is used to describe the layout of the index and
+vertex buffers. Only its index and attribute metadata are used, the actual
+index and vertex data contents aren't accessed.
+
+@snippet MeshTools-gl.cpp ComputeGL
+
+The results match the CPU implementations up to floating-point precision. In
+particular, @ref generateSmoothNormalsInto() accumulates the per-triangle
+contributions in a nondeterministic order, so the output may differ from
+@ref MeshTools::generateSmoothNormalsInto() in the last few bits.
+
+The compute shaders are compiled lazily on first use of each operation and
+kept for the whole lifetime of the instance, so it's recommended to reuse it
+when processing multiple meshes. All operations put a memory barrier after
+themselves, so the buffers can be directly used for drawing or read back
+afterwards.
+
+@section MeshTools-ComputeGL-requirements Layout requirements
+
+As the shaders access the buffers as arrays of 32-bit words, all processed
+attributes are expected to have offsets and strides divisible by four. The
+index buffer can have any @ref MeshIndexType, and its offset can be arbitrary
+as long as it's a multiple of the index type size. If the index data don't
+end at a four-byte boundary, such as with a single triangle of
+@ref MeshIndexType::UnsignedShort indices, they're copied to a temporary
+buffer padded to a multiple of four bytes first.
+
+@attention This is a GPU-only implementation, so it expects an active GL
+    context.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl43 Compute shaders and shader storage buffers are not available
+    in OpenGL 4.2 and older.
+@requires_gles31 Compute shaders and shader storage buffers are not available
+    in OpenGL ES 3.0 and older.
+@requires_gles Compute shaders are not available in WebGL.
+*/
+class MAGNUM_MESHTOOLS_EXPORT ComputeGL {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Expects that OpenGL 4.3 or OpenGL ES 3.1 is supported. The compute
+         * shaders are compiled lazily on first use.
+         */
+        explicit ComputeGL();
+
+        /**
+         * @brief Construct without creating the internal OpenGL state
+         *
+         * The constructed instance is equivalent to moved-from state, i.e. no
+         * APIs can be safely called on the object. Useful in cases where you
+         * will overwrite the instance later anyway. Move another object over
+         * it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit ComputeGL(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        ComputeGL(const ComputeGL&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * Performs a destructive move, i.e. the original object isn't usable
+         * afterwards anymore.
+         */
+        ComputeGL(ComputeGL&&) noexcept;
+
+        ~ComputeGL();
+
+        /** @brief Copying is not allowed */
+        ComputeGL& operator=(const ComputeGL&) = delete;
+
+        /** @brief Move assignment */
+        ComputeGL& operator=(ComputeGL&&) noexcept;
+
+        /**
+         * @brief Generate smooth normals into a vertex buffer
+         * @param mesh      Mesh describing the buffer layout
+         * @param indices   Index buffer
+         * @param vertices  Vertex buffer
+         *
+         * A GPU equivalent of
+         * @ref MeshTools::generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&).
+         * Expects that @p mesh is an indexed @ref MeshPrimitive::Triangles
+         * mesh with index count divisible by 3 and that it has a
+         * @ref Trade::MeshAttribute::Position and a
+         * @ref Trade::MeshAttribute::Normal attribute, both of
+         * @ref VertexFormat::Vector3. Positions are read from @p vertices and
+         * the normals are written to @p vertices as well, at the location
+         * described by the normal attribute. Indices are expected to be in
+         * range for the vertex count.
+         */
+        void generateSmoothNormalsInto(const Trade::MeshData& mesh, GL::Buffer& indices, GL::Buffer& vertices);
+
+        /**
+         * @brief Transform 3D positions, normals, tangents and bitangents in a vertex buffer
+         * @param mesh      Mesh describing the buffer layout
+         * @param vertices  Vertex buffer
+         * @param transformation Transformation matrix
+         * @param id        ID of the position, normal, tangent and bitangent
+         *      attribute to transform
+         * @param morphTargetId Morph target ID of the attributes to transform
+         *
+         * A GPU equivalent of
+         * @ref MeshTools::transform3DInPlace(Trade::MeshData&, const Matrix4&, UnsignedInt, Int),
+         * with the same expectations on the attribute presence and formats.
+         * Positions are transformed using the @p transformation, normals,
+         * tangents and bitangents using @ref Matrix4::normalMatrix().
+         */
+        void transform3DInPlace(const Trade::MeshData& mesh, GL::Buffer& vertices, const Matrix4& transformation, UnsignedInt id = 0, Int morphTargetId = -1);
+
+        /**
+         * @brief Calculate a bounding range of positions in a vertex buffer
+         * @param mesh      Mesh describing the buffer layout
+         * @param vertices  Vertex buffer
+         *
+         * A GPU equivalent of @ref MeshTools::boundingRange(). Expects that
+         * @p mesh has a @ref Trade::MeshAttribute::Position attribute of
+         * @ref VertexFormat::Vector3. Only the six resulting values are read
+         * back from the GPU. If the mesh has no vertices, returns a
+         * default-constructed range.
+         */
+        Range3D boundingRange(const Trade::MeshData& mesh, GL::Buffer& vertices);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL builds
+#endif
+#else
+#error this header is available only in the OpenGL build
+#endif
+
+#endif
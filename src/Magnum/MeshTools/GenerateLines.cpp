@@ -25,10 +25,10 @@
 
 #include "GenerateLines.h"
 
-#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
 
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/GenerateIndices.h"
@@ -40,6 +40,117 @@
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+/* Shared between generateLines() and generateLinesInto(). Expects the
+   annotation view to have quadCount*4 items and the index view to have
+   generateLinesIndexCount() items. */
+void generateLineAnnotationsIndicesInto(const MeshPrimitive primitive, const UnsignedInt quadCount, const Containers::StridedArrayView1D<Shaders::LineVertexAnnotations>& annotations, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexOffset) {
+    for(UnsignedInt i = 0; i != quadCount; ++i) {
+        annotations[i*4 + 0] = Shaders::LineVertexAnnotation::Up|Shaders::LineVertexAnnotation::Begin;
+        annotations[i*4 + 1] = Shaders::LineVertexAnnotation::Begin;
+        annotations[i*4 + 2] = Shaders::LineVertexAnnotation::Up;
+        annotations[i*4 + 3] = {};
+    }
+
+    /* A line strip has joins everywhere except the first and last two
+       vertices; line loop joins also the first and last two vertices if it's
+       non-empty */
+    /** @todo add a flag to use the original index buffer somehow to figure out
+        abitrary joins and loops */
+    if(primitive == MeshPrimitive::LineStrip ||
+       primitive == MeshPrimitive::LineLoop) {
+        for(UnsignedInt i = 0; i != quadCount; ++i) {
+            annotations[i*4 + 0] |= Shaders::LineVertexAnnotation::Join;
+            annotations[i*4 + 1] |= Shaders::LineVertexAnnotation::Join;
+            annotations[i*4 + 2] |= Shaders::LineVertexAnnotation::Join;
+            annotations[i*4 + 3] |= Shaders::LineVertexAnnotation::Join;
+        }
+    }
+    if(quadCount && primitive == MeshPrimitive::LineStrip) {
+        annotations[0] &= ~Shaders::LineVertexAnnotation::Join;
+        annotations[1] &= ~Shaders::LineVertexAnnotation::Join;
+        annotations[quadCount*4 - 2] &= ~Shaders::LineVertexAnnotation::Join;
+        annotations[quadCount*4 - 1] &= ~Shaders::LineVertexAnnotation::Join;
+    }
+
+    /* Create an index buffer. The size is known upfront, so it's filled
+       directly instead of growing an array. */
+    std::size_t index = 0;
+    const auto append = [&](UnsignedInt a, UnsignedInt b, UnsignedInt c, UnsignedInt d, UnsignedInt e, UnsignedInt f) {
+        indices[index++] = vertexOffset + a;
+        indices[index++] = vertexOffset + b;
+        indices[index++] = vertexOffset + c;
+        indices[index++] = vertexOffset + d;
+        indices[index++] = vertexOffset + e;
+        indices[index++] = vertexOffset + f;
+    };
+    for(UnsignedInt i = 0; i != quadCount; ++i) {
+        /* The order is chosen in a way that makes it possible to interpret
+           the 6 indices as 3 lines instead of 2 triangles, and additionally
+           those forming only one line, with the other two degenerating to an
+           invisible point to avoid overlaps that would break blending.
+
+            0---2 2
+            |  / /|       0---2
+            | / / |
+            |/ /  |      11   32
+            1 1---3 */
+        append(
+            i*4 + 2,
+            i*4 + 0,
+            i*4 + 1,
+
+            i*4 + 1,
+            i*4 + 3,
+            i*4 + 2);
+
+        /* Add also indices for the bevel in both orientations (one will always
+           degenerate). For the line fallback these will all degenerate.
+
+            2 2   2---4 4   4--
+             /|   |  / /|   |        23    44
+            / |   | / / |   | /
+              |   |/ /  |   |/          35
+            --3   3 3---5   5 5 */
+        if(i + 1 != quadCount && annotations[i*4 + 3] & Shaders::LineVertexAnnotation::Join) {
+            append(
+                i*4 + 2,
+                i*4 + 3,
+                i*4 + 4,
+
+                i*4 + 4,
+                i*4 + 3,
+                i*4 + 5);
+        }
+    }
+
+    /* And finally also bevel indices between the last and first segment in
+       case of loops, if the loop isn't empty
+
+        -2  -2---0 0   0-
+        /|   |  / /|   |
+         |   | / / |   |
+         |   |/ /  |   |/
+        -1  -1 -1--1   1 */
+    if(quadCount && annotations[0] & Shaders::LineVertexAnnotation::Join) {
+        CORRADE_INTERNAL_ASSERT(annotations[quadCount*4 - 1] & Shaders::LineVertexAnnotation::Join);
+
+        append(
+            quadCount*4 - 2,
+            quadCount*4 - 1,
+            0u,
+
+            0u,
+            quadCount*4 - 1,
+            1u);
+    }
+
+    CORRADE_INTERNAL_ASSERT(index == indices.size());
+}
+
+}
+
 Trade::MeshData generateLines(const Trade::MeshData& lineMesh) {
     CORRADE_ASSERT(lineMesh.primitive() == MeshPrimitive::Lines ||
                    lineMesh.primitive() == MeshPrimitive::LineStrip ||
@@ -168,107 +279,122 @@ Trade::MeshData generateLines(const Trade::MeshData& lineMesh) {
         }
     }
 
-    /* Fill in point annotation */
-    const Containers::StridedArrayView1D<Shaders::LineVertexAnnotations> annotations = Containers::arrayCast<Shaders::LineVertexAnnotations>(mesh.mutableAttribute<UnsignedInt>(Implementation::LineMeshAttributeAnnotation));
-    for(UnsignedInt i = 0; i != quadCount; ++i) {
-        annotations[i*4 + 0] = Shaders::LineVertexAnnotation::Up|Shaders::LineVertexAnnotation::Begin;
-        annotations[i*4 + 1] = Shaders::LineVertexAnnotation::Begin;
-        annotations[i*4 + 2] = Shaders::LineVertexAnnotation::Up;
-        annotations[i*4 + 3] = {};
-    }
-
-    /* A line strip has joins everywhere except the first and last two
-       vertices; line loop joins also the first and last two vertices if it's
-       non-empty */
-    /** @todo add a flag to use the original index buffer somehow to figure out
-        abitrary joins and loops */
-    if(lineMesh.primitive() == MeshPrimitive::LineStrip ||
-       lineMesh.primitive() == MeshPrimitive::LineLoop) {
-        for(UnsignedInt i = 0; i != quadCount; ++i) {
-            annotations[i*4 + 0] |= Shaders::LineVertexAnnotation::Join;
-            annotations[i*4 + 1] |= Shaders::LineVertexAnnotation::Join;
-            annotations[i*4 + 2] |= Shaders::LineVertexAnnotation::Join;
-            annotations[i*4 + 3] |= Shaders::LineVertexAnnotation::Join;
-        }
-    }
-    if(quadCount && lineMesh.primitive() == MeshPrimitive::LineStrip) {
-        annotations[0] &= ~Shaders::LineVertexAnnotation::Join;
-        annotations[1] &= ~Shaders::LineVertexAnnotation::Join;
-        annotations[quadCount*4 - 2] &= ~Shaders::LineVertexAnnotation::Join;
-        annotations[quadCount*4 - 1] &= ~Shaders::LineVertexAnnotation::Join;
-    }
-
-    /* Create an index buffer */
-    Containers::Array<UnsignedInt> indexData;
-    arrayReserve(indexData, quadCount*6);
-    for(UnsignedInt i = 0; i != quadCount; ++i) {
-        /* The order is chosen in a way that makes it possible to interpret
-           the 6 indices as 3 lines instead of 2 triangles, and additionally
-           those forming only one line, with the other two degenerating to an
-           invisible point to avoid overlaps that would break blending.
+    /* Fill in point annotations and the index buffer */
+    Containers::Array<char> indexData{NoInit, generateLinesIndexCount(lineMesh.primitive(), lineMesh.isIndexed() ? lineMesh.indexCount() : lineMesh.vertexCount())*sizeof(UnsignedInt)};
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+    generateLineAnnotationsIndicesInto(lineMesh.primitive(), quadCount, Containers::arrayCast<Shaders::LineVertexAnnotations>(mesh.mutableAttribute<UnsignedInt>(Implementation::LineMeshAttributeAnnotation)), indices, 0);
 
-            0---2 2
-            |  / /|       0---2
-            | / / |
-            |/ /  |      11   32
-            1 1---3 */
-        arrayAppend(indexData, {
-            i*4 + 2,
-            i*4 + 0,
-            i*4 + 1,
+    const Trade::MeshIndexData indexDataDescription{indices};
+    return Trade::MeshData{mesh.primitive(),
+        indices.isEmpty() ? Containers::Array<char>{} : Utility::move(indexData), indexDataDescription,
+        mesh.releaseVertexData(), mesh.releaseAttributeData()};
+}
 
-            i*4 + 1,
-            i*4 + 3,
-            i*4 + 2
-        });
+UnsignedInt generateLinesVertexCount(const MeshPrimitive primitive, const UnsignedInt elementCount) {
+    CORRADE_ASSERT(primitive == MeshPrimitive::Lines ||
+                   primitive == MeshPrimitive::LineStrip ||
+                   primitive == MeshPrimitive::LineLoop,
+        "MeshTools::generateLinesVertexCount(): expected a line primitive, got" << primitive, {});
 
-        /* Add also indices for the bevel in both orientations (one will always
-           degenerate). For the line fallback these will all degenerate.
+    return primitiveCount(primitive, elementCount)*4;
+}
 
-            2 2   2---4 4   4--
-             /|   |  / /|   |        23    44
-            / |   | / / |   | /
-              |   |/ /  |   |/          35
-            --3   3 3---5   5 5 */
-        if(i + 1 != quadCount && annotations[i*4 + 3] & Shaders::LineVertexAnnotation::Join) {
-            arrayAppend(indexData, {
-                i*4 + 2,
-                i*4 + 3,
-                i*4 + 4,
+UnsignedInt generateLinesIndexCount(const MeshPrimitive primitive, const UnsignedInt elementCount) {
+    CORRADE_ASSERT(primitive == MeshPrimitive::Lines ||
+                   primitive == MeshPrimitive::LineStrip ||
+                   primitive == MeshPrimitive::LineLoop,
+        "MeshTools::generateLinesIndexCount(): expected a line primitive, got" << primitive, {});
+
+    const UnsignedInt quadCount = primitiveCount(primitive, elementCount);
+    if(!quadCount) return 0;
+
+    /* Each quad is two triangles, line strips have a join (two more
+       triangles) between each neighboring quad and loops additionally one
+       between the last and the first */
+    if(primitive == MeshPrimitive::LineStrip)
+        return quadCount*6 + (quadCount - 1)*6;
+    if(primitive == MeshPrimitive::LineLoop)
+        return quadCount*12;
+    return quadCount*6;
+}
 
-                i*4 + 4,
-                i*4 + 3,
-                i*4 + 5,
-            });
+namespace {
+
+template<class T> void generateLinesIntoImplementation(const MeshPrimitive primitive, const Containers::StridedArrayView1D<const T>& positions, const Containers::StridedArrayView1D<T>& outputPositions, const Containers::StridedArrayView1D<T>& outputPreviousPositions, const Containers::StridedArrayView1D<T>& outputNextPositions, const Containers::StridedArrayView1D<UnsignedInt>& outputAnnotations, const Containers::StridedArrayView1D<UnsignedInt>& outputIndices, const UnsignedInt vertexOffset) {
+    CORRADE_ASSERT(primitive == MeshPrimitive::Lines ||
+                   primitive == MeshPrimitive::LineStrip ||
+                   primitive == MeshPrimitive::LineLoop,
+        "MeshTools::generateLinesInto(): expected a line primitive, got" << primitive, );
+
+    const UnsignedInt quadCount = primitiveCount(primitive, positions.size());
+    CORRADE_ASSERT(
+        outputPositions.size() == quadCount*4 &&
+        outputPreviousPositions.size() == quadCount*4 &&
+        outputNextPositions.size() == quadCount*4 &&
+        outputAnnotations.size() == quadCount*4,
+        "MeshTools::generateLinesInto(): expected output vertex views to have a size of" << quadCount*4 << "but got" << outputPositions.size() << Debug::nospace << "," << outputPreviousPositions.size() << Debug::nospace << "," << outputNextPositions.size() << "and" << outputAnnotations.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedInt indexCount = generateLinesIndexCount(primitive, positions.size());
+    #endif
+    CORRADE_ASSERT(outputIndices.size() == indexCount,
+        "MeshTools::generateLinesInto(): expected output index view to have a size of" << indexCount << "but got" << outputIndices.size(), );
+
+    const bool hasNeighbors = primitive == MeshPrimitive::LineStrip ||
+                              primitive == MeshPrimitive::LineLoop;
+    const bool isLoop = primitive == MeshPrimitive::LineLoop;
+
+    /* Point indices of the first and second point of segment i. Lines are
+       pairs of points, strips and loops share them with neighbors, loops
+       additionally connect the last point back to the first. */
+    const auto begin = [&](UnsignedInt i) -> UnsignedInt {
+        return hasNeighbors ? i : i*2;
+    };
+    const auto end = [&](UnsignedInt i) -> UnsignedInt {
+        if(!hasNeighbors) return i*2 + 1;
+        return isLoop && i + 1 == quadCount ? 0 : i + 1;
+    };
+
+    /* Same layout as generateLines() produces -- given AABBCCDDEEFF, the
+       first two points of each quad are the segment begin, the second two the
+       segment end. Previous position of the begin and next position of the
+       end is taken from the neighbor segment, if there's any, and is zero
+       otherwise. */
+    for(UnsignedInt i = 0; i != quadCount; ++i) {
+        const T& a = positions[begin(i)];
+        const T& b = positions[end(i)];
+
+        T previous{}, next{};
+        if(hasNeighbors) {
+            if(i != 0)
+                previous = positions[begin(i - 1)];
+            else if(isLoop)
+                previous = positions[begin(quadCount - 1)];
+
+            if(i + 1 != quadCount)
+                next = positions[end(i + 1)];
+            else if(isLoop)
+                next = positions[end(0)];
         }
-    }
 
-    /* And finally also bevel indices between the last and first segment in
-       case of loops, if the loop isn't empty
+        outputPositions[i*4 + 0] = outputPositions[i*4 + 1] = a;
+        outputPositions[i*4 + 2] = outputPositions[i*4 + 3] = b;
+        outputPreviousPositions[i*4 + 0] = outputPreviousPositions[i*4 + 1] = previous;
+        outputPreviousPositions[i*4 + 2] = outputPreviousPositions[i*4 + 3] = a;
+        outputNextPositions[i*4 + 0] = outputNextPositions[i*4 + 1] = b;
+        outputNextPositions[i*4 + 2] = outputNextPositions[i*4 + 3] = next;
+    }
 
-        -2  -2---0 0   0-
-        /|   |  / /|   |
-         |   | / / |   |
-         |   |/ /  |   |/
-        -1  -1 -1--1   1 */
-    if(quadCount && annotations[0] & Shaders::LineVertexAnnotation::Join) {
-        CORRADE_INTERNAL_ASSERT(annotations[quadCount*4 - 1] & Shaders::LineVertexAnnotation::Join);
+    generateLineAnnotationsIndicesInto(primitive, quadCount, Containers::arrayCast<Shaders::LineVertexAnnotations>(outputAnnotations), outputIndices, vertexOffset);
+}
 
-        arrayAppend(indexData, {
-            quadCount*4 - 2,
-            quadCount*4 - 1,
-            0u,
+}
 
-            0u,
-            quadCount*4 - 1,
-            1u
-        });
-    }
+void generateLinesInto(const MeshPrimitive primitive, const Containers::StridedArrayView1D<const Vector2>& positions, const Containers::StridedArrayView1D<Vector2>& outputPositions, const Containers::StridedArrayView1D<Vector2>& outputPreviousPositions, const Containers::StridedArrayView1D<Vector2>& outputNextPositions, const Containers::StridedArrayView1D<UnsignedInt>& outputAnnotations, const Containers::StridedArrayView1D<UnsignedInt>& outputIndices, const UnsignedInt vertexOffset) {
+    generateLinesIntoImplementation(primitive, positions, outputPositions, outputPreviousPositions, outputNextPositions, outputAnnotations, outputIndices, vertexOffset);
+}
 
-    Trade::MeshIndexData indices{indexData};
-    return Trade::MeshData{mesh.primitive(),
-        indexData ? Containers::arrayAllocatorCast<char>(Utility::move(indexData)) : Containers::Array<char>{}, indices,
-        mesh.releaseVertexData(), mesh.releaseAttributeData()};
+void generateLinesInto(const MeshPrimitive primitive, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& outputPositions, const Containers::StridedArrayView1D<Vector3>& outputPreviousPositions, const Containers::StridedArrayView1D<Vector3>& outputNextPositions, const Containers::StridedArrayView1D<UnsignedInt>& outputAnnotations, const Containers::StridedArrayView1D<UnsignedInt>& outputIndices, const UnsignedInt vertexOffset) {
+    generateLinesIntoImplementation(primitive, positions, outputPositions, outputPreviousPositions, outputNextPositions, outputAnnotations, outputIndices, vertexOffset);
 }
 
 }}
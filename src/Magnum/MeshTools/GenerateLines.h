@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::generateLines()
+ * @brief Function @ref Magnum::MeshTools::generateLines(), @ref Magnum::MeshTools::generateLinesInto(), @ref Magnum::MeshTools::generateLinesVertexCount(), @ref Magnum::MeshTools::generateLinesIndexCount()
  * @m_since_latest
  */
 
@@ -79,11 +79,71 @@ and is a line @relativeref{Magnum,MeshPrimitive}.
 The returned @ref Trade::MeshData instance is meant to be passed to
 @ref compileLines() for use with the shader. It can however be also processed
 with other @ref MeshTools first, such as @ref compressIndices(const Trade::MeshData&, MeshIndexType) or @ref concatenate().
+If you need to fill existing memory or process large datasets in batches, use
+@ref generateLinesInto() instead.
 
 @experimental
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData generateLines(const Trade::MeshData& lineMesh);
 
+/**
+@brief Vertex count produced by @ref generateLinesInto()
+@m_since_latest
+
+Returns @cpp 4*primitiveCount(primitive, elementCount) @ce, i.e. four vertices
+for every line segment. Expects that @p primitive is a line
+@relativeref{Magnum,MeshPrimitive}, restrictions on @p elementCount are the same
+as in @ref primitiveCount().
+@see @ref generateLinesIndexCount()
+*/
+MAGNUM_MESHTOOLS_EXPORT UnsignedInt generateLinesVertexCount(MeshPrimitive primitive, UnsignedInt elementCount);
+
+/**
+@brief Index count produced by @ref generateLinesInto()
+@m_since_latest
+
+Returns six indices for every line segment and additional six indices for
+every join between neighboring segments of a @ref MeshPrimitive::LineStrip or
+a @ref MeshPrimitive::LineLoop. Expects that @p primitive is a line
+@relativeref{Magnum,MeshPrimitive}, restrictions on @p elementCount are the same
+as in @ref primitiveCount().
+@see @ref generateLinesVertexCount()
+*/
+MAGNUM_MESHTOOLS_EXPORT UnsignedInt generateLinesIndexCount(MeshPrimitive primitive, UnsignedInt elementCount);
+
+/**
+@brief Generate line mesh data for use with @ref Shaders::LineGL into existing views
+@m_since_latest
+
+A variant of @ref generateLines() that operates directly on positions and
+fills caller-provided memory instead of allocating a new @ref Trade::MeshData.
+The @p positions are expected to be non-indexed and ordered according to
+@p primitive, the @p outputPositions, @p outputPreviousPositions,
+@p outputNextPositions and @p outputAnnotations views are expected to have a
+size of @ref generateLinesVertexCount() and @p outputIndices a size of
+@ref generateLinesIndexCount(). The annotations are
+@ref Shaders::LineVertexAnnotations stored as @relativeref{Magnum,UnsignedInt},
+matching the @ref Shaders::LineGL::Annotation attribute. Output of this
+function is equivalent to what @ref generateLines() produces for a
+non-indexed position-only mesh, with previous and next positions of segment
+ends that have no neighbor set to zero.
+
+The @p vertexOffset is added to all generated indices. Together with the
+output being written only to the views passed in, this allows a large line
+dataset to be processed in batches --- for example one line strip at a time
+--- directly into slices of a single preallocated vertex and index buffer,
+without having to expand the whole dataset again whenever a part of it
+changes. Since each call touches only its own output ranges, independent
+batches can be also processed concurrently from multiple threads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateLinesInto(MeshPrimitive primitive, const Containers::StridedArrayView1D<const Vector2>& positions, const Containers::StridedArrayView1D<Vector2>& outputPositions, const Containers::StridedArrayView1D<Vector2>& outputPreviousPositions, const Containers::StridedArrayView1D<Vector2>& outputNextPositions, const Containers::StridedArrayView1D<UnsignedInt>& outputAnnotations, const Containers::StridedArrayView1D<UnsignedInt>& outputIndices, UnsignedInt vertexOffset = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateLinesInto(MeshPrimitive primitive, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& outputPositions, const Containers::StridedArrayView1D<Vector3>& outputPreviousPositions, const Containers::StridedArrayView1D<Vector3>& outputNextPositions, const Containers::StridedArrayView1D<UnsignedInt>& outputAnnotations, const Containers::StridedArrayView1D<UnsignedInt>& outputIndices, UnsignedInt vertexOffset = 0);
+
 }}
 
 #endif
@@ -29,6 +29,7 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 
@@ -41,16 +42,26 @@
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+/* Count of triangles or vertices processed in a single ThreadPool job */
+constexpr std::size_t ParallelGrainSize = 4096;
+
+}
+
 void generateFlatNormalsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
     CORRADE_ASSERT(positions.size() % 3 == 0,
         "MeshTools::generateFlatNormalsInto(): position count not divisible by 3", );
     CORRADE_ASSERT(normals.size() == positions.size(),
         "MeshTools::generateFlatNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
 
-    for(std::size_t i = 0; i != positions.size(); i += 3)
-        normals[i] = normals[i + 1] = normals[i + 2] = Math::cross(
-            positions[i + 2] - positions[i + 1],
-            positions[i] - positions[i+1]).normalized();
+    /* Each triangle is independent, so it can be processed in parallel */
+    ThreadPool::global().parallelFor(positions.size()/3, ParallelGrainSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin*3; i != end*3; i += 3)
+            normals[i] = normals[i + 1] = normals[i + 2] = Math::cross(
+                positions[i + 2] - positions[i + 1],
+                positions[i] - positions[i+1]).normalized();
+    });
 }
 
 Containers::Array<Vector3> generateFlatNormals(const Containers::StridedArrayView1D<const Vector3>& positions) {
@@ -149,80 +160,91 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
        below would otherwise calculate it for every vertex, which is at least
        3x as much work */
     Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
-        const Vector3 v0 = positions[indices[i*3 + 0]];
-        const Vector3 v1 = positions[indices[i*3 + 1]];
-        const Vector3 v2 = positions[indices[i*3 + 2]];
-
-        /* Cross product */
-        crossAngles[i].first() = Math::cross(v2 - v1, v0 - v1);
-
-        /* If any of the vectors is zero, the normalization would result in a
-           NaN and the angle calculation will assert. This happens also when
-           any of the original positions is NaN. If that's the case, skip the
-           rest. Given triangle will then contribute with a zero total angle,
-           effectively getting ignored for normal calculation.
-
-           If, however, an angle
-           */
-        const Vector3 v10n = (v1 - v0).normalized();
-        const Vector3 v20n = (v2 - v0).normalized();
-        const Vector3 v21n = (v2 - v1).normalized();
-        if(Math::isNan(v10n) || Math::isNan(v20n) || Math::isNan(v21n)) {
-            crossAngles[i].second() = Math::Vector3<Rad>{Math::ZeroInit};
-            continue;
+    ThreadPool& pool = ThreadPool::global();
+    pool.parallelFor(crossAngles.size(), ParallelGrainSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const Vector3 v0 = positions[indices[i*3 + 0]];
+            const Vector3 v1 = positions[indices[i*3 + 1]];
+            const Vector3 v2 = positions[indices[i*3 + 2]];
+
+            /* Cross product */
+            crossAngles[i].first() = Math::cross(v2 - v1, v0 - v1);
+
+            /* If any of the vectors is zero, the normalization would result
+               in a NaN and the angle calculation will assert. This happens
+               also when any of the original positions is NaN. If that's the
+               case, skip the rest. Given triangle will then contribute with a
+               zero total angle, effectively getting ignored for normal
+               calculation.
+
+               If, however, an angle
+               */
+            const Vector3 v10n = (v1 - v0).normalized();
+            const Vector3 v20n = (v2 - v0).normalized();
+            const Vector3 v21n = (v2 - v1).normalized();
+            if(Math::isNan(v10n) || Math::isNan(v20n) || Math::isNan(v21n)) {
+                crossAngles[i].second() = Math::Vector3<Rad>{Math::ZeroInit};
+                continue;
+            }
+
+            /* Inner angle at each vertex of the triangle. The last one can be
+               calculated as a remainder to 180°. */
+            /* This using namespace doesn't work with MSVC2019 with
+               /permissive- (it gets lost when instantiating?!), so it's
+               duplicated above */
+            using namespace Math::Literals;
+            crossAngles[i].second()[0] = Math::angle(v10n, v20n);
+            crossAngles[i].second()[1] = Math::angle(-v10n, v21n);
+            crossAngles[i].second()[2] = Rad(180.0_degf)
+                - crossAngles[i].second()[0] - crossAngles[i].second()[1];
         }
-
-        /* Inner angle at each vertex of the triangle. The last one can be
-           calculated as a remainder to 180°. */
-        /* This using namespace doesn't work with MSVC2019 with /permissive-
-           (it gets lost when instantiating?!), so it's duplicated above */
-        using namespace Math::Literals;
-        crossAngles[i].second()[0] = Math::angle(v10n, v20n);
-        crossAngles[i].second()[1] = Math::angle(-v10n, v21n);
-        crossAngles[i].second()[2] = Rad(180.0_degf)
-            - crossAngles[i].second()[0] - crossAngles[i].second()[1];
-    }
+    });
 
     /* For every vertex v, calculate normals from all faces it belongs to and
-       average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
-        /* normals are an external memory, ensure we accumulate from zero */
-        normals[v] = Vector3{Math::ZeroInit};
-
-        /* Go through all triangles sharing this vertex */
-        for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
-            const T v0i = indices[baseIndex + 0];
-            const T v1i = indices[baseIndex + 1];
-            const T v2i = indices[baseIndex + 2];
-
-            /* Cross product is a vector in direction of the normal with length
-               equal to size of the parallelogram */
-            const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
-
-            /* Angle between two sides of the triangle that share vertex `v`.
-               The shared vertex can be one of the three. */
-            Rad angle;
-            if(v == v0i) angle = crossAngle.second()[0];
-            else if(v == v1i) angle = crossAngle.second()[1];
-            else if(v == v2i) angle = crossAngle.second()[2];
-            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-
-            /* The normal is cross.normalized(), we need to multiply it it by
-               surface area which is cross.length()/2. Since normalization is
-               division by length, multiplying it by length again will be a
-               no-op. Then, since all normals are divided by 2, it doesn't
-               change their ratio for the final normalization so we can omit
-               that as well. Finally we need to weight by the angle, and in
-               that case only the ratio is important as well, so it doesn't
-               matter if degrees or radians. */
-            normals[v] += crossAngle.first()*Float(angle);
+       average them. Each vertex gathers the contributions on its own in a
+       fixed order, so the output is the same regardless of how the vertices
+       get distributed across threads. */
+    pool.parallelFor(positions.size(), ParallelGrainSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t v = begin; v != end; ++v) {
+            /* normals are an external memory, ensure we accumulate from
+               zero */
+            normals[v] = Vector3{Math::ZeroInit};
+
+            /* Go through all triangles sharing this vertex */
+            for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
+                const std::size_t baseIndex = triangleIds[t]*3;
+                const T v0i = indices[baseIndex + 0];
+                const T v1i = indices[baseIndex + 1];
+                const T v2i = indices[baseIndex + 2];
+
+                /* Cross product is a vector in direction of the normal with
+                   length equal to size of the parallelogram */
+                const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
+
+                /* Angle between two sides of the triangle that share vertex
+                   `v`. The shared vertex can be one of the three. */
+                Rad angle;
+                if(v == v0i) angle = crossAngle.second()[0];
+                else if(v == v1i) angle = crossAngle.second()[1];
+                else if(v == v2i) angle = crossAngle.second()[2];
+                else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+                /* The normal is cross.normalized(), we need to multiply it it
+                   by surface area which is cross.length()/2. Since
+                   normalization is division by length, multiplying it by
+                   length again will be a no-op. Then, since all normals are
+                   divided by 2, it doesn't change their ratio for the final
+                   normalization so we can omit that as well. Finally we need
+                   to weight by the angle, and in that case only the ratio is
+                   important as well, so it doesn't matter if degrees or
+                   radians. */
+                normals[v] += crossAngle.first()*Float(angle);
+            }
+
+            /* Normalize the accumulated direction */
+            normals[v] = normals[v].normalized();
         }
-
-        /* Normalize the accumulated direction */
-        normals[v] = normals[v].normalized();
-    }
+    });
 }
 
 }
@@ -0,0 +1,204 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/CompileVk.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Mesh.h"
+#include "Magnum/Vk/UploadManager.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct CompileVkTest: Vk::VulkanTester {
+    explicit CompileVkTest();
+
+    void indexed();
+    void nonIndexed();
+    void unsupportedAttribute();
+    void noKnownAttributes();
+    void empty();
+    void negativeStride();
+};
+
+CompileVkTest::CompileVkTest() {
+    addTests({&CompileVkTest::indexed,
+              &CompileVkTest::nonIndexed,
+              &CompileVkTest::unsupportedAttribute,
+              &CompileVkTest::noKnownAttributes,
+              &CompileVkTest::empty,
+              &CompileVkTest::negativeStride});
+}
+
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+};
+
+const Vertex Vertices[]{
+    {{-1.0f, -1.0f, 0.0f}, Vector3::zAxis()},
+    {{ 1.0f, -1.0f, 0.0f}, Vector3::zAxis()},
+    {{ 0.0f,  1.0f, 0.0f}, Vector3::zAxis()}
+};
+
+const UnsignedShort Indices[]{0, 1, 2, 2, 1, 0};
+
+void CompileVkTest::indexed() {
+    const Containers::StridedArrayView1D<const Vertex> vertices = Vertices;
+    Trade::MeshData meshData{MeshPrimitive::Triangles,
+        {}, Indices, Trade::MeshIndexData{Indices},
+        {}, Vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertices.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::position)}
+        }};
+
+    Vk::UploadManager uploadManager{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics), 1024};
+
+    Vk::Mesh mesh = compile(device(), uploadManager, meshData);
+    uploadManager.wait(uploadManager.submit());
+
+    CORRADE_COMPARE(mesh.count(), 6);
+    CORRADE_VERIFY(mesh.isIndexed());
+    CORRADE_COMPARE(mesh.indexType(), Vk::MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh.indexBufferOffset(), 0);
+
+    /* Position goes to binding 0, normal to binding 5, both referencing the
+       same buffer */
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 2);
+    CORRADE_VERIFY(mesh.vertexBuffers()[0]);
+    CORRADE_COMPARE(mesh.vertexBuffers()[1], mesh.vertexBuffers()[0]);
+    CORRADE_COMPARE_AS(mesh.vertexBufferOffsets(), Containers::arrayView<UnsignedLong>({
+        0, 12
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.vertexBufferStrides(), Containers::arrayView<UnsignedLong>({
+        24, 24
+    }), TestSuite::Compare::Container);
+}
+
+void CompileVkTest::nonIndexed() {
+    const Containers::StridedArrayView1D<const Vertex> vertices = Vertices;
+    Trade::MeshData meshData{MeshPrimitive::Triangles,
+        {}, Vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::position)}
+        }};
+
+    Vk::UploadManager uploadManager{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics), 1024};
+
+    Vk::Mesh mesh = compile(device(), uploadManager, meshData);
+    uploadManager.wait(uploadManager.submit());
+
+    CORRADE_COMPARE(mesh.count(), 3);
+    CORRADE_VERIFY(!mesh.isIndexed());
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 1);
+}
+
+void CompileVkTest::unsupportedAttribute() {
+    const Containers::StridedArrayView1D<const Vertex> vertices = Vertices;
+    Trade::MeshData meshData{MeshPrimitive::Triangles,
+        {}, Vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::position)},
+            /* Second position gets ignored */
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(15), vertices.slice(&Vertex::normal)}
+        }};
+
+    Vk::UploadManager uploadManager{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics), 1024};
+
+    std::ostringstream out;
+    Warning redirectWarning{&out};
+    Vk::Mesh mesh = compile(device(), uploadManager, meshData);
+    uploadManager.wait(uploadManager.submit());
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 1);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compile(): ignoring unknown/unsupported attribute Trade::MeshAttribute::Position\n"
+        "MeshTools::compile(): ignoring unknown/unsupported attribute Trade::MeshAttribute::Custom(15)\n");
+}
+
+void CompileVkTest::noKnownAttributes() {
+    const Containers::StridedArrayView1D<const Vertex> vertices = Vertices;
+    Trade::MeshData meshData{MeshPrimitive::Triangles,
+        {}, Vertices, {
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(15), vertices.slice(&Vertex::normal)}
+        }};
+
+    Vk::UploadManager uploadManager{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics), 1024};
+
+    std::ostringstream out;
+    Warning redirectWarning{&out};
+    Vk::Mesh mesh = compile(device(), uploadManager, meshData);
+    /* No buffer should be created and thus nothing recorded */
+    CORRADE_COMPARE(uploadManager.recordedSize(), 0);
+    CORRADE_COMPARE(mesh.count(), 3);
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compile(): ignoring unknown/unsupported attribute Trade::MeshAttribute::Custom(15)\n");
+}
+
+void CompileVkTest::empty() {
+    const Containers::ArrayView<const Vertex> vertices = Containers::arrayView(Vertices).prefix(0);
+    const Containers::ArrayView<const UnsignedShort> indices = Containers::arrayView(Indices).prefix(0);
+    Trade::MeshData meshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::stridedArrayView(vertices).slice(&Vertex::position)}
+        }};
+
+    Vk::UploadManager uploadManager{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics), 1024};
+
+    /* Vulkan doesn't allow zero-sized buffers, so none should be created */
+    Vk::Mesh mesh = compile(device(), uploadManager, meshData);
+    CORRADE_COMPARE(uploadManager.recordedSize(), 0);
+    CORRADE_COMPARE(mesh.count(), 0);
+    CORRADE_VERIFY(!mesh.isIndexed());
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 1);
+    CORRADE_VERIFY(!mesh.vertexBuffers()[0]);
+}
+
+void CompileVkTest::negativeStride() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Containers::StridedArrayView1D<const Vertex> vertices = Vertices;
+    Trade::MeshData meshData{MeshPrimitive::Triangles,
+        {}, Vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::position).flipped<0>()}
+        }};
+
+    Vk::UploadManager uploadManager{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics), 1024};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compile(device(), uploadManager, meshData);
+    CORRADE_COMPARE(out.str(), "MeshTools::compile(): Trade::MeshAttribute::Position stride of -24 bytes isn't supported by Vulkan\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompileVkTest)
@@ -0,0 +1,599 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Version.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/ComputeGL.h"
+#include "Magnum/MeshTools/GenerateNormals.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct ComputeGLTest: GL::OpenGLTester {
+    explicit ComputeGLTest();
+
+    void constructNoCreate();
+    void constructCopy();
+    void constructMove();
+
+    template<class T> void generateSmoothNormals();
+    void generateSmoothNormalsUnpaddedIndices();
+    void generateSmoothNormalsNoTriangles();
+    void generateSmoothNormalsInvalid();
+
+    void transform3D();
+    void transform3DInvalid();
+
+    void boundingRange();
+    void boundingRangeEmpty();
+    void boundingRangeInvalid();
+};
+
+using namespace Math::Literals;
+
+/* Interleaved with padding in between so the offsets and strides are
+   nontrivial */
+struct Vertex {
+    Vector3 position;
+    Float padding;
+    Vector3 normal;
+    Vector4 tangent;
+};
+
+/* A cube with one corner pulled out so the normals aren't all the same
+   length before normalization */
+constexpr Vector3 CubePositions[]{
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f},
+    {-1.0f,  1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    {-1.5f, -2.0f, -1.5f},
+};
+
+constexpr UnsignedByte CubeIndices[]{
+    0, 1, 2, 0, 2, 3, /* +Z */
+    1, 6, 5, 1, 5, 2, /* +X */
+    3, 2, 5, 3, 5, 4, /* +Y */
+    4, 5, 6, 4, 6, 7, /* -Z */
+    3, 4, 7, 3, 7, 0, /* -X */
+    7, 6, 1, 7, 1, 0  /* -Y */
+};
+
+Containers::Array<Vertex> cubeVertices() {
+    Containers::Array<Vertex> vertices{ValueInit, Containers::arraySize(CubePositions)};
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        vertices[i].position = CubePositions[i];
+        vertices[i].padding = 1337.0f;
+        vertices[i].normal = CubePositions[i].normalized();
+        vertices[i].tangent = {Vector3{1.0f, 0.0f, Float(i)}.normalized(), -1.0f};
+    }
+    return vertices;
+}
+
+/* Non-indexed mesh describing the vertex layout. Mutable so it can be used for
+   calculating the expected output on the CPU as well. */
+Trade::MeshData vertexMesh(MeshPrimitive primitive, Containers::ArrayView<Vertex> vertices) {
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    return Trade::MeshData{primitive, Trade::DataFlag::Mutable, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, view.slice(&Vertex::tangent)},
+    }};
+}
+
+template<class T> Containers::Array<T> download(GL::Buffer& buffer, std::size_t count) {
+    Containers::Array<T> out{NoInit, count};
+    Utility::copy(Containers::arrayCast<const T>(buffer.mapRead(0, count*sizeof(T))), out);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(buffer.unmap());
+    return out;
+}
+
+ComputeGLTest::ComputeGLTest() {
+    addTests({&ComputeGLTest::constructNoCreate,
+              &ComputeGLTest::constructCopy,
+              &ComputeGLTest::constructMove,
+
+              &ComputeGLTest::generateSmoothNormals<UnsignedByte>,
+              &ComputeGLTest::generateSmoothNormals<UnsignedShort>,
+              &ComputeGLTest::generateSmoothNormals<UnsignedInt>,
+              &ComputeGLTest::generateSmoothNormalsUnpaddedIndices,
+              &ComputeGLTest::generateSmoothNormalsNoTriangles,
+              &ComputeGLTest::generateSmoothNormalsInvalid,
+
+              &ComputeGLTest::transform3D,
+              &ComputeGLTest::transform3DInvalid,
+
+              &ComputeGLTest::boundingRange,
+              &ComputeGLTest::boundingRangeEmpty,
+              &ComputeGLTest::boundingRangeInvalid});
+}
+
+#ifndef MAGNUM_TARGET_GLES
+constexpr GL::Version ComputeVersion = GL::Version::GL430;
+#else
+constexpr GL::Version ComputeVersion = GL::Version::GLES310;
+#endif
+
+#define SKIP_IF_COMPUTE_NOT_SUPPORTED()                                     \
+    if(!GL::Context::current().isVersionSupported(ComputeVersion))          \
+        CORRADE_SKIP(ComputeVersion << "is not supported.")
+
+void ComputeGLTest::constructNoCreate() {
+    {
+        ComputeGL compute{NoCreate};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ComputeGLTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<ComputeGL>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<ComputeGL>{});
+}
+
+void ComputeGLTest::constructMove() {
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    ComputeGL a;
+
+    ComputeGL b{Utility::move(a)};
+
+    ComputeGL c{NoCreate};
+    c = Utility::move(b);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ComputeGL>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ComputeGL>::value);
+
+    /* The moved-to instance should be usable */
+    Containers::Array<Vertex> vertices = cubeVertices();
+    GL::Buffer vertexBuffer{vertices};
+    Range3D range = c.boundingRange(vertexMesh(MeshPrimitive::Triangles, vertices), vertexBuffer);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(range, (Range3D{{-1.5f, -2.0f, -1.5f}, {1.0f, 1.0f, 1.0f}}));
+}
+
+template<class T> void ComputeGLTest::generateSmoothNormals() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    /* Put the indices at an offset to verify it's taken into account. For
+       8-bit indices this also verifies that they're correctly extracted from
+       a word that isn't four-byte aligned. The size is rounded up to a
+       multiple of four bytes, unpadded buffers are tested in
+       generateSmoothNormalsUnpaddedIndices(). */
+    Containers::Array<T> indices{ValueInit, (3 + Containers::arraySize(CubeIndices) + 3)/4*4};
+    for(std::size_t i = 0; i != Containers::arraySize(CubeIndices); ++i)
+        indices[3 + i] = CubeIndices[i];
+
+    Containers::Array<Vertex> vertices = cubeVertices();
+    /* Garbage that's supposed to get overwritten */
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i].normal = Vector3{Float(i)};
+
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices.slice(3, 3 + Containers::arraySize(CubeIndices))},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+        }};
+
+    GL::Buffer indexBuffer{indices};
+    GL::Buffer vertexBuffer{vertices};
+
+    ComputeGL compute;
+    compute.generateSmoothNormalsInto(mesh, indexBuffer, vertexBuffer);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Array<Vertex> out = download<Vertex>(vertexBuffer, vertices.size());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::normal),
+        MeshTools::generateSmoothNormals(Containers::arrayView(CubeIndices), CubePositions),
+        TestSuite::Compare::Container);
+
+    /* Positions, the padding and tangents should stay untouched */
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::position),
+        Containers::arrayView(CubePositions),
+        TestSuite::Compare::Container);
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i].padding, 1337.0f);
+        CORRADE_COMPARE(out[i].tangent, vertices[i].tangent);
+    }
+}
+
+void ComputeGLTest::generateSmoothNormalsUnpaddedIndices() {
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    /* Index buffers sized exactly to the data, which isn't a multiple of four
+       bytes, like what MeshTools::compile() uploads. The last 32-bit word
+       would reach past the end of the buffer if read directly. The 16-bit
+       indices are at an offset to verify it's taken into account when
+       copying them. */
+    Containers::Array<UnsignedShort> indicesShort{ValueInit, 1 + Containers::arraySize(CubeIndices)};
+    for(std::size_t i = 0; i != Containers::arraySize(CubeIndices); ++i)
+        indicesShort[1 + i] = CubeIndices[i];
+    CORRADE_COMPARE(indicesShort.size()*sizeof(UnsignedShort) % 4, 2);
+    const UnsignedByte indicesByte[]{0, 1, 2};
+
+    Containers::Array<Vertex> vertices = cubeVertices();
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    Trade::MeshData meshShort{MeshPrimitive::Triangles,
+        {}, indicesShort, Trade::MeshIndexData{indicesShort.exceptPrefix(1)},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+        }};
+    Trade::MeshData meshByte{MeshPrimitive::Triangles,
+        {}, indicesByte, Trade::MeshIndexData{indicesByte},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+        }};
+
+    GL::Buffer indexBufferShort{indicesShort};
+    GL::Buffer indexBufferByte{Containers::arrayView(indicesByte)};
+    GL::Buffer vertexBuffer{vertices};
+
+    /* Processing the smaller buffer second verifies the temporary copy gets
+       resized as well */
+    ComputeGL compute;
+    compute.generateSmoothNormalsInto(meshShort, indexBufferShort, vertexBuffer);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Array<Vertex> out = download<Vertex>(vertexBuffer, vertices.size());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::normal),
+        MeshTools::generateSmoothNormals(Containers::arrayView(CubeIndices), CubePositions),
+        TestSuite::Compare::Container);
+
+    compute.generateSmoothNormalsInto(meshByte, indexBufferByte, vertexBuffer);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    out = download<Vertex>(vertexBuffer, vertices.size());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    Containers::Array<Vector3> expected = MeshTools::generateSmoothNormals(Containers::arrayView(indicesByte), CubePositions);
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::normal).prefix(3),
+        expected.prefix(3),
+        TestSuite::Compare::Container);
+}
+
+void ComputeGLTest::generateSmoothNormalsNoTriangles() {
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    Containers::Array<Vertex> vertices = cubeVertices();
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, Containers::ArrayView<const void>{}, Trade::MeshIndexData{Containers::ArrayView<const UnsignedInt>{}},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+        }};
+
+    /* An empty index buffer can't be bound as a SSBO on certain drivers, so
+       put something in */
+    GL::Buffer indexBuffer{Containers::arrayView({0u})};
+    GL::Buffer vertexBuffer{vertices};
+
+    ComputeGL compute;
+    compute.generateSmoothNormalsInto(mesh, indexBuffer, vertexBuffer);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Same as on the CPU, normals of vertices not referenced by any triangle
+       are NaNs */
+    Containers::Array<Vertex> out = download<Vertex>(vertexBuffer, vertices.size());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(Math::isNan(out[i].normal).all());
+    }
+}
+
+void ComputeGLTest::generateSmoothNormalsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct Data {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    } vertices[3]{};
+    const UnsignedInt indices[6]{};
+    const char indexBytes[14]{};
+    Containers::StridedArrayView1D<const Data> view = vertices;
+    Containers::StridedArrayView1D<const Vector3> positions = view.slice(&Data::position);
+    Containers::StridedArrayView1D<const Vector3> normals = view.slice(&Data::normal);
+
+    Trade::MeshData lines{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles,
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData indexCountNotDivisibleBy3{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{Containers::arrayView(indices).prefix(4)},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::stridedArrayView(indices)},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData positions2D{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Data::textureCoordinates)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData noNormals{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions}
+        }};
+    Trade::MeshData normalsHalf{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3h, normals}
+        }};
+    Trade::MeshData unalignedOffset{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, Containers::StridedArrayView1D<const void>{vertices, reinterpret_cast<const char*>(vertices) + 2, 3, sizeof(Data)}},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+    Trade::MeshData unalignedIndexOffset{MeshPrimitive::Triangles,
+        {}, indexBytes, Trade::MeshIndexData{MeshIndexType::UnsignedShort, Containers::StridedArrayView1D<const void>{indexBytes, indexBytes + 1, 6, 2}},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals}
+        }};
+
+    /* The asserts happen before any GL state is touched, so a NoCreate
+       instance is enough */
+    ComputeGL compute{NoCreate};
+    GL::Buffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compute.generateSmoothNormalsInto(lines, buffer, buffer);
+    compute.generateSmoothNormalsInto(notIndexed, buffer, buffer);
+    compute.generateSmoothNormalsInto(indexCountNotDivisibleBy3, buffer, buffer);
+    compute.generateSmoothNormalsInto(implementationSpecificIndexType, buffer, buffer);
+    compute.generateSmoothNormalsInto(noPositions, buffer, buffer);
+    compute.generateSmoothNormalsInto(positions2D, buffer, buffer);
+    compute.generateSmoothNormalsInto(noNormals, buffer, buffer);
+    compute.generateSmoothNormalsInto(normalsHalf, buffer, buffer);
+    compute.generateSmoothNormalsInto(unalignedOffset, buffer, buffer);
+    compute.generateSmoothNormalsInto(unalignedIndexOffset, buffer, buffer);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::Lines\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): the mesh is not indexed\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): index count not divisible by 3\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): can't process an implementation-specific index type MeshIndexType::ImplementationSpecific(0xcaca)\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): the mesh has no positions\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected VertexFormat::Vector3 positions but got VertexFormat::Vector2\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): the mesh has no normals\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected VertexFormat::Vector3 normals but got VertexFormat::Vector3h\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected positive four-byte aligned attribute offsets and strides\n"
+        "MeshTools::ComputeGL::generateSmoothNormalsInto(): expected the index offset to be aligned to the index type size\n");
+}
+
+void ComputeGLTest::transform3D() {
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    Containers::Array<Vertex> vertices = cubeVertices();
+
+    const Matrix4 transformation =
+        Matrix4::translation({1.0f, -2.0f, 3.0f})*
+        Matrix4::rotationY(35.0_degf)*
+        Matrix4::scaling({2.0f, 0.5f, 1.5f});
+
+    /* Expected output calculated on the CPU */
+    Containers::Array<Vertex> expected{NoInit, vertices.size()};
+    Utility::copy(vertices, expected);
+    Trade::MeshData expectedMesh = vertexMesh(MeshPrimitive::Triangles, expected);
+    MeshTools::transform3DInPlace(expectedMesh, transformation);
+
+    GL::Buffer vertexBuffer{vertices};
+
+    ComputeGL compute;
+    compute.transform3DInPlace(vertexMesh(MeshPrimitive::Triangles, vertices), vertexBuffer, transformation);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Array<Vertex> out = download<Vertex>(vertexBuffer, vertices.size());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::position),
+        stridedArrayView(expected).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::normal),
+        stridedArrayView(expected).slice(&Vertex::normal),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(out).slice(&Vertex::tangent),
+        stridedArrayView(expected).slice(&Vertex::tangent),
+        TestSuite::Compare::Container);
+
+    /* The padding should stay untouched */
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i].padding, 1337.0f);
+    }
+}
+
+void ComputeGLTest::transform3DInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData noPositions{MeshPrimitive::Triangles, 3};
+    Trade::MeshData positions2D{MeshPrimitive::Triangles,
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr}
+        }};
+    Trade::MeshData tangents2D{MeshPrimitive::Triangles,
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, VertexFormat::Vector2, nullptr}
+        }};
+    Trade::MeshData bitangentsHalf{MeshPrimitive::Triangles,
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Bitangent, VertexFormat::Vector3h, nullptr}
+        }};
+    Trade::MeshData normalsByte{MeshPrimitive::Triangles,
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, nullptr}
+        }};
+    const char data[3*14]{};
+    Trade::MeshData unalignedStride{MeshPrimitive::Triangles,
+        {}, data, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, Containers::StridedArrayView1D<const void>{data, data, 3, 14}}
+        }};
+
+    ComputeGL compute{NoCreate};
+    GL::Buffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compute.transform3DInPlace(noPositions, buffer, {});
+    compute.transform3DInPlace(noPositions, buffer, {}, 1, 5);
+    compute.transform3DInPlace(positions2D, buffer, {});
+    compute.transform3DInPlace(tangents2D, buffer, {});
+    compute.transform3DInPlace(bitangentsHalf, buffer, {});
+    compute.transform3DInPlace(normalsByte, buffer, {});
+    compute.transform3DInPlace(unalignedStride, buffer, {});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::ComputeGL::transform3DInPlace(): the mesh has no positions with index 0\n"
+        "MeshTools::ComputeGL::transform3DInPlace(): the mesh has no positions with index 1 in morph target 5\n"
+        "MeshTools::ComputeGL::transform3DInPlace(): expected VertexFormat::Vector3 positions but got VertexFormat::Vector2\n"
+        "MeshTools::ComputeGL::transform3DInPlace(): expected VertexFormat::Vector3 or VertexFormat::Vector4 tangents but got VertexFormat::Vector2\n"
+        "MeshTools::ComputeGL::transform3DInPlace(): expected VertexFormat::Vector3 bitangents but got VertexFormat::Vector3h\n"
+        "MeshTools::ComputeGL::transform3DInPlace(): expected VertexFormat::Vector3 normals but got VertexFormat::Vector3bNormalized\n"
+        "MeshTools::ComputeGL::transform3DInPlace(): expected positive four-byte aligned attribute offsets and strides\n");
+}
+
+void ComputeGLTest::boundingRange() {
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    /* More than a single workgroup, with both negative and positive values
+       and a NaN that should get ignored */
+    Containers::Array<Vertex> vertices{ValueInit, 1000};
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i].position = {
+            Math::sin(Rad(Float(i)))*Float(i),
+            -0.5f + Float(i % 37)*0.125f,
+            Float(i)*0.001f - 0.75f};
+    vertices[573].position.y() = Constants::nan();
+
+    GL::Buffer vertexBuffer{vertices};
+
+    ComputeGL compute;
+    const Range3D range = compute.boundingRange(vertexMesh(MeshPrimitive::Points, vertices), vertexBuffer);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The CPU implementation doesn't treat NaNs in any special way, so replace
+       it with a value that's inside the range for the comparison */
+    vertices[573].position.y() = 0.0f;
+    CORRADE_COMPARE(range, MeshTools::boundingRange(stridedArrayView(vertices).slice(&Vertex::position)));
+}
+
+void ComputeGLTest::boundingRangeEmpty() {
+    SKIP_IF_COMPUTE_NOT_SUPPORTED();
+
+    Trade::MeshData mesh{MeshPrimitive::Points,
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+        }};
+
+    GL::Buffer vertexBuffer;
+
+    ComputeGL compute;
+    CORRADE_COMPARE(compute.boundingRange(mesh, vertexBuffer), Range3D{});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ComputeGLTest::boundingRangeInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData noPositions{MeshPrimitive::Points, 3};
+    Trade::MeshData positions4D{MeshPrimitive::Points,
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector4, nullptr}
+        }};
+    const char data[3*16]{};
+    Trade::MeshData unalignedOffset{MeshPrimitive::Points,
+        {}, data, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, Containers::StridedArrayView1D<const void>{data, data + 1, 3, 16}}
+        }};
+
+    ComputeGL compute{NoCreate};
+    GL::Buffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compute.boundingRange(noPositions, buffer);
+    compute.boundingRange(positions4D, buffer);
+    compute.boundingRange(unalignedOffset, buffer);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::ComputeGL::boundingRange(): the mesh has no positions\n"
+        "MeshTools::ComputeGL::boundingRange(): expected VertexFormat::Vector3 positions but got VertexFormat::Vector4\n"
+        "MeshTools::ComputeGL::boundingRange(): expected positive four-byte aligned attribute offsets and strides\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ComputeGLTest)
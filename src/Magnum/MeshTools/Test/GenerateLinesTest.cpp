@@ -48,6 +48,12 @@ struct GenerateLinesTest: TestSuite::Tester {
     void notLines();
     void noAttributes();
     void noPositionAttribute();
+
+    void vertexIndexCount();
+    template<class T> void into();
+    void intoVertexOffset();
+    void intoNotLines();
+    void intoWrongSize();
 };
 
 using namespace Math::Literals;
@@ -107,6 +113,35 @@ const struct {
     /** @todo closed (indexed) strip, once arbitrary index buffer looping is supported */
 };
 
+const struct {
+    const char* name;
+    MeshPrimitive primitive;
+    UnsignedInt elementCount;
+    UnsignedInt expectedVertexCount;
+    UnsignedInt expectedIndexCount;
+} VertexIndexCountData[]{
+    {"empty segments", MeshPrimitive::Lines, 0, 0, 0},
+    {"segments", MeshPrimitive::Lines, 8, 16, 24},
+    {"empty strip", MeshPrimitive::LineStrip, 0, 0, 0},
+    {"strip, one segment", MeshPrimitive::LineStrip, 2, 4, 6},
+    {"strip", MeshPrimitive::LineStrip, 5, 16, 42},
+    {"empty loop", MeshPrimitive::LineLoop, 0, 0, 0},
+    {"loop, two vertices", MeshPrimitive::LineLoop, 2, 8, 24},
+    {"loop", MeshPrimitive::LineLoop, 4, 16, 48},
+};
+
+const struct {
+    const char* name;
+    MeshPrimitive primitive;
+    UnsignedInt positionCount;
+} IntoData[]{
+    {"segments", MeshPrimitive::Lines, 8},
+    {"strip", MeshPrimitive::LineStrip, 5},
+    {"strip, one segment", MeshPrimitive::LineStrip, 2},
+    {"loop", MeshPrimitive::LineLoop, 5},
+    {"loop, two vertices", MeshPrimitive::LineLoop, 2},
+};
+
 GenerateLinesTest::GenerateLinesTest() {
     addInstancedTests<GenerateLinesTest>({
         &GenerateLinesTest::oneLoop<UnsignedInt>,
@@ -122,6 +157,18 @@ GenerateLinesTest::GenerateLinesTest() {
               &GenerateLinesTest::notLines,
               &GenerateLinesTest::noAttributes,
               &GenerateLinesTest::noPositionAttribute});
+
+    addInstancedTests({&GenerateLinesTest::vertexIndexCount},
+        Containers::arraySize(VertexIndexCountData));
+
+    addInstancedTests<GenerateLinesTest>({
+        &GenerateLinesTest::into<Vector2>,
+        &GenerateLinesTest::into<Vector3>},
+        Containers::arraySize(IntoData));
+
+    addTests({&GenerateLinesTest::intoVertexOffset,
+              &GenerateLinesTest::intoNotLines,
+              &GenerateLinesTest::intoWrongSize});
 }
 
 template<class T> void GenerateLinesTest::oneLoop() {
@@ -665,6 +712,142 @@ void GenerateLinesTest::noPositionAttribute() {
     CORRADE_COMPARE(out.str(), "MeshTools::generateLines(): the mesh has no positions\n");
 }
 
+void GenerateLinesTest::vertexIndexCount() {
+    auto&& data = VertexIndexCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_COMPARE(generateLinesVertexCount(data.primitive, data.elementCount), data.expectedVertexCount);
+    CORRADE_COMPARE(generateLinesIndexCount(data.primitive, data.elementCount), data.expectedIndexCount);
+}
+
+template<class T> void GenerateLinesTest::into() {
+    auto&& data = IntoData[testCaseInstanceId()];
+    setTestCaseTemplateName(T::Size == 2 ? "Vector2" : "Vector3");
+    setTestCaseDescription(data.name);
+
+    /* Some arbitrary positions, distinct enough to catch wrong neighbors */
+    Containers::Array<T> positions{NoInit, data.positionCount};
+    for(UnsignedInt i = 0; i != positions.size(); ++i)
+        positions[i] = T::pad(Vector3{Float(i), Float(i*i), Float(10 - i)});
+
+    Trade::MeshData expected = generateLines(Trade::MeshData{data.primitive, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::stridedArrayView(positions)}
+    }});
+
+    const UnsignedInt vertexCount = generateLinesVertexCount(data.primitive, positions.size());
+    const UnsignedInt indexCount = generateLinesIndexCount(data.primitive, positions.size());
+    CORRADE_COMPARE(vertexCount, expected.vertexCount());
+    CORRADE_COMPARE(indexCount, expected.indexCount());
+
+    /* Output interleaved to verify strides are respected */
+    struct Vertex {
+        T position;
+        T previousPosition;
+        T nextPosition;
+        UnsignedInt annotation;
+    };
+    Containers::Array<Vertex> vertices{ValueInit, vertexCount};
+    Containers::Array<UnsignedInt> indices{ValueInit, indexCount};
+    Containers::StridedArrayView1D<Vertex> verticesView = vertices;
+    generateLinesInto(data.primitive, Containers::arrayView(positions),
+        verticesView.slice(&Vertex::position),
+        verticesView.slice(&Vertex::previousPosition),
+        verticesView.slice(&Vertex::nextPosition),
+        verticesView.slice(&Vertex::annotation),
+        indices);
+
+    CORRADE_COMPARE_AS(indices,
+        expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(verticesView.slice(&Vertex::position),
+        expected.attribute<T>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(verticesView.slice(&Vertex::previousPosition),
+        expected.attribute<T>(Implementation::LineMeshAttributePreviousPosition),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(verticesView.slice(&Vertex::nextPosition),
+        expected.attribute<T>(Implementation::LineMeshAttributeNextPosition),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(verticesView.slice(&Vertex::annotation),
+        expected.attribute<UnsignedInt>(Implementation::LineMeshAttributeAnnotation),
+        TestSuite::Compare::Container);
+}
+
+void GenerateLinesTest::intoVertexOffset() {
+    /* Two strips generated in two batches into a single buffer */
+    const Vector2 first[]{{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}};
+    const Vector2 second[]{{5.0f, 5.0f}, {6.0f, 5.0f}};
+
+    Vector2 positions[12];
+    Vector2 previousPositions[12];
+    Vector2 nextPositions[12];
+    UnsignedInt annotations[12];
+    UnsignedInt indices[24];
+    generateLinesInto(MeshPrimitive::LineStrip, first,
+        Containers::arrayView(positions).prefix(8),
+        Containers::arrayView(previousPositions).prefix(8),
+        Containers::arrayView(nextPositions).prefix(8),
+        Containers::arrayView(annotations).prefix(8),
+        Containers::arrayView(indices).prefix(18));
+    generateLinesInto(MeshPrimitive::LineStrip, second,
+        Containers::arrayView(positions).exceptPrefix(8),
+        Containers::arrayView(previousPositions).exceptPrefix(8),
+        Containers::arrayView(nextPositions).exceptPrefix(8),
+        Containers::arrayView(annotations).exceptPrefix(8),
+        Containers::arrayView(indices).exceptPrefix(18), 8);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        2, 0, 1, 1, 3, 2,
+        2, 3, 4, 4, 3, 5, /* join */
+        6, 4, 5, 5, 7, 6,
+        10, 8, 9, 9, 11, 10,
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(positions).exceptPrefix(8), Containers::arrayView<Vector2>({
+        {5.0f, 5.0f}, {5.0f, 5.0f},
+            {6.0f, 5.0f}, {6.0f, 5.0f}
+    }), TestSuite::Compare::Container);
+    /* The batches don't see each other */
+    CORRADE_COMPARE(nextPositions[7], Vector2{});
+    CORRADE_COMPARE(previousPositions[8], Vector2{});
+}
+
+void GenerateLinesTest::intoNotLines() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector2 positions[3]{};
+    Vector2 outputPositions[12];
+    UnsignedInt outputAnnotations[12];
+    UnsignedInt outputIndices[18];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    generateLinesVertexCount(MeshPrimitive::Triangles, 3);
+    generateLinesIndexCount(MeshPrimitive::Triangles, 3);
+    generateLinesInto(MeshPrimitive::Triangles, positions, outputPositions, outputPositions, outputPositions, outputAnnotations, outputIndices);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateLinesVertexCount(): expected a line primitive, got MeshPrimitive::Triangles\n"
+        "MeshTools::generateLinesIndexCount(): expected a line primitive, got MeshPrimitive::Triangles\n"
+        "MeshTools::generateLinesInto(): expected a line primitive, got MeshPrimitive::Triangles\n");
+}
+
+void GenerateLinesTest::intoWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector3 positions[3]{};
+    Vector3 outputPositions[8];
+    Vector3 outputPositionsWrong[7];
+    UnsignedInt outputAnnotations[8];
+    UnsignedInt outputIndices[18];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    generateLinesInto(MeshPrimitive::LineStrip, positions, outputPositions, outputPositions, outputPositionsWrong, outputAnnotations, outputIndices);
+    generateLinesInto(MeshPrimitive::LineStrip, positions, outputPositions, outputPositions, outputPositions, outputAnnotations, Containers::arrayView(outputIndices).exceptSuffix(1));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateLinesInto(): expected output vertex views to have a size of 8 but got 8, 8, 7 and 8\n"
+        "MeshTools::generateLinesInto(): expected output index view to have a size of 18 but got 17\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateLinesTest)
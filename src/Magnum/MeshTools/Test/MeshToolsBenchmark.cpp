@@ -0,0 +1,351 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/MeshTools/Concatenate.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateNormals.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Test/BenchmarkTester.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct MeshToolsBenchmark: Magnum::Test::BenchmarkTester {
+    explicit MeshToolsBenchmark();
+
+    void concatenate();
+    void removeDuplicates();
+    void generateSmoothNormals();
+    void tipsify();
+    void interleave();
+    void compressIndices();
+    void duplicate();
+    void transform3D();
+};
+
+/* Deterministic value noise, a function of the grid coordinates only so
+   vertices on edges shared by neighboring tiles are bit-exact */
+Float noise(UnsignedInt x, UnsignedInt y) {
+    UnsignedInt h = x*374761393u + y*668265263u;
+    h = (h ^ (h >> 13))*1274126177u;
+    return Float((h ^ (h >> 16)) & 0xffff)/65535.0f;
+}
+
+/* Scanned-mesh-like input -- a noisy heightfield split into 4x4 separately
+   captured tiles of 128x128 quads each. Positions and colors are in separate
+   non-interleaved arrays, vertices on tile edges are duplicated. */
+constexpr UnsignedInt ScannedTileCount = 4;
+constexpr UnsignedInt ScannedTileSize = 128;
+
+Containers::Array<Trade::MeshData> scannedMesh() {
+    constexpr UnsignedInt VertexCount = (ScannedTileSize + 1)*(ScannedTileSize + 1);
+
+    Containers::Array<Trade::MeshData> tiles;
+    for(UnsignedInt tileY = 0; tileY != ScannedTileCount; ++tileY) {
+        for(UnsignedInt tileX = 0; tileX != ScannedTileCount; ++tileX) {
+            Containers::Array<char> vertexData{NoInit, VertexCount*(sizeof(Vector3) + sizeof(Color3))};
+            const Containers::ArrayView<Vector3> positions = Containers::arrayCast<Vector3>(vertexData.prefix(VertexCount*sizeof(Vector3)));
+            const Containers::ArrayView<Color3> colors = Containers::arrayCast<Color3>(vertexData.exceptPrefix(VertexCount*sizeof(Vector3)));
+            for(UnsignedInt y = 0; y <= ScannedTileSize; ++y) {
+                for(UnsignedInt x = 0; x <= ScannedTileSize; ++x) {
+                    const UnsignedInt globalX = tileX*ScannedTileSize + x;
+                    const UnsignedInt globalY = tileY*ScannedTileSize + y;
+                    const Float n = noise(globalX, globalY);
+                    const std::size_t i = y*(ScannedTileSize + 1) + x;
+                    positions[i] = {globalX*0.01f, globalY*0.01f,
+                        Math::sin(Rad(globalX*0.05f))*Math::cos(Rad(globalY*0.03f)) + n*0.002f};
+                    colors[i] = Color3{n*0.1f + 0.5f};
+                }
+            }
+
+            Containers::Array<char> indexData{NoInit, ScannedTileSize*ScannedTileSize*6*sizeof(UnsignedInt)};
+            const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+            std::size_t i = 0;
+            for(UnsignedInt y = 0; y != ScannedTileSize; ++y) {
+                for(UnsignedInt x = 0; x != ScannedTileSize; ++x) {
+                    const UnsignedInt a = y*(ScannedTileSize + 1) + x;
+                    const UnsignedInt b = a + ScannedTileSize + 1;
+                    indices[i++] = a;
+                    indices[i++] = a + 1;
+                    indices[i++] = b + 1;
+                    indices[i++] = a;
+                    indices[i++] = b + 1;
+                    indices[i++] = b;
+                }
+            }
+
+            arrayAppend(tiles, Trade::MeshData{MeshPrimitive::Triangles,
+                std::move(indexData), Trade::MeshIndexData{indices},
+                std::move(vertexData), {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions},
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Color, colors}
+                }});
+        }
+    }
+
+    return tiles;
+}
+
+/* CAD-like input -- a large amount of small randomly placed parts with hard
+   edges, each with interleaved positions and normals */
+Containers::Array<Trade::MeshData> cadModel() {
+    /* Default-seeded to have the benchmark reproducible */
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> position{-100.0f, 100.0f};
+    std::uniform_real_distribution<Float> angle{0.0f, 360.0f};
+    std::uniform_real_distribution<Float> scale{0.1f, 2.0f};
+
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Trade::MeshData cylinder = Primitives::cylinderSolid(1, 24, 1.0f, Primitives::CylinderFlag::CapEnds);
+
+    Containers::Array<Trade::MeshData> parts;
+    for(std::size_t i = 0; i != 4096; ++i) {
+        const Matrix4 transformation =
+            Matrix4::translation({position(g), position(g), position(g)})*
+            Matrix4::rotationY(Deg(angle(g)))*
+            Matrix4::scaling(Vector3{scale(g)});
+        arrayAppend(parts, MeshTools::transform3D(i % 2 ? cylinder : cube, transformation));
+    }
+
+    return parts;
+}
+
+/* Non-indexed copy of the mesh with each attribute in a separate contiguous
+   array */
+Trade::MeshData deinterleave(const Trade::MeshData& mesh) {
+    std::size_t vertexDataSize = 0;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        vertexDataSize += mesh.vertexCount()*vertexFormatSize(mesh.attributeFormat(i));
+
+    Containers::Array<char> vertexData{NoInit, vertexDataSize};
+    Containers::Array<Trade::MeshAttributeData> attributes{ValueInit, mesh.attributeCount()};
+    std::size_t offset = 0;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        const std::size_t size = vertexFormatSize(format);
+        const Containers::StridedArrayView2D<char> dst{vertexData.sliceSize(offset, mesh.vertexCount()*size), {mesh.vertexCount(), size}};
+        Utility::copy(mesh.attribute(i), dst);
+        attributes[i] = Trade::MeshAttributeData{mesh.attributeName(i), format, dst};
+        offset += mesh.vertexCount()*size;
+    }
+
+    return Trade::MeshData{mesh.primitive(), std::move(vertexData), std::move(attributes)};
+}
+
+const struct {
+    const char* name;
+    Containers::Array<Trade::MeshData>(*generate)();
+} Data[]{
+    {"scanned mesh", scannedMesh},
+    {"CAD model", cadModel}
+};
+
+MeshToolsBenchmark::MeshToolsBenchmark(): BenchmarkTester{"MeshToolsBenchmark"} {
+    const std::initializer_list<void(MeshToolsBenchmark::*)()> benchmarks{
+        &MeshToolsBenchmark::concatenate,
+        &MeshToolsBenchmark::removeDuplicates,
+        &MeshToolsBenchmark::generateSmoothNormals,
+        &MeshToolsBenchmark::tipsify,
+        &MeshToolsBenchmark::interleave,
+        &MeshToolsBenchmark::compressIndices,
+        &MeshToolsBenchmark::duplicate,
+        &MeshToolsBenchmark::transform3D};
+
+    addCustomInstancedBenchmarks<MeshToolsBenchmark>(benchmarks, 5,
+        Containers::arraySize(Data),
+        &MeshToolsBenchmark::throughputBenchmarkBegin,
+        &MeshToolsBenchmark::throughputBenchmarkEnd,
+        BenchmarkUnits::Count);
+
+    if(MemoryBenchmarkSupported)
+        addCustomInstancedBenchmarks<MeshToolsBenchmark>(benchmarks, 1,
+            Containers::arraySize(Data),
+            &MeshToolsBenchmark::memoryBenchmarkBegin,
+            &MeshToolsBenchmark::memoryBenchmarkEnd,
+            BenchmarkUnits::Bytes);
+}
+
+void MeshToolsBenchmark::concatenate() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("concatenate", data.name);
+
+    Containers::Array<Trade::MeshData> parts = data.generate();
+    UnsignedInt vertexCount = 0;
+    for(const Trade::MeshData& part: parts)
+        vertexCount += part.vertexCount();
+
+    UnsignedInt outputVertexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        outputVertexCount = MeshTools::concatenate(parts).vertexCount();
+        addProcessedElements(outputVertexCount);
+    }
+
+    CORRADE_COMPARE(outputVertexCount, vertexCount);
+}
+
+void MeshToolsBenchmark::removeDuplicates() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("removeDuplicates", data.name);
+
+    /* Triangle soup, as is common for STL files or scanner output */
+    const Trade::MeshData mesh = MeshTools::duplicate(MeshTools::concatenate(data.generate()));
+
+    UnsignedInt outputVertexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        outputVertexCount = MeshTools::removeDuplicates(mesh).vertexCount();
+        addProcessedElements(mesh.vertexCount());
+    }
+
+    CORRADE_COMPARE_AS(outputVertexCount, mesh.vertexCount(),
+        TestSuite::Compare::Less);
+    /* Vertices on the tile edges are bit-exact so they should be merged as
+       well */
+    if(data.generate == scannedMesh)
+        CORRADE_COMPARE(outputVertexCount, (ScannedTileCount*ScannedTileSize + 1)*(ScannedTileCount*ScannedTileSize + 1));
+}
+
+void MeshToolsBenchmark::generateSmoothNormals() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("generateSmoothNormals", data.name);
+
+    const Trade::MeshData mesh = MeshTools::concatenate(data.generate());
+    const Containers::StridedArrayView1D<const UnsignedInt> indices = mesh.indices<UnsignedInt>();
+    const Containers::StridedArrayView1D<const Vector3> positions = mesh.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    std::size_t normalCount = 0;
+    CORRADE_BENCHMARK(1) {
+        normalCount = MeshTools::generateSmoothNormals(indices, positions).size();
+        addProcessedElements(indices.size());
+    }
+
+    CORRADE_COMPARE(normalCount, mesh.vertexCount());
+}
+
+void MeshToolsBenchmark::tipsify() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("tipsify", data.name);
+
+    const Trade::MeshData mesh = MeshTools::concatenate(data.generate());
+    const Containers::StridedArrayView1D<const UnsignedInt> indices = mesh.indices<UnsignedInt>();
+    Containers::Array<UnsignedInt> optimized{NoInit, indices.size()};
+
+    CORRADE_BENCHMARK(1) {
+        /* Restoring the original order every time so each iteration does the
+           same work, the copy is negligible compared to the optimization */
+        Utility::copy(indices, Containers::stridedArrayView(optimized));
+        MeshTools::tipsifyInPlace(optimized, mesh.vertexCount(), 24);
+        addProcessedElements(indices.size());
+    }
+
+    CORRADE_COMPARE(optimized.size(), indices.size());
+}
+
+void MeshToolsBenchmark::interleave() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("interleave", data.name);
+
+    const Trade::MeshData mesh = deinterleave(MeshTools::concatenate(data.generate()));
+
+    UnsignedInt outputVertexCount = 0;
+    bool interleaved = false;
+    CORRADE_BENCHMARK(1) {
+        Trade::MeshData out = MeshTools::interleave(mesh);
+        outputVertexCount = out.vertexCount();
+        interleaved = MeshTools::isInterleaved(out);
+        addProcessedElements(mesh.vertexCount());
+    }
+
+    CORRADE_COMPARE(outputVertexCount, mesh.vertexCount());
+    CORRADE_VERIFY(interleaved);
+}
+
+void MeshToolsBenchmark::compressIndices() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("compressIndices", data.name);
+
+    const Trade::MeshData mesh = MeshTools::concatenate(data.generate());
+
+    MeshIndexType type{};
+    CORRADE_BENCHMARK(1) {
+        type = MeshTools::compressIndices(mesh).indexType();
+        addProcessedElements(mesh.indexCount());
+    }
+
+    /* Both meshes have more than 65k vertices */
+    CORRADE_COMPARE(type, MeshIndexType::UnsignedInt);
+}
+
+void MeshToolsBenchmark::duplicate() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("duplicate", data.name);
+
+    const Trade::MeshData mesh = MeshTools::concatenate(data.generate());
+
+    UnsignedInt outputVertexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        outputVertexCount = MeshTools::duplicate(mesh).vertexCount();
+        addProcessedElements(outputVertexCount);
+    }
+
+    CORRADE_COMPARE(outputVertexCount, mesh.indexCount());
+}
+
+void MeshToolsBenchmark::transform3D() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("transform3D", data.name);
+
+    const Trade::MeshData mesh = MeshTools::concatenate(data.generate());
+    const Matrix4 transformation = Matrix4::rotationX(35.0_degf)*Matrix4::scaling({2.0f, 0.5f, 1.0f});
+
+    UnsignedInt outputVertexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        outputVertexCount = MeshTools::transform3D(mesh, transformation).vertexCount();
+        addProcessedElements(mesh.vertexCount());
+    }
+
+    CORRADE_COMPARE(outputVertexCount, mesh.vertexCount());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshToolsBenchmark)
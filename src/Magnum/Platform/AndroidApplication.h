@@ -460,6 +460,12 @@ class AndroidApplication::GLConfiguration: public GL::Context::Configuration {
          * @see @ref Flags, @ref setFlags(), @ref GL::Context::Flag
          */
         enum class Flag: UnsignedLong {
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
@@ -1037,6 +1037,12 @@ class EmscriptenApplication::GLConfiguration: public GL::Context::Configuration
              */
             ProxyContextToMainThread = 1 << 8,
 
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
@@ -837,6 +837,12 @@ class GlfwApplication::GLConfiguration: public GL::Context::Configuration {
 
             Stereo = 1 << 3,    /**< Stereo rendering */
 
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
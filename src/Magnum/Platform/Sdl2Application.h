@@ -1347,6 +1347,12 @@ class Sdl2Application::GLConfiguration: public GL::Context::Configuration {
             #endif
             #endif
 
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
@@ -230,6 +230,12 @@ class WindowlessEglContext::Configuration: public GL::Context::Configuration {
             NoError = 1ull << 32,
             #endif
 
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
@@ -225,6 +225,12 @@ class WindowlessGlxContext::Configuration: public GL::Context::Configuration {
                handling manually. */
             NoError = 1ull << 32,
 
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
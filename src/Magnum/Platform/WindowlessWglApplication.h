@@ -212,6 +212,12 @@ class WindowlessWglContext::Configuration: public GL::Context::Configuration {
                handling manually. */
             NoError = 1ull << 32,
 
+            /**
+             * @copydoc GL::Context::Configuration::Flag::CacheExtensions
+             * @m_since_latest
+             */
+            CacheExtensions = UnsignedLong(GL::Context::Configuration::Flag::CacheExtensions),
+
             /**
              * @copydoc GL::Context::Configuration::Flag::QuietLog
              * @m_since_latest
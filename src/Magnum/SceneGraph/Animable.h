@@ -106,6 +106,25 @@ just puts itself to rest and waits until some animation changes its state to
 permanently running into separate group, they will not be traversed every time
 the @ref AnimableGroup::step() gets called, saving precious frame time.
 
+@section SceneGraph-Animable-parallel Parallel animation stepping
+
+With large numbers of running animables, calling @ref animationStep() on each
+of them serially can take a significant portion of the frame time. If the
+step of an animable only updates its own data, you can mark it with
+@ref setThreadSafe() and enable multiple threads by making a @ref ThreadPool
+with worker threads the @ref ThreadPool::setGlobal() "global pool":
+
+@snippet SceneGraph.cpp Animable-parallel
+
+@ref AnimableGroup::step() then first goes serially through all animables,
+handles state changes, calls the @ref animationStarted(),
+@ref animationPaused(), @ref animationResumed() and @ref animationStopped()
+callbacks in order and calls @ref animationStep() for animables that aren't
+thread-safe. After that, @ref animationStep() of all running thread-safe
+animables is called, partitioned across the pool threads. Because of that,
+the state change callbacks are always called in the same order regardless of
+the thread count and thread-safe animables always see a consistent state.
+
 @section SceneGraph-Animable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -201,6 +220,36 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
             return *this;
         }
 
+        /**
+         * @brief Whether the animation step is thread-safe
+         * @m_since_latest
+         *
+         * @see @ref setThreadSafe()
+         */
+        bool isThreadSafe() const { return _threadSafe; }
+
+        /**
+         * @brief Mark the animation step as thread-safe
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If enabled and the @ref ThreadPool::global() "global thread pool"
+         * has worker threads or a dispatch callback, @ref animationStep() may
+         * be called from a worker thread, concurrently with steps of other thread-safe animables in
+         * the same group. Only mark the animable as thread-safe if its
+         * @ref animationStep() doesn't touch any state shared with other
+         * animables, the group or the scene graph, and doesn't call
+         * @ref setState() or any other function on the animable itself. The
+         * state change callbacks such as @ref animationStarted() are always
+         * called on the thread calling @ref AnimableGroup::step(). Default is
+         * @cpp false @ce. See @ref SceneGraph-Animable-parallel for more
+         * information.
+         */
+        Animable<dimensions, T>& setThreadSafe(bool threadSafe) {
+            _threadSafe = threadSafe;
+            return *this;
+        }
+
         /**
          * @brief Group containing this animable
          *
@@ -299,6 +348,7 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         Float _startTime, _pauseTime;
         AnimationState _previousState, _currentState;
         bool _repeated;
+        bool _threadSafe;
         UnsignedShort _repeatCount;
         UnsignedShort _repeats;
 };
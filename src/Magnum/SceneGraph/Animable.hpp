@@ -29,6 +29,9 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
@@ -36,7 +39,7 @@
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>{object, group}, _duration{0.0f}, _startTime{Constants::inf()}, _pauseTime{-Constants::inf()}, _previousState{AnimationState::Stopped}, _currentState{AnimationState::Stopped}, _repeated{false}, _repeatCount{0}, _repeats{0} {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>{object, group}, _duration{0.0f}, _startTime{Constants::inf()}, _pauseTime{-Constants::inf()}, _previousState{AnimationState::Stopped}, _currentState{AnimationState::Stopped}, _repeated{false}, _threadSafe{false}, _repeatCount{0}, _repeats{0} {}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
     /* Update count of running animations when deleting an animable that's
@@ -70,6 +73,14 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
     if(!_runningCount && !wakeUp) return;
     wakeUp = false;
 
+    /* Running thread-safe animables, stepped after the serial pass if the
+       global pool can run them on more than one thread (concurrency of 0
+       means a dispatch callback is set). Cleared here and not after to not
+       lose the capacity. */
+    ThreadPool& pool = ThreadPool::global();
+    const bool parallel = pool.concurrency() != 1;
+    arrayResize(_parallelAnimables, NoInit, 0); /** @todo arrayClear() */
+
     for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
         Animable<dimensions, T>& animable = (*this)[i];
 
@@ -135,10 +146,31 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
         CORRADE_ASSERT(delta >= 0.0f,
             "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable._startTime, delta);
+        if(parallel && animable._threadSafe)
+            arrayAppend(_parallelAnimables, &animable);
+        else
+            animable.animationStep(time - animable._startTime, delta);
     }
 
     CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+
+    /* Step all running thread-safe animables in parallel. The serial pass
+       above is done already, so nothing modifies the start time anymore. */
+    if(!_parallelAnimables.isEmpty()) {
+        struct State {
+            Animable<dimensions, T>** animables;
+            Float time, delta;
+        } state{_parallelAnimables.data(), time, delta};
+        /* A single animable step is usually cheap, so process them in
+           batches to not drown the pool in tiny jobs */
+        pool.parallelFor(_parallelAnimables.size(), 64, [](void* state, std::size_t begin, std::size_t end) {
+            const State& s = *static_cast<const State*>(state);
+            for(std::size_t i = begin; i != end; ++i) {
+                Animable<dimensions, T>& animable = *s.animables[i];
+                animable.animationStep(s.time - animable._startTime, s.delta);
+            }
+        }, &state);
+    }
 }
 
 }}
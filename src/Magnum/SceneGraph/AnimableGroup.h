@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::AnimableGroup, alias @ref Magnum::SceneGraph::BasicAnimableGroup2D, @ref Magnum::SceneGraph::BasicAnimableGroup3D, typedef @ref Magnum::SceneGraph::AnimableGroup2D, @ref Magnum::SceneGraph::AnimableGroup3D
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/SceneGraph/Animable.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/SceneGraph/visibility.h"
@@ -63,7 +65,12 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
          * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
-         * If there are no running animations the function does nothing.
+         * If there are no running animations the function does nothing. If
+         * the @ref ThreadPool::global() "global thread pool" has worker
+         * threads or a dispatch callback, animables marked with
+         * @ref Animable::setThreadSafe() are stepped in parallel after all
+         * other animables, see @ref SceneGraph-Animable-parallel for more
+         * information.
          * @see @ref runningCount()
          */
         void step(Float time, Float delta);
@@ -71,6 +78,7 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
     private:
         std::size_t _runningCount;
         bool wakeUp;
+        Containers::Array<Animable<dimensions, T>*> _parallelAnimables;
 };
 
 /**
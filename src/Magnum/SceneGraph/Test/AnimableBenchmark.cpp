@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/Animable.h"
+#include "Magnum/SceneGraph/AnimableGroup.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct AnimableBenchmark: TestSuite::Tester {
+    explicit AnimableBenchmark();
+
+    void step();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt workerCount;
+    bool threadSafe;
+} StepData[]{
+    {"serial", 0, false},
+    {"thread-safe, no workers", 0, true},
+    {"thread-safe, 1 worker", 1, true},
+    {"thread-safe, 3 workers", 3, true},
+    {"thread-safe, 7 workers", 7, true}
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+enum: std::size_t { AnimableCount = 50000 };
+
+/* Does a bit of math on its own data only, to simulate a typical lightweight
+   animation such as a procedural wobble */
+class WobbleAnimable: public Animable3D {
+    public:
+        explicit WobbleAnimable(Object3D& object, AnimableGroup3D& group): Animable3D{object, &group} {}
+
+        Vector3 offset;
+
+    private:
+        void animationStep(Float time, Float) override {
+            for(std::size_t i = 0; i != 8; ++i)
+                offset = Vector3{Math::sin(Rad(time + i)), Math::cos(Rad(time*0.5f + i)), Math::sin(Rad(time*0.25f + i))};
+        }
+};
+
+AnimableBenchmark::AnimableBenchmark() {
+    addInstancedBenchmarks({&AnimableBenchmark::step}, 10,
+        Containers::arraySize(StepData));
+}
+
+void AnimableBenchmark::step() {
+    auto&& data = StepData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.workerCount};
+
+    Object3D object;
+    AnimableGroup3D group;
+
+    Containers::Array<Containers::Pointer<WobbleAnimable>> animables{ValueInit, AnimableCount};
+    for(Containers::Pointer<WobbleAnimable>& animable: animables) {
+        animable.emplace(object, group);
+        animable->setThreadSafe(data.threadSafe)
+            .setState(AnimationState::Running);
+    }
+
+    /* Start all animations outside of the benchmark loop */
+    group.step(0.0f, 0.0f);
+
+    Float time = 0.0f;
+    ThreadPool::setGlobal(&pool);
+    CORRADE_BENCHMARK(1) {
+        time += 1.0f/60.0f;
+        group.step(time, 1.0f/60.0f);
+    }
+    ThreadPool::setGlobal(nullptr);
+
+    CORRADE_COMPARE(group.runningCount(), AnimableCount);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::AnimableBenchmark)
@@ -24,9 +24,12 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
+#include "Magnum/ThreadPool.h"
 #include "Magnum/SceneGraph/AbstractFeature.hpp"
 #include "Magnum/SceneGraph/Animable.hpp"
 #include "Magnum/SceneGraph/AnimableGroup.h"
@@ -48,6 +51,8 @@ struct AnimableTest: TestSuite::Tester {
 
     void deleteWhileRunning();
 
+    template<class T> void parallel();
+
     void debug();
 };
 
@@ -67,6 +72,9 @@ AnimableTest::AnimableTest() {
 
               &AnimableTest::deleteWhileRunning,
 
+              &AnimableTest::parallel<Float>,
+              &AnimableTest::parallel<Double>,
+
               &AnimableTest::debug});
 }
 
@@ -399,6 +407,80 @@ void AnimableTest::deleteWhileRunning() {
     CORRADE_COMPARE(group.runningCount(), 0);
 }
 
+template<class T> void AnimableTest::parallel() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class ParallelAnimable: public SceneGraph::BasicAnimable3D<T> {
+        public:
+            ParallelAnimable(AbstractBasicObject3D<T>& object, BasicAnimableGroup3D<T>& group, std::string& trackedState, char id, Float duration): SceneGraph::BasicAnimable3D<T>{object, &group}, _trackedState(trackedState), _id{id} {
+                this->setDuration(duration);
+            }
+
+            Float time = -1.0f, delta = -1.0f;
+            Int stepCount = 0;
+
+        protected:
+            void animationStep(Float time, Float delta) override {
+                this->time = time;
+                this->delta = delta;
+                ++stepCount;
+            }
+
+            /* These are called serially, so appending to a shared string is
+               fine */
+            void animationStarted() override { _trackedState += _id; }
+            void animationStopped() override { _trackedState += '-'; _trackedState += _id; }
+
+        private:
+            std::string& _trackedState;
+            char _id;
+    };
+
+    /* The result has to be the same regardless of the worker count */
+    for(UnsignedInt workerCount: {0u, 3u, 63u}) {
+        CORRADE_ITERATION(workerCount);
+
+        ThreadPool pool{workerCount};
+        Object3D<T> object;
+        BasicAnimableGroup3D<T> group;
+        std::string trackedState;
+
+        /* Every third animable is not thread-safe, even ones stop after the
+           first step */
+        Containers::Array<Containers::Pointer<ParallelAnimable>> animables{ValueInit, 26};
+        for(std::size_t i = 0; i != animables.size(); ++i) {
+            animables[i].emplace(object, group, trackedState, char('a' + i), i % 2 ? 0.0f : 3.0f);
+            animables[i]->setThreadSafe(i % 3 != 0)
+                .setState(AnimationState::Running);
+        }
+
+        ThreadPool::setGlobal(&pool);
+        group.step(1.0f, 0.5f);
+        ThreadPool::setGlobal(nullptr);
+        CORRADE_COMPARE(group.runningCount(), 26);
+        CORRADE_COMPARE(trackedState, "abcdefghijklmnopqrstuvwxyz");
+        for(std::size_t i = 0; i != animables.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(animables[i]->stepCount, 1);
+            CORRADE_COMPARE(animables[i]->time, 0.0f);
+            CORRADE_COMPARE(animables[i]->delta, 0.5f);
+        }
+
+        trackedState.clear();
+        ThreadPool::setGlobal(&pool);
+        group.step(5.0f, 4.0f);
+        ThreadPool::setGlobal(nullptr);
+        CORRADE_COMPARE(group.runningCount(), 13);
+        CORRADE_COMPARE(trackedState, "-a-c-e-g-i-k-m-o-q-s-u-w-y");
+        for(std::size_t i = 0; i != animables.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(animables[i]->stepCount, i % 2 ? 2 : 1);
+            CORRADE_COMPARE(animables[i]->time, i % 2 ? 4.0f : 0.0f);
+            CORRADE_COMPARE(animables[i]->delta, i % 2 ? 4.0f : 0.5f);
+        }
+    }
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running << AnimationState(0xbe);
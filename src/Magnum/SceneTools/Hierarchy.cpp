@@ -33,6 +33,7 @@
 #include <Corrade/Containers/Triple.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/SceneData.h"
@@ -330,10 +331,14 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
        transformation for given mesh. */
     const auto mapping = Containers::arrayCast<UnsignedInt>(outputTransformations);
     scene.mappingInto(fieldId, mapping);
-    for(std::size_t i = 0; i != mapping.size(); ++i) {
-        CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
-        outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
-    }
+    /* Each entry reads and overwrites only its own location, so the entries
+       can be processed in parallel */
+    ThreadPool::global().parallelFor(mapping.size(), 16384, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
+            outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
+        }
+    });
 }
 
 template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
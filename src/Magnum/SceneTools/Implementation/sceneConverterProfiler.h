@@ -0,0 +1,279 @@
+#ifndef Magnum_SceneTools_Implementation_sceneConverterProfiler_h
+#define Magnum_SceneTools_Implementation_sceneConverterProfiler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm> /* std::stable_sort() */
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringStl.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/FormatStl.h>
+
+#ifdef CORRADE_TARGET_UNIX
+#include <sys/resource.h>
+#endif
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define MAGNUM_SCENECONVERTER_PROFILER_MALLINFO2
+#endif
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Implementation/peakMemory.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace SceneTools { namespace Implementation {
+
+/* Used only in executables where we don't want it to be exported -- in
+   particular magnum-sceneconverter and its tests */
+namespace {
+
+struct ProfileEntry {
+    Containers::String stage;
+    /* Empty for stages that don't operate on a particular item, such as
+       opening a file */
+    Containers::String item;
+    std::chrono::nanoseconds wallTime;
+    std::chrono::nanoseconds cpuTime;
+    /* Net heap growth, negative if the stage freed more than it allocated.
+       Zero on platforms where it can't be queried. */
+    Long allocated;
+    /* Peak resident memory during the stage on Linux, peak resident memory
+       of the whole process so far on other Unix systems, zero elsewhere */
+    UnsignedLong peakMemory;
+};
+
+struct Profiler {
+    bool enabled{};
+    Containers::Array<ProfileEntry> entries;
+};
+
+Long profileHeapAllocated() {
+    #ifdef MAGNUM_SCENECONVERTER_PROFILER_MALLINFO2
+    /* Both small allocations from the arena and large ones that are mmap()ed
+       directly */
+    const struct mallinfo2 info = mallinfo2();
+    return Long(info.uordblks + info.hblkhd);
+    #else
+    return 0;
+    #endif
+}
+
+void profileResetPeakMemory() {
+    #ifdef __linux__
+    Magnum::Implementation::resetPeakMemory();
+    #endif
+}
+
+UnsignedLong profilePeakMemory() {
+    #ifdef __linux__
+    return Magnum::Implementation::memoryStatus("VmHWM:");
+    #elif defined(CORRADE_TARGET_UNIX)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    #ifdef CORRADE_TARGET_APPLE
+    /* In bytes on Apple platforms, in kB elsewhere */
+    return usage.ru_maxrss;
+    #else
+    return UnsignedLong(usage.ru_maxrss)*1024;
+    #endif
+    #else
+    return 0;
+    #endif
+}
+
+/* Like Trade::Implementation::Duration, accumulating the wall time into
+   given output. If profiling is enabled, additionally records CPU time, heap
+   growth and peak memory into a new profiler entry. */
+struct Profile {
+    explicit Profile(Profiler& profiler, std::chrono::high_resolution_clock::duration& output, Containers::StringView stage, Containers::StringView itemType = {}, UnsignedInt itemId = 0): _profiler(profiler), _output(output), _stage{stage}, _itemType{itemType}, _itemId{itemId}, _allocated{}, _cpuTime{} {
+        if(_profiler.enabled) {
+            profileResetPeakMemory();
+            _allocated = profileHeapAllocated();
+            _cpuTime = std::clock();
+        }
+        _t = std::chrono::high_resolution_clock::now();
+    }
+
+    ~Profile() {
+        const std::chrono::high_resolution_clock::duration wallTime = std::chrono::high_resolution_clock::now() - _t;
+        _output += wallTime;
+        if(!_profiler.enabled) return;
+
+        const std::clock_t cpuTime = std::clock() - _cpuTime;
+        arrayAppend(_profiler.entries, ProfileEntry{
+            _stage,
+            _itemType ? Utility::format("{} {}", _itemType, _itemId) : Containers::String{},
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wallTime),
+            std::chrono::nanoseconds{Long(Double(cpuTime)*1.0e9/CLOCKS_PER_SEC)},
+            profileHeapAllocated() - _allocated,
+            profilePeakMemory()});
+    }
+
+    private:
+        Profiler& _profiler;
+        std::chrono::high_resolution_clock::duration& _output;
+        Containers::StringView _stage, _itemType;
+        UnsignedInt _itemId;
+        Long _allocated;
+        std::clock_t _cpuTime;
+        std::chrono::high_resolution_clock::time_point _t;
+};
+
+std::string profilePad(const std::string& value, std::size_t width, bool left) {
+    if(value.size() >= width) return value;
+    return left ? value + std::string(width - value.size(), ' ') :
+        std::string(width - value.size(), ' ') + value;
+}
+
+std::string profileMilliseconds(std::chrono::nanoseconds value) {
+    return Utility::formatString("{:.2f}", Double(value.count())/1.0e6);
+}
+
+std::string profileKilobytes(Long value, bool sign) {
+    return Utility::formatString(sign && value >= 0 ? "+{}" : "{}", value/1024);
+}
+
+std::string profileRow(const std::string& stage, const std::string& item, const std::string& count, const std::string& wallTime, const std::string& cpuTime, const std::string& allocated, const std::string& peakMemory) {
+    return profilePad(stage, 36, true) +
+        profilePad(item, 16, true) +
+        profilePad(count, 7, false) +
+        profilePad(wallTime, 12, false) +
+        profilePad(cpuTime, 12, false) +
+        profilePad(allocated, 12, false) +
+        profilePad(peakMemory, 14, false) + '\n';
+}
+
+std::string profileRow(const std::string& stage, const std::string& item, const std::string& count, const ProfileEntry& entry) {
+    return profileRow(stage, item, count,
+        profileMilliseconds(entry.wallTime),
+        profileMilliseconds(entry.cpuTime),
+        profileKilobytes(entry.allocated, true),
+        profileKilobytes(entry.peakMemory, false));
+}
+
+/* Entries aggregated by stage, in the order the stages were first
+   encountered, together with the count of entries in each */
+Containers::Array<Containers::Pair<ProfileEntry, std::size_t>> profileStages(const Profiler& profiler) {
+    Containers::Array<Containers::Pair<ProfileEntry, std::size_t>> stages;
+    for(const ProfileEntry& entry: profiler.entries) {
+        std::size_t i = 0;
+        for(; i != stages.size(); ++i)
+            if(stages[i].first().stage == entry.stage) break;
+        if(i == stages.size())
+            arrayAppend(stages, Containers::pair(ProfileEntry{entry.stage, {}, {}, {}, 0, 0}, std::size_t{}));
+
+        ProfileEntry& stage = stages[i].first();
+        stage.wallTime += entry.wallTime;
+        stage.cpuTime += entry.cpuTime;
+        stage.allocated += entry.allocated;
+        stage.peakMemory = Math::max(stage.peakMemory, entry.peakMemory);
+        ++stages[i].second();
+    }
+
+    return stages;
+}
+
+/* Per-stage table, optionally followed by topCount items with the largest
+   wall time */
+Containers::String profileTable(const Profiler& profiler, std::size_t topCount) {
+    std::string out = profileRow("Stage", {}, "Items", "Wall [ms]", "CPU [ms]", "Heap [kB]", "Peak [kB]");
+
+    ProfileEntry total{{}, {}, {}, {}, 0, 0};
+    for(const Containers::Pair<ProfileEntry, std::size_t>& stage: profileStages(profiler)) {
+        out += profileRow(stage.first().stage, {}, std::to_string(stage.second()), stage.first());
+        total.wallTime += stage.first().wallTime;
+        total.cpuTime += stage.first().cpuTime;
+        total.allocated += stage.first().allocated;
+        total.peakMemory = Math::max(total.peakMemory, stage.first().peakMemory);
+    }
+    out += profileRow("Total", {}, std::to_string(profiler.entries.size()), total);
+
+    /* Sort indices of entries that have an item by wall time, largest first.
+       Stable to have equivalent items listed in the order they were
+       processed. */
+    Containers::Array<std::size_t> order;
+    for(std::size_t i = 0; i != profiler.entries.size(); ++i)
+        if(profiler.entries[i].item) arrayAppend(order, i);
+    if(!topCount || order.isEmpty()) return out;
+
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return profiler.entries[a].wallTime > profiler.entries[b].wallTime;
+    });
+
+    const std::size_t count = Math::min(topCount, order.size());
+    out += Utility::formatString("\nTop {} items by wall time:\n", count);
+    out += profileRow("Stage", "Item", {}, "Wall [ms]", "CPU [ms]", "Heap [kB]", "Peak [kB]");
+    for(std::size_t i = 0; i != count; ++i) {
+        const ProfileEntry& entry = profiler.entries[order[i]];
+        out += profileRow(entry.stage, entry.item, {}, entry);
+    }
+
+    return out;
+}
+
+std::string profileJsonString(Containers::StringView value) {
+    std::string out;
+    out += '"';
+    for(const char c: value) {
+        if(c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    out += '"';
+    return out;
+}
+
+std::string profileJsonEntry(const ProfileEntry& entry, const std::string& itemKey, const std::string& itemValue) {
+    return Utility::formatString("{{\"stage\": {}, \"{}\": {}, \"wallTimeNs\": {}, \"cpuTimeNs\": {}, \"allocatedBytes\": {}, \"peakMemoryBytes\": {}}}",
+        profileJsonString(entry.stage), itemKey, itemValue,
+        Long(entry.wallTime.count()), Long(entry.cpuTime.count()),
+        entry.allocated, entry.peakMemory);
+}
+
+/* Aggregated stages followed by all recorded entries */
+Containers::String profileJson(const Profiler& profiler) {
+    std::string out = "{\n  \"stages\": [";
+    const Containers::Array<Containers::Pair<ProfileEntry, std::size_t>> stages = profileStages(profiler);
+    for(std::size_t i = 0; i != stages.size(); ++i) {
+        out += i ? ",\n    " : "\n    ";
+        out += profileJsonEntry(stages[i].first(), "items", std::to_string(stages[i].second()));
+    }
+    out += stages.isEmpty() ? "],\n  \"items\": [" : "\n  ],\n  \"items\": [";
+    for(std::size_t i = 0; i != profiler.entries.size(); ++i) {
+        out += i ? ",\n    " : "\n    ";
+        out += profileJsonEntry(profiler.entries[i], "item", profileJsonString(profiler.entries[i].item));
+    }
+    out += profiler.entries.isEmpty() ? "]\n}\n" : "\n  ]\n}\n";
+    return out;
+}
+}
+
+}}}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RuntimeScene.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+RuntimeScene::RuntimeScene() noexcept = default;
+
+RuntimeScene::RuntimeScene(const Trade::SceneData& scene): RuntimeScene{} {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::RuntimeScene: the scene has no hierarchy", );
+    CORRADE_ASSERT(!scene.is2D(),
+        "SceneTools::RuntimeScene: the scene is 2D", );
+
+    /* Order the objects so a parent is always before its children. That's
+       all update() needs to calculate the absolute transformations in a
+       single pass. */
+    const Containers::Array<Containers::Pair<UnsignedInt, Int>> parents = parentsBreadthFirst(scene);
+    const std::size_t count = parents.size();
+    arrayResize(_objectsForMapping, DirectInit, std::size_t(scene.mappingBound()), ~UnsignedInt{});
+    arrayResize(_mapping, NoInit, count);
+    arrayResize(_parents, NoInit, count);
+    arrayResize(_transformations, ValueInit, count);
+    arrayResize(_absoluteTransformations, ValueInit, count);
+    arrayResize(_dirty, DirectInit, count, true);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt mapping = parents[i].first();
+        const Int parent = parents[i].second();
+        _mapping[i] = mapping;
+        _objectsForMapping[mapping] = i;
+        /* The parent was processed already, so its index is known */
+        _parents[i] = parent == -1 ? -1 : Int(_objectsForMapping[parent]);
+    }
+
+    /* Objects that aren't a part of the hierarchy are ignored */
+    if(scene.is3D()) for(const Containers::Pair<UnsignedInt, Matrix4>& transformation: scene.transformations3DAsArray()) {
+        const UnsignedInt object = _objectsForMapping[transformation.first()];
+        if(object != ~UnsignedInt{})
+            _transformations[object] = transformation.second();
+    }
+
+    if(scene.hasField(Trade::SceneField::Mesh)) for(const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& meshMaterial: scene.meshesMaterialsAsArray()) {
+        const UnsignedInt object = _objectsForMapping[meshMaterial.first()];
+        if(object != ~UnsignedInt{})
+            addDrawable(object, meshMaterial.second().first(), meshMaterial.second().second());
+    }
+}
+
+RuntimeScene::RuntimeScene(RuntimeScene&&) noexcept = default;
+
+RuntimeScene::~RuntimeScene() = default;
+
+RuntimeScene& RuntimeScene::operator=(RuntimeScene&&) noexcept = default;
+
+Containers::Optional<UnsignedInt> RuntimeScene::findObject(const UnsignedLong mapping) const {
+    if(mapping >= _objectsForMapping.size() || _objectsForMapping[mapping] == ~UnsignedInt{})
+        return {};
+    return _objectsForMapping[mapping];
+}
+
+bool RuntimeScene::isDirty(const UnsignedInt object) const {
+    CORRADE_ASSERT(object < _parents.size(),
+        "SceneTools::RuntimeScene::isDirty(): index" << object << "out of range for" << _parents.size() << "objects", {});
+    return _dirty[object];
+}
+
+UnsignedInt RuntimeScene::addObject(const Int parent, const Matrix4& transformation) {
+    CORRADE_ASSERT(parent == -1 || std::size_t(parent) < _parents.size(),
+        "SceneTools::RuntimeScene::addObject(): parent index" << parent << "out of range for" << _parents.size() << "objects", {});
+
+    const UnsignedInt object = _parents.size();
+    arrayAppend(_mapping, UnsignedInt(_objectsForMapping.size()));
+    arrayAppend(_objectsForMapping, object);
+    arrayAppend(_parents, parent);
+    arrayAppend(_transformations, transformation);
+    arrayAppend(_absoluteTransformations, InPlaceInit);
+    arrayAppend(_dirty, true);
+    _firstDirty = Math::min(_firstDirty, std::size_t(object));
+    return object;
+}
+
+RuntimeScene& RuntimeScene::setTransformation(const UnsignedInt object, const Matrix4& transformation) {
+    CORRADE_ASSERT(object < _parents.size(),
+        "SceneTools::RuntimeScene::setTransformation(): index" << object << "out of range for" << _parents.size() << "objects", *this);
+
+    _transformations[object] = transformation;
+    _dirty[object] = true;
+    _firstDirty = Math::min(_firstDirty, std::size_t(object));
+    return *this;
+}
+
+std::size_t RuntimeScene::update() {
+    /* Parents are always before their children, so by the time a child is
+       processed, the parent dirty bit is final and its absolute
+       transformation up-to-date */
+    std::size_t count = 0;
+    for(std::size_t i = _firstDirty; i < _parents.size(); ++i) {
+        const Int parent = _parents[i];
+        if(parent != -1 && _dirty[parent])
+            _dirty[i] = true;
+        if(!_dirty[i]) continue;
+
+        _absoluteTransformations[i] = parent == -1 ? _transformations[i] :
+            _absoluteTransformations[parent]*_transformations[i];
+        ++count;
+    }
+
+    /* Clear the dirty bits only after, as they're needed for propagation to
+       children above */
+    for(std::size_t i = _firstDirty; i < _parents.size(); ++i)
+        _dirty[i] = false;
+    _firstDirty = _parents.size();
+
+    return count;
+}
+
+UnsignedInt RuntimeScene::addDrawable(const UnsignedInt object, const UnsignedInt mesh, const Int material) {
+    CORRADE_ASSERT(object < _parents.size(),
+        "SceneTools::RuntimeScene::addDrawable(): index" << object << "out of range for" << _parents.size() << "objects", {});
+
+    arrayAppend(_drawableObjects, object);
+    arrayAppend(_drawableMeshes, mesh);
+    arrayAppend(_drawableMaterials, material);
+    return _drawableObjects.size() - 1;
+}
+
+UnsignedInt RuntimeScene::addAnimable(const UnsignedInt object, const UnsignedInt animation) {
+    CORRADE_ASSERT(object < _parents.size(),
+        "SceneTools::RuntimeScene::addAnimable(): index" << object << "out of range for" << _parents.size() << "objects", {});
+
+    arrayAppend(_animableObjects, object);
+    arrayAppend(_animableAnimations, animation);
+    return _animableObjects.size() - 1;
+}
+
+}}
@@ -0,0 +1,285 @@
+#ifndef Magnum_SceneTools_RuntimeScene_h
+#define Magnum_SceneTools_RuntimeScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::RuntimeScene
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Data-oriented runtime scene
+@m_since_latest
+
+A data-oriented alternative to the pointer-based @ref SceneGraph library for
+3D scenes. Every object property is stored in its own contiguous array,
+indexed by object index:
+
+-   @ref parents() contains the parent index of each object, or
+    @cpp -1 @ce for root objects. A parent is always before all its children,
+    which means absolute transformations can be calculated in a single linear
+    pass without any pointer chasing.
+-   @ref transformations() contains transformations relative to the parent
+-   @ref absoluteTransformations() contains transformations relative to the
+    root, calculated in @ref update()
+-   @ref mapping() contains the object ID in the @ref Trade::SceneData the
+    scene was created from
+
+Besides that, drawable and animable components are stored in dense arrays
+referencing the objects by their index.
+
+@section SceneTools-RuntimeScene-import Importing from scene data
+
+Constructing the class from a @ref Trade::SceneData orders the objects using
+@ref parentsBreadthFirst(), imports their transformations and creates a
+drawable for every @ref Trade::SceneField::Mesh entry:
+
+@snippet SceneTools.cpp RuntimeScene-usage
+
+@section SceneTools-RuntimeScene-update Updating the transformations
+
+Changing a transformation with @ref setTransformation() marks the object as
+dirty. The @ref update() function then recalculates absolute transformations
+of dirty objects and all their children, starting from the first dirty
+object. Because each object is updated after its parent, a dirty state
+propagates to the whole subtree without any recursion. Objects that were not
+marked dirty and whose parents were not either are skipped.
+
+@experimental
+*/
+class MAGNUM_SCENETOOLS_EXPORT RuntimeScene {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty scene. Use @ref addObject(),
+         * @ref addDrawable() and @ref addAnimable() to populate it.
+         */
+        explicit RuntimeScene() noexcept;
+
+        /**
+         * @brief Construct from scene data
+         *
+         * Expects that @p scene contains a @ref Trade::SceneField::Parent
+         * field and that it isn't 2D. Objects are added in the order returned
+         * by @ref parentsBreadthFirst(), objects that are not a part of the
+         * hierarchy are ignored. If the object has a transformation, it's
+         * imported as well, otherwise the transformation is an identity. Each
+         * @ref Trade::SceneField::Mesh entry for an object that's a part of
+         * the hierarchy is added as a drawable together with its
+         * @ref Trade::SceneField::MeshMaterial, if present. All objects are
+         * marked as dirty, call @ref update() to calculate absolute
+         * transformations.
+         */
+        explicit RuntimeScene(const Trade::SceneData& scene);
+
+        /** @brief Copying is not allowed */
+        RuntimeScene(const RuntimeScene&) = delete;
+
+        /** @brief Move constructor */
+        RuntimeScene(RuntimeScene&&) noexcept;
+
+        ~RuntimeScene();
+
+        /** @brief Copying is not allowed */
+        RuntimeScene& operator=(const RuntimeScene&) = delete;
+
+        /** @brief Move assignment */
+        RuntimeScene& operator=(RuntimeScene&&) noexcept;
+
+        /**
+         * @brief Object mapping bound
+         *
+         * Upper bound on values in @ref mapping(). Initially equal to
+         * @ref Trade::SceneData::mappingBound() of the scene the instance
+         * was created from, incremented by each @ref addObject() call.
+         */
+        UnsignedLong mappingBound() const { return _objectsForMapping.size(); }
+
+        /** @brief Object count */
+        std::size_t objectCount() const { return _parents.size(); }
+
+        /**
+         * @brief Object mapping
+         *
+         * Object ID in the original @ref Trade::SceneData for each object.
+         * Objects added with @ref addObject() get a new unique ID assigned.
+         * @see @ref findObject()
+         */
+        Containers::ArrayView<const UnsignedInt> mapping() const { return _mapping; }
+
+        /**
+         * @brief Find an object index for given mapping
+         *
+         * Returns an index into @ref parents() and other object arrays for an
+         * object with given ID in the original @ref Trade::SceneData, or
+         * @relativeref{Corrade,Containers::NullOpt} if the object isn't in
+         * the scene. The lookup is done in an @f$ \mathcal{O}(1) @f$ time.
+         */
+        Containers::Optional<UnsignedInt> findObject(UnsignedLong mapping) const;
+
+        /**
+         * @brief Object parents
+         *
+         * Parent index for each object, or @cpp -1 @ce for root objects. A
+         * parent index is always less than the index of the object itself.
+         */
+        Containers::ArrayView<const Int> parents() const { return _parents; }
+
+        /**
+         * @brief Object transformations relative to the parent
+         *
+         * @see @ref setTransformation()
+         */
+        Containers::ArrayView<const Matrix4> transformations() const { return _transformations; }
+
+        /**
+         * @brief Absolute object transformations
+         *
+         * Values for objects that are @ref isDirty() are stale until
+         * @ref update() is called.
+         */
+        Containers::ArrayView<const Matrix4> absoluteTransformations() const { return _absoluteTransformations; }
+
+        /** @brief Whether any object is dirty */
+        bool isDirty() const { return _firstDirty < _parents.size(); }
+
+        /**
+         * @brief Whether an object is dirty
+         *
+         * Returns @cpp true @ce if the object was marked dirty since the last
+         * @ref update(). Note that children of a dirty object are updated as
+         * well, even though they aren't reported as dirty here. Expects that
+         * @p object is less than @ref objectCount().
+         */
+        bool isDirty(UnsignedInt object) const;
+
+        /**
+         * @brief Add an object
+         * @param parent            Parent object index or @cpp -1 @ce for a
+         *      root object
+         * @param transformation    Transformation relative to the parent
+         * @return Index of the newly added object
+         *
+         * Expects that @p parent is either @cpp -1 @ce or less than
+         * @ref objectCount(). The object is appended at the end with
+         * @ref mappingBound() as its mapping and marked as dirty.
+         */
+        UnsignedInt addObject(Int parent, const Matrix4& transformation = {});
+
+        /**
+         * @brief Set object transformation relative to the parent
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p object is less than @ref objectCount(). Marks the
+         * object as dirty.
+         */
+        RuntimeScene& setTransformation(UnsignedInt object, const Matrix4& transformation);
+
+        /**
+         * @brief Update absolute transformations
+         * @return Count of objects that got updated
+         *
+         * Recalculates absolute transformations of all dirty objects and
+         * their children and clears the dirty state. Objects before the first
+         * dirty object aren't touched at all.
+         */
+        std::size_t update();
+
+        /** @brief Drawable count */
+        std::size_t drawableCount() const { return _drawableObjects.size(); }
+
+        /** @brief Object index for each drawable */
+        Containers::ArrayView<const UnsignedInt> drawableObjects() const { return _drawableObjects; }
+
+        /** @brief Mesh ID for each drawable */
+        Containers::ArrayView<const UnsignedInt> drawableMeshes() const { return _drawableMeshes; }
+
+        /**
+         * @brief Material ID for each drawable
+         *
+         * @cpp -1 @ce if the drawable has no material assigned.
+         */
+        Containers::ArrayView<const Int> drawableMaterials() const { return _drawableMaterials; }
+
+        /**
+         * @brief Add a drawable
+         * @return Index of the newly added drawable
+         *
+         * Expects that @p object is less than @ref objectCount().
+         */
+        UnsignedInt addDrawable(UnsignedInt object, UnsignedInt mesh, Int material = -1);
+
+        /** @brief Animable count */
+        std::size_t animableCount() const { return _animableObjects.size(); }
+
+        /** @brief Object index for each animable */
+        Containers::ArrayView<const UnsignedInt> animableObjects() const { return _animableObjects; }
+
+        /** @brief Animation ID for each animable */
+        Containers::ArrayView<const UnsignedInt> animableAnimations() const { return _animableAnimations; }
+
+        /**
+         * @brief Add an animable
+         * @return Index of the newly added animable
+         *
+         * Expects that @p object is less than @ref objectCount(). As
+         * @ref Trade::SceneData has no notion of animations, animables are
+         * never created on import --- use @ref findObject() to map targets of
+         * @ref Trade::AnimationData tracks to object indices.
+         */
+        UnsignedInt addAnimable(UnsignedInt object, UnsignedInt animation);
+
+    private:
+        Containers::Array<UnsignedInt> _mapping;
+        Containers::Array<UnsignedInt> _objectsForMapping;
+        Containers::Array<Int> _parents;
+        Containers::Array<Matrix4> _transformations;
+        Containers::Array<Matrix4> _absoluteTransformations;
+        /* Not a BitArray as that one isn't growable */
+        Containers::Array<bool> _dirty;
+        std::size_t _firstDirty{};
+
+        Containers::Array<UnsignedInt> _drawableObjects;
+        Containers::Array<UnsignedInt> _drawableMeshes;
+        Containers::Array<Int> _drawableMaterials;
+
+        Containers::Array<UnsignedInt> _animableObjects;
+        Containers::Array<UnsignedInt> _animableAnimations;
+};
+
+}}
+
+#endif
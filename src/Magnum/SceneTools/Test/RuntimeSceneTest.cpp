@@ -0,0 +1,390 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <type_traits>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/RuntimeScene.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct RuntimeSceneTest: TestSuite::Tester {
+    explicit RuntimeSceneTest();
+
+    void construct();
+    void constructFromSceneData();
+    void constructFromSceneDataNoHierarchy();
+    void constructFromSceneData2D();
+    void constructMove();
+
+    void addObject();
+    void addObjectInvalidParent();
+
+    void update();
+    void updatePartial();
+
+    void drawablesAnimables();
+    void invalidObject();
+};
+
+using namespace Math::Literals;
+
+RuntimeSceneTest::RuntimeSceneTest() {
+    addTests({&RuntimeSceneTest::construct,
+              &RuntimeSceneTest::constructFromSceneData,
+              &RuntimeSceneTest::constructFromSceneDataNoHierarchy,
+              &RuntimeSceneTest::constructFromSceneData2D,
+              &RuntimeSceneTest::constructMove,
+
+              &RuntimeSceneTest::addObject,
+              &RuntimeSceneTest::addObjectInvalidParent,
+
+              &RuntimeSceneTest::update,
+              &RuntimeSceneTest::updatePartial,
+
+              &RuntimeSceneTest::drawablesAnimables,
+              &RuntimeSceneTest::invalidObject});
+}
+
+const struct Scene {
+    struct Parent {
+        UnsignedShort object;
+        Short parent;
+    } parents[5];
+
+    struct Transformation {
+        UnsignedShort object;
+        Matrix4 transformation;
+    } transformations[4];
+
+    struct Mesh {
+        UnsignedShort object;
+        UnsignedByte mesh;
+        Byte material;
+    } meshes[3];
+} Data[]{{
+    /* Objects 2, 4 and 6 are not in the hierarchy */
+    {{3, -1},
+     {1, 3},
+     {5, 1},
+     {0, 3},
+     {7, -1}},
+    {{3, Matrix4::translation(Vector3::xAxis(1.0f))},
+     {1, Matrix4::scaling(Vector3{2.0f})},
+     {5, Matrix4::translation(Vector3::yAxis(1.0f))},
+     /* Ignored */
+     {4, Matrix4::translation(Vector3{9.0f})}},
+    {{5, 2, 1},
+     {7, 0, -1},
+     /* Ignored */
+     {6, 3, 4}}
+}};
+
+Trade::SceneData scene() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 8, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transformations)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transformations)
+                .slice(&Scene::Transformation::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::material)},
+    }};
+}
+
+void RuntimeSceneTest::construct() {
+    RuntimeScene scene;
+    CORRADE_COMPARE(scene.mappingBound(), 0);
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_COMPARE(scene.drawableCount(), 0);
+    CORRADE_COMPARE(scene.animableCount(), 0);
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_COMPARE(scene.update(), 0);
+    CORRADE_VERIFY(!scene.findObject(0));
+}
+
+void RuntimeSceneTest::constructFromSceneData() {
+    RuntimeScene scene{RuntimeSceneTest::scene()};
+    CORRADE_COMPARE(scene.mappingBound(), 8);
+    CORRADE_COMPARE(scene.objectCount(), 5);
+
+    /* Breadth-first order */
+    CORRADE_COMPARE_AS(scene.mapping(), Containers::arrayView<UnsignedInt>({
+        3, 7, 1, 0, 5
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.parents(), Containers::arrayView<Int>({
+        -1, -1, 0, 0, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.findObject(5), 4u);
+    CORRADE_COMPARE(scene.findObject(7), 1u);
+    CORRADE_VERIFY(!scene.findObject(4));
+    CORRADE_VERIFY(!scene.findObject(8));
+
+    CORRADE_COMPARE_AS(scene.transformations(), Containers::arrayView({
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4{},
+        Matrix4::scaling(Vector3{2.0f}),
+        Matrix4{},
+        Matrix4::translation(Vector3::yAxis(1.0f))
+    }), TestSuite::Compare::Container);
+
+    /* Everything is dirty initially */
+    CORRADE_VERIFY(scene.isDirty());
+    for(UnsignedInt i = 0; i != scene.objectCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(scene.isDirty(i));
+    }
+
+    CORRADE_COMPARE(scene.update(), 5);
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4{},
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+            Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+            Matrix4::scaling(Vector3{2.0f})*
+            Matrix4::translation(Vector3::yAxis(1.0f))
+    }), TestSuite::Compare::Container);
+
+    /* Drawables only for objects in the hierarchy */
+    CORRADE_COMPARE_AS(scene.drawableObjects(), Containers::arrayView<UnsignedInt>({
+        4, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.drawableMeshes(), Containers::arrayView<UnsignedInt>({
+        2, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.drawableMaterials(), Containers::arrayView<Int>({
+        1, -1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.animableCount(), 0);
+}
+
+void RuntimeSceneTest::constructFromSceneDataNoHierarchy() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData data{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::UnsignedInt, nullptr},
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    RuntimeScene{data};
+    CORRADE_COMPARE(out.str(), "SceneTools::RuntimeScene: the scene has no hierarchy\n");
+}
+
+void RuntimeSceneTest::constructFromSceneData2D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData data{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix3x3, nullptr}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    RuntimeScene{data};
+    CORRADE_COMPARE(out.str(), "SceneTools::RuntimeScene: the scene is 2D\n");
+}
+
+void RuntimeSceneTest::constructMove() {
+    RuntimeScene a{scene()};
+    a.update();
+
+    RuntimeScene b = Utility::move(a);
+    CORRADE_COMPARE(b.objectCount(), 5);
+    CORRADE_COMPARE(b.drawableCount(), 2);
+    CORRADE_COMPARE(a.objectCount(), 0);
+
+    RuntimeScene c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.objectCount(), 5);
+    CORRADE_COMPARE(c.absoluteTransformations()[4],
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::yAxis(1.0f)));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<RuntimeScene>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<RuntimeScene>::value);
+}
+
+void RuntimeSceneTest::addObject() {
+    RuntimeScene scene{RuntimeSceneTest::scene()};
+    scene.update();
+
+    CORRADE_COMPARE(scene.addObject(2, Matrix4::translation(Vector3::zAxis(3.0f))), 5);
+    CORRADE_COMPARE(scene.addObject(-1), 6);
+    CORRADE_COMPARE(scene.objectCount(), 7);
+
+    /* New objects get new unique IDs */
+    CORRADE_COMPARE(scene.mappingBound(), 10);
+    CORRADE_COMPARE(scene.mapping()[5], 8);
+    CORRADE_COMPARE(scene.mapping()[6], 9);
+    CORRADE_COMPARE(scene.findObject(9), 6u);
+
+    CORRADE_VERIFY(scene.isDirty());
+    CORRADE_VERIFY(!scene.isDirty(4));
+    CORRADE_VERIFY(scene.isDirty(5));
+    CORRADE_VERIFY(scene.isDirty(6));
+
+    /* Only the two new objects get updated */
+    CORRADE_COMPARE(scene.update(), 2);
+    CORRADE_COMPARE(scene.absoluteTransformations()[5],
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::zAxis(3.0f)));
+    CORRADE_COMPARE(scene.absoluteTransformations()[6], Matrix4{});
+}
+
+void RuntimeSceneTest::addObjectInvalidParent() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    RuntimeScene scene;
+    scene.addObject(-1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    scene.addObject(1);
+    scene.addObject(-2);
+    CORRADE_COMPARE(out.str(),
+        "SceneTools::RuntimeScene::addObject(): parent index 1 out of range for 1 objects\n"
+        "SceneTools::RuntimeScene::addObject(): parent index -2 out of range for 1 objects\n");
+}
+
+void RuntimeSceneTest::update() {
+    RuntimeScene scene{RuntimeSceneTest::scene()};
+    CORRADE_COMPARE(scene.update(), 5);
+
+    /* Nothing dirty, nothing to update */
+    CORRADE_COMPARE(scene.update(), 0);
+
+    /* Changing the root updates the whole subtree but not the other root */
+    scene.setTransformation(0, Matrix4::translation(Vector3::xAxis(-1.0f)));
+    CORRADE_VERIFY(scene.isDirty(0));
+    CORRADE_VERIFY(!scene.isDirty(2));
+    CORRADE_COMPARE(scene.update(), 4);
+    CORRADE_VERIFY(!scene.isDirty(0));
+    CORRADE_COMPARE(scene.absoluteTransformations()[4],
+        Matrix4::translation(Vector3::xAxis(-1.0f))*
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::yAxis(1.0f)));
+}
+
+void RuntimeSceneTest::updatePartial() {
+    RuntimeScene scene{RuntimeSceneTest::scene()};
+    scene.update();
+
+    /* Only the object and its single child get updated, the sibling is
+       untouched */
+    scene.setTransformation(2, Matrix4::scaling(Vector3{3.0f}));
+    CORRADE_COMPARE(scene.update(), 2);
+    CORRADE_COMPARE(scene.absoluteTransformations()[3],
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(scene.absoluteTransformations()[4],
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::scaling(Vector3{3.0f})*
+        Matrix4::translation(Vector3::yAxis(1.0f)));
+
+    /* A leaf updates just itself */
+    scene.setTransformation(4, Matrix4{});
+    CORRADE_COMPARE(scene.update(), 1);
+    CORRADE_COMPARE(scene.absoluteTransformations()[4],
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::scaling(Vector3{3.0f}));
+}
+
+void RuntimeSceneTest::drawablesAnimables() {
+    RuntimeScene scene;
+    scene.addObject(-1);
+    scene.addObject(0);
+
+    CORRADE_COMPARE(scene.addDrawable(1, 5), 0);
+    CORRADE_COMPARE(scene.addDrawable(0, 3, 7), 1);
+    CORRADE_COMPARE(scene.addAnimable(1, 2), 0);
+
+    CORRADE_COMPARE(scene.drawableCount(), 2);
+    CORRADE_COMPARE_AS(scene.drawableObjects(), Containers::arrayView<UnsignedInt>({
+        1, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.drawableMeshes(), Containers::arrayView<UnsignedInt>({
+        5, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.drawableMaterials(), Containers::arrayView<Int>({
+        -1, 7
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(scene.animableCount(), 1);
+    CORRADE_COMPARE_AS(scene.animableObjects(), Containers::arrayView<UnsignedInt>({
+        1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.animableAnimations(), Containers::arrayView<UnsignedInt>({
+        2
+    }), TestSuite::Compare::Container);
+}
+
+void RuntimeSceneTest::invalidObject() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    RuntimeScene scene;
+    scene.addObject(-1);
+    scene.addObject(0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    scene.isDirty(2);
+    scene.setTransformation(2, {});
+    scene.addDrawable(2, 0);
+    scene.addAnimable(2, 0);
+    CORRADE_COMPARE(out.str(),
+        "SceneTools::RuntimeScene::isDirty(): index 2 out of range for 2 objects\n"
+        "SceneTools::RuntimeScene::setTransformation(): index 2 out of range for 2 objects\n"
+        "SceneTools::RuntimeScene::addDrawable(): index 2 out of range for 2 objects\n"
+        "SceneTools::RuntimeScene::addAnimable(): index 2 out of range for 2 objects\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::RuntimeSceneTest)
@@ -26,6 +26,7 @@
 #include <sstream>
 #include <Corrade/Containers/ArrayTuple.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
@@ -36,6 +37,7 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 
+#include "Magnum/SceneTools/Implementation/sceneConverterProfiler.h"
 #include "Magnum/SceneTools/Implementation/sceneConverterUtilities.h"
 
 #include "configure.h"
@@ -65,6 +67,14 @@ struct SceneConverterImplementationTest: TestSuite::Tester {
     void infoReferenceCount();
     void infoError();
 
+    void profileDisabled();
+    void profileEnabled();
+    void profileTable();
+    void profileTableTop();
+    void profileTableEmpty();
+    void profileJson();
+    void profileJsonEmpty();
+
     Utility::Arguments _infoArgs;
 
     /* Explicitly forbid system-wide plugin dependencies */
@@ -151,7 +161,15 @@ SceneConverterImplementationTest::SceneConverterImplementationTest() {
         Containers::arraySize(InfoOneOrAllData));
 
     addTests({&SceneConverterImplementationTest::infoReferenceCount,
-              &SceneConverterImplementationTest::infoError});
+              &SceneConverterImplementationTest::infoError,
+
+              &SceneConverterImplementationTest::profileDisabled,
+              &SceneConverterImplementationTest::profileEnabled,
+              &SceneConverterImplementationTest::profileTable,
+              &SceneConverterImplementationTest::profileTableTop,
+              &SceneConverterImplementationTest::profileTableEmpty,
+              &SceneConverterImplementationTest::profileJson,
+              &SceneConverterImplementationTest::profileJsonEmpty});
 
     /* A subset of arguments needed by the info printing code */
     _infoArgs.addBooleanOption("info")
@@ -1383,6 +1401,106 @@ void SceneConverterImplementationTest::infoError() {
         "Object 0: A name\n");
 }
 
+void SceneConverterImplementationTest::profileDisabled() {
+    Implementation::Profiler profiler;
+    std::chrono::high_resolution_clock::duration duration{};
+    {
+        Implementation::Profile p{profiler, duration, "import", "mesh", 3};
+    }
+
+    /* The duration is gathered always, entries only if enabled */
+    CORRADE_VERIFY(duration.count() >= 0);
+    CORRADE_COMPARE(profiler.entries.size(), 0);
+}
+
+void SceneConverterImplementationTest::profileEnabled() {
+    Implementation::Profiler profiler;
+    profiler.enabled = true;
+
+    std::chrono::high_resolution_clock::duration duration{};
+    {
+        Implementation::Profile p{profiler, duration, "import", "mesh", 3};
+    } {
+        const Containers::String stage = "converter "_s + "AnySceneConverter"_s;
+        Implementation::Profile p{profiler, duration, stage};
+    }
+
+    CORRADE_COMPARE(profiler.entries.size(), 2);
+    CORRADE_COMPARE(profiler.entries[0].stage, "import");
+    CORRADE_COMPARE(profiler.entries[0].item, "mesh 3");
+    CORRADE_COMPARE(profiler.entries[1].stage, "converter AnySceneConverter");
+    CORRADE_COMPARE(profiler.entries[1].item, "");
+    /* The duration is a sum of both */
+    CORRADE_COMPARE_AS(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+        (profiler.entries[0].wallTime + profiler.entries[1].wallTime).count(),
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+Implementation::Profiler profilerWithEntries() {
+    Implementation::Profiler profiler;
+    profiler.enabled = true;
+    arrayAppend(profiler.entries, Implementation::ProfileEntry{"import", "mesh 0", std::chrono::milliseconds{2}, std::chrono::milliseconds{1}, 2048, 1048576});
+    arrayAppend(profiler.entries, Implementation::ProfileEntry{"import", "mesh 1", std::chrono::milliseconds{5}, std::chrono::milliseconds{4}, -1024, 2097152});
+    arrayAppend(profiler.entries, Implementation::ProfileEntry{"converter AnySceneConverter", {}, std::chrono::milliseconds{1}, std::chrono::milliseconds{1}, 0, 1048576});
+    return profiler;
+}
+
+void SceneConverterImplementationTest::profileTable() {
+    CORRADE_COMPARE(Implementation::profileTable(profilerWithEntries(), 0),
+        "Stage                                                 Items   Wall [ms]    CPU [ms]   Heap [kB]     Peak [kB]\n"
+        "import                                                    2        7.00        5.00          +1          2048\n"
+        "converter AnySceneConverter                               1        1.00        1.00          +0          1024\n"
+        "Total                                                     3        8.00        6.00          +1          2048\n");
+}
+
+void SceneConverterImplementationTest::profileTableTop() {
+    CORRADE_COMPARE(Implementation::profileTable(profilerWithEntries(), 1),
+        "Stage                                                 Items   Wall [ms]    CPU [ms]   Heap [kB]     Peak [kB]\n"
+        "import                                                    2        7.00        5.00          +1          2048\n"
+        "converter AnySceneConverter                               1        1.00        1.00          +0          1024\n"
+        "Total                                                     3        8.00        6.00          +1          2048\n"
+        "\n"
+        "Top 1 items by wall time:\n"
+        "Stage                               Item                      Wall [ms]    CPU [ms]   Heap [kB]     Peak [kB]\n"
+        "import                              mesh 1                         5.00        4.00          -1          2048\n");
+}
+
+void SceneConverterImplementationTest::profileTableEmpty() {
+    Implementation::Profiler profiler;
+    profiler.enabled = true;
+
+    /* The top list isn't printed at all if there are no items */
+    CORRADE_COMPARE(Implementation::profileTable(profiler, 10),
+        "Stage                                                 Items   Wall [ms]    CPU [ms]   Heap [kB]     Peak [kB]\n"
+        "Total                                                     0        0.00        0.00          +0             0\n");
+}
+
+void SceneConverterImplementationTest::profileJson() {
+    CORRADE_COMPARE(Implementation::profileJson(profilerWithEntries()),
+        "{\n"
+        "  \"stages\": [\n"
+        "    {\"stage\": \"import\", \"items\": 2, \"wallTimeNs\": 7000000, \"cpuTimeNs\": 5000000, \"allocatedBytes\": 1024, \"peakMemoryBytes\": 2097152},\n"
+        "    {\"stage\": \"converter AnySceneConverter\", \"items\": 1, \"wallTimeNs\": 1000000, \"cpuTimeNs\": 1000000, \"allocatedBytes\": 0, \"peakMemoryBytes\": 1048576}\n"
+        "  ],\n"
+        "  \"items\": [\n"
+        "    {\"stage\": \"import\", \"item\": \"mesh 0\", \"wallTimeNs\": 2000000, \"cpuTimeNs\": 1000000, \"allocatedBytes\": 2048, \"peakMemoryBytes\": 1048576},\n"
+        "    {\"stage\": \"import\", \"item\": \"mesh 1\", \"wallTimeNs\": 5000000, \"cpuTimeNs\": 4000000, \"allocatedBytes\": -1024, \"peakMemoryBytes\": 2097152},\n"
+        "    {\"stage\": \"converter AnySceneConverter\", \"item\": \"\", \"wallTimeNs\": 1000000, \"cpuTimeNs\": 1000000, \"allocatedBytes\": 0, \"peakMemoryBytes\": 1048576}\n"
+        "  ]\n"
+        "}\n");
+}
+
+void SceneConverterImplementationTest::profileJsonEmpty() {
+    Implementation::Profiler profiler;
+    profiler.enabled = true;
+
+    CORRADE_COMPARE(Implementation::profileJson(profiler),
+        "{\n"
+        "  \"stages\": [],\n"
+        "  \"items\": []\n"
+        "}\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SceneConverterImplementationTest)
@@ -300,6 +300,23 @@ const struct {
         "Mesh 0 duplicate removal: 5 -> 4 vertices\n"
         "Mesh 1 duplicate removal: 6 -> 4 vertices\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    {"two meshes + scene, remove duplicate vertices, streaming, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--remove-duplicate-vertices", "--stream", "-v",
+            "-I", "GltfImporter", "-C", "GltfSceneConverter",
+            /* Removing the generator identifier for a smaller file */
+            "-c", "generator=",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-quads-duplicates.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-quads.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter", {}, nullptr,
+        /* The meshes are processed and added one by one, but the output
+           should be the same as without --stream */
+        "two-quads.gltf", "two-quads.bin",
+        "Mesh 0 duplicate removal: 5 -> 4 vertices\n"
+        "Mesh 1 duplicate removal: 6 -> 4 vertices\n"
+        "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
     {"one implicit mesh, remove duplicate vertices fuzzy", {InPlaceInit, {
             "--remove-duplicate-vertices-fuzzy", "1.0e-1",
             Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-duplicates-fuzzy.obj"),
@@ -1037,6 +1054,11 @@ const struct {
         }},
         nullptr, nullptr, nullptr, nullptr,
         "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes\n"},
+    {"--stream and --pack-texture-arrays", {InPlaceInit, {
+            "--stream", "--pack-texture-arrays", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --stream and --pack-texture-arrays options are mutually exclusive\n"},
     {"--prefer without a colon", {InPlaceInit, {
             "--prefer", "PngImporter=StbImageImporter", "a", "b",
         }},
@@ -0,0 +1,241 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <utility>
+#include <random>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/SceneTools/Filter.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Test/BenchmarkTester.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct SceneToolsBenchmark: Magnum::Test::BenchmarkTester {
+    explicit SceneToolsBenchmark();
+
+    void parentsBreadthFirst();
+    void absoluteFieldTransformations3D();
+    void filterObjects();
+    void combineFields();
+};
+
+/* City-scale scene -- a city root with 16 districts, 16 blocks in each
+   district, 16 buildings in each block and 8 mesh parts in each building,
+   giving 37137 objects in total. Each object has a parent and a
+   transformation, the leaf parts have a mesh and a material. */
+struct CityScene {
+    Containers::Array<UnsignedInt> objects;
+    Containers::Array<Int> parents;
+    Containers::Array<Matrix4> transformations;
+    Containers::Array<UnsignedInt> meshObjects;
+    Containers::Array<UnsignedInt> meshes;
+    Containers::Array<Int> meshMaterials;
+
+    UnsignedInt objectCount() const { return objects.size(); }
+
+    Containers::Array<Trade::SceneFieldData> fields() const {
+        return Containers::array<Trade::SceneFieldData>({
+            Trade::SceneFieldData{Trade::SceneField::Parent,
+                Containers::stridedArrayView(objects),
+                Containers::stridedArrayView(parents)},
+            Trade::SceneFieldData{Trade::SceneField::Transformation,
+                Containers::stridedArrayView(objects),
+                Containers::stridedArrayView(transformations)},
+            Trade::SceneFieldData{Trade::SceneField::Mesh,
+                Containers::stridedArrayView(meshObjects),
+                Containers::stridedArrayView(meshes)},
+            Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+                Containers::stridedArrayView(meshObjects),
+                Containers::stridedArrayView(meshMaterials)}
+        });
+    }
+
+    Trade::SceneData scene() const {
+        const Containers::Array<Trade::SceneFieldData> fields = this->fields();
+        return SceneTools::combineFields(Trade::SceneMappingType::UnsignedInt, objectCount(), fields);
+    }
+};
+
+/* Objects are created in a depth-first order, optionally with their IDs
+   shuffled to resemble a file where the hierarchy is stored in an arbitrary
+   order */
+CityScene cityScene(bool shuffled) {
+    /* Default-seeded to have the benchmark reproducible */
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> position{-10.0f, 10.0f};
+    std::uniform_real_distribution<Float> angle{0.0f, 360.0f};
+
+    CityScene out;
+    const auto addObject = [&](Int parent) {
+        const UnsignedInt id = out.objects.size();
+        arrayAppend(out.objects, id);
+        arrayAppend(out.parents, parent);
+        arrayAppend(out.transformations,
+            Matrix4::translation({position(g), 0.0f, position(g)})*
+            Matrix4::rotationY(Deg(angle(g))));
+        return Int(id);
+    };
+
+    const Int city = addObject(-1);
+    for(std::size_t district = 0; district != 16; ++district) {
+        const Int districtId = addObject(city);
+        for(std::size_t block = 0; block != 16; ++block) {
+            const Int blockId = addObject(districtId);
+            for(std::size_t building = 0; building != 16; ++building) {
+                const Int buildingId = addObject(blockId);
+                for(std::size_t part = 0; part != 8; ++part) {
+                    const Int partId = addObject(buildingId);
+                    arrayAppend(out.meshObjects, UnsignedInt(partId));
+                    arrayAppend(out.meshes, UnsignedInt(part));
+                    arrayAppend(out.meshMaterials, Int(building % 4));
+                }
+            }
+        }
+    }
+
+    if(shuffled) {
+        Containers::Array<UnsignedInt> mapping{NoInit, out.objects.size()};
+        for(std::size_t i = 0; i != mapping.size(); ++i) mapping[i] = i;
+        /* Not using std::shuffle() as its output is implementation-defined,
+           the benchmark should do the same work everywhere */
+        for(std::size_t i = mapping.size() - 1; i > 0; --i)
+            std::swap(mapping[i], mapping[g() % (i + 1)]);
+
+        for(UnsignedInt& i: out.objects) i = mapping[i];
+        for(Int& i: out.parents) if(i != -1) i = mapping[i];
+        for(UnsignedInt& i: out.meshObjects) i = mapping[i];
+    }
+
+    return out;
+}
+
+const struct {
+    const char* name;
+    bool shuffled;
+} Data[]{
+    {"city scene, depth-first", false},
+    {"city scene, shuffled", true}
+};
+
+SceneToolsBenchmark::SceneToolsBenchmark(): BenchmarkTester{"SceneToolsBenchmark"} {
+    const std::initializer_list<void(SceneToolsBenchmark::*)()> benchmarks{
+        &SceneToolsBenchmark::parentsBreadthFirst,
+        &SceneToolsBenchmark::absoluteFieldTransformations3D,
+        &SceneToolsBenchmark::filterObjects,
+        &SceneToolsBenchmark::combineFields};
+
+    addCustomInstancedBenchmarks<SceneToolsBenchmark>(benchmarks, 5,
+        Containers::arraySize(Data),
+        &SceneToolsBenchmark::throughputBenchmarkBegin,
+        &SceneToolsBenchmark::throughputBenchmarkEnd,
+        BenchmarkUnits::Count);
+
+    if(MemoryBenchmarkSupported)
+        addCustomInstancedBenchmarks<SceneToolsBenchmark>(benchmarks, 1,
+            Containers::arraySize(Data),
+            &SceneToolsBenchmark::memoryBenchmarkBegin,
+            &SceneToolsBenchmark::memoryBenchmarkEnd,
+            BenchmarkUnits::Bytes);
+}
+
+void SceneToolsBenchmark::parentsBreadthFirst() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("parentsBreadthFirst", data.name);
+
+    const Trade::SceneData scene = cityScene(data.shuffled).scene();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        count = SceneTools::parentsBreadthFirst(scene).size();
+        addProcessedElements(scene.fieldSize(Trade::SceneField::Parent));
+    }
+
+    CORRADE_COMPARE(count, scene.mappingBound());
+}
+
+void SceneToolsBenchmark::absoluteFieldTransformations3D() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("absoluteFieldTransformations3D", data.name);
+
+    const Trade::SceneData scene = cityScene(data.shuffled).scene();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        count = SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh).size();
+        addProcessedElements(scene.fieldSize(Trade::SceneField::Mesh));
+    }
+
+    CORRADE_COMPARE(count, std::size_t{16*16*16*8});
+}
+
+void SceneToolsBenchmark::filterObjects() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("filterObjects", data.name);
+
+    const Trade::SceneData scene = cityScene(data.shuffled).scene();
+
+    /* Keeping every other object */
+    Containers::BitArray objectsToKeep{ValueInit, std::size_t(scene.mappingBound())};
+    for(std::size_t i = 0; i < objectsToKeep.size(); i += 2)
+        objectsToKeep.set(i);
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        count = SceneTools::filterObjects(scene, objectsToKeep).fieldSize(Trade::SceneField::Parent);
+        addProcessedElements(scene.mappingBound());
+    }
+
+    CORRADE_COMPARE(count, (scene.mappingBound() + 1)/2);
+}
+
+void SceneToolsBenchmark::combineFields() {
+    auto&& data = Data[testCaseInstanceId()];
+    setBenchmarkCase("combineFields", data.name);
+
+    const CityScene city = cityScene(data.shuffled);
+    const Containers::Array<Trade::SceneFieldData> fields = city.fields();
+    std::size_t entryCount = 0;
+    for(const Trade::SceneFieldData& field: fields)
+        entryCount += field.size();
+
+    UnsignedInt fieldCount = 0;
+    CORRADE_BENCHMARK(1) {
+        fieldCount = SceneTools::combineFields(Trade::SceneMappingType::UnsignedInt, city.objectCount(), fields).fieldCount();
+        addProcessedElements(entryCount);
+    }
+
+    CORRADE_COMPARE(fieldCount, 4);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SceneToolsBenchmark)
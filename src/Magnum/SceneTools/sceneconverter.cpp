@@ -33,6 +33,7 @@
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* parseNumberSequence() */
 
+#include "Magnum/MaterialTools/PackTextureArrays.h"
 #include "Magnum/MaterialTools/PhongToPbrMetallicRoughness.h"
 #include "Magnum/MaterialTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Concatenate.h"
@@ -41,12 +42,15 @@
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/TextureData.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
 
 #include "Magnum/Implementation/converterUtilities.h"
+#include "Magnum/SceneTools/Implementation/sceneConverterProfiler.h"
 #include "Magnum/SceneTools/Implementation/sceneConverterUtilities.h"
 
 namespace Magnum {
@@ -185,7 +189,7 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
     [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
     [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
-    [--remove-duplicate-materials]
+    [--remove-duplicate-materials] [--pack-texture-arrays] [--stream]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
@@ -197,7 +201,8 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [--info-images] [--info-lights] [--info-cameras] [--info-materials]
     [--info-meshes] [--info-objects] [--info-scenes] [--info-skins]
     [--info-textures] [--info] [--color on|4bit|off|auto] [--bounds]
-    [--object-hierarchy] [-v|--verbose] [--profile] [--] input output
+    [--object-hierarchy] [-v|--verbose] [--profile] [--profile-top N]
+    [--profile-json FILE] [--threads N] [--] input output
 @endcode
 
 Arguments:
@@ -231,6 +236,10 @@ Arguments:
     using @ref MaterialTools::phongToPbrMetallicRoughness()
 -   `--remove-duplicate-materials` --- remove duplicate materials using
     @ref MaterialTools::removeDuplicatesInPlace()
+-   `--pack-texture-arrays` --- pack material textures into texture arrays
+    using @ref MaterialTools::packTextureArrays()
+-   `--stream` --- import, process and add meshes and images one by one
+    instead of processing all of them before conversion
 -   `-i`, `--importer-options key=val,key2=val2,…` --- configuration options to
     pass to the importer
 -   `-c`, `--converter-options key=val,key2=val2,…` --- configuration options
@@ -270,7 +279,15 @@ Arguments:
 -   `--bounds` --- show bounds of known attributes in `--info` output
 -   `--object-hierarchy` --- visualize object hierarchy in `--info` output
 -   `-v`, `--verbose` --- verbose output from importer and converter plugins
--   `--profile` --- measure import and conversion time
+-   `--profile` --- measure import and conversion time, with a per-stage
+    breakdown
+-   `--profile-top N` --- list @p N items that took the longest, implies
+    `--profile`
+-   `--profile-json FILE` --- save detailed per-stage and per-item profiling
+    results to a JSON file, implies `--profile`
+-   `--threads N` --- number of threads to use for mesh, scene and texture
+    processing, including the main thread. Use @cpp 0 @ce to use all hardware
+    threads. (default: @cpp 1 @ce)
 
 If any of the `--info-importer`, `--info-converter` or `--info-image-converter`
 options are given, the utility will print information about given plugin
@@ -312,9 +329,22 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no `-P` / `-M` is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The `--remove-duplicate-vertices`, `--phong-to-pbr` and
-`--remove-duplicate-materials` operations are performed on meshes and materials
-before passing them to any converter.
+The `--remove-duplicate-vertices`, `--phong-to-pbr`,
+`--remove-duplicate-materials` and `--pack-texture-arrays` operations are
+performed on meshes and materials before passing them to any converter. With
+`--pack-texture-arrays`, all 2D images referenced by material textures are
+replaced with 3D images containing the texture arrays, and the output thus
+needs to support 3D images.
+
+By default, when any image or mesh processing is requested, all images and
+meshes are imported and processed first and only then passed to the converter.
+With `--stream`, each image and mesh is imported, processed, added to the
+converter and discarded before the next one is imported. If the output
+converter supports @ref Trade::SceneConverterFeature::StreamingOutput, the
+peak memory use is then proportional to the largest image or mesh instead of
+the total size of the input. As the importer plugins aren't thread-safe, at
+most one item is processed at a time. The option can't be combined with
+`--pack-texture-arrays`, which needs all images at once.
 
 If `--concatenate-meshes` is given, all meshes of the input file are
 first concatenated into a single mesh using @ref MeshTools::concatenate(), with
@@ -323,6 +353,16 @@ the scene hierarchy transformation baked in using
 remaining operations. Only attributes that are present in the first mesh are
 taken, if `--only-mesh-attributes` is specified as well, the IDs reference
 attributes of the first mesh.
+
+With `--profile`, the total import and conversion time is printed at the end,
+followed by a table with wall time, CPU time, net heap allocation and peak
+resident memory of each stage, such as import, duplicate removal or a
+particular converter plugin. With `--profile-top` the table is followed by a
+given count of individual meshes, images, materials or scenes that took the
+longest, `--profile-json` saves all stages and individual items to a JSON file
+for further processing. Net heap allocation is available only with glibc, peak
+resident memory is per-stage on Linux and for the whole process so far on
+other Unix systems.
 */
 
 }
@@ -352,7 +392,7 @@ bool isDataInfoRequested(const Utility::Arguments& args) {
            args.isSet("info");
 }
 
-template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
+template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, SceneTools::Implementation::Profiler& profiler, std::chrono::high_resolution_clock::duration& conversionTime, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
     const bool passthroughOnConversionFailure = args.isSet("passthrough-on-image-converter-failure");
 
     for(std::size_t j = 0, imageConverterCount = args.arrayValueCount("image-converter"); j != imageConverterCount; ++j) {
@@ -401,7 +441,13 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
         /** @todo handle image levels here, once GltfSceneConverter is capable
             of converting them (which needs AbstractImageConverter to be
             reworked around ImageData) */
-        if(Containers::Optional<Trade::ImageData<dimensions>> converted = imageConverter->convert(*image)) {
+        Containers::Optional<Trade::ImageData<dimensions>> converted;
+        {
+            const Containers::String stage = "image converter "_s + imageConverterName;
+            SceneTools::Implementation::Profile d{profiler, conversionTime, stage, dimensions == 2 ? "2D image"_s : "3D image"_s, i};
+            converted = imageConverter->convert(*image);
+        }
+        if(converted) {
             image = Utility::move(converted);
         } else if(passthroughOnConversionFailure) {
             Warning{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName << Debug::nospace << ", passing the original through";
@@ -437,6 +483,8 @@ int main(int argc, char** argv) {
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
         .addBooleanOption("phong-to-pbr").setHelp("phong-to-pbr", "convert Phong materials to PBR metallic/roughness")
         .addBooleanOption("remove-duplicate-materials").setHelp("remove-duplicate-materials", "remove duplicate materials")
+        .addBooleanOption("pack-texture-arrays").setHelp("pack-texture-arrays", "pack material textures into texture arrays")
+        .addBooleanOption("stream").setHelp("stream", "import, process and add meshes and images one by one instead of processing all of them before conversion")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
         .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
         .addArrayOption('p', "image-converter-options").setHelp("image-converter-options", "configuration options to pass to the image converter(s)", "key=val,key2=val2,…")
@@ -464,7 +512,10 @@ int main(int argc, char** argv) {
         .addBooleanOption("bounds").setHelp("bounds", "show bounds of known attributes in --info output")
         .addBooleanOption("object-hierarchy").setHelp("object-hierarchy", "visualize object hierarchy in --info output")
         .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
-        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
+        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time, with a per-stage breakdown")
+        .addOption("profile-top", "0").setHelp("profile-top", "list given count of items that took the longest, implies --profile", "N")
+        .addOption("profile-json").setHelp("profile-json", "save detailed per-stage and per-item profiling results to a JSON file, implies --profile", "FILE")
+        .addOption("threads", "1").setHelp("threads", "number of threads to use for mesh, scene and texture processing, including the main thread; 0 to use all hardware threads", "N")
         .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
             /* If --info for plugins is passed, we don't need the input */
             if(error == Utility::Arguments::ParseError::MissingArgument &&
@@ -515,9 +566,17 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no -P / -M is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The --remove-duplicate-vertices, --phong-to-pbr and
---remove-duplicate-materials operations are performed on meshes and materials
-before passing them to any converter.
+The --remove-duplicate-vertices, --phong-to-pbr, --remove-duplicate-materials
+and --pack-texture-arrays operations are performed on meshes and materials
+before passing them to any converter. With --pack-texture-arrays, all 2D images
+referenced by material textures are replaced with 3D images containing the
+texture arrays, and the output thus needs to support 3D images.
+
+With --stream, each image and mesh is imported, processed, added to the
+converter and discarded before the next one is imported, instead of processing
+all of them before conversion. If the output converter supports streaming
+output, the peak memory use is then proportional to the largest item instead of
+the total input size. Can't be combined with --pack-texture-arrays.
 
 If --concatenate-meshes is given, all meshes of the input file are first
 concatenated into a single mesh, with the scene hierarchy transformation baked
@@ -579,6 +638,10 @@ well, the IDs reference attributes of the first mesh.)")
         Error{} << "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes";
         return 1;
     }
+    if(args.isSet("stream") && args.isSet("pack-texture-arrays")) {
+        Error{} << "The --stream and --pack-texture-arrays options are mutually exclusive";
+        return 1;
+    }
 
     /* Importer manager */
     PluginManager::Manager<Trade::AbstractImporter> importerManager{
@@ -758,11 +821,23 @@ well, the IDs reference attributes of the first mesh.)")
        conversion are measured separately. */
     std::chrono::high_resolution_clock::duration importConversionTime{};
 
+    /* Per-stage and per-item profiling. The above durations are gathered
+       always, the detailed entries only if requested. */
+    SceneTools::Implementation::Profiler profiler;
+    profiler.enabled = args.isSet("profile") || args.value<UnsignedInt>("profile-top") || args.value<Containers::StringView>("profile-json");
+
+    /* Thread pool used by MeshTools, SceneTools and TextureTools algorithms.
+       The calling thread participates as well, so the worker count is one
+       less than the requested thread count. */
+    const UnsignedInt threadCount = args.value<UnsignedInt>("threads");
+    ThreadPool threadPool{(threadCount ? threadCount : ThreadPool::hardwareThreadCount()) - 1};
+    ThreadPool::setGlobal(&threadPool);
+
     /* Open the file or map it if requested */
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
     if(args.isSet("map")) {
-        Trade::Implementation::Duration d{importConversionTime};
+        SceneTools::Implementation::Profile d{profiler, importConversionTime, "open"};
         if(!(mapped = Utility::Path::mapRead(args.value("input"))) || !importer->openMemory(*mapped)) {
             Error() << "Cannot memory-map file" << args.value("input");
             return 3;
@@ -770,7 +845,7 @@ well, the IDs reference attributes of the first mesh.)")
     } else
     #endif
     {
-        Trade::Implementation::Duration d{importConversionTime};
+        SceneTools::Implementation::Profile d{profiler, importConversionTime, "open"};
         if(!importer->openFile(args.value("input"))) {
             Error() << "Cannot open file" << args.value("input");
             return 3;
@@ -781,7 +856,7 @@ well, the IDs reference attributes of the first mesh.)")
     if(isDataInfoRequested(args)) {
         const bool error = SceneTools::Implementation::printInfo(useColor, useColor24, args, *importer, importConversionTime);
 
-        if(args.isSet("profile")) {
+        if(profiler.enabled) {
             Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importConversionTime).count())/1.0e3f << "seconds";
         }
 
@@ -800,7 +875,7 @@ well, the IDs reference attributes of the first mesh.)")
         for(UnsignedInt i = 0; i != importer->sceneCount(); ++i) {
             Containers::Optional<Trade::SceneData> scene;
             {
-                Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "scene", i};
                 if(!(scene = importer->scene(i))) {
                     Error{} << "Cannot import scene" << i;
                     return 1;
@@ -836,7 +911,7 @@ well, the IDs reference attributes of the first mesh.)")
             /** @todo handle mesh levels here, once any plugin is capable of
                 importing them */
             for(std::size_t i = 0, iMax = importer->meshCount(); i != iMax; ++i) {
-                Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "mesh", UnsignedInt(i)};
                 Containers::Optional<Trade::MeshData> meshToConcatenate = importer->mesh(i);
                 if(!meshToConcatenate) {
                     Error{} << "Cannot import mesh" << i;
@@ -857,7 +932,7 @@ well, the IDs reference attributes of the first mesh.)")
                         original behavior only being achievable if everything
                         except meshes and scene hierarchy is filtered away */
                     const UnsignedInt defaultScene = importer->defaultScene() == -1 ? 0 : importer->defaultScene();
-                    Trade::Implementation::Duration d{importConversionTime};
+                    SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "scene", defaultScene};
                     if(!(scene = importer->scene(defaultScene))) {
                         Error{} << "Cannot import scene" << defaultScene << "for mesh concatenation";
                         return 1;
@@ -870,7 +945,7 @@ well, the IDs reference attributes of the first mesh.)")
                     SceneTools::absoluteFieldTransformations3D(*scene, Trade::SceneField::Mesh);
                 Containers::Array<Trade::MeshData> flattenedMeshes;
                 {
-                    Trade::Implementation::Duration d{conversionTime};
+                    SceneTools::Implementation::Profile d{profiler, conversionTime, "concatenate-meshes transform"};
                     /** @todo once there are 2D scenes, check the scene is 3D */
                     for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
                         arrayAppend(flattenedMeshes, MeshTools::transform3D(
@@ -881,7 +956,7 @@ well, the IDs reference attributes of the first mesh.)")
             }
 
             {
-                Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::Profile d{profiler, conversionTime, "concatenate-meshes"};
                 /** @todo this will assert if the meshes have incompatible primitives
                     (such as some triangles, some lines), or if they have
                     loops/strips/fans -- handle that explicitly */
@@ -890,7 +965,7 @@ well, the IDs reference attributes of the first mesh.)")
 
         /* Otherwise import just one */
         } else {
-            Trade::Implementation::Duration d{importConversionTime};
+            SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "mesh", args.value<UnsignedInt>("mesh")};
             if(!(mesh = importer->mesh(args.value<UnsignedInt>("mesh"), args.value<UnsignedInt>("mesh-level")))) {
                 Error{} << "Cannot import the mesh";
                 return 4;
@@ -974,11 +1049,147 @@ well, the IDs reference attributes of the first mesh.)")
             *previousImporter);
     }
 
+    /* Import and process a single image or mesh. Used either upfront for all
+       images and meshes below, or directly when adding them to the converter
+       if --stream is specified. Returns a non-zero exit code on failure. */
+    auto importImage2D = [&](const UnsignedInt i, Containers::Optional<Trade::ImageData2D>& image) -> Int {
+        {
+            /** @todo handle image levels once GltfSceneConverter can save
+                them (which needs AbstractImageConverter to be reworked
+                around ImageData) -- there could be an image2DOffsets
+                array saying which subrange is levels for which image */
+            SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "2D image", i};
+            if(!(image = importer->image2D(i))) {
+                Error{} << "Cannot import 2D image" << i;
+                return 1;
+            }
+        }
+
+        if(!runImageConverters(imageConverterManager, args, profiler, conversionTime, i, image))
+            return 1;
+
+        return 0;
+    };
+    auto importImage3D = [&](const UnsignedInt i, Containers::Optional<Trade::ImageData3D>& image) -> Int {
+        {
+            /** @todo handle image levels once GltfSceneConverter can save
+                them (which needs AbstractImageConverter to be reworked
+                around ImageData) -- there could be an image2DOffsets
+                array saying which subrange is levels for which image */
+            SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "3D image", i};
+            if(!(image = importer->image3D(i))) {
+                Error{} << "Cannot import 3D image" << i;
+                return 1;
+            }
+        }
+
+        if(!runImageConverters(imageConverterManager, args, profiler, conversionTime, i, image))
+            return 1;
+
+        return 0;
+    };
+    auto importMesh = [&](const UnsignedInt i, Containers::Optional<Trade::MeshData>& mesh) -> Int {
+        {
+            /** @todo handle mesh levels here, once any plugin is capable
+                of importing them */
+            SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "mesh", i};
+            if(!(mesh = importer->mesh(i))) {
+                Error{} << "Cannot import mesh" << i;
+                return 1;
+            }
+        }
+
+        /* Duplicate removal */
+        if(args.isSet("remove-duplicate-vertices") ||
+           args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
+        {
+            const UnsignedInt beforeVertexCount = mesh->vertexCount();
+            const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
+
+            /** @todo accept two values for float and double fuzzy
+                comparison, or maybe also different for positions, normals
+                and texcoords? ugh... */
+            if(fuzzy) {
+                SceneTools::Implementation::Profile d{profiler, conversionTime, "remove-duplicate-vertices-fuzzy", "mesh", i};
+                mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
+            } else {
+                SceneTools::Implementation::Profile d{profiler, conversionTime, "remove-duplicate-vertices", "mesh", i};
+                mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
+            }
+
+            if(args.isSet("verbose")) {
+                Debug d;
+                /* Mesh index 0 would be confusing in case of
+                    --concatenate-meshes and plain wrong with --mesh, so
+                    don't even print it */
+                if(singleMesh)
+                    d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
+                else
+                    d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
+                d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
+            }
+        }
+
+        /* Arbitrary mesh converters */
+        const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
+        for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
+            const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
+            if(args.isSet("verbose")) {
+                Debug d;
+                d << "Processing mesh" << i;
+                if(meshConverterCount > 1)
+                    d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
+                d << "with" << meshConverterName << Debug::nospace << "...";
+            }
+
+            Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(meshConverterName);
+            if(!meshConverter) {
+                Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
+                return 2;
+            }
+
+            /* Set options, if passed. The AnySceneConverter check makes no
+               sense here, is just there because the helper wants it */
+            if(args.isSet("verbose")) meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
+            if(j < args.arrayValueCount("mesh-converter-options"))
+                Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+
+            if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
+                Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
+                return 1;
+            }
+
+            /** @todo handle mesh levels here, once any plugin is capable
+                of converting them */
+            Containers::Optional<Trade::MeshData> converted;
+            {
+                const Containers::String stage = "mesh converter "_s + meshConverterName;
+                SceneTools::Implementation::Profile d{profiler, conversionTime, stage, "mesh", i};
+                converted = meshConverter->convert(*mesh);
+            }
+            if(converted) {
+                mesh = Utility::move(converted);
+            } else if(passthroughOnConversionFailure) {
+                Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
+            } else {
+                Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
+                return 1;
+            }
+        }
+
+        return 0;
+    };
+
     /* Operations to perform on all images in the importer. If there are any,
-       images are supplied manually to the converter from the array below. */
+       images are supplied manually to the converter from the array below, or
+       imported one by one when adding them to the converter with --stream.
+       Texture array packing needs all images as well. */
     Containers::Array<Trade::ImageData2D> images2D;
     Containers::Array<Trade::ImageData3D> images3D;
-    if(args.arrayValueCount("image-converter")) {
+    bool streamImages = false;
+    if(args.arrayValueCount("image-converter") ||
+       args.isSet("pack-texture-arrays"))
+    {
         /** @todo implement once there's any file format capable of storing
             these */
         if(importer->image1DCount()) {
@@ -986,142 +1197,48 @@ well, the IDs reference attributes of the first mesh.)")
             return 1;
         }
 
-        for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
-            Containers::Optional<Trade::ImageData2D> image;
-            {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image2D(i))) {
-                    Error{} << "Cannot import 2D image" << i;
-                    return 1;
-                }
-            }
-
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
-
-            arrayAppend(images2D, *Utility::move(image));
-        }
+        if(args.isSet("stream")) {
+            streamImages = true;
+        } else {
+            for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
+                Containers::Optional<Trade::ImageData2D> image;
+                if(const Int code = importImage2D(i, image))
+                    return code;
 
-        for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
-            Containers::Optional<Trade::ImageData3D> image;
-            {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image3D(i))) {
-                    Error{} << "Cannot import 3D image" << i;
-                    return 1;
-                }
+                arrayAppend(images2D, *Utility::move(image));
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
+            for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
+                Containers::Optional<Trade::ImageData3D> image;
+                if(const Int code = importImage3D(i, image))
+                    return code;
 
-            arrayAppend(images3D, *Utility::move(image));
+                arrayAppend(images3D, *Utility::move(image));
+            }
         }
     }
 
     /* Operations to perform on all meshes in the importer. If there are any,
-       meshes are supplied manually to the converter from the array below. */
+       meshes are supplied manually to the converter from the array below, or
+       imported one by one when adding them to the converter with --stream. */
     Containers::Array<Trade::MeshData> meshes;
+    bool streamMeshes = false;
     if(args.isSet("remove-duplicate-vertices") ||
        args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
        args.arrayValueCount("mesh-converter"))
     {
-        const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
-
-        arrayReserve(meshes, importer->meshCount());
-
-        for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
-            Containers::Optional<Trade::MeshData> mesh;
-            {
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of importing them */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(mesh = importer->mesh(i))) {
-                    Error{} << "Cannot import mesh" << i;
-                    return 1;
-                }
-            }
-
-            /* Duplicate removal */
-            if(args.isSet("remove-duplicate-vertices") ||
-               args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
-            {
-                const UnsignedInt beforeVertexCount = mesh->vertexCount();
-                const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
-
-                /** @todo accept two values for float and double fuzzy
-                    comparison, or maybe also different for positions, normals
-                    and texcoords? ugh... */
-                if(fuzzy) {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
-                } else {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
-                }
-
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    /* Mesh index 0 would be confusing in case of
-                        --concatenate-meshes and plain wrong with --mesh, so
-                        don't even print it */
-                    if(singleMesh)
-                        d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
-                    else
-                        d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
-                    d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
-                }
-            }
-
-            /* Arbitrary mesh converters */
-            for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
-                const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    d << "Processing mesh" << i;
-                    if(meshConverterCount > 1)
-                        d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
-                    d << "with" << meshConverterName << Debug::nospace << "...";
-                }
-
-                Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(meshConverterName);
-                if(!meshConverter) {
-                    Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
-                    return 2;
-                }
-
-                /* Set options, if passed. The AnySceneConverter check makes no
-                   sense here, is just there because the helper wants it */
-                if(args.isSet("verbose")) meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
-                if(j < args.arrayValueCount("mesh-converter-options"))
-                    Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+        if(args.isSet("stream")) {
+            streamMeshes = true;
+        } else {
+            arrayReserve(meshes, importer->meshCount());
 
-                if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
-                    Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
-                    return 1;
-                }
+            for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+                Containers::Optional<Trade::MeshData> mesh;
+                if(const Int code = importMesh(i, mesh))
+                    return code;
 
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of converting them */
-                if(Containers::Optional<Trade::MeshData> converted = meshConverter->convert(*mesh)) {
-                    mesh = Utility::move(converted);
-                } else if(passthroughOnConversionFailure) {
-                    Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
-                } else {
-                    Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
-                    return 1;
-                }
+                arrayAppend(meshes, *Utility::move(mesh));
             }
-
-            arrayAppend(meshes, *Utility::move(mesh));
         }
     }
 
@@ -1129,15 +1246,18 @@ well, the IDs reference attributes of the first mesh.)")
        any, materials are supplied manually to the converter from the array
        below. */
     Containers::Array<Trade::MaterialData> materials;
+    Containers::Array<Trade::TextureData> textures;
+    bool texturesPacked = false;
     if(args.isSet("phong-to-pbr") ||
-       args.isSet("remove-duplicate-materials"))
+       args.isSet("remove-duplicate-materials") ||
+       args.isSet("pack-texture-arrays"))
     {
         arrayReserve(materials, importer->materialCount());
 
         for(UnsignedInt i = 0; i != importer->materialCount(); ++i) {
             Containers::Optional<Trade::MaterialData> material;
             {
-                Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "material", i};
                 if(!(material = importer->material(i))) {
                     Error{} << "Cannot import material" << i;
                     return 1;
@@ -1149,7 +1269,7 @@ well, the IDs reference attributes of the first mesh.)")
                 if(args.isSet("verbose"))
                     Debug{} << "Converting material" << i << "to PBR";
 
-                Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::Profile d{profiler, conversionTime, "phong-to-pbr", "material", i};
                 /** @todo make the flags configurable as well? then the below
                     assert can actually fire, convert to a runtime error */
                 material = MaterialTools::phongToPbrMetallicRoughness(*material, MaterialTools::PhongToPbrMetallicRoughnessFlag::DropUnconvertibleAttributes);
@@ -1161,7 +1281,7 @@ well, the IDs reference attributes of the first mesh.)")
 
         /* Duplicate removal */
         if(args.isSet("remove-duplicate-materials")) {
-            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::Profile d{profiler, conversionTime, "remove-duplicate-materials"};
 
             Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> mapping = MaterialTools::removeDuplicatesInPlace(materials);
             if(args.isSet("verbose"))
@@ -1185,6 +1305,48 @@ well, the IDs reference attributes of the first mesh.)")
                 }
             }
         }
+
+        /* Texture array packing. Done after duplicate removal to not pack
+           textures referenced only by removed materials. */
+        if(args.isSet("pack-texture-arrays")) {
+            arrayReserve(textures, importer->textureCount());
+            for(UnsignedInt i = 0; i != importer->textureCount(); ++i) {
+                Containers::Optional<Trade::TextureData> texture;
+                {
+                    SceneTools::Implementation::Profile d{profiler, importConversionTime, "import", "texture", i};
+                    if(!(texture = importer->texture(i))) {
+                        Error{} << "Cannot import texture" << i;
+                        return 1;
+                    }
+                }
+
+                arrayAppend(textures, *Utility::move(texture));
+            }
+
+            SceneTools::Implementation::Profile d{profiler, conversionTime, "pack-texture-arrays"};
+
+            Containers::Optional<Containers::Triple<Containers::Array<Trade::MaterialData>, Containers::Array<Trade::TextureData>, Containers::Array<Trade::ImageData3D>>> packed = MaterialTools::packTextureArrays(materials, textures, images2D);
+            if(!packed) {
+                Error{} << "Cannot pack textures into texture arrays";
+                return 1;
+            }
+            if(args.isSet("verbose"))
+                Debug{} << "Texture array packing:" << textures.size() << "textures and" << images2D.size() << "2D images ->" << packed->second().size() << "texture arrays";
+
+            /* The packed images are put after 3D images from the importer, so
+               the texture references have to be shifted */
+            materials = Utility::move(packed->first());
+            textures = Containers::Array<Trade::TextureData>{};
+            arrayReserve(textures, packed->second().size());
+            for(const Trade::TextureData& texture: packed->second())
+                arrayAppend(textures, InPlaceInit, texture.type(), texture.minificationFilter(), texture.magnificationFilter(), texture.mipmapFilter(), texture.wrapping(), UnsignedInt(images3D.size() + texture.image()));
+            for(Trade::ImageData3D& image: packed->third())
+                arrayAppend(images3D, Utility::move(image));
+
+            /* The original 2D images aren't referenced by anything anymore */
+            images2D = {};
+            texturesPacked = true;
+        }
     }
 
     /* Assume there's always one passed --converter option less, and the last
@@ -1203,6 +1365,10 @@ well, the IDs reference attributes of the first mesh.)")
             return 2;
         }
 
+        /* Profiling stage names, referenced by the Profile instances below */
+        const Containers::String converterStage = "converter "_s + converterName;
+        const Containers::String converterContentsStage = converterStage + " importer contents"_s;
+
         /* Set options, if passed */
         if(args.isSet("verbose")) converter->addFlags(Trade::SceneConverterFlag::Verbose);
         if(i < args.arrayValueCount("converter-options"))
@@ -1225,7 +1391,7 @@ well, the IDs reference attributes of the first mesh.)")
            the end), output to a file */
         if(isLastConverter) {
             {
-                Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage};
                 if(!converter->beginFile(args.value("output"))) {
                     Error{} << "Cannot begin conversion of file" << args.value("output");
                     return 1;
@@ -1242,7 +1408,7 @@ well, the IDs reference attributes of the first mesh.)")
             }
 
             {
-                Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage};
                 if(!converter->begin()) {
                     Error{} << "Cannot begin importer conversion";
                     return 1;
@@ -1258,16 +1424,34 @@ well, the IDs reference attributes of the first mesh.)")
             mesh, material and scene import */
         Trade::SceneContents contents = ~Trade::SceneContents{};
 
+        /* If the textures were packed into texture arrays, the original 2D
+           images and textures aren't referenced by anything anymore. Do this
+           only for the first converter, the next ones get the images and
+           textures from the previous conversion step. */
+        if(texturesPacked) {
+            contents &= ~(Trade::SceneContent::Images2D|Trade::SceneContent::Textures);
+            texturesPacked = false;
+        }
+
         /* If there are any loose images from previous conversion steps, add
            them directly, and clear the array so the next iteration (if any)
-           takes them from the importer instead */
+           takes them from the importer instead. With --stream, the images are
+           imported and processed only here, one by one. */
         /** @todo 1D images, once there's any format that supports them */
-        if(images2D) {
+        if(images2D || streamImages) {
+            const UnsignedInt imageCount = streamImages ? importer->image2DCount() : images2D.size();
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Images2D)) {
-                Warning{} << "Ignoring" << images2D.size() << "2D images not supported by the converter";
-            } else for(UnsignedInt j = 0; j != images2D.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
-                if(!converter->add(images2D[j], contents & Trade::SceneContent::Names ? importer->image2DName(j) : Containers::String{})) {
+                if(imageCount)
+                    Warning{} << "Ignoring" << imageCount << "2D images not supported by the converter";
+            } else for(UnsignedInt j = 0; j != imageCount; ++j) {
+                Containers::Optional<Trade::ImageData2D> streamed;
+                if(streamImages) {
+                    if(const Int code = importImage2D(j, streamed))
+                        return code;
+                }
+
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage, "2D image", j};
+                if(!converter->add(streamImages ? *streamed : images2D[j], contents & Trade::SceneContent::Names ? importer->image2DName(j) : Containers::String{})) {
                     Error{} << "Cannot add 2D image" << j;
                     return 1;
                 }
@@ -1285,12 +1469,22 @@ well, the IDs reference attributes of the first mesh.)")
                 converter supporting images */
             images2D = {};
         }
-        if(images3D) {
+        if(images3D || streamImages) {
+            const UnsignedInt imageCount = streamImages ? importer->image3DCount() : images3D.size();
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Images3D)) {
-                Warning{} << "Ignoring" << images3D.size() << "3D images not supported by the converter";
-            } else for(UnsignedInt j = 0; j != images3D.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
-                if(!converter->add(images3D[j], contents & Trade::SceneContent::Names ? importer->image3DName(j) : Containers::String{})) {
+                if(imageCount)
+                    Warning{} << "Ignoring" << imageCount << "3D images not supported by the converter";
+            } else for(UnsignedInt j = 0; j != imageCount; ++j) {
+                Containers::Optional<Trade::ImageData3D> streamed;
+                if(streamImages) {
+                    if(const Int code = importImage3D(j, streamed))
+                        return code;
+                }
+
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage, "3D image", j};
+                /* Images coming from texture array packing are put after
+                   the imported ones and have no names */
+                if(!converter->add(streamImages ? *streamed : images3D[j], contents & Trade::SceneContent::Names && j < importer->image3DCount() ? importer->image3DName(j) : Containers::String{})) {
                     Error{} << "Cannot add 3D image" << j;
                     return 1;
                 }
@@ -1307,20 +1501,30 @@ well, the IDs reference attributes of the first mesh.)")
             /** @todo this line is untested, needs first an importer->importer
                 converter supporting images */
             images3D = {};
+            streamImages = false;
         }
 
         /* If there are any loose meshes from previous conversion steps, add
            them directly, and clear the array so the next iteration (if any)
-           takes them from the importer instead */
-        if(meshes) {
+           takes them from the importer instead. With --stream, the meshes are
+           imported and processed only here, one by one. */
+        if(meshes || streamMeshes) {
+            const UnsignedInt meshCount = streamMeshes ? importer->meshCount() : meshes.size();
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Meshes)) {
                 /** @todo test this branch once there's a plugin that doesn't
                     support meshes (URDF exporter, for example? glXF?) */
-                Warning{} << "Ignoring" << meshes.size() << "meshes not supported by the converter";
-            } else for(UnsignedInt j = 0; j != meshes.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                if(meshCount)
+                    Warning{} << "Ignoring" << meshCount << "meshes not supported by the converter";
+            } else for(UnsignedInt j = 0; j != meshCount; ++j) {
+                Containers::Optional<Trade::MeshData> streamed;
+                if(streamMeshes) {
+                    if(const Int code = importMesh(j, streamed))
+                        return code;
+                }
+
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage, "mesh", j};
 
-                const Trade::MeshData& mesh = meshes[j];
+                const Trade::MeshData& mesh = streamMeshes ? *streamed : meshes[j];
 
                 /* Propagate custom attribute names, skip ones that are empty.
                    Compared to data names this is done always to avoid
@@ -1358,6 +1562,36 @@ well, the IDs reference attributes of the first mesh.)")
                 that each change the output to verify the old meshes don't get
                 reused in the next step again */
             meshes = {};
+            streamMeshes = false;
+        }
+
+        /* If there are any loose textures from previous conversion steps, add
+           them directly, and clear the array so the next iteration (if any)
+           takes them from the importer instead. The images they reference
+           were added above already. */
+        if(textures) {
+            if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Textures)) {
+                Warning{} << "Ignoring" << textures.size() << "textures not supported by the converter";
+            } else for(UnsignedInt j = 0; j != textures.size(); ++j) {
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage, "texture", j};
+
+                /* Textures produced by texture array packing have no names */
+                if(!converter->add(textures[j])) {
+                    Error{} << "Cannot add texture" << j;
+                    return 1;
+                }
+            }
+
+            /* Ensure the textures are not added by
+               addSupportedImporterContents() below. Do this also in case the
+               converter actually doesn't support texture addition, as it
+               would otherwise cause two warnings about the same thing being
+               printed. */
+            contents &= ~Trade::SceneContent::Textures;
+
+            /* Delete the list to avoid adding them again for the next
+               converter (at which point they would be stale) */
+            textures = {};
         }
 
         /* If there are any loose materials from previous conversion steps, add
@@ -1375,7 +1609,7 @@ well, the IDs reference attributes of the first mesh.)")
                      Trade::SceneContent::Textures|
                      Trade::SceneContent::Names);
 
-                Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::Profile d{profiler, importConversionTime, converterContentsStage};
                 if(!converter->addSupportedImporterContents(*importer, materialDependencies)) {
                     Error{} << "Cannot add material dependencies";
                     return 5;
@@ -1390,7 +1624,7 @@ well, the IDs reference attributes of the first mesh.)")
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Materials)) {
                 Warning{} << "Ignoring" << materials.size() << "materials not supported by the converter";
             } else for(UnsignedInt j = 0; j != materials.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage, "material", j};
 
                 if(!converter->add(materials[j], contents & Trade::SceneContent::Names ? importer->materialName(j) : Containers::String{})) {
                     Error{} << "Cannot add material" << j;
@@ -1427,7 +1661,7 @@ well, the IDs reference attributes of the first mesh.)")
                       Trade::SceneContent::Scenes|
                       Trade::SceneContent::Animations);
 
-                Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::Profile d{profiler, importConversionTime, converterContentsStage};
                 if(!converter->addSupportedImporterContents(*importer, sceneDependencies)) {
                     Error{} << "Cannot add scene dependencies";
                     return 5;
@@ -1442,7 +1676,7 @@ well, the IDs reference attributes of the first mesh.)")
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Scenes)) {
                 Warning{} << "Ignoring" << scenes.size() << "scenes not supported by the converter";
             } else for(UnsignedInt j = 0; j != scenes.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage, "scene", j};
 
                 if(!converter->add(scenes[j], contents & Trade::SceneContent::Names ? importer->sceneName(j) : Containers::String{})) {
                     Error{} << "Cannot add scene" << j;
@@ -1466,7 +1700,7 @@ well, the IDs reference attributes of the first mesh.)")
         }
 
         {
-            Trade::Implementation::Duration d{importConversionTime};
+            SceneTools::Implementation::Profile d{profiler, importConversionTime, converterContentsStage};
             if(!converter->addSupportedImporterContents(*importer, contents)) {
                 Error{} << "Cannot add importer contents";
                 return 5;
@@ -1476,7 +1710,7 @@ well, the IDs reference attributes of the first mesh.)")
         /* This is the last --converter (or the implicit AnySceneConverter at
            the end), end the file and exit the loop */
         if(isLastConverter) {
-            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage};
             if(!converter->endFile()) {
                 Error{} << "Cannot end conversion of file" << args.value("output");
                 return 5;
@@ -1491,7 +1725,7 @@ well, the IDs reference attributes of the first mesh.)")
            a different one in the next iteration and keeping just the importer
            returned from it. */
         } else {
-            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::Profile d{profiler, conversionTime, converterStage};
             if(!(importer = converter->end())) {
                 Error{} << "Cannot end importer conversion";
                 return 1;
@@ -1499,8 +1733,17 @@ well, the IDs reference attributes of the first mesh.)")
         }
     }
 
-    if(args.isSet("profile")) {
+    if(profiler.enabled) {
         Debug{} << "Import and conversion took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importConversionTime).count())/1.0e3f << "seconds, conversion"
             << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
+        Debug{Debug::Flag::NoNewlineAtTheEnd} << SceneTools::Implementation::profileTable(profiler, args.value<UnsignedInt>("profile-top"));
+
+        if(const Containers::StringView profileJson = args.value<Containers::StringView>("profile-json")) {
+            const Containers::String json = SceneTools::Implementation::profileJson(profiler);
+            if(!Utility::Path::write(profileJson, Containers::arrayView(json.data(), json.size()))) {
+                Error{} << "Cannot save profiling results to" << profileJson;
+                return 1;
+            }
+        }
     }
 }
@@ -0,0 +1,111 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Phong.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Shaders {
+
+Containers::Array<UnsignedInt> phongLightClusters(const Matrix4& projectionMatrix, const Vector3ui& clusterCount, const Float near, const Float far, const Containers::ArrayView<const PhongLightUniform> lights) {
+    CORRADE_ASSERT(clusterCount.x() && clusterCount.y() && clusterCount.z(),
+        "Shaders::phongLightClusters(): expected a non-zero cluster count, got" << Debug::packed << clusterCount, {});
+    CORRADE_ASSERT(near > 0.0f && near < far,
+        "Shaders::phongLightClusters(): expected near to be positive and less than far, got" << near << "and" << far, {});
+
+    /* Unproject the corners of the screen-space grid to rays in view space.
+       Using NDC depth of -1 and 0 instead of 1 for the second point to not
+       end up dividing by zero for infinite projections. */
+    const Matrix4 unprojection = projectionMatrix.inverted();
+    Containers::Array<Containers::Pair<Vector3, Vector3>> rays{NoInit, std::size_t(clusterCount.x() + 1)*(clusterCount.y() + 1)};
+    for(UnsignedInt y = 0; y <= clusterCount.y(); ++y) {
+        for(UnsignedInt x = 0; x <= clusterCount.x(); ++x) {
+            const Vector2 ndc{2.0f*x/clusterCount.x() - 1.0f,
+                              2.0f*y/clusterCount.y() - 1.0f};
+            const Vector3 a = unprojection.transformPoint({ndc, -1.0f});
+            const Vector3 b = unprojection.transformPoint({ndc, 0.0f});
+            rays[y*(clusterCount.x() + 1) + x] = {a, b - a};
+        }
+    }
+
+    /* Offset and count pairs for all clusters first, light indices after */
+    const std::size_t totalClusterCount = std::size_t(clusterCount.x())*clusterCount.y()*clusterCount.z();
+    Containers::Array<UnsignedInt> out{ValueInit, 2*totalClusterCount};
+    const Float depthRatio = far/near;
+    for(UnsignedInt z = 0; z != clusterCount.z(); ++z) {
+        /* The first slice starts at the camera to not lose lights affecting
+           fragments closer than near */
+        const Float depthMin = z ? near*Math::pow(depthRatio, Float(z - 1)/(clusterCount.z() - 1)) : 0.0f;
+        const Float depthMax = clusterCount.z() == 1 ? far : near*Math::pow(depthRatio, Float(z)/(clusterCount.z() - 1));
+
+        for(UnsignedInt y = 0; y != clusterCount.y(); ++y) {
+            for(UnsignedInt x = 0; x != clusterCount.x(); ++x) {
+                /* Bounding box of the four corner rays clipped to the depth
+                   slice */
+                Range3D bounds{Vector3{Constants::inf()}, Vector3{-Constants::inf()}};
+                for(UnsignedInt corner = 0; corner != 4; ++corner) {
+                    const Containers::Pair<Vector3, Vector3>& ray = rays[(y + (corner >> 1))*(clusterCount.x() + 1) + x + (corner & 1)];
+                    for(const Float depth: {depthMin, depthMax}) {
+                        const Vector3 point = ray.first() + ray.second()*((-depth - ray.first().z())/ray.second().z());
+                        bounds.min() = Math::min(bounds.min(), point);
+                        bounds.max() = Math::max(bounds.max(), point);
+                    }
+                }
+
+                const std::size_t cluster = (std::size_t(z)*clusterCount.y() + y)*clusterCount.x() + x;
+                out[2*cluster + 0] = UnsignedInt(out.size());
+                for(std::size_t i = 0; i != lights.size(); ++i) {
+                    const PhongLightUniform& light = lights[i];
+
+                    /* Directional and infinite lights affect all clusters,
+                       otherwise test the range sphere against the bounds */
+                    if(light.position.w() != 0.0f && light.range != Constants::inf()) {
+                        const Vector3 center = light.position.xyz()/light.position.w();
+                        const Vector3 closest = Math::clamp(center, bounds.min(), bounds.max());
+                        if((center - closest).dot() > light.range*light.range)
+                            continue;
+                    }
+
+                    arrayAppend(out, UnsignedInt(i));
+                }
+                out[2*cluster + 1] = UnsignedInt(out.size()) - out[2*cluster + 0];
+            }
+        }
+    }
+
+    /* Convert back to a default deleter to make the returned array usable
+       outside of this library */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+}}
@@ -255,6 +255,33 @@ layout(std140
     BUFFER_READONLY LightUniform lights[LIGHT_COUNT];
 };
 #endif
+
+/* Clustered lighting is available only with SSBOs, so the buffer can be
+   unbounded and the layout can be tightly packed */
+#ifdef CLUSTERED_LIGHTING
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2)
+#endif
+uniform highp uvec3 lightClusterCount
+    #ifndef GL_ES
+    = uvec3(1u)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 3)
+#endif
+uniform highp vec4 lightClusterScale; /* defaults to zero */
+#define lightClusterScale_tile lightClusterScale.xy
+#define lightClusterScale_sliceScale lightClusterScale.z
+#define lightClusterScale_sliceBias lightClusterScale.w
+
+/* First 2*lightClusterCount.x*y*z items are offset and light count pairs for
+   every cluster, the offsets then point to light IDs */
+layout(std430, binding = 7) buffer LightCluster {
+    readonly highp uint lightClusters[];
+};
+#endif
 #endif
 
 /* Textures */
@@ -408,6 +435,17 @@ void main() {
     #ifdef LIGHT_CULLING
     mediump const uint lightCount = draws[drawId].draw_lightOffsetLightCount >> 16 & 0xffffu;
     #endif
+    #ifdef CLUSTERED_LIGHTING
+    /* Tiles are uniform in screen space, slices logarithmic in depth.
+       Fragments outside of the grid get clamped to the nearest cluster. */
+    highp const uvec3 cluster = uvec3(clamp(vec3(
+        gl_FragCoord.xy*lightClusterScale_tile,
+        log(max(-transformedPosition.z, 0.000001))*lightClusterScale_sliceScale + lightClusterScale_sliceBias),
+        vec3(0.0), vec3(lightClusterCount - uvec3(1u))));
+    highp const uint clusterId = (cluster.z*lightClusterCount.y + cluster.y)*lightClusterCount.x + cluster.x;
+    highp const uint clusterLightOffset = lightClusters[2u*clusterId];
+    mediump const uint lightCount = lightClusters[2u*clusterId + 1u];
+    #endif
     #endif
     #endif
 
@@ -470,21 +508,30 @@ void main() {
     highp const vec3 cameraDirection = normalize(-transformedPosition);
 
     /* Add diffuse color for each light */
-    #ifndef LIGHT_CULLING
+    #if !defined(LIGHT_CULLING) && !defined(CLUSTERED_LIGHTING)
     for(int i = 0; i < PER_DRAW_LIGHT_COUNT; ++i)
     #else
     for(uint i = 0u, actualLightCount = min(uint(PER_DRAW_LIGHT_COUNT), lightCount); i < actualLightCount; ++i)
     #endif
     {
+        #ifdef UNIFORM_BUFFERS
+        highp const uint lightId =
+            #ifdef CLUSTERED_LIGHTING
+            lightClusters[clusterLightOffset + i]
+            #else
+            #ifdef LIGHT_CULLING
+            lightOffset +
+            #endif
+            uint(i)
+            #endif
+            ;
+        #endif
+
         lowp const vec3 lightColor =
             #ifndef UNIFORM_BUFFERS
             lightColors[i]
             #else
-            lights[
-                #ifdef LIGHT_CULLING
-                lightOffset +
-                #endif
-                i].light_color
+            lights[lightId].light_color
             #endif
             ;
         #ifndef NO_SPECULAR
@@ -492,11 +539,7 @@ void main() {
             #ifndef UNIFORM_BUFFERS
             lightSpecularColors[i]
             #else
-            lights[
-                #ifdef LIGHT_CULLING
-                lightOffset +
-                #endif
-                i].light_specularColor
+            lights[lightId].light_specularColor
             #endif
             ;
         #endif
@@ -504,11 +547,7 @@ void main() {
             #ifndef UNIFORM_BUFFERS
             lightRanges[i]
             #else
-            lights[
-                #ifdef LIGHT_CULLING
-                lightOffset +
-                #endif
-                i].light_range
+            lights[lightId].light_range
             #endif
             ;
 
@@ -516,11 +555,7 @@ void main() {
             #ifndef UNIFORM_BUFFERS
             lightPositions[i]
             #else
-            lights[
-                #ifdef LIGHT_CULLING
-                lightOffset +
-                #endif
-                i].position
+            lights[lightId].position
             #endif
             ;
         highp const vec4 lightDirection = vec4(lightPosition.xyz - transformedPosition*lightPosition.w, lightPosition.w);
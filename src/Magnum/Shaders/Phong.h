@@ -26,13 +26,14 @@
 */
 
 /** @file
- * @brief Struct @ref Magnum::Shaders::PhongDrawUniform, @ref Magnum::Shaders::PhongMaterialUniform, @ref Magnum::Shaders::PhongLightUniform
+ * @brief Struct @ref Magnum::Shaders::PhongDrawUniform, @ref Magnum::Shaders::PhongMaterialUniform, @ref Magnum::Shaders::PhongLightUniform, function @ref Magnum::Shaders::phongLightClusters()
  */
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Tags.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix.h"
+#include "Magnum/Shaders/visibility.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <Corrade/Utility/Macros.h>
@@ -430,7 +431,9 @@ struct PhongMaterialUniform {
 Describes light properties for each light used by the shader, either all
 @ref PhongGL::lightCount() or the subrange referenced by the
 @ref PhongDrawUniform::lightOffset and @ref PhongDrawUniform::lightCount range
-if @ref PhongGL::Flag::LightCulling is enabled.
+if @ref PhongGL::Flag::LightCulling is enabled, or the lights listed for a
+particular cluster by @ref phongLightClusters() if
+@ref PhongGL::Flag::ClusteredLighting is enabled.
 @see @ref PhongGL::bindLightBuffer()
 */
 struct PhongLightUniform {
@@ -548,6 +551,42 @@ struct PhongLightUniform {
     #endif
 };
 
+/**
+@brief Bin lights into a clustered lighting grid
+@param projectionMatrix     Projection matrix the scene is rendered with
+@param clusterCount         Cluster count in the horizontal, vertical and
+    depth direction
+@param near                 View-space distance where the second depth slice
+    starts
+@param far                  View-space distance where the last depth slice
+    ends
+@param lights               Lights with positions in camera space, in the
+    same order as in the buffer bound with @ref PhongGL::bindLightBuffer()
+@m_since_latest
+
+Divides the view frustum into a grid of @p clusterCount froxels --- the
+horizontal and vertical direction is divided uniformly in screen space, the
+depth range between @p near and @p far logarithmically --- and for each froxel
+lists lights whose range sphere intersects it. Directional lights and lights
+with an infinite @ref PhongLightUniform::range are put into every cluster. The
+first depth slice extends from the camera up to @p near and fragments beyond
+@p far are treated as belonging to the last slice, so the @p far value should
+be at least the farthest visible distance.
+
+The returned array is meant to be uploaded to a buffer bound with
+@ref PhongGL::bindLightClusterBuffer() and the same @p clusterCount, @p near
+and @p far values passed to @ref PhongGL::setLightClusterGrid(). The first
+@cpp 2*clusterCount.product() @ce items are pairs of an offset and a count for
+each cluster, with clusters ordered first horizontally, then vertically and
+then in depth. The offset points to a list of light indices that's stored
+after the pairs.
+
+Expects that all @p clusterCount components are non-zero and that @p near
+is positive and less than @p far.
+@see @ref PhongGL::Flag::ClusteredLighting
+*/
+MAGNUM_SHADERS_EXPORT Containers::Array<UnsignedInt> phongLightClusters(const Matrix4& projectionMatrix, const Vector3ui& clusterCount, Float near, Float far, Containers::ArrayView<const PhongLightUniform> lights);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /** @brief @copybrief PhongGL
  * @m_deprecated_since_latest Use @ref PhongGL instead.
@@ -41,6 +41,7 @@
 #include "Magnum/GL/Shader.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 
@@ -81,6 +82,7 @@ namespace {
         MaterialBufferBinding = 4,
         LightBufferBinding = 5,
         JointBufferBinding = 6,
+        LightClusterBufferBinding = 7
     };
     #endif
 }
@@ -128,6 +130,12 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
         "Shaders::PhongGL: texture arrays require texture transformation enabled as well if uniform buffers are used", CompileState{NoCreate});
     CORRADE_ASSERT(!(configuration.flags() & Flag::LightCulling) || (configuration.flags() & Flag::UniformBuffers),
         "Shaders::PhongGL: light culling requires uniform buffers to be enabled", CompileState{NoCreate});
+    #ifndef MAGNUM_TARGET_WEBGL
+    CORRADE_ASSERT(!(configuration.flags() & Flag::ClusteredLighting) || configuration.flags() >= Flag::ShaderStorageBuffers,
+        "Shaders::PhongGL: clustered lighting requires shader storage buffers to be enabled", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::ClusteredLighting) || !(configuration.flags() & Flag::LightCulling),
+        "Shaders::PhongGL: clustered lighting and light culling are mutually exclusive", CompileState{NoCreate});
+    #endif
     #endif
 
     CORRADE_ASSERT(!(configuration.flags() & Flag::SpecularTexture) || !(configuration.flags() & (Flag::NoSpecular)),
@@ -377,7 +385,11 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
                 configuration.lightCount(),
                 configuration.perDrawLightCount()));
         frag.addSource(configuration.flags() >= Flag::MultiDraw ? "#define MULTI_DRAW\n"_s : ""_s)
-            .addSource(configuration.flags() >= Flag::LightCulling ? "#define LIGHT_CULLING\n"_s : ""_s);
+            .addSource(configuration.flags() >= Flag::LightCulling ? "#define LIGHT_CULLING\n"_s : ""_s)
+            #ifndef MAGNUM_TARGET_WEBGL
+            .addSource(configuration.flags() >= Flag::ClusteredLighting ? "#define CLUSTERED_LIGHTING\n"_s : ""_s)
+            #endif
+            ;
     } else
     #endif
     {
@@ -525,6 +537,12 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
                 || flags() >= Flag::ShaderStorageBuffers
                 #endif
             ) _drawOffsetUniform = uniformLocation("drawOffset"_s);
+            #ifndef MAGNUM_TARGET_WEBGL
+            if(_flags >= Flag::ClusteredLighting) {
+                _lightClusterCountUniform = uniformLocation("lightClusterCount"_s);
+                _lightClusterScaleUniform = uniformLocation("lightClusterScale"_s);
+            }
+            #endif
         } else
         #endif
         {
@@ -608,6 +626,11 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
     #ifndef MAGNUM_TARGET_GLES2
     if(_flags >= Flag::UniformBuffers) {
         /* Draw offset is zero by default */
+        #ifndef MAGNUM_TARGET_WEBGL
+        /* A single cluster, light cluster scale is zero by default */
+        if(_flags >= Flag::ClusteredLighting)
+            setUniform(_lightClusterCountUniform, Vector3ui{1});
+        #endif
     } else
     #endif
     {
@@ -1172,6 +1195,41 @@ PhongGL& PhongGL::bindJointBuffer(GL::Buffer& buffer, const GLintptr offset, con
         GL::Buffer::Target::Uniform, JointBufferBinding, offset, size);
     return *this;
 }
+
+#ifndef MAGNUM_TARGET_WEBGL
+PhongGL& PhongGL::setLightClusterGrid(const Vector3ui& clusterCount, const Vector2i& viewportSize, const Float near, const Float far) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLighting,
+        "Shaders::PhongGL::setLightClusterGrid(): the shader was not created with clustered lighting enabled", *this);
+    CORRADE_ASSERT(clusterCount.x() && clusterCount.y() && clusterCount.z() && viewportSize.x() > 0 && viewportSize.y() > 0,
+        "Shaders::PhongGL::setLightClusterGrid(): expected non-zero cluster count and viewport size, got" << Debug::packed << clusterCount << "and" << Debug::packed << viewportSize, *this);
+    CORRADE_ASSERT(near > 0.0f && near < far,
+        "Shaders::PhongGL::setLightClusterGrid(): expected near to be positive and less than far, got" << near << "and" << far, *this);
+
+    /* The first slice spans from the camera to near, the remaining slices are
+       logarithmic between near and far, matching phongLightClusters() */
+    const Float sliceScale = (clusterCount.z() - 1)/Math::log(far/near);
+    setUniform(_lightClusterCountUniform, clusterCount);
+    setUniform(_lightClusterScaleUniform, Vector4{
+        Vector2{clusterCount.xy()}/Vector2{viewportSize},
+        sliceScale,
+        1.0f - Math::log(near)*sliceScale});
+    return *this;
+}
+
+PhongGL& PhongGL::bindLightClusterBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLighting,
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lighting enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterBufferBinding);
+    return *this;
+}
+
+PhongGL& PhongGL::bindLightClusterBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLighting,
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lighting enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterBufferBinding, offset, size);
+    return *this;
+}
+#endif
 #endif
 
 PhongGL& PhongGL::bindAmbientTexture(GL::Texture2D& texture) {
@@ -1361,6 +1419,9 @@ Debug& operator<<(Debug& debug, const PhongGL::Flag value) {
         _c(MultiDraw)
         _c(TextureArrays)
         _c(LightCulling)
+        #ifndef MAGNUM_TARGET_WEBGL
+        _c(ClusteredLighting)
+        #endif
         #endif
         _c(NoSpecular)
         #ifndef MAGNUM_TARGET_GLES2
@@ -1408,6 +1469,9 @@ Debug& operator<<(Debug& debug, const PhongGL::Flags value) {
         PhongGL::Flag::UniformBuffers,
         PhongGL::Flag::TextureArrays,
         PhongGL::Flag::LightCulling,
+        #ifndef MAGNUM_TARGET_WEBGL
+        PhongGL::Flag::ClusteredLighting,
+        #endif
         #endif
         PhongGL::Flag::NoSpecular,
         #ifndef MAGNUM_TARGET_GLES2
@@ -331,6 +331,27 @@ Altogether for a particular draw, each per-vertex joint ID is offset with
 multidraw scenario as well, as it is tied to a particular mesh layout and thus
 doesn't need to vary per draw.
 
+@subsection Shaders-PhongGL-clustered Clustered lighting
+
+With a large amount of local lights, going through all of them for every
+fragment quickly becomes the bottleneck. With @ref Flag::ClusteredLighting,
+which is available in combination with @ref Flag::ShaderStorageBuffers, the
+view frustum is divided into a grid of clusters --- tiles in screen space and
+logarithmic slices in depth --- and each fragment processes only lights
+assigned to the cluster it's in. The assignment is calculated on the CPU with
+@ref phongLightClusters() from the same @ref PhongLightUniform data that's
+bound with @ref bindLightBuffer(), and supplied to the shader with
+@ref bindLightClusterBuffer() together with the grid layout passed to
+@ref setLightClusterGrid(). Lights are expected to be in camera space, so the
+clusters need to be recalculated every time the camera or the lights move.
+
+@snippet Shaders-gl.cpp PhongGL-clustered
+
+The per-draw light count passed to @ref Configuration::setLightCount() then
+limits how many lights at most are processed for a single fragment, while the
+total light count is unbounded. Directional lights and lights with an infinite
+range are present in every cluster, so they should be kept at a minimum.
+
 @requires_gl30 Extension @gl_extension{EXT,texture_array} for texture arrays.
 @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object} for uniform
     buffers.
@@ -896,6 +917,32 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
              * @m_since_latest
              */
             LightCulling = 1 << 15,
+
+            #ifndef MAGNUM_TARGET_WEBGL
+            /**
+             * Enable clustered forward lighting. Instead of going through all
+             * @ref perDrawLightCount() lights for every fragment, the view
+             * frustum is divided into a grid of clusters and each fragment
+             * goes only through lights listed for the cluster it's in, which
+             * makes it possible to have hundreds of local lights in a scene
+             * without a proportional increase in shader cost. The cluster
+             * contents are supplied via @ref bindLightClusterBuffer(), usually
+             * calculated by @ref phongLightClusters(), the grid layout via
+             * @ref setLightClusterGrid(). The @ref perDrawLightCount() is then
+             * an upper bound on lights processed for a single fragment.
+             *
+             * Expects that @ref Flag::ShaderStorageBuffers is enabled as well
+             * and that @ref Flag::LightCulling isn't. See
+             * @ref Shaders-PhongGL-clustered for more information.
+             * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+             * @requires_gles31 Shader storage buffers are not available in
+             *      OpenGL ES 3.0 and older.
+             * @requires_gles Shader storage buffers are not available in
+             *      WebGL.
+             * @m_since_latest
+             */
+            ClusteredLighting = 1 << 21,
+            #endif
             #endif
 
             /**
@@ -1900,6 +1947,54 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
          */
         PhongGL& bindJointBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
 
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Set light cluster grid layout
+         * @param clusterCount  Cluster count in the horizontal, vertical and
+         *      depth direction
+         * @param viewportSize  Size of the viewport the shader renders to
+         * @param near          View-space distance where the second depth
+         *      slice starts
+         * @param far           View-space distance where the last depth
+         *      slice ends
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::ClusteredLighting is set, that all
+         * @p clusterCount and @p viewportSize components are non-zero and
+         * that @p near is positive and less than @p far. The values should
+         * match what was passed to @ref phongLightClusters() for the data in
+         * a buffer bound with @ref bindLightClusterBuffer(). Initial value is
+         * a single cluster spanning the whole view frustum.
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gles31 Shader storage buffers are not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Shader storage buffers are not available in WebGL.
+         */
+        PhongGL& setLightClusterGrid(const Vector3ui& clusterCount, const Vector2i& viewportSize, Float near, Float far);
+
+        /**
+         * @brief Bind a light cluster shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::ClusteredLighting is set. The buffer is
+         * expected to contain data in the layout produced by
+         * @ref phongLightClusters(), with light indices referring to the
+         * buffer bound with @ref bindLightBuffer().
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gles31 Shader storage buffers are not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Shader storage buffers are not available in WebGL.
+         */
+        PhongGL& bindLightClusterBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        PhongGL& bindLightClusterBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
         /**
          * @}
          */
@@ -2160,6 +2255,11 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
             _drawOffsetUniform{0},
             /* 13 + 4*lightCount + jointCount, or 1 with UBOs */
             _perVertexJointCountUniform;
+        #ifndef MAGNUM_TARGET_WEBGL
+        /* Used only with Flag::ClusteredLighting, which implies UBOs */
+        Int _lightClusterCountUniform{2},
+            _lightClusterScaleUniform{3};
+        #endif
         #endif
 };
 
@@ -136,6 +136,10 @@ struct PhongGLTest: GL::OpenGLTester {
     #ifndef MAGNUM_TARGET_GLES2
     void setWrongDrawOffset();
     #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void clusteredLightingNotEnabled();
+    void setLightClusterGridInvalid();
+    #endif
 
     void renderSetup();
     void renderTeardown();
@@ -169,6 +173,9 @@ struct PhongGLTest: GL::OpenGLTester {
     #ifndef MAGNUM_TARGET_GLES2
     void renderLightCulling();
     #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void renderClusteredLighting();
+    #endif
 
     template<PhongGL::Flag flag = PhongGL::Flag{}> void renderZeroLights();
 
@@ -373,6 +380,10 @@ constexpr struct {
         0, 4, 0, 0, 0, 4, 0},
     {"shader storage + multidraw with all the things except instancing", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::AmbientTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::AlphaMask|PhongGL::Flag::ObjectId|PhongGL::Flag::LightCulling|PhongGL::Flag::DynamicPerVertexJointCount,
         0, 4, 0, 0, 0, 3, 4},
+    {"shader storage + clustered lighting", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting,
+        0, 4, 0, 0, 0, 0, 0},
+    {"shader storage + multidraw + clustered lighting, textured", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::ClusteredLighting|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::NormalTexture,
+        0, 16, 0, 0, 0, 0, 0},
     #endif
 };
 #endif
@@ -451,6 +462,16 @@ constexpr struct {
         PhongGL::Flag::LightCulling,
         1, 1, 0, 0, 0, 1, 1,
         "light culling requires uniform buffers to be enabled"},
+    #ifndef MAGNUM_TARGET_WEBGL
+    {"clustered lighting but no SSBOs",
+        PhongGL::Flag::UniformBuffers|PhongGL::Flag::ClusteredLighting,
+        1, 1, 0, 0, 0, 1, 1,
+        "clustered lighting requires shader storage buffers to be enabled"},
+    {"clustered lighting together with light culling",
+        PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting|PhongGL::Flag::LightCulling,
+        1, 1, 0, 0, 0, 1, 1,
+        "clustered lighting and light culling are mutually exclusive"},
+    #endif
     /* These two fail for UBOs but not SSBOs */
     {"per-vertex joint count but no joint count",
         PhongGL::Flag::UniformBuffers,
@@ -847,6 +868,18 @@ const struct {
 };
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+const struct {
+    const char* name;
+    Vector3ui clusterCount;
+} RenderClusteredLightingData[]{
+    {"single cluster", {1, 1, 1}},
+    {"single depth slice", {8, 8, 1}},
+    {"8x8x16 clusters", {8, 8, 16}},
+    {"non-uniform grid", {3, 7, 5}},
+};
+#endif
+
 const struct {
     const char* name;
     PhongGL::Flags flags;
@@ -1297,7 +1330,11 @@ PhongGLTest::PhongGLTest() {
         &PhongGLTest::setWrongJointCountOrId,
         #endif
         #ifndef MAGNUM_TARGET_GLES2
-        &PhongGLTest::setWrongDrawOffset
+        &PhongGLTest::setWrongDrawOffset,
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        &PhongGLTest::clusteredLightingNotEnabled,
+        &PhongGLTest::setLightClusterGridInvalid,
         #endif
     });
 
@@ -1458,6 +1495,13 @@ PhongGLTest::PhongGLTest() {
         &PhongGLTest::renderTeardown);
     #endif
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    addInstancedTests({&PhongGLTest::renderClusteredLighting},
+        Containers::arraySize(RenderClusteredLightingData),
+        &PhongGLTest::renderSetup,
+        &PhongGLTest::renderTeardown);
+    #endif
+
     /* MSVC needs explicit type due to default template args */
     addTests<PhongGLTest>({
         &PhongGLTest::renderZeroLights,
@@ -2236,6 +2280,58 @@ void PhongGLTest::setWrongDrawOffset() {
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void PhongGLTest::clusteredLightingNotEnabled() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    #endif
+
+    GL::Buffer buffer;
+    PhongGL shader{PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::UniformBuffers)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.setLightClusterGrid({1, 1, 1}, {80, 80}, 0.1f, 10.0f)
+        .bindLightClusterBuffer(buffer)
+        .bindLightClusterBuffer(buffer, 0, 16);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::PhongGL::setLightClusterGrid(): the shader was not created with clustered lighting enabled\n"
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lighting enabled\n"
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lighting enabled\n");
+}
+
+void PhongGLTest::setLightClusterGridInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_storage_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::shader_storage_buffer_object::string() << "is not supported.");
+    #else
+    if(!GL::Context::current().isVersionSupported(GL::Version::GLES310))
+        CORRADE_SKIP(GL::Version::GLES310 << "is not supported.");
+    #endif
+
+    PhongGL shader{PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.setLightClusterGrid({8, 0, 4}, {80, 80}, 0.1f, 10.0f)
+        .setLightClusterGrid({8, 8, 4}, {80, 0}, 0.1f, 10.0f)
+        .setLightClusterGrid({8, 8, 4}, {80, 80}, 0.0f, 10.0f)
+        .setLightClusterGrid({8, 8, 4}, {80, 80}, 10.0f, 10.0f);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::PhongGL::setLightClusterGrid(): expected non-zero cluster count and viewport size, got {8, 0, 4} and {80, 80}\n"
+        "Shaders::PhongGL::setLightClusterGrid(): expected non-zero cluster count and viewport size, got {8, 8, 4} and {80, 0}\n"
+        "Shaders::PhongGL::setLightClusterGrid(): expected near to be positive and less than far, got 0 and 10\n"
+        "Shaders::PhongGL::setLightClusterGrid(): expected near to be positive and less than far, got 10 and 10\n");
+}
+#endif
+
 constexpr Vector2i RenderSize{80, 80};
 
 void PhongGLTest::renderSetup() {
@@ -4259,6 +4355,99 @@ void PhongGLTest::renderLightCulling() {
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void PhongGLTest::renderClusteredLighting() {
+    auto&& data = RenderClusteredLightingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_storage_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::shader_storage_buffer_object::string() << "is not supported.");
+    #else
+    if(!GL::Context::current().isVersionSupported(GL::Version::GLES310))
+        CORRADE_SKIP(GL::Version::GLES310 << "is not supported.");
+    #endif
+
+    /* Some drivers (ARM Mali-G71) don't support SSBOs in vertex shaders */
+    if(GL::Shader::maxShaderStorageBlocks(GL::Shader::Type::Vertex) < 3)
+        CORRADE_SKIP("Only" << GL::Shader::maxShaderStorageBlocks(GL::Shader::Type::Vertex) << "shader storage blocks supported in vertex shaders.");
+    if(GL::Shader::maxShaderStorageBlocks(GL::Shader::Type::Fragment) < 4)
+        CORRADE_SKIP("Only" << GL::Shader::maxShaderStorageBlocks(GL::Shader::Type::Fragment) << "shader storage blocks supported in fragment shaders.");
+
+    GL::Mesh sphere = MeshTools::compile(Primitives::uvSphereSolid(16, 32));
+
+    const Matrix4 projectionMatrix = Matrix4::perspectiveProjection(60.0_degf, 1.0f, 0.1f, 10.0f);
+    GL::Buffer projectionUniform{GL::Buffer::TargetHint::ShaderStorage, {
+        ProjectionUniform3D{}
+            .setProjectionMatrix(projectionMatrix)
+    }};
+    GL::Buffer transformationUniform{GL::Buffer::TargetHint::ShaderStorage, {
+        TransformationUniform3D{}
+            .setTransformationMatrix(Matrix4::translation(Vector3::zAxis(-2.15f)))
+    }};
+    GL::Buffer drawUniform{GL::Buffer::TargetHint::ShaderStorage, {
+        PhongDrawUniform{}
+    }};
+    GL::Buffer materialUniform{GL::Buffer::TargetHint::ShaderStorage, {
+        PhongMaterialUniform{}
+            .setAmbientColor(0x330033_rgbf)
+            .setDiffuseColor(0xccffcc_rgbf)
+            .setSpecularColor(0x6666ff_rgbf)
+    }};
+
+    /* The same two directional lights as in renderLightCulling(), together
+       with bright point lights behind the camera and beyond the far plane
+       that shouldn't get to any cluster. As the per-draw light count is 2,
+       any of them being listed in the clusters before the directional lights
+       would cause the output to differ. */
+    PhongLightUniform lights[64];
+    for(std::size_t i = 0; i != Containers::arraySize(lights); ++i) {
+        const Deg angle = Float(i)/Containers::arraySize(lights)*360.0_degf;
+        lights[i] = PhongLightUniform{}
+            .setPosition({3.0f*Math::sin(angle), 3.0f*Math::cos(angle), i % 2 ? 5.0f : -15.0f, 1.0f})
+            .setColor(0xffffff_rgbf*10.0f)
+            .setRange(0.5f);
+    }
+    lights[57] = PhongLightUniform{}
+        .setPosition({-3.0f, -3.0f, 2.0f, 0.0f})
+        .setColor(0x993366_rgbf);
+    lights[58] = PhongLightUniform{}
+        .setPosition({3.0f, -3.0f, 2.0f, 0.0f})
+        .setColor(0x669933_rgbf);
+    GL::Buffer lightUniform{GL::Buffer::TargetHint::ShaderStorage, lights};
+
+    Containers::Array<UnsignedInt> clusters = phongLightClusters(projectionMatrix, data.clusterCount, 0.1f, 10.0f, lights);
+    GL::Buffer clusterStorage{GL::Buffer::TargetHint::ShaderStorage, clusters};
+
+    PhongGL shader{PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting)
+        .setLightCount(0, 2)};
+    shader
+        .setLightClusterGrid(data.clusterCount, RenderSize, 0.1f, 10.0f)
+        .bindProjectionBuffer(projectionUniform)
+        .bindTransformationBuffer(transformationUniform)
+        .bindDrawBuffer(drawUniform)
+        .bindMaterialBuffer(materialUniform)
+        .bindLightBuffer(lightUniform)
+        .bindLightClusterBuffer(clusterStorage)
+        .draw(sphere);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    /* Same thresholds as in renderLightCulling() */
+    const Float maxThreshold = 8.34f, meanThreshold = 0.100f;
+    CORRADE_COMPARE_WITH(
+        /* Dropping the alpha channel, as it's always 1.0 */
+        Containers::arrayCast<Color3ub>(_framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm}).pixels<Color4ub>()),
+        Utility::Path::join(_testDir, "PhongTestFiles/colored.tga"),
+        (DebugTools::CompareImageToFile{_manager, maxThreshold, meanThreshold}));
+}
+#endif
+
 template<PhongGL::Flag flag> void PhongGLTest::renderZeroLights() {
     if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
        !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
@@ -24,7 +24,10 @@
 */
 
 #include <new>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/Phong.h"
@@ -48,6 +51,10 @@ struct PhongTest: TestSuite::Tester {
     void lightUniformConstructDefault();
     void lightUniformConstructNoInit();
     void lightUniformSetters();
+
+    void lightClusters();
+    void lightClustersDepthSlices();
+    void lightClustersInvalid();
 };
 
 PhongTest::PhongTest() {
@@ -66,7 +73,11 @@ PhongTest::PhongTest() {
 
               &PhongTest::lightUniformConstructDefault,
               &PhongTest::lightUniformConstructNoInit,
-              &PhongTest::lightUniformSetters});
+              &PhongTest::lightUniformSetters,
+
+              &PhongTest::lightClusters,
+              &PhongTest::lightClustersDepthSlices,
+              &PhongTest::lightClustersInvalid});
 }
 
 using namespace Math::Literals;
@@ -371,6 +382,98 @@ void PhongTest::lightUniformSetters() {
     CORRADE_COMPARE(a.range, 7.0f);
 }
 
+void PhongTest::lightClusters() {
+    /* Orthographic projection to have the tile edges easy to calculate. With
+       a single depth slice, the slice spans the whole depth range. */
+    const PhongLightUniform lights[]{
+        /* Directional, in all clusters */
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, 1.0f, 0.0f}),
+        /* Only in the bottom left / top right cluster */
+        PhongLightUniform{}
+            .setPosition({-1.0f, -1.0f, -5.0f, 1.0f})
+            .setRange(0.5f),
+        PhongLightUniform{}
+            .setPosition({1.0f, 1.0f, -5.0f, 1.0f})
+            .setRange(0.5f),
+        /* On the edge between bottom left and bottom right */
+        PhongLightUniform{}
+            .setPosition({0.0f, -1.0f, -5.0f, 1.0f})
+            .setRange(0.5f),
+        /* Outside of the view */
+        PhongLightUniform{}
+            .setPosition({5.0f, 5.0f, -5.0f, 1.0f})
+            .setRange(1.0f),
+        /* Outside of the view, but with infinite range, so in all clusters */
+        PhongLightUniform{}
+            .setPosition({5.0f, 5.0f, -5.0f, 1.0f}),
+    };
+
+    Containers::Array<UnsignedInt> clusters = phongLightClusters(Matrix4::orthographicProjection({4.0f, 4.0f}, 0.0f, 10.0f), {2, 2, 1}, 1.0f, 10.0f, lights);
+    CORRADE_COMPARE_AS(clusters, Containers::arrayView<UnsignedInt>({
+        8, 4,
+        12, 3,
+        15, 2,
+        17, 3,
+        0, 1, 3, 5,
+        0, 3, 5,
+        0, 5,
+        0, 2, 5
+    }), TestSuite::Compare::Container);
+}
+
+void PhongTest::lightClustersDepthSlices() {
+    /* Three slices, the first going from the camera to 1, the second from 1
+       to 10 and the last from 10 to 100 */
+    const PhongLightUniform lights[]{
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, -50.0f, 1.0f})
+            .setRange(0.1f),
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, -5.0f, 1.0f})
+            .setRange(0.1f),
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, -0.5f, 1.0f})
+            .setRange(0.1f),
+        /* Beyond far */
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, -200.0f, 1.0f})
+            .setRange(1.0f),
+        /* Behind the camera */
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, 2.0f, 1.0f})
+            .setRange(1.0f),
+        /* Spanning the first two slices */
+        PhongLightUniform{}
+            .setPosition({0.0f, 0.0f, -1.0f, 1.0f})
+            .setRange(0.5f),
+    };
+
+    Containers::Array<UnsignedInt> clusters = phongLightClusters(Matrix4::perspectiveProjection(90.0_degf, 1.0f, 0.01f, 1000.0f), {1, 1, 3}, 1.0f, 100.0f, lights);
+    CORRADE_COMPARE_AS(clusters, Containers::arrayView<UnsignedInt>({
+        6, 2,
+        8, 2,
+        10, 1,
+        2, 5,
+        1, 5,
+        0
+    }), TestSuite::Compare::Container);
+}
+
+void PhongTest::lightClustersInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    phongLightClusters({}, {4, 4, 0}, 1.0f, 10.0f, nullptr);
+    phongLightClusters({}, {4, 4, 4}, 0.0f, 10.0f, nullptr);
+    phongLightClusters({}, {4, 4, 4}, 10.0f, 1.0f, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::phongLightClusters(): expected a non-zero cluster count, got {4, 4, 0}\n"
+        "Shaders::phongLightClusters(): expected near to be positive and less than far, got 0 and 10\n"
+        "Shaders::phongLightClusters(): expected near to be positive and less than far, got 10 and 1\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::PhongTest)
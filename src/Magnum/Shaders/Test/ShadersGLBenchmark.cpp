@@ -40,7 +40,9 @@
 #include "Magnum/GL/RenderbufferFormat.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/Version.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/Compile.h"
 #include "Magnum/MeshTools/Duplicate.h"
@@ -213,6 +215,14 @@ const struct {
     #endif
     {"multidraw, one light, light culling enabled", PhongGL::Flag::MultiDraw|PhongGL::Flag::LightCulling, 1, 32, 128, false},
     {"multidraw, 64 lights, light culling enabled, five used", PhongGL::Flag::MultiDraw|PhongGL::Flag::LightCulling, 64, 32, 128, false},
+    #ifndef MAGNUM_TARGET_WEBGL
+    {"SSBO single, one point light", PhongGL::Flag::ShaderStorageBuffers, 1, 1, 1, false},
+    {"SSBO single, 64 point lights", PhongGL::Flag::ShaderStorageBuffers, 64, 1, 1, false},
+    {"SSBO single, 1024 point lights", PhongGL::Flag::ShaderStorageBuffers, 1024, 1, 1, false},
+    {"SSBO single, one point light, clustered", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting, 1, 1, 1, false},
+    {"SSBO single, 64 point lights, clustered", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting, 64, 1, 1, false},
+    {"SSBO single, 1024 point lights, clustered", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLighting, 1024, 1, 1, false},
+    #endif
     #endif
 };
 
@@ -692,6 +702,18 @@ void ShadersGLBenchmark::phong() {
         CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
     #endif
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(data.flags >= PhongGL::Flag::ShaderStorageBuffers) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_storage_buffer_object>())
+            CORRADE_SKIP(GL::Extensions::ARB::shader_storage_buffer_object::string() << "is not supported.");
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES310))
+            CORRADE_SKIP(GL::Version::GLES310 << "is not supported.");
+        #endif
+    }
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES2
     if(data.flags >= PhongGL::Flag::MultiDraw) {
         #ifndef MAGNUM_TARGET_GLES
@@ -723,6 +745,9 @@ void ShadersGLBenchmark::phong() {
     GL::Buffer materialUniform{NoCreate};
     GL::Buffer lightUniform{NoCreate};
     GL::Buffer textureTransformationUniform{NoCreate};
+    #ifndef MAGNUM_TARGET_WEBGL
+    GL::Buffer lightClusterStorage{NoCreate};
+    #endif
     if(data.flags & PhongGL::Flag::UniformBuffers) {
         projectionUniform = GL::Buffer{};
         transformationUniform = GL::Buffer{};
@@ -740,6 +765,20 @@ void ShadersGLBenchmark::phong() {
             .setAmbientColor(0xffffffff_rgbaf)
             .setAlphaMask(0.0f);
         Containers::Array<PhongLightUniform> lightData{data.lightCount};
+        #ifndef MAGNUM_TARGET_WEBGL
+        /* For SSBOs, spread small point lights evenly over the whole grid in
+           order to compare the cost of evaluating all of them with evaluating
+           just the ones listed in a particular cluster */
+        if(data.flags >= PhongGL::Flag::ShaderStorageBuffers) {
+            const UnsignedInt side = UnsignedInt(Math::ceil(Math::sqrt(Float(data.lightCount))));
+            for(UnsignedInt i = 0; i != data.lightCount; ++i) {
+                const Vector2 position = (Vector2{Float(i % side), Float(i / side)} + Vector2{0.5f})*2.0f/Float(side) - Vector2{1.0f};
+                lightData[i]
+                    .setPosition({position.x(), position.y(), 0.0f, 1.0f})
+                    .setRange(2.0f/Float(side));
+            }
+        }
+        #endif
         Containers::Array<TextureTransformationUniform> textureTransformationData{data.drawCount};
 
         #ifndef MAGNUM_TARGET_GLES
@@ -776,6 +815,19 @@ void ShadersGLBenchmark::phong() {
         if(data.flags & PhongGL::Flag::TextureTransformation)
             shader.bindTextureTransformationBuffer(textureTransformationUniform);
 
+        #ifndef MAGNUM_TARGET_WEBGL
+        /* Binning is done upfront as the benchmark is only about the shader
+           cost. The projection is identity, so the near and far values don't
+           really matter with a single depth slice. */
+        if(data.flags & PhongGL::Flag::ClusteredLighting) {
+            const Vector3ui clusterCount{16, 16, 1};
+            lightClusterStorage = GL::Buffer{};
+            lightClusterStorage.setData(phongLightClusters({}, clusterCount, 0.5f, 1.0f, lightData));
+            shader.setLightClusterGrid(clusterCount, RenderSize, 0.5f, 1.0f)
+                .bindLightClusterBuffer(lightClusterStorage);
+        }
+        #endif
+
     } else
     #endif
     {
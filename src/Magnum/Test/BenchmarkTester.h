@@ -0,0 +1,155 @@
+#ifndef Magnum_Test_BenchmarkTester_h
+#define Magnum_Test_BenchmarkTester_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Implementation/peakMemory.h"
+
+namespace Magnum { namespace Test {
+
+/* Common base for benchmarks processing large synthetic inputs. Provides two
+   custom benchmark types in addition to the builtin ones:
+
+    -   throughputBenchmarkBegin() / throughputBenchmarkEnd() measure wall time
+        and report it as processed elements per second
+    -   memoryBenchmarkBegin() / memoryBenchmarkEnd() report the peak resident
+        memory growth during the benchmark, in bytes. Implemented only on
+        Linux, where the peak can be reset through /proc/self/clear_refs.
+
+   Each benchmark case calls setBenchmarkCase() at the start and then
+   addProcessedElements() once in every CORRADE_BENCHMARK() iteration. With
+   --results-file <path> passed on the command line, every measured sample
+   is additionally appended to given file as a JSON object on a single line,
+   for tracking regressions between releases. */
+class BenchmarkTester: public TestSuite::Tester {
+    public:
+        explicit BenchmarkTester(const char* suiteName): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"results"})}, _suiteName{suiteName} {
+            Utility::Arguments args{"results"};
+            args.addOption("file").setHelp("file", "append benchmark results to given file as JSON lines", "PATH")
+                .parse(arguments().first, arguments().second);
+            _resultsFile = Containers::String{args.value<Containers::StringView>("file")};
+        }
+
+        #ifdef __linux__
+        static constexpr bool MemoryBenchmarkSupported = true;
+        #else
+        static constexpr bool MemoryBenchmarkSupported = false;
+        #endif
+
+    protected:
+        void setBenchmarkCase(const char* name, const char* description) {
+            _caseName = name;
+            _caseDescription = description;
+            setTestCaseDescription(description);
+        }
+
+        void addProcessedElements(std::size_t count) {
+            _elementCount += count;
+            ++_iterationCount;
+        }
+
+        void throughputBenchmarkBegin() {
+            setBenchmarkName("elements/s");
+            _elementCount = 0;
+            _iterationCount = 0;
+            _begin = std::chrono::steady_clock::now();
+        }
+
+        std::uint64_t throughputBenchmarkEnd() {
+            const std::uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _begin).count();
+            /* If the test failed, exit early as continuing would cause a
+               division by zero */
+            if(!_iterationCount) return {};
+
+            /* The tester divides the value by the batch size, multiply it
+               back so it reports the throughput over the whole batch */
+            const std::uint64_t elementsPerSecond = Double(_elementCount)*1.0e9/Double(duration ? duration : 1);
+            saveResult("throughput", "elements/s", elementsPerSecond);
+            return elementsPerSecond*_iterationCount;
+        }
+
+        void memoryBenchmarkBegin() {
+            setBenchmarkName("peak memory");
+            _elementCount = 0;
+            _iterationCount = 0;
+            #ifdef __linux__
+            Implementation::resetPeakMemory();
+            _memoryBaseline = Implementation::memoryStatus("VmRSS:");
+            #endif
+        }
+
+        std::uint64_t memoryBenchmarkEnd() {
+            #ifdef __linux__
+            const std::uint64_t peak = Implementation::memoryStatus("VmHWM:");
+            const std::uint64_t growth = peak > _memoryBaseline ? peak - _memoryBaseline : 0;
+            #else
+            const std::uint64_t growth = 0;
+            #endif
+            if(!_iterationCount) return {};
+
+            saveResult("memory", "bytes", growth);
+            return growth*_iterationCount;
+        }
+
+    private:
+        void saveResult(const char* metric, const char* unit, std::uint64_t value) {
+            if(_resultsFile.isEmpty()) return;
+
+            std::FILE* f = std::fopen(_resultsFile.data(), "a");
+            if(!f) {
+                Utility::Error{} << "Cannot open" << _resultsFile << "for appending";
+                return;
+            }
+
+            /* The names are all fixed ASCII strings without quotes, no need
+               to escape anything */
+            const Containers::String line = Utility::format(
+                "{{\"suite\": \"{}\", \"case\": \"{}\", \"data\": \"{}\", \"metric\": \"{}\", \"unit\": \"{}\", \"value\": {}}}\n",
+                _suiteName, _caseName, _caseDescription, metric, unit, value);
+            std::fputs(line.data(), f);
+            std::fclose(f);
+        }
+
+        const char* _suiteName;
+        Containers::String _resultsFile;
+        const char* _caseName{};
+        const char* _caseDescription{};
+        std::uint64_t _elementCount{}, _memoryBaseline{};
+        UnsignedInt _iterationCount{};
+        std::chrono::steady_clock::time_point _begin;
+};
+
+}}
+
+#endif
@@ -0,0 +1,475 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ThreadPoolTest: TestSuite::Tester {
+    explicit ThreadPoolTest();
+
+    void taskGraph();
+    void taskGraphInvalid();
+    void taskGraphClear();
+
+    void hardwareThreadCount();
+    void construct();
+    void constructMove();
+    void global();
+
+    void parallelFor();
+    void parallelForSingleThreadedOrder();
+    void parallelForSingleChunk();
+    void parallelForEmpty();
+    void parallelForNested();
+    void parallelForDispatchCallback();
+    void parallelForInvalid();
+
+    void run();
+    void runSingleThreadedOrder();
+    void runDispatchCallback();
+    void runEmpty();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt workerCount;
+} WorkerCountData[]{
+    {"no workers", 0},
+    {"one worker", 1},
+    {"three workers", 3},
+};
+
+ThreadPoolTest::ThreadPoolTest() {
+    addTests({&ThreadPoolTest::taskGraph,
+              &ThreadPoolTest::taskGraphInvalid,
+              &ThreadPoolTest::taskGraphClear,
+
+              &ThreadPoolTest::hardwareThreadCount,
+              &ThreadPoolTest::construct,
+              &ThreadPoolTest::constructMove,
+              &ThreadPoolTest::global});
+
+    addInstancedTests({&ThreadPoolTest::parallelFor},
+        Containers::arraySize(WorkerCountData));
+
+    addTests({&ThreadPoolTest::parallelForSingleThreadedOrder,
+              &ThreadPoolTest::parallelForSingleChunk,
+              &ThreadPoolTest::parallelForEmpty});
+
+    addInstancedTests({&ThreadPoolTest::parallelForNested},
+        Containers::arraySize(WorkerCountData));
+
+    addTests({&ThreadPoolTest::parallelForDispatchCallback,
+              &ThreadPoolTest::parallelForInvalid});
+
+    addInstancedTests({&ThreadPoolTest::run},
+        Containers::arraySize(WorkerCountData));
+
+    addTests({&ThreadPoolTest::runSingleThreadedOrder,
+              &ThreadPoolTest::runDispatchCallback,
+              &ThreadPoolTest::runEmpty});
+}
+
+void noop(void*) {}
+
+void ThreadPoolTest::taskGraph() {
+    TaskGraph graph;
+    CORRADE_COMPARE(graph.taskCount(), 0);
+
+    int state;
+    CORRADE_COMPARE(graph.addTask(noop, &state), 0);
+    CORRADE_COMPARE(graph.addTask(noop), 1);
+    CORRADE_COMPARE(graph.addTask(noop, &state, {1, 0}), 2);
+    const UnsignedInt dependencies[]{2, 0};
+    CORRADE_COMPARE(graph.addTask(noop, nullptr, dependencies), 3);
+    CORRADE_COMPARE(graph.taskCount(), 4);
+
+    CORRADE_COMPARE_AS(graph.taskDependencies(0),
+        Containers::ArrayView<const UnsignedInt>{},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(graph.taskDependencies(1),
+        Containers::ArrayView<const UnsignedInt>{},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(graph.taskDependencies(2),
+        Containers::arrayView({1u, 0u}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(graph.taskDependencies(3),
+        Containers::arrayView({2u, 0u}),
+        TestSuite::Compare::Container);
+}
+
+void ThreadPoolTest::taskGraphInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TaskGraph graph;
+    graph.addTask(noop);
+    graph.addTask(noop);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    graph.addTask(nullptr);
+    graph.addTask(noop, nullptr, {0, 2});
+    graph.taskDependencies(2);
+    CORRADE_COMPARE(out.str(),
+        "TaskGraph::addTask(): expected a non-null function\n"
+        "TaskGraph::addTask(): dependency 2 out of range for 2 tasks\n"
+        "TaskGraph::taskDependencies(): index 2 out of range for 2 tasks\n");
+}
+
+void ThreadPoolTest::taskGraphClear() {
+    TaskGraph graph;
+    graph.addTask(noop);
+    graph.addTask(noop, nullptr, {0});
+    CORRADE_COMPARE(graph.taskCount(), 2);
+
+    graph.clear();
+    CORRADE_COMPARE(graph.taskCount(), 0);
+
+    /* IDs start from zero again */
+    CORRADE_COMPARE(graph.addTask(noop), 0);
+}
+
+void ThreadPoolTest::hardwareThreadCount() {
+    CORRADE_COMPARE_AS(ThreadPool::hardwareThreadCount(), 1,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void ThreadPoolTest::construct() {
+    {
+        ThreadPool pool{0};
+        CORRADE_COMPARE(pool.workerCount(), 0);
+        CORRADE_COMPARE(pool.concurrency(), 1);
+        CORRADE_VERIFY(!pool.dispatchCallback());
+        CORRADE_VERIFY(!pool.dispatchCallbackUserData());
+    } {
+        ThreadPool pool{3};
+        /* No threads are created on Emscripten */
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        CORRADE_COMPARE(pool.workerCount(), 3);
+        CORRADE_COMPARE(pool.concurrency(), 4);
+        #else
+        CORRADE_COMPARE(pool.workerCount(), 0);
+        CORRADE_COMPARE(pool.concurrency(), 1);
+        #endif
+    }
+}
+
+void ThreadPoolTest::constructMove() {
+    ThreadPool a{2};
+
+    /* No threads are created on Emscripten */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const UnsignedInt expectedWorkerCount = 2;
+    #else
+    const UnsignedInt expectedWorkerCount = 0;
+    #endif
+
+    ThreadPool b{Utility::move(a)};
+    CORRADE_COMPARE(b.workerCount(), expectedWorkerCount);
+
+    ThreadPool c{0};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.workerCount(), expectedWorkerCount);
+
+    /* The moved-to instance should be usable */
+    std::atomic<std::size_t> sum{};
+    c.parallelFor(100, 7, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) sum += i;
+    });
+    CORRADE_COMPARE(sum.load(), 4950);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ThreadPool>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ThreadPool>::value);
+}
+
+void ThreadPoolTest::global() {
+    /* The builtin global pool is single-threaded */
+    ThreadPool& builtin = ThreadPool::global();
+    CORRADE_COMPARE(builtin.workerCount(), 0);
+
+    ThreadPool pool{2};
+    ThreadPool::setGlobal(&pool);
+    CORRADE_COMPARE(&ThreadPool::global(), &pool);
+
+    ThreadPool::setGlobal(nullptr);
+    CORRADE_COMPARE(&ThreadPool::global(), &builtin);
+}
+
+void ThreadPoolTest::parallelFor() {
+    auto&& data = WorkerCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.workerCount};
+
+    /* Each index should be visited exactly once, with chunk boundaries
+       independent of the worker count */
+    Containers::Array<std::atomic<Int>> visited{ValueInit, 1000};
+    Containers::Array<std::atomic<Int>> chunkSizes{ValueInit, 1000};
+    pool.parallelFor(visited.size(), 64, [&](std::size_t begin, std::size_t end) {
+        chunkSizes[begin] = Int(end - begin);
+        for(std::size_t i = begin; i != end; ++i) ++visited[i];
+    });
+
+    for(std::size_t i = 0; i != visited.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visited[i].load(), 1);
+        if(i % 64 == 0)
+            CORRADE_COMPARE(chunkSizes[i].load(), i == 960 ? 40 : 64);
+        else
+            CORRADE_COMPARE(chunkSizes[i].load(), 0);
+    }
+}
+
+void ThreadPoolTest::parallelForSingleThreadedOrder() {
+    ThreadPool pool{0};
+
+    /* With no workers the chunks are executed in order on the calling
+       thread */
+    const std::thread::id caller = std::this_thread::get_id();
+    Containers::Array<std::size_t> begins;
+    pool.parallelFor(10, 3, [&](std::size_t begin, std::size_t) {
+        CORRADE_VERIFY(std::this_thread::get_id() == caller);
+        arrayAppend(begins, begin);
+    });
+    CORRADE_COMPARE_AS(begins,
+        Containers::arrayView<std::size_t>({0, 3, 6, 9}),
+        TestSuite::Compare::Container);
+}
+
+void ThreadPoolTest::parallelForSingleChunk() {
+    ThreadPool pool{2};
+
+    /* A single chunk gets executed directly on the calling thread */
+    const std::thread::id caller = std::this_thread::get_id();
+    std::size_t calls = 0;
+    pool.parallelFor(10, 10, [&](std::size_t begin, std::size_t end) {
+        CORRADE_VERIFY(std::this_thread::get_id() == caller);
+        CORRADE_COMPARE(begin, 0);
+        CORRADE_COMPARE(end, 10);
+        ++calls;
+    });
+    CORRADE_COMPARE(calls, 1);
+}
+
+void ThreadPoolTest::parallelForEmpty() {
+    ThreadPool pool{2};
+
+    std::size_t calls = 0;
+    pool.parallelFor(0, 10, [&](std::size_t, std::size_t) {
+        ++calls;
+    });
+    CORRADE_COMPARE(calls, 0);
+}
+
+void ThreadPoolTest::parallelForNested() {
+    auto&& data = WorkerCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.workerCount};
+
+    /* Waiting for the inner loop executes jobs on the waiting thread as
+       well, so this shouldn't deadlock even with a single worker */
+    std::atomic<std::size_t> sum{};
+    pool.parallelFor(16, 1, [&](std::size_t outerBegin, std::size_t) {
+        pool.parallelFor(100, 10, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                sum += outerBegin*100 + i;
+        });
+    });
+    CORRADE_COMPARE(sum.load(), 1599*1600/2);
+}
+
+void ThreadPoolTest::parallelForDispatchCallback() {
+    ThreadPool pool{2};
+
+    /* A custom "job system" that runs the jobs in reverse */
+    struct Dispatch {
+        std::size_t calls;
+        std::size_t jobCount;
+    } dispatch{};
+    pool.setDispatchCallback([](std::size_t jobCount, ThreadPool::JobFunction job, void* jobState, void* userData) {
+        Dispatch& dispatch = *static_cast<Dispatch*>(userData);
+        ++dispatch.calls;
+        dispatch.jobCount += jobCount;
+        for(std::size_t i = jobCount; i != 0; --i)
+            job(jobState, i - 1);
+    }, &dispatch);
+    CORRADE_VERIFY(pool.dispatchCallback());
+    CORRADE_COMPARE(pool.dispatchCallbackUserData(), static_cast<void*>(&dispatch));
+    CORRADE_COMPARE(pool.concurrency(), 0);
+
+    Containers::Array<std::size_t> begins;
+    pool.parallelFor(10, 3, [&](std::size_t begin, std::size_t) {
+        arrayAppend(begins, begin);
+    });
+    CORRADE_COMPARE(dispatch.calls, 1);
+    CORRADE_COMPARE(dispatch.jobCount, 4);
+    CORRADE_COMPARE_AS(begins,
+        Containers::arrayView<std::size_t>({9, 6, 3, 0}),
+        TestSuite::Compare::Container);
+
+    /* Resetting the callback goes back to the workers */
+    pool.setDispatchCallback(nullptr);
+    pool.parallelFor(10, 3, [&](std::size_t, std::size_t) {});
+    CORRADE_COMPARE(dispatch.calls, 1);
+}
+
+void ThreadPoolTest::parallelForInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ThreadPool pool{0};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.parallelFor(10, 0, [](std::size_t, std::size_t) {});
+    pool.parallelFor(10, 1, nullptr, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "ThreadPool::parallelFor(): expected a non-zero grain size\n"
+        "ThreadPool::parallelFor(): expected a non-null function\n");
+}
+
+struct TaskState {
+    std::atomic<UnsignedInt>* counter;
+    UnsignedInt order;
+};
+
+void recordOrder(void* state) {
+    TaskState& task = *static_cast<TaskState*>(state);
+    task.order = (*task.counter)++;
+}
+
+void ThreadPoolTest::run() {
+    auto&& data = WorkerCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.workerCount};
+
+    /* A diamond with an extra independent chain */
+    std::atomic<UnsignedInt> counter{};
+    TaskState tasks[7];
+    for(TaskState& task: tasks) task = {&counter, ~UnsignedInt{}};
+
+    TaskGraph graph;
+    graph.addTask(recordOrder, &tasks[0]);
+    graph.addTask(recordOrder, &tasks[1], {0});
+    graph.addTask(recordOrder, &tasks[2], {0});
+    graph.addTask(recordOrder, &tasks[3], {1, 2});
+    graph.addTask(recordOrder, &tasks[4]);
+    graph.addTask(recordOrder, &tasks[5], {4});
+    graph.addTask(recordOrder, &tasks[6], {3, 5});
+
+    /* Running the same graph twice should work */
+    for(std::size_t iteration = 0; iteration != 2; ++iteration) {
+        CORRADE_ITERATION(iteration);
+        counter = 0;
+
+        pool.run(graph);
+        CORRADE_COMPARE(counter.load(), 7);
+
+        for(std::size_t i = 0; i != graph.taskCount(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE_AS(tasks[i].order, 7,
+                TestSuite::Compare::Less);
+            for(const UnsignedInt dependency: graph.taskDependencies(i))
+                CORRADE_COMPARE_AS(tasks[i].order, tasks[dependency].order,
+                    TestSuite::Compare::Greater);
+        }
+    }
+}
+
+void ThreadPoolTest::runSingleThreadedOrder() {
+    ThreadPool pool{0};
+
+    std::atomic<UnsignedInt> counter{};
+    TaskState tasks[4];
+    for(TaskState& task: tasks) task = {&counter, ~UnsignedInt{}};
+
+    /* With no workers the tasks are executed in the order they were added */
+    TaskGraph graph;
+    graph.addTask(recordOrder, &tasks[0]);
+    graph.addTask(recordOrder, &tasks[1]);
+    graph.addTask(recordOrder, &tasks[2], {0});
+    graph.addTask(recordOrder, &tasks[3], {1});
+    pool.run(graph);
+    CORRADE_COMPARE(tasks[0].order, 0);
+    CORRADE_COMPARE(tasks[1].order, 1);
+    CORRADE_COMPARE(tasks[2].order, 2);
+    CORRADE_COMPARE(tasks[3].order, 3);
+}
+
+void ThreadPoolTest::runDispatchCallback() {
+    ThreadPool pool{0};
+
+    Containers::Array<std::size_t> jobCounts;
+    pool.setDispatchCallback([](std::size_t jobCount, ThreadPool::JobFunction job, void* jobState, void* userData) {
+        arrayAppend(*static_cast<Containers::Array<std::size_t>*>(userData), jobCount);
+        for(std::size_t i = 0; i != jobCount; ++i)
+            job(jobState, i);
+    }, &jobCounts);
+
+    std::atomic<UnsignedInt> counter{};
+    TaskState tasks[5];
+    for(TaskState& task: tasks) task = {&counter, ~UnsignedInt{}};
+
+    /* Dispatched in batches of tasks with all dependencies satisfied */
+    TaskGraph graph;
+    graph.addTask(recordOrder, &tasks[0]);
+    graph.addTask(recordOrder, &tasks[1]);
+    graph.addTask(recordOrder, &tasks[2], {0});
+    graph.addTask(recordOrder, &tasks[3], {1, 2});
+    graph.addTask(recordOrder, &tasks[4], {1});
+    pool.run(graph);
+    CORRADE_COMPARE_AS(jobCounts,
+        Containers::arrayView<std::size_t>({2, 2, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(tasks[0].order, 0);
+    CORRADE_COMPARE(tasks[1].order, 1);
+    CORRADE_COMPARE(tasks[2].order, 2);
+    CORRADE_COMPARE(tasks[4].order, 3);
+    CORRADE_COMPARE(tasks[3].order, 4);
+}
+
+void ThreadPoolTest::runEmpty() {
+    ThreadPool pool{2};
+
+    TaskGraph graph;
+    pool.run(graph);
+    CORRADE_VERIFY(true);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ThreadPoolTest)
@@ -0,0 +1,340 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/System.h>
+
+#include "Magnum/TimestepScheduler.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct TimestepSchedulerTest: TestSuite::Tester {
+    explicit TimestepSchedulerTest();
+
+    void construct();
+    void addRate();
+    void addRateInvalid();
+
+    void advance();
+    void advanceMultipleRates();
+    void advanceOverrun();
+    void advanceInvalid();
+    void jitter();
+    void reset();
+
+    void startStop();
+
+    void invalidIndex();
+};
+
+using namespace Math::Literals;
+
+TimestepSchedulerTest::TimestepSchedulerTest() {
+    addTests({&TimestepSchedulerTest::construct,
+              &TimestepSchedulerTest::addRate,
+              &TimestepSchedulerTest::addRateInvalid,
+
+              &TimestepSchedulerTest::advance,
+              &TimestepSchedulerTest::advanceMultipleRates,
+              &TimestepSchedulerTest::advanceOverrun,
+              &TimestepSchedulerTest::advanceInvalid,
+              &TimestepSchedulerTest::jitter,
+              &TimestepSchedulerTest::reset,
+
+              &TimestepSchedulerTest::startStop,
+
+              &TimestepSchedulerTest::invalidIndex});
+}
+
+void TimestepSchedulerTest::construct() {
+    TimestepScheduler scheduler;
+    CORRADE_VERIFY(!scheduler.isRunning());
+    CORRADE_COMPARE(scheduler.rateCount(), 0);
+    CORRADE_COMPARE(scheduler.time(), 0_nsec);
+    CORRADE_COMPARE(scheduler.frameDuration(), 0_nsec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 0_nsec);
+    CORRADE_COMPARE(scheduler.frameCount(), 0);
+}
+
+void TimestepSchedulerTest::addRate() {
+    TimestepScheduler scheduler;
+    CORRADE_COMPARE(scheduler.addRate(10.0_msec), 0);
+    CORRADE_COMPARE(scheduler.addRate(100.0_msec, 3), 1);
+    CORRADE_COMPARE(scheduler.rateCount(), 2);
+
+    CORRADE_COMPARE(scheduler.period(0), 10.0_msec);
+    CORRADE_COMPARE(scheduler.maxStepCount(0), 8);
+    CORRADE_COMPARE(scheduler.period(1), 100.0_msec);
+    CORRADE_COMPARE(scheduler.maxStepCount(1), 3);
+
+    /* Initially there's nothing to step */
+    CORRADE_COMPARE(scheduler.stepCount(1), 0);
+    CORRADE_COMPARE(scheduler.totalStepCount(1), 0);
+    CORRADE_COMPARE(scheduler.alpha(1), 0.0f);
+    CORRADE_COMPARE(scheduler.droppedDuration(1), 0_nsec);
+    CORRADE_COMPARE(scheduler.overrunCount(1), 0);
+}
+
+void TimestepSchedulerTest::addRateInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TimestepScheduler scheduler;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    scheduler.addRate(0_nsec);
+    scheduler.addRate(-1.0_msec);
+    scheduler.addRate(10.0_msec, 0);
+    CORRADE_COMPARE(out.str(),
+        "TimestepScheduler::addRate(): expected a positive period, got Nanoseconds(0)\n"
+        "TimestepScheduler::addRate(): expected a positive period, got Nanoseconds(-1000000)\n"
+        "TimestepScheduler::addRate(): expected a non-zero max step count\n");
+}
+
+void TimestepSchedulerTest::advance() {
+    TimestepScheduler scheduler;
+    scheduler.addRate(10.0_msec);
+
+    /* Not enough for a single step */
+    scheduler.advance(4.0_msec);
+    CORRADE_COMPARE(scheduler.time(), 4.0_msec);
+    CORRADE_COMPARE(scheduler.frameDuration(), 4.0_msec);
+    CORRADE_COMPARE(scheduler.frameCount(), 1);
+    CORRADE_COMPARE(scheduler.stepCount(0), 0);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 0);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.4f);
+
+    /* Accumulated to one step with remainder */
+    scheduler.advance(8.0_msec);
+    CORRADE_COMPARE(scheduler.time(), 12.0_msec);
+    CORRADE_COMPARE(scheduler.frameCount(), 2);
+    CORRADE_COMPARE(scheduler.stepCount(0), 1);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 1);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.2f);
+
+    /* Several steps in a single frame, landing exactly on a step boundary */
+    scheduler.advance(28.0_msec);
+    CORRADE_COMPARE(scheduler.time(), 40.0_msec);
+    CORRADE_COMPARE(scheduler.stepCount(0), 3);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 4);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.0f);
+    CORRADE_COMPARE(scheduler.droppedDuration(0), 0_nsec);
+    CORRADE_COMPARE(scheduler.overrunCount(0), 0);
+
+    /* A zero-duration frame does nothing */
+    scheduler.advance(0_nsec);
+    CORRADE_COMPARE(scheduler.time(), 40.0_msec);
+    CORRADE_COMPARE(scheduler.frameCount(), 4);
+    CORRADE_COMPARE(scheduler.stepCount(0), 0);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 4);
+}
+
+void TimestepSchedulerTest::advanceMultipleRates() {
+    TimestepScheduler scheduler;
+    /* Physics at 125 Hz, AI at 10 Hz, to have periods in whole milliseconds */
+    UnsignedInt physics = scheduler.addRate(8.0_msec);
+    UnsignedInt ai = scheduler.addRate(100.0_msec);
+
+    /* 60 frames at a 60 Hz-ish framerate */
+    UnsignedInt physicsSteps = 0, aiSteps = 0;
+    for(std::size_t i = 0; i != 60; ++i) {
+        scheduler.advance(16.5_msec);
+        physicsSteps += scheduler.stepCount(physics);
+        aiSteps += scheduler.stepCount(ai);
+        CORRADE_COMPARE_AS(scheduler.alpha(physics), 1.0f,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(scheduler.alpha(ai), 1.0f,
+            TestSuite::Compare::Less);
+    }
+
+    /* 990 ms in total */
+    CORRADE_COMPARE(scheduler.time(), 990.0_msec);
+    CORRADE_COMPARE(physicsSteps, 123);
+    CORRADE_COMPARE(scheduler.totalStepCount(physics), 123);
+    CORRADE_COMPARE(scheduler.alpha(physics), 0.75f);
+    CORRADE_COMPARE(aiSteps, 9);
+    CORRADE_COMPARE(scheduler.totalStepCount(ai), 9);
+    CORRADE_COMPARE(scheduler.alpha(ai), 0.9f);
+}
+
+void TimestepSchedulerTest::advanceOverrun() {
+    TimestepScheduler scheduler;
+    scheduler.addRate(10.0_msec, 3);
+
+    scheduler.advance(5.0_msec);
+    CORRADE_COMPARE(scheduler.stepCount(0), 0);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.5f);
+
+    /* A long frame would need 7 steps, only 3 are done and the rest dropped.
+       The fractional part is kept. */
+    scheduler.advance(67.0_msec);
+    CORRADE_COMPARE(scheduler.stepCount(0), 3);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 3);
+    CORRADE_COMPARE(scheduler.droppedDuration(0), 40.0_msec);
+    CORRADE_COMPARE(scheduler.overrunCount(0), 1);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.2f);
+
+    /* Next frame doesn't need to catch up anymore */
+    scheduler.advance(10.0_msec);
+    CORRADE_COMPARE(scheduler.stepCount(0), 1);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 4);
+    CORRADE_COMPARE(scheduler.droppedDuration(0), 0_nsec);
+    CORRADE_COMPARE(scheduler.overrunCount(0), 1);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.2f);
+
+    /* Exactly the max step count isn't an overrun */
+    scheduler.advance(28.0_msec);
+    CORRADE_COMPARE(scheduler.stepCount(0), 3);
+    CORRADE_COMPARE(scheduler.droppedDuration(0), 0_nsec);
+    CORRADE_COMPARE(scheduler.overrunCount(0), 1);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.0f);
+}
+
+void TimestepSchedulerTest::advanceInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TimestepScheduler scheduler;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    scheduler.advance(-1_nsec);
+    CORRADE_COMPARE(out.str(),
+        "TimestepScheduler::advance(): expected a non-negative duration, got Nanoseconds(-1)\n");
+}
+
+void TimestepSchedulerTest::jitter() {
+    TimestepScheduler scheduler;
+
+    /* No jitter for the first frame */
+    scheduler.advance(16.0_msec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 0_nsec);
+
+    scheduler.advance(17.0_msec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 1.0_msec);
+
+    /* Absolute difference */
+    scheduler.advance(14.0_msec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 3.0_msec);
+
+    scheduler.advance(14.0_msec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 0_nsec);
+}
+
+void TimestepSchedulerTest::reset() {
+    TimestepScheduler scheduler;
+    scheduler.addRate(10.0_msec, 2);
+    scheduler.advance(15.0_msec);
+    scheduler.advance(45.0_msec);
+    CORRADE_COMPARE(scheduler.time(), 60.0_msec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 30.0_msec);
+    CORRADE_COMPARE(scheduler.frameCount(), 2);
+    CORRADE_COMPARE(scheduler.stepCount(0), 2);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 3);
+    CORRADE_COMPARE(scheduler.droppedDuration(0), 30.0_msec);
+    CORRADE_COMPARE(scheduler.overrunCount(0), 1);
+
+    scheduler.reset();
+    CORRADE_COMPARE(scheduler.rateCount(), 1);
+    CORRADE_COMPARE(scheduler.period(0), 10.0_msec);
+    CORRADE_COMPARE(scheduler.time(), 0_nsec);
+    CORRADE_COMPARE(scheduler.frameDuration(), 0_nsec);
+    CORRADE_COMPARE(scheduler.frameJitter(), 0_nsec);
+    CORRADE_COMPARE(scheduler.frameCount(), 0);
+    CORRADE_COMPARE(scheduler.stepCount(0), 0);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 0);
+    CORRADE_COMPARE(scheduler.alpha(0), 0.0f);
+    CORRADE_COMPARE(scheduler.droppedDuration(0), 0_nsec);
+    CORRADE_COMPARE(scheduler.overrunCount(0), 0);
+}
+
+void TimestepSchedulerTest::startStop() {
+    /* Similarly to TimelineTest, can't reliably test that the measured time
+       is less than something, so verifying just the lower bound. */
+    constexpr std::size_t ms = 50;
+
+    TimestepScheduler scheduler;
+    scheduler.addRate(10.0_msec, 100);
+
+    /* Stopped by default, nextFrame() does nothing */
+    Utility::System::sleep(ms);
+    scheduler.nextFrame();
+    CORRADE_COMPARE(scheduler.frameCount(), 0);
+    CORRADE_COMPARE(scheduler.time(), 0_nsec);
+
+    scheduler.start();
+    CORRADE_VERIFY(scheduler.isRunning());
+    CORRADE_COMPARE(scheduler.frameCount(), 0);
+
+    Utility::System::sleep(ms);
+    scheduler.nextFrame();
+    CORRADE_COMPARE(scheduler.frameCount(), 1);
+    CORRADE_COMPARE_AS(scheduler.frameDuration(), 50.0_msec,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(scheduler.stepCount(0), 5,
+        TestSuite::Compare::GreaterOrEqual);
+
+    /* Stopping resets everything */
+    scheduler.stop();
+    CORRADE_VERIFY(!scheduler.isRunning());
+    CORRADE_COMPARE(scheduler.frameCount(), 0);
+    CORRADE_COMPARE(scheduler.time(), 0_nsec);
+    CORRADE_COMPARE(scheduler.totalStepCount(0), 0);
+
+    scheduler.nextFrame();
+    CORRADE_COMPARE(scheduler.frameCount(), 0);
+}
+
+void TimestepSchedulerTest::invalidIndex() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TimestepScheduler scheduler;
+    scheduler.addRate(10.0_msec);
+    scheduler.addRate(20.0_msec);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    scheduler.period(2);
+    scheduler.maxStepCount(2);
+    scheduler.stepCount(2);
+    scheduler.totalStepCount(2);
+    scheduler.alpha(2);
+    scheduler.droppedDuration(2);
+    scheduler.overrunCount(2);
+    CORRADE_COMPARE(out.str(),
+        "TimestepScheduler::period(): index 2 out of range for 2 rates\n"
+        "TimestepScheduler::maxStepCount(): index 2 out of range for 2 rates\n"
+        "TimestepScheduler::stepCount(): index 2 out of range for 2 rates\n"
+        "TimestepScheduler::totalStepCount(): index 2 out of range for 2 rates\n"
+        "TimestepScheduler::alpha(): index 2 out of range for 2 rates\n"
+        "TimestepScheduler::droppedDuration(): index 2 out of range for 2 rates\n"
+        "TimestepScheduler::overrunCount(): index 2 out of range for 2 rates\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TimestepSchedulerTest)
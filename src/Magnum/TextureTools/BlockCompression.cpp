@@ -0,0 +1,433 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlockCompression.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace TextureTools {
+
+Debug& operator<<(Debug& debug, const BlockCompressionQuality value) {
+    debug << "TextureTools::BlockCompressionQuality" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case BlockCompressionQuality::v: return debug << "::" #v;
+        _c(Fast)
+        _c(Normal)
+        _c(High)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+namespace {
+
+bool isSupportedInputFormat(const PixelFormat format) {
+    return format == PixelFormat::R8Unorm ||
+           format == PixelFormat::R8Srgb ||
+           format == PixelFormat::RG8Unorm ||
+           format == PixelFormat::RG8Srgb ||
+           format == PixelFormat::RGB8Unorm ||
+           format == PixelFormat::RGB8Srgb ||
+           format == PixelFormat::RGBA8Unorm ||
+           format == PixelFormat::RGBA8Srgb;
+}
+
+bool isSupportedOutputFormat(const CompressedPixelFormat format) {
+    return format == CompressedPixelFormat::Bc1RGBUnorm ||
+           format == CompressedPixelFormat::Bc1RGBSrgb ||
+           format == CompressedPixelFormat::Bc1RGBAUnorm ||
+           format == CompressedPixelFormat::Bc1RGBASrgb ||
+           format == CompressedPixelFormat::Bc3RGBAUnorm ||
+           format == CompressedPixelFormat::Bc3RGBASrgb ||
+           format == CompressedPixelFormat::Bc4RUnorm ||
+           format == CompressedPixelFormat::Bc5RGUnorm;
+}
+
+/* Fetches a 4x4 block at given block coordinates, repeating the last row and
+   column for blocks crossing the image edge */
+void fetchBlock(const Containers::StridedArrayView3D<const char>& pixels, const std::size_t blockY, const std::size_t blockX, Color4ub(&out)[16]) {
+    const std::size_t pixelSize = pixels.size()[2];
+    for(std::size_t y = 0; y != 4; ++y) {
+        const std::size_t row = Math::min(blockY*4 + y, pixels.size()[0] - 1);
+        for(std::size_t x = 0; x != 4; ++x) {
+            const std::size_t col = Math::min(blockX*4 + x, pixels.size()[1] - 1);
+            const UnsignedByte* const pixel = static_cast<const UnsignedByte*>(pixels[row][col].data());
+            Color4ub& color = out[y*4 + x];
+            color = {0, 0, 0, 255};
+            for(std::size_t i = 0; i != pixelSize; ++i)
+                color[i] = pixel[i];
+        }
+    }
+}
+
+/* BC4 block, used also for BC3 alpha and both BC5 channels. Always uses the
+   eight-value mode (first endpoint larger than the second), with the
+   exception of uniform blocks, where both endpoints are the same and all
+   indices zero. */
+void encodeBc4(const UnsignedByte(&values)[16], char* const out) {
+    UnsignedByte min = values[0], max = values[0];
+    for(UnsignedByte v: values) {
+        min = Math::min(min, v);
+        max = Math::max(max, v);
+    }
+
+    out[0] = char(max);
+    out[1] = char(min);
+
+    UnsignedLong indices = 0;
+    if(min != max) {
+        /* Palette as defined by the spec, index 0 is max, index 1 is min and
+           indices 2 to 7 interpolate from max to min */
+        Int palette[8];
+        palette[0] = max;
+        palette[1] = min;
+        for(Int i = 2; i != 8; ++i)
+            palette[i] = ((8 - i)*max + (i - 1)*min)/7;
+
+        for(std::size_t i = 0; i != 16; ++i) {
+            UnsignedLong best = 0;
+            Int bestError = 256;
+            for(UnsignedLong j = 0; j != 8; ++j) {
+                const Int error = Math::abs(palette[j] - Int(values[i]));
+                if(error < bestError) {
+                    bestError = error;
+                    best = j;
+                }
+            }
+            indices |= best << (3*i);
+        }
+    }
+
+    /* 48 bits of indices, little-endian */
+    for(std::size_t i = 0; i != 6; ++i)
+        out[2 + i] = char((indices >> (8*i)) & 0xff);
+}
+
+UnsignedShort packRgb565(const Vector3& color) {
+    const Vector3i quantized{Math::round(Math::clamp(color, 0.0f, 255.0f)*Vector3{31.0f/255.0f, 63.0f/255.0f, 31.0f/255.0f})};
+    return UnsignedShort(quantized.r() << 11 | quantized.g() << 5 | quantized.b());
+}
+
+Vector3 unpackRgb565(const UnsignedShort packed) {
+    const UnsignedInt r = (packed >> 11) & 0x1f;
+    const UnsignedInt g = (packed >> 5) & 0x3f;
+    const UnsignedInt b = packed & 0x1f;
+    return Vector3{Float((r << 3)|(r >> 2)),
+                   Float((g << 2)|(g >> 4)),
+                   Float((b << 3)|(b >> 2))};
+}
+
+/* Picks the closest palette entry for each pixel, returns the total squared
+   error. In the three-color mode, transparent pixels get index 3. */
+Float fitBc1Indices(const Vector3(&colors)[16], const bool(&transparent)[16], const UnsignedShort c0, const UnsignedShort c1, const bool threeColor, UnsignedInt& indices) {
+    const Vector3 e0 = unpackRgb565(c0);
+    const Vector3 e1 = unpackRgb565(c1);
+    Vector3 palette[4];
+    palette[0] = e0;
+    palette[1] = e1;
+    if(threeColor) {
+        palette[2] = (e0 + e1)*0.5f;
+        palette[3] = {};
+    } else {
+        palette[2] = (e0*2.0f + e1)/3.0f;
+        palette[3] = (e0 + e1*2.0f)/3.0f;
+    }
+
+    indices = 0;
+    Float error = 0.0f;
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(transparent[i]) {
+            indices |= 3u << (2*i);
+            continue;
+        }
+
+        UnsignedInt best = 0;
+        Float bestError = (colors[i] - palette[0]).dot();
+        for(UnsignedInt j = 1, jMax = threeColor ? 3 : 4; j != jMax; ++j) {
+            const Float e = (colors[i] - palette[j]).dot();
+            if(e < bestError) {
+                bestError = e;
+                best = j;
+            }
+        }
+        indices |= best << (2*i);
+        error += bestError;
+    }
+
+    return error;
+}
+
+/* Orders the endpoints according to the mode and fits the indices */
+Float fitBc1(const Vector3(&colors)[16], const bool(&transparent)[16], const Vector3& a, const Vector3& b, const bool threeColor, UnsignedShort& c0, UnsignedShort& c1, UnsignedInt& indices) {
+    const UnsignedShort packedA = packRgb565(a);
+    const UnsignedShort packedB = packRgb565(b);
+
+    /* Four-color mode needs c0 > c1, three-color mode c0 <= c1. If both
+       endpoints quantize to the same value in the four-color mode, the block
+       gets interpreted as three-color, so use just the first index then. */
+    if(threeColor) {
+        c0 = Math::min(packedA, packedB);
+        c1 = Math::max(packedA, packedB);
+    } else {
+        c0 = Math::max(packedA, packedB);
+        c1 = Math::min(packedA, packedB);
+        if(c0 == c1) {
+            indices = 0;
+            Float error = 0.0f;
+            const Vector3 color = unpackRgb565(c0);
+            for(std::size_t i = 0; i != 16; ++i)
+                error += (colors[i] - color).dot();
+            return error;
+        }
+    }
+
+    return fitBc1Indices(colors, transparent, c0, c1, threeColor, indices);
+}
+
+void encodeBc1(const Color4ub(&pixels)[16], const bool punchThroughAlpha, const BlockCompressionQuality quality, char* const out) {
+    Vector3 colors[16];
+    bool transparent[16];
+    std::size_t opaqueCount = 0;
+    Vector3 min{255.0f}, max{0.0f}, mean;
+    for(std::size_t i = 0; i != 16; ++i) {
+        colors[i] = Vector3{pixels[i].rgb()};
+        transparent[i] = punchThroughAlpha && pixels[i].a() < 128;
+        if(transparent[i]) continue;
+
+        ++opaqueCount;
+        min = Math::min(min, colors[i]);
+        max = Math::max(max, colors[i]);
+        mean += colors[i];
+    }
+
+    UnsignedShort c0, c1;
+    UnsignedInt indices;
+    const bool threeColor = opaqueCount != 16;
+
+    /* Fully transparent block, three-color mode with all indices 3 */
+    if(!opaqueCount) {
+        c0 = c1 = 0;
+        indices = 0xffffffffu;
+
+    } else {
+        Vector3 a = max, b = min;
+        mean /= Float(opaqueCount);
+
+        /* Pick the bounding box diagonal that matches the correlation of the
+           channels, the max - min diagonal works only if all channels
+           increase together */
+        if(quality == BlockCompressionQuality::Fast) {
+            Float rg = 0.0f, rb = 0.0f;
+            for(std::size_t i = 0; i != 16; ++i) {
+                if(transparent[i]) continue;
+                const Vector3 d = colors[i] - mean;
+                rg += d.x()*d.y();
+                rb += d.x()*d.z();
+            }
+            if(rg < 0.0f) Utility::swap(a.y(), b.y());
+            if(rb < 0.0f) Utility::swap(a.z(), b.z());
+
+        /* Use the principal axis of the colors instead, extended to cover the
+           projection of all colors */
+        } else {
+
+            Float cov[6]{};
+            for(std::size_t i = 0; i != 16; ++i) {
+                if(transparent[i]) continue;
+                const Vector3 d = colors[i] - mean;
+                cov[0] += d.x()*d.x();
+                cov[1] += d.x()*d.y();
+                cov[2] += d.x()*d.z();
+                cov[3] += d.y()*d.y();
+                cov[4] += d.y()*d.z();
+                cov[5] += d.z()*d.z();
+            }
+
+            /* Power iteration, starting from the bounding box diagonal */
+            Vector3 axis = max - min;
+            for(std::size_t iteration = 0; iteration != 8; ++iteration) {
+                const Vector3 next{
+                    cov[0]*axis.x() + cov[1]*axis.y() + cov[2]*axis.z(),
+                    cov[1]*axis.x() + cov[3]*axis.y() + cov[4]*axis.z(),
+                    cov[2]*axis.x() + cov[4]*axis.y() + cov[5]*axis.z()};
+                const Float length = next.length();
+                if(length < 1.0e-6f) break;
+                axis = next/length;
+            }
+
+            if(axis.dot() > 1.0e-6f) {
+                Float minT = Constants::inf(), maxT = -Constants::inf();
+                for(std::size_t i = 0; i != 16; ++i) {
+                    if(transparent[i]) continue;
+                    const Float t = Math::dot(colors[i] - mean, axis);
+                    minT = Math::min(minT, t);
+                    maxT = Math::max(maxT, t);
+                }
+                a = mean + axis*maxT/axis.dot();
+                b = mean + axis*minT/axis.dot();
+            }
+        }
+
+        Float error = fitBc1(colors, transparent, a, b, threeColor, c0, c1, indices);
+
+        /* Least-squares refinement of the endpoints for given indices --
+           minimizing the sum of |w*e0 + (1 - w)*e1 - p|^2 over all pixels,
+           where w is the palette weight of the first endpoint */
+        if(quality == BlockCompressionQuality::High) for(std::size_t iteration = 0; iteration != 2 && error > 0.0f && c0 != c1; ++iteration) {
+            const Float weights4[]{1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f};
+            const Float weights3[]{1.0f, 0.0f, 0.5f, 0.0f};
+            const Float* const weights = threeColor ? weights3 : weights4;
+
+            Float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            Vector3 ap, bp;
+            for(std::size_t i = 0; i != 16; ++i) {
+                if(transparent[i]) continue;
+                const Float w = weights[(indices >> (2*i)) & 3];
+                aa += w*w;
+                ab += w*(1.0f - w);
+                bb += (1.0f - w)*(1.0f - w);
+                ap += w*colors[i];
+                bp += (1.0f - w)*colors[i];
+            }
+
+            const Float det = aa*bb - ab*ab;
+            if(Math::abs(det) < 1.0e-6f) break;
+
+            const Vector3 refinedA = (ap*bb - bp*ab)/det;
+            const Vector3 refinedB = (bp*aa - ap*ab)/det;
+            UnsignedShort refinedC0, refinedC1;
+            UnsignedInt refinedIndices;
+            const Float refinedError = fitBc1(colors, transparent, refinedA, refinedB, threeColor, refinedC0, refinedC1, refinedIndices);
+            if(refinedError >= error) break;
+
+            error = refinedError;
+            c0 = refinedC0;
+            c1 = refinedC1;
+            indices = refinedIndices;
+        }
+    }
+
+    /* Two 16-bit endpoints and 32 bits of indices, all little-endian */
+    out[0] = char(c0 & 0xff);
+    out[1] = char(c0 >> 8);
+    out[2] = char(c1 & 0xff);
+    out[3] = char(c1 >> 8);
+    for(std::size_t i = 0; i != 4; ++i)
+        out[4 + i] = char((indices >> (8*i)) & 0xff);
+}
+
+}
+
+void compressBlocksInto(const ImageView2D& image, const CompressedPixelFormat format, const Containers::ArrayView<char>& output, const BlockCompressionQuality quality) {
+    CORRADE_ASSERT(isSupportedInputFormat(image.format()),
+        "TextureTools::compressBlocksInto(): unsupported input format" << image.format(), );
+    CORRADE_ASSERT(isSupportedOutputFormat(format),
+        "TextureTools::compressBlocksInto(): unsupported output format" << format, );
+
+    const Vector2i blockCount = (image.size() + Vector2i{3})/4;
+    const std::size_t blockDataSize = compressedPixelFormatBlockDataSize(format);
+    CORRADE_ASSERT(output.size() == std::size_t(blockCount.product())*blockDataSize,
+        "TextureTools::compressBlocksInto(): expected output size to be" << blockCount.product()*blockDataSize << "bytes for" << Debug::packed << blockCount << "blocks but got" << output.size(), );
+
+    if(image.size().isZero()) return;
+
+    const Containers::StridedArrayView3D<const char> pixels = image.pixels();
+    const bool punchThroughAlpha =
+        format == CompressedPixelFormat::Bc1RGBAUnorm ||
+        format == CompressedPixelFormat::Bc1RGBASrgb;
+
+    /* Each block is encoded independently of the others, so the rows of
+       blocks can be processed in parallel */
+    ThreadPool::global().parallelFor(blockCount.y(), 1, [&](const std::size_t yBegin, const std::size_t yEnd) {
+        Color4ub block[16];
+        UnsignedByte channel[16];
+        char* out = output.data() + yBegin*blockCount.x()*blockDataSize;
+        for(std::size_t y = yBegin; y != yEnd; ++y) {
+            for(std::size_t x = 0; x != std::size_t(blockCount.x()); ++x) {
+                fetchBlock(pixels, y, x, block);
+
+                switch(format) {
+                    case CompressedPixelFormat::Bc1RGBUnorm:
+                    case CompressedPixelFormat::Bc1RGBSrgb:
+                    case CompressedPixelFormat::Bc1RGBAUnorm:
+                    case CompressedPixelFormat::Bc1RGBASrgb:
+                        encodeBc1(block, punchThroughAlpha, quality, out);
+                        break;
+                    case CompressedPixelFormat::Bc3RGBAUnorm:
+                    case CompressedPixelFormat::Bc3RGBASrgb:
+                        for(std::size_t i = 0; i != 16; ++i)
+                            channel[i] = block[i].a();
+                        encodeBc4(channel, out);
+                        encodeBc1(block, false, quality, out + 8);
+                        break;
+                    case CompressedPixelFormat::Bc4RUnorm:
+                        for(std::size_t i = 0; i != 16; ++i)
+                            channel[i] = block[i].r();
+                        encodeBc4(channel, out);
+                        break;
+                    case CompressedPixelFormat::Bc5RGUnorm:
+                        for(std::size_t i = 0; i != 16; ++i)
+                            channel[i] = block[i].r();
+                        encodeBc4(channel, out);
+                        for(std::size_t i = 0; i != 16; ++i)
+                            channel[i] = block[i].g();
+                        encodeBc4(channel, out + 8);
+                        break;
+                    default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+                }
+
+                out += blockDataSize;
+            }
+        }
+    });
+}
+
+CompressedImage2D compressBlocks(const ImageView2D& image, const CompressedPixelFormat format, const BlockCompressionQuality quality) {
+    /* Checking just the output format here as the block size is needed for
+       the allocation, the rest is checked in compressBlocksInto() */
+    CORRADE_ASSERT(isSupportedOutputFormat(format),
+        "TextureTools::compressBlocks(): unsupported output format" << format, {});
+
+    const Vector2i blockCount = (image.size() + Vector2i{3})/4;
+    Containers::Array<char> data{NoInit, std::size_t(blockCount.product())*compressedPixelFormatBlockDataSize(format)};
+    compressBlocksInto(image, format, data, quality);
+    return CompressedImage2D{format, image.size(), Utility::move(data)};
+}
+
+}}
@@ -0,0 +1,113 @@
+#ifndef Magnum_TextureTools_BlockCompression_h
+#define Magnum_TextureTools_BlockCompression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::compressBlocks(), @ref Magnum::TextureTools::compressBlocksInto(), enum @ref Magnum::TextureTools::BlockCompressionQuality
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Block compression quality
+@m_since_latest
+
+@see @ref compressBlocks(), @ref compressBlocksInto()
+*/
+enum class BlockCompressionQuality: UnsignedByte {
+    /**
+     * Color endpoints are taken from a bounding box of block colors. Fastest,
+     * but produces visible artifacts on blocks with colors not lying on the
+     * box diagonal.
+     */
+    Fast,
+
+    /**
+     * Color endpoints are taken from the principal axis of block colors.
+     * Default.
+     */
+    Normal,
+
+    /**
+     * Like @ref BlockCompressionQuality::Normal, but additionally refining
+     * the color endpoints with a least-squares fit to the selected palette
+     * indices. About twice as slow as @ref BlockCompressionQuality::Normal.
+     */
+    High
+};
+
+/**
+ * @debugoperatorenum{BlockCompressionQuality}
+ * @m_since_latest
+ */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, BlockCompressionQuality value);
+
+/**
+@brief Compress an image into BC blocks
+@m_since_latest
+
+Encodes @p image into 4x4 blocks of given @p format. Supported formats are
+@ref CompressedPixelFormat::Bc1RGBUnorm / @relativeref{CompressedPixelFormat,Bc1RGBSrgb},
+@ref CompressedPixelFormat::Bc1RGBAUnorm / @relativeref{CompressedPixelFormat,Bc1RGBASrgb}
+(with pixels having alpha below @cpp 128 @ce encoded as transparent),
+@ref CompressedPixelFormat::Bc3RGBAUnorm / @relativeref{CompressedPixelFormat,Bc3RGBASrgb},
+@ref CompressedPixelFormat::Bc4RUnorm and
+@ref CompressedPixelFormat::Bc5RGUnorm. The @p image is expected to be in one
+of @ref PixelFormat::R8Unorm, @relativeref{PixelFormat,RG8Unorm},
+@relativeref{PixelFormat,RGB8Unorm}, @relativeref{PixelFormat,RGBA8Unorm} or
+their sRGB variants. Channels missing in the input are treated as
+@cpp 0 @ce, except for alpha which is treated as @cpp 255 @ce. sRGB formats
+are encoded as-is, without converting to linear space first.
+
+If the image size isn't a multiple of the block size, the last row and column
+is repeated to fill the remaining block space. The output is a
+@ref CompressedImage2D with default @ref CompressedPixelStorage, directly
+usable for example with @ref GL::Texture::setCompressedImage(). Each block is
+encoded independently, use @ref compressBlocksInto() to compress parts of an
+image into existing memory, for example from multiple threads.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBlocks(const ImageView2D& image, CompressedPixelFormat format, BlockCompressionQuality quality = BlockCompressionQuality::Normal);
+
+/**
+@brief Compress an image into BC blocks into existing memory
+@m_since_latest
+
+Like @ref compressBlocks(), but writes the blocks into @p output instead of
+allocating a new image. The @p output is expected to have a size of
+@ref compressedPixelFormatBlockDataSize() multiplied by the count of blocks in
+both dimensions, with blocks ordered row-major.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void compressBlocksInto(const ImageView2D& image, CompressedPixelFormat format, const Containers::ArrayView<char>& output, BlockCompressionQuality quality = BlockCompressionQuality::Normal);
+
+}}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct BlockCompressionBenchmark: TestSuite::Tester {
+    explicit BlockCompressionBenchmark();
+
+    void bc1();
+    void bc3();
+    void bc4();
+    void bc5();
+};
+
+const struct {
+    const char* name;
+    BlockCompressionQuality quality;
+} QualityData[]{
+    {"fast", BlockCompressionQuality::Fast},
+    {"normal", BlockCompressionQuality::Normal},
+    {"high", BlockCompressionQuality::High},
+};
+
+constexpr Vector2i Size{256, 256};
+
+BlockCompressionBenchmark::BlockCompressionBenchmark() {
+    addInstancedBenchmarks({&BlockCompressionBenchmark::bc1,
+                            &BlockCompressionBenchmark::bc3}, 10,
+        Containers::arraySize(QualityData));
+
+    addBenchmarks({&BlockCompressionBenchmark::bc4,
+                   &BlockCompressionBenchmark::bc5}, 10);
+}
+
+/* A smooth pattern with some noise, to not have the blocks trivially
+   uniform */
+Containers::Array<Color4ub> pattern() {
+    Containers::Array<Color4ub> out{NoInit, std::size_t(Size.product())};
+    UnsignedInt seed = 1;
+    for(std::size_t y = 0; y != std::size_t(Size.y()); ++y) {
+        for(std::size_t x = 0; x != std::size_t(Size.x()); ++x) {
+            seed = seed*1103515245u + 12345u;
+            const UnsignedByte noise = (seed >> 16) & 0x0f;
+            out[y*Size.x() + x] = {
+                UnsignedByte(x + noise),
+                UnsignedByte(y + noise),
+                UnsignedByte((x + y)/2),
+                UnsignedByte(255 - x)};
+        }
+    }
+    return out;
+}
+
+void BlockCompressionBenchmark::bc1() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Color4ub> pixels = pattern();
+    const ImageView2D image{PixelFormat::RGBA8Unorm, Size, pixels};
+    Containers::Array<char> out{NoInit, std::size_t(Size.product()/16*8)};
+
+    CORRADE_BENCHMARK(1)
+        compressBlocksInto(image, CompressedPixelFormat::Bc1RGBUnorm, out, data.quality);
+}
+
+void BlockCompressionBenchmark::bc3() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Color4ub> pixels = pattern();
+    const ImageView2D image{PixelFormat::RGBA8Unorm, Size, pixels};
+    Containers::Array<char> out{NoInit, std::size_t(Size.product()/16*16)};
+
+    CORRADE_BENCHMARK(1)
+        compressBlocksInto(image, CompressedPixelFormat::Bc3RGBAUnorm, out, data.quality);
+}
+
+void BlockCompressionBenchmark::bc4() {
+    Containers::Array<Color4ub> pixels = pattern();
+    const ImageView2D image{PixelFormat::RGBA8Unorm, Size, pixels};
+    Containers::Array<char> out{NoInit, std::size_t(Size.product()/16*8)};
+
+    CORRADE_BENCHMARK(1)
+        compressBlocksInto(image, CompressedPixelFormat::Bc4RUnorm, out);
+}
+
+void BlockCompressionBenchmark::bc5() {
+    Containers::Array<Color4ub> pixels = pattern();
+    const ImageView2D image{PixelFormat::RGBA8Unorm, Size, pixels};
+    Containers::Array<char> out{NoInit, std::size_t(Size.product()/16*16)};
+
+    CORRADE_BENCHMARK(1)
+        compressBlocksInto(image, CompressedPixelFormat::Bc5RGUnorm, out);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::BlockCompressionBenchmark)
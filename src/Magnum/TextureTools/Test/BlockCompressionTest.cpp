@@ -0,0 +1,373 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct BlockCompressionTest: TestSuite::Tester {
+    explicit BlockCompressionTest();
+
+    void debugQuality();
+
+    void bc1Uniform();
+    void bc1Gradient();
+    void bc1PunchThroughAlpha();
+    void bc3();
+    void bc4TwoValues();
+    void bc4Uniform();
+    void bc5();
+    void edgeReplication();
+    void into();
+    void empty();
+
+    void unsupportedInputFormat();
+    void unsupportedOutputFormat();
+    void intoWrongSize();
+};
+
+const struct {
+    const char* name;
+    BlockCompressionQuality quality;
+} QualityData[]{
+    {"fast", BlockCompressionQuality::Fast},
+    {"normal", BlockCompressionQuality::Normal},
+    {"high", BlockCompressionQuality::High},
+};
+
+BlockCompressionTest::BlockCompressionTest() {
+    addTests({&BlockCompressionTest::debugQuality});
+
+    addInstancedTests({&BlockCompressionTest::bc1Uniform,
+                       &BlockCompressionTest::bc1Gradient,
+                       &BlockCompressionTest::bc1PunchThroughAlpha,
+                       &BlockCompressionTest::bc3},
+        Containers::arraySize(QualityData));
+
+    addTests({&BlockCompressionTest::bc4TwoValues,
+              &BlockCompressionTest::bc4Uniform,
+              &BlockCompressionTest::bc5,
+              &BlockCompressionTest::edgeReplication,
+              &BlockCompressionTest::into,
+              &BlockCompressionTest::empty,
+
+              &BlockCompressionTest::unsupportedInputFormat,
+              &BlockCompressionTest::unsupportedOutputFormat,
+              &BlockCompressionTest::intoWrongSize});
+}
+
+/* Minimal reference decoders, following the spec to the letter */
+Vector3i decodeRgb565(UnsignedShort packed) {
+    const Int r = (packed >> 11) & 0x1f;
+    const Int g = (packed >> 5) & 0x3f;
+    const Int b = packed & 0x1f;
+    return {(r << 3)|(r >> 2), (g << 2)|(g >> 4), (b << 3)|(b >> 2)};
+}
+
+void decodeBc1(const char* data, Color4ub(&out)[16]) {
+    const UnsignedShort c0 = UnsignedByte(data[0]) | UnsignedByte(data[1]) << 8;
+    const UnsignedShort c1 = UnsignedByte(data[2]) | UnsignedByte(data[3]) << 8;
+    const UnsignedInt indices = UnsignedInt(UnsignedByte(data[4])) |
+        UnsignedInt(UnsignedByte(data[5])) << 8 |
+        UnsignedInt(UnsignedByte(data[6])) << 16 |
+        UnsignedInt(UnsignedByte(data[7])) << 24;
+    const Vector3i e0 = decodeRgb565(c0);
+    const Vector3i e1 = decodeRgb565(c1);
+    Color4ub palette[4];
+    palette[0] = {Color3ub{e0}, 255};
+    palette[1] = {Color3ub{e1}, 255};
+    if(c0 > c1) {
+        palette[2] = {Color3ub{(e0*2 + e1)/3}, 255};
+        palette[3] = {Color3ub{(e0 + e1*2)/3}, 255};
+    } else {
+        palette[2] = {Color3ub{(e0 + e1)/2}, 255};
+        palette[3] = {0, 0, 0, 0};
+    }
+    for(std::size_t i = 0; i != 16; ++i)
+        out[i] = palette[(indices >> (2*i)) & 3];
+}
+
+void decodeBc4(const char* data, UnsignedByte(&out)[16]) {
+    const Int a0 = UnsignedByte(data[0]);
+    const Int a1 = UnsignedByte(data[1]);
+    UnsignedLong indices = 0;
+    for(std::size_t i = 0; i != 6; ++i)
+        indices |= UnsignedLong(UnsignedByte(data[2 + i])) << (8*i);
+    Int palette[8]{a0, a1};
+    if(a0 > a1) for(Int i = 2; i != 8; ++i)
+        palette[i] = ((8 - i)*a0 + (i - 1)*a1)/7;
+    else {
+        for(Int i = 2; i != 6; ++i)
+            palette[i] = ((6 - i)*a0 + (i - 1)*a1)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+    for(std::size_t i = 0; i != 16; ++i)
+        out[i] = palette[(indices >> (3*i)) & 7];
+}
+
+void BlockCompressionTest::debugQuality() {
+    std::ostringstream out;
+    Debug{&out} << BlockCompressionQuality::High << BlockCompressionQuality(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::BlockCompressionQuality::High TextureTools::BlockCompressionQuality(0xde)\n");
+}
+
+void BlockCompressionTest::bc1Uniform() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A color that's exactly representable in 565 */
+    Color3ub pixels[16];
+    for(Color3ub& i: pixels) i = {0x84, 0x41, 0xff};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc1RGBUnorm, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 4}));
+    CORRADE_COMPARE(out.data().size(), 8);
+
+    Color4ub decoded[16];
+    decodeBc1(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[i], (Color4ub{0x84, 0x41, 0xff, 0xff}));
+    }
+}
+
+void BlockCompressionTest::bc1Gradient() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A diagonal gradient with anti-correlated red and green, which lies on
+       a line in the color space and thus should be representable with an
+       error of at most half the palette spacing (144/3/2 for red) plus
+       quantization in all modes */
+    Color4ub pixels[16];
+    for(std::size_t y = 0; y != 4; ++y)
+        for(std::size_t x = 0; x != 4; ++x)
+            pixels[y*4 + x] = {UnsignedByte(32 + (x + y)*24), UnsignedByte(200 - (x + y)*16), 64, 255};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc1RGBUnorm, data.quality);
+
+    Color4ub decoded[16];
+    decodeBc1(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        const Vector3i delta = Math::abs(Vector3i{decoded[i].rgb()} - Vector3i{pixels[i].rgb()});
+        CORRADE_COMPARE_AS(delta.max(), 28, TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BlockCompressionTest::bc1PunchThroughAlpha() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub pixels[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        pixels[i] = {0xff, 0x00, 0x00, UnsignedByte(i % 3 ? 0xff : 0x20)};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc1RGBAUnorm, data.quality);
+
+    Color4ub decoded[16];
+    decodeBc1(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        if(i % 3) CORRADE_COMPARE(decoded[i], (Color4ub{0xff, 0x00, 0x00, 0xff}));
+        else CORRADE_COMPARE(decoded[i].a(), 0);
+    }
+
+    /* Without alpha the block is fully opaque */
+    CompressedImage2D opaque = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc1RGBUnorm, data.quality);
+    decodeBc1(opaque.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[i], (Color4ub{0xff, 0x00, 0x00, 0xff}));
+    }
+}
+
+void BlockCompressionTest::bc3() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub pixels[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        pixels[i] = {0x00, 0xff, 0x00, UnsignedByte(i < 8 ? 0x10 : 0xe0)};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Srgb, {4, 4}, pixels}, CompressedPixelFormat::Bc3RGBASrgb, data.quality);
+    CORRADE_COMPARE(out.data().size(), 16);
+
+    UnsignedByte alpha[16];
+    Color4ub color[16];
+    decodeBc4(out.data(), alpha);
+    decodeBc1(out.data() + 8, color);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(alpha[i], pixels[i].a());
+        CORRADE_COMPARE(color[i].rgb(), (Color3ub{0x00, 0xff, 0x00}));
+    }
+}
+
+void BlockCompressionTest::bc4TwoValues() {
+    UnsignedByte pixels[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        pixels[i] = i % 2 ? 17 : 233;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc4RUnorm);
+    CORRADE_COMPARE(out.data().size(), 8);
+    CORRADE_COMPARE(UnsignedByte(out.data()[0]), 233);
+    CORRADE_COMPARE(UnsignedByte(out.data()[1]), 17);
+
+    UnsignedByte decoded[16];
+    decodeBc4(out.data(), decoded);
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc4Uniform() {
+    UnsignedByte pixels[16];
+    for(UnsignedByte& i: pixels) i = 97;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc4RUnorm);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        97, 97, 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc5() {
+    Vector2ub pixels[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        pixels[i] = {UnsignedByte(i*17), UnsignedByte(255 - i*17)};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RG8Unorm, {4, 4}, pixels}, CompressedPixelFormat::Bc5RGUnorm);
+    CORRADE_COMPARE(out.data().size(), 16);
+
+    UnsignedByte red[16], green[16];
+    decodeBc4(out.data(), red);
+    decodeBc4(out.data() + 8, green);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        /* The palette has eight values spaced ~36 apart */
+        CORRADE_COMPARE_AS(Math::abs(Int(red[i]) - Int(pixels[i].x())), 18, TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(Math::abs(Int(green[i]) - Int(pixels[i].y())), 18, TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BlockCompressionTest::edgeReplication() {
+    /* A 5x2 image gives 2x1 blocks, the second block is filled with the last
+       column and both blocks repeat the last row */
+    const UnsignedByte pixels[]{
+        10, 10, 10, 10, 200, 0, 0, 0,
+        10, 10, 10, 10, 200, 0, 0, 0
+    };
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {5, 2}, pixels}, CompressedPixelFormat::Bc4RUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{5, 2}));
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        10, 10, 0, 0, 0, 0, 0, 0,
+        char(200), char(200), 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::into() {
+    Color3ub pixels[8*4];
+    for(std::size_t i = 0; i != 8*4; ++i)
+        pixels[i] = i % 8 < 4 ? Color3ub{0xff, 0x00, 0x00} : Color3ub{0x00, 0x00, 0xff};
+    const ImageView2D image{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {8, 4}, pixels};
+
+    char data[16];
+    compressBlocksInto(image, CompressedPixelFormat::Bc1RGBUnorm, data);
+
+    /* Should be the same as the allocating variant */
+    CompressedImage2D out = compressBlocks(image, CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE_AS(Containers::arrayView(data),
+        out.data(),
+        TestSuite::Compare::Container);
+
+    Color4ub decoded[16];
+    decodeBc1(data + 8, decoded);
+    CORRADE_COMPARE(decoded[5], (Color4ub{0x00, 0x00, 0xff, 0xff}));
+}
+
+void BlockCompressionTest::empty() {
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {0, 4}}, CompressedPixelFormat::Bc3RGBAUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{0, 4}));
+    CORRADE_COMPARE(out.data().size(), 0);
+}
+
+void BlockCompressionTest::unsupportedInputFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[8];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compressBlocks(ImageView2D{PixelFormat::RGBA16Unorm, {4, 4}}, CompressedPixelFormat::Bc1RGBUnorm);
+    compressBlocksInto(ImageView2D{PixelFormat::R32F, {4, 4}}, CompressedPixelFormat::Bc4RUnorm, data);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::compressBlocksInto(): unsupported input format PixelFormat::RGBA16Unorm\n"
+        "TextureTools::compressBlocksInto(): unsupported input format PixelFormat::R32F\n");
+}
+
+void BlockCompressionTest::unsupportedOutputFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[16];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}}, CompressedPixelFormat::Bc7RGBAUnorm);
+    compressBlocksInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}}, CompressedPixelFormat::Etc2RGB8Unorm, data);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::compressBlocks(): unsupported output format CompressedPixelFormat::Bc7RGBAUnorm\n"
+        "TextureTools::compressBlocksInto(): unsupported output format CompressedPixelFormat::Etc2RGB8Unorm\n");
+}
+
+void BlockCompressionTest::intoWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[32];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compressBlocksInto(ImageView2D{PixelFormat::RGBA8Unorm, {5, 4}}, CompressedPixelFormat::Bc3RGBAUnorm, Containers::arrayView(data).exceptSuffix(1));
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::compressBlocksInto(): expected output size to be 32 bytes for {2, 1} blocks but got 31\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::BlockCompressionTest)
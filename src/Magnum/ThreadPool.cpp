@@ -0,0 +1,463 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum {
+
+TaskGraph::TaskGraph() = default;
+
+TaskGraph::TaskGraph(TaskGraph&&) noexcept = default;
+
+TaskGraph::~TaskGraph() = default;
+
+TaskGraph& TaskGraph::operator=(TaskGraph&&) noexcept = default;
+
+UnsignedInt TaskGraph::addTask(const Function function, void* const state, const Containers::ArrayView<const UnsignedInt> dependencies) {
+    CORRADE_ASSERT(function,
+        "TaskGraph::addTask(): expected a non-null function", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt dependency: dependencies)
+        CORRADE_ASSERT(dependency < _tasks.size(),
+            "TaskGraph::addTask(): dependency" << dependency << "out of range for" << _tasks.size() << "tasks", {});
+    #endif
+
+    arrayAppend(_tasks, Task{function, state, _dependencies.size(), dependencies.size()});
+    arrayAppend(_dependencies, dependencies);
+    return _tasks.size() - 1;
+}
+
+UnsignedInt TaskGraph::addTask(const Function function, void* const state, const std::initializer_list<UnsignedInt> dependencies) {
+    return addTask(function, state, Containers::arrayView(dependencies));
+}
+
+UnsignedInt TaskGraph::addTask(const Function function, void* const state) {
+    return addTask(function, state, nullptr);
+}
+
+Containers::ArrayView<const UnsignedInt> TaskGraph::taskDependencies(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _tasks.size(),
+        "TaskGraph::taskDependencies(): index" << id << "out of range for" << _tasks.size() << "tasks", {});
+    return _dependencies.sliceSize(_tasks[id].dependencyOffset, _tasks[id].dependencyCount);
+}
+
+void TaskGraph::clear() {
+    arrayClear(_tasks);
+    arrayClear(_dependencies);
+}
+
+namespace Implementation {
+
+struct ThreadPoolJob {
+    ThreadPool::JobFunction function;
+    void* state;
+    std::size_t id;
+};
+
+struct ThreadPoolQueue {
+    std::mutex mutex;
+    std::deque<ThreadPoolJob> jobs;
+};
+
+/* Not directly ThreadPool::State as it's private and thus couldn't be
+   referenced from the thread-local variables below */
+struct ThreadPoolState {
+    explicit ThreadPoolState(UnsignedInt workerCount);
+    ~ThreadPoolState();
+
+    /* Pushes a job to the queue of the current worker or to the shared
+       queue if called from a thread not belonging to this pool, doesn't wake
+       anybody up */
+    void push(const ThreadPoolJob& job);
+    /* Wakes up sleeping workers after jobs were pushed */
+    void notify();
+    /* Executes a single job, taking it from the back of the current queue or
+       stealing from the front of the others. Returns false if there was
+       nothing to execute. */
+    bool executeOne();
+    /* Executes jobs until the counter reaches zero */
+    void wait(const std::atomic<std::size_t>& remaining);
+
+    void workerLoop(std::size_t id);
+
+    /* One queue per worker, the last one is for threads outside of the
+       pool */
+    Containers::Array<ThreadPoolQueue> queues;
+    Containers::Array<std::thread> workers;
+
+    std::atomic<std::size_t> queuedJobCount{};
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool stop = false;
+
+    ThreadPool::DispatchCallback dispatchCallback{};
+    void* dispatchCallbackUserData{};
+};
+
+namespace {
+
+/* Pool and queue the current thread is a worker of, if any */
+CORRADE_THREAD_LOCAL ThreadPoolState* currentPool{};
+CORRADE_THREAD_LOCAL std::size_t currentQueue{};
+
+}
+
+ThreadPoolState::ThreadPoolState(const UnsignedInt workerCount): queues{ValueInit, std::size_t(workerCount) + 1}, workers{ValueInit, workerCount} {
+    for(std::size_t i = 0; i != workers.size(); ++i)
+        workers[i] = std::thread{&ThreadPoolState::workerLoop, this, i};
+}
+
+ThreadPoolState::~ThreadPoolState() {
+    {
+        std::lock_guard<std::mutex> lock{wakeMutex};
+        stop = true;
+    }
+    wake.notify_all();
+    for(std::thread& worker: workers) worker.join();
+}
+
+void ThreadPoolState::push(const ThreadPoolJob& job) {
+    const std::size_t id = currentPool == this ? currentQueue : workers.size();
+    {
+        std::lock_guard<std::mutex> lock{queues[id].mutex};
+        queues[id].jobs.push_back(job);
+    }
+    queuedJobCount.fetch_add(1, std::memory_order_release);
+}
+
+void ThreadPoolState::notify() {
+    /* Lock the mutex so a worker that just found the queues empty doesn't
+       miss the notification before it starts waiting */
+    {
+        std::lock_guard<std::mutex> lock{wakeMutex};
+    }
+    wake.notify_all();
+}
+
+bool ThreadPoolState::executeOne() {
+    const std::size_t id = currentPool == this ? currentQueue : workers.size();
+    ThreadPoolJob job;
+    bool found = false;
+
+    /* Own queue first, newest jobs first as they're most likely to still
+       have their data in cache */
+    {
+        ThreadPoolQueue& queue = queues[id];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if(!queue.jobs.empty()) {
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+            found = true;
+        }
+    }
+
+    /* Then steal the oldest jobs from the others, starting at the next
+       queue so the workers don't all go for the same victim */
+    for(std::size_t i = 1; !found && i != queues.size(); ++i) {
+        ThreadPoolQueue& queue = queues[(id + i) % queues.size()];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if(!queue.jobs.empty()) {
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if(!found) return false;
+
+    queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+    job.function(job.state, job.id);
+    return true;
+}
+
+void ThreadPoolState::wait(const std::atomic<std::size_t>& remaining) {
+    /* Help with the work instead of just waiting. The jobs we're waiting for
+       may be already running on other threads, in which case there's
+       nothing to do but yield. */
+    while(remaining.load(std::memory_order_acquire))
+        if(!executeOne()) std::this_thread::yield();
+}
+
+void ThreadPoolState::workerLoop(const std::size_t id) {
+    currentPool = this;
+    currentQueue = id;
+
+    for(;;) {
+        if(executeOne()) continue;
+
+        std::unique_lock<std::mutex> lock{wakeMutex};
+        wake.wait(lock, [&]{
+            return stop || queuedJobCount.load(std::memory_order_acquire);
+        });
+        if(stop && !queuedJobCount.load(std::memory_order_acquire)) return;
+    }
+}
+
+}
+
+struct ThreadPool::State: Implementation::ThreadPoolState {
+    using ThreadPoolState::ThreadPoolState;
+};
+
+namespace {
+
+ThreadPool* globalPool{};
+
+}
+
+UnsignedInt ThreadPool::hardwareThreadCount() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* The function is allowed to return 0 if the value is not computable */
+    return Math::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    return 1;
+    #endif
+}
+
+ThreadPool& ThreadPool::global() {
+    if(globalPool) return *globalPool;
+
+    static ThreadPool builtin{0};
+    return builtin;
+}
+
+void ThreadPool::setGlobal(ThreadPool* const pool) {
+    globalPool = pool;
+}
+
+ThreadPool::ThreadPool(const UnsignedInt workerCount):
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _state{InPlaceInit, workerCount}
+    #else
+    /* Threads aren't available on Emscripten, everything is executed on the
+       calling thread there */
+    _state{InPlaceInit, 0u}
+    #endif
+{
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    static_cast<void>(workerCount);
+    #endif
+}
+
+ThreadPool::ThreadPool(ThreadPool&&) noexcept = default;
+
+ThreadPool::~ThreadPool() = default;
+
+ThreadPool& ThreadPool::operator=(ThreadPool&&) noexcept = default;
+
+UnsignedInt ThreadPool::workerCount() const {
+    return _state->workers.size();
+}
+
+UnsignedInt ThreadPool::concurrency() const {
+    return _state->dispatchCallback ? 0 : _state->workers.size() + 1;
+}
+
+ThreadPool::DispatchCallback ThreadPool::dispatchCallback() const {
+    return _state->dispatchCallback;
+}
+
+void* ThreadPool::dispatchCallbackUserData() const {
+    return _state->dispatchCallbackUserData;
+}
+
+ThreadPool& ThreadPool::setDispatchCallback(const DispatchCallback callback, void* const userData) {
+    _state->dispatchCallback = callback;
+    _state->dispatchCallbackUserData = userData;
+    return *this;
+}
+
+namespace {
+
+struct ParallelFor {
+    ThreadPool::RangeFunction function;
+    void* state;
+    std::size_t count;
+    std::size_t grainSize;
+    std::atomic<std::size_t> remaining;
+};
+
+void parallelForJob(void* const state, const std::size_t id) {
+    ParallelFor& data = *static_cast<ParallelFor*>(state);
+    const std::size_t begin = id*data.grainSize;
+    data.function(data.state, begin, Math::min(begin + data.grainSize, data.count));
+    data.remaining.fetch_sub(1, std::memory_order_release);
+}
+
+}
+
+void ThreadPool::parallelFor(const std::size_t count, const std::size_t grainSize, const RangeFunction function, void* const state) {
+    CORRADE_ASSERT(grainSize,
+        "ThreadPool::parallelFor(): expected a non-zero grain size", );
+    CORRADE_ASSERT(function,
+        "ThreadPool::parallelFor(): expected a non-null function", );
+
+    const std::size_t chunkCount = (count + grainSize - 1)/grainSize;
+    if(chunkCount <= 1) {
+        if(count) function(state, 0, count);
+        return;
+    }
+
+    ParallelFor data{function, state, count, grainSize, {chunkCount}};
+
+    if(_state->dispatchCallback) {
+        _state->dispatchCallback(chunkCount, parallelForJob, &data, _state->dispatchCallbackUserData);
+        CORRADE_INTERNAL_ASSERT(!data.remaining);
+        return;
+    }
+
+    /* No workers, execute everything in order on the calling thread */
+    if(_state->workers.isEmpty()) {
+        for(std::size_t i = 0; i != chunkCount; ++i)
+            parallelForJob(&data, i);
+        return;
+    }
+
+    /* Push in reverse so the calling thread, which takes jobs from the back
+       of its queue, starts with the first chunk */
+    for(std::size_t i = chunkCount; i != 0; --i)
+        _state->push({parallelForJob, &data, i - 1});
+    _state->notify();
+    _state->wait(data.remaining);
+}
+
+namespace {
+
+struct TaskGraphRun {
+    Implementation::ThreadPoolState& pool;
+    const TaskGraph& graph;
+    ThreadPool::JobFunction job;
+    /* Dependents of each task, in a CSR layout */
+    Containers::Array<std::size_t> dependentOffsets;
+    Containers::Array<UnsignedInt> dependents;
+    Containers::Array<std::atomic<UnsignedInt>> pendingDependencyCounts;
+    std::atomic<std::size_t> remaining;
+};
+
+}
+
+void ThreadPool::run(const TaskGraph& graph) {
+    const std::size_t taskCount = graph._tasks.size();
+    if(!taskCount) return;
+
+    /* No workers and no dispatch callback, the order in which the tasks were
+       added is a valid execution order */
+    if(!_state->dispatchCallback && _state->workers.isEmpty()) {
+        for(const TaskGraph::Task& task: graph._tasks)
+            task.function(task.state);
+        return;
+    }
+
+    /* With a dispatch callback, dispatch the tasks in batches where each
+       batch contains tasks whose dependencies are all in earlier batches */
+    if(_state->dispatchCallback) {
+        Containers::Array<UnsignedInt> levels{ValueInit, taskCount};
+        UnsignedInt levelCount = 0;
+        for(std::size_t i = 0; i != taskCount; ++i) {
+            for(const UnsignedInt dependency: graph.taskDependencies(i))
+                levels[i] = Math::max(levels[i], levels[dependency] + 1);
+            levelCount = Math::max(levelCount, levels[i] + 1);
+        }
+
+        struct Batch {
+            const TaskGraph& graph;
+            Containers::Array<UnsignedInt> tasks;
+        } batch{graph, {}};
+        arrayReserve(batch.tasks, taskCount);
+        for(UnsignedInt level = 0; level != levelCount; ++level) {
+            arrayClear(batch.tasks);
+            for(std::size_t i = 0; i != taskCount; ++i)
+                if(levels[i] == level) arrayAppend(batch.tasks, UnsignedInt(i));
+            _state->dispatchCallback(batch.tasks.size(), [](void* state, std::size_t id) {
+                const Batch& batch = *static_cast<const Batch*>(state);
+                const TaskGraph::Task& task = batch.graph._tasks[batch.tasks[id]];
+                task.function(task.state);
+            }, &batch, _state->dispatchCallbackUserData);
+        }
+        return;
+    }
+
+    /* Otherwise each finished task schedules the dependents that have no
+       more pending dependencies */
+    TaskGraphRun data{*_state, graph, nullptr,
+        Containers::Array<std::size_t>{ValueInit, taskCount + 1},
+        Containers::Array<UnsignedInt>{NoInit, graph._dependencies.size()},
+        Containers::Array<std::atomic<UnsignedInt>>{ValueInit, taskCount},
+        {taskCount}};
+    for(const UnsignedInt dependency: graph._dependencies)
+        ++data.dependentOffsets[dependency + 1];
+    for(std::size_t i = 0; i != taskCount; ++i)
+        data.dependentOffsets[i + 1] += data.dependentOffsets[i];
+    {
+        Containers::Array<std::size_t> fill{NoInit, taskCount};
+        for(std::size_t i = 0; i != taskCount; ++i)
+            fill[i] = data.dependentOffsets[i];
+        for(std::size_t i = 0; i != taskCount; ++i) {
+            const TaskGraph::Task& task = graph._tasks[i];
+            data.pendingDependencyCounts[i].store(task.dependencyCount, std::memory_order_relaxed);
+            for(const UnsignedInt dependency: graph.taskDependencies(i))
+                data.dependents[fill[dependency]++] = i;
+        }
+    }
+
+    data.job = [](void* state, std::size_t id) {
+        TaskGraphRun& data = *static_cast<TaskGraphRun*>(state);
+        const TaskGraph::Task& task = data.graph._tasks[id];
+        task.function(task.state);
+
+        bool pushed = false;
+        for(std::size_t i = data.dependentOffsets[id], end = data.dependentOffsets[id + 1]; i != end; ++i) {
+            const UnsignedInt dependent = data.dependents[i];
+            if(data.pendingDependencyCounts[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                data.pool.push({data.job, state, dependent});
+                pushed = true;
+            }
+        }
+        if(pushed) data.pool.notify();
+
+        data.remaining.fetch_sub(1, std::memory_order_release);
+    };
+
+    /* Push the tasks without dependencies in reverse, for the same reason as
+       in parallelFor() */
+    for(std::size_t i = taskCount; i != 0; --i)
+        if(!graph._tasks[i - 1].dependencyCount)
+            _state->push({data.job, &data, i - 1});
+    _state->notify();
+    _state->wait(data.remaining);
+}
+
+}
@@ -0,0 +1,342 @@
+#ifndef Magnum_ThreadPool_h
+#define Magnum_ThreadPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ThreadPool, @ref Magnum::TaskGraph
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <type_traits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Task graph
+@m_since_latest
+
+A list of tasks with dependencies, executed with @ref ThreadPool::run(). Each
+task is a function pointer together with a state pointer that's passed to
+it. A task can depend only on tasks added before it, which means the graph
+is acyclic by construction and the order in which the tasks were added is
+always a valid order of execution.
+
+@snippet Magnum.cpp TaskGraph
+
+The graph only references the state pointers, it's the caller
+responsibility to keep them alive until @ref ThreadPool::run() returns. The
+same graph can be run any number of times.
+*/
+class MAGNUM_EXPORT TaskGraph {
+    public:
+        /**
+         * @brief Task function
+         *
+         * Receives the state pointer passed to @ref addTask().
+         */
+        typedef void(*Function)(void* state);
+
+        /** @brief Constructor */
+        explicit TaskGraph();
+
+        /** @brief Copying is not allowed */
+        TaskGraph(const TaskGraph&) = delete;
+
+        /** @brief Move constructor */
+        TaskGraph(TaskGraph&&) noexcept;
+
+        ~TaskGraph();
+
+        /** @brief Copying is not allowed */
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /** @brief Move assignment */
+        TaskGraph& operator=(TaskGraph&&) noexcept;
+
+        /** @brief Task count */
+        std::size_t taskCount() const { return _tasks.size(); }
+
+        /**
+         * @brief Add a task
+         * @param function      Task function
+         * @param state         State passed to @p function
+         * @param dependencies  IDs of tasks that have to finish before this
+         *      one is started
+         * @return ID of the added task
+         *
+         * The @p function is expected to not be @cpp nullptr @ce and all
+         * @p dependencies are expected to be less than @ref taskCount().
+         */
+        UnsignedInt addTask(Function function, void* state, Containers::ArrayView<const UnsignedInt> dependencies);
+
+        /** @overload */
+        UnsignedInt addTask(Function function, void* state, std::initializer_list<UnsignedInt> dependencies);
+
+        /** @overload */
+        UnsignedInt addTask(Function function, void* state = nullptr);
+
+        /**
+         * @brief Task dependencies
+         *
+         * The @p id is expected to be less than @ref taskCount().
+         */
+        Containers::ArrayView<const UnsignedInt> taskDependencies(UnsignedInt id) const;
+
+        /** @brief Remove all tasks */
+        void clear();
+
+    private:
+        friend ThreadPool;
+
+        struct Task {
+            Function function;
+            void* state;
+            std::size_t dependencyOffset;
+            std::size_t dependencyCount;
+        };
+
+        Containers::Array<Task> _tasks;
+        Containers::Array<UnsignedInt> _dependencies;
+};
+
+/**
+@brief Work-stealing thread pool
+@m_since_latest
+
+Runs @ref parallelFor() loops over index ranges and @ref TaskGraph instances
+on a fixed set of worker threads. Each worker has its own job queue, takes
+jobs from its back and when it runs out of them, steals jobs from the front
+of other queues. The thread calling @ref parallelFor() or @ref run() takes
+part in the work as well until all jobs are finished, so it's possible to
+call @ref parallelFor() from within jobs already running on the same pool
+without deadlocking.
+
+@snippet Magnum.cpp ThreadPool
+
+@section ThreadPool-single-threaded Single-threaded execution
+
+If the pool is constructed with zero worker threads, no threads are created
+and everything is executed on the calling thread, in order. That's useful
+for deterministic runs, debugging or on platforms without threading
+support. The @ref global() pool used by Magnum libraries has zero workers
+by default, so Magnum doesn't spawn any threads unless the application opts
+in by calling @ref setGlobal():
+
+@snippet Magnum.cpp ThreadPool-global
+
+@section ThreadPool-dispatch Integrating with a custom job system
+
+Applications that already have a job system can route all work through it
+by setting a @ref setDispatchCallback() "dispatch callback". The callback
+receives a job count and a job function and is expected to call the job
+function for all indices in given range, in any order and on any thread,
+and return only after all of them have finished. The pool worker threads
+are then not used at all, so such pool is usually constructed with zero
+workers:
+
+@snippet Magnum.cpp ThreadPool-dispatch
+
+@section ThreadPool-determinism Determinism
+
+@ref parallelFor() always splits the range into the same chunks regardless
+of the worker count or the dispatch callback, so operations that produce a
+separate result for each chunk and combine them in a fixed order are
+deterministic. Only the order in which the chunks are executed differs.
+*/
+class MAGNUM_EXPORT ThreadPool {
+    public:
+        /**
+         * @brief Range function
+         *
+         * Receives the state pointer passed to @ref parallelFor() and a
+         * range of indices to process.
+         */
+        typedef void(*RangeFunction)(void* state, std::size_t begin, std::size_t end);
+
+        /**
+         * @brief Job function
+         *
+         * Passed to a @ref DispatchCallback, receives the job state and the
+         * index of the job to execute.
+         */
+        typedef void(*JobFunction)(void* state, std::size_t id);
+
+        /**
+         * @brief Dispatch callback
+         *
+         * Expected to call @p job with @p jobState and each index in range
+         * @f$ [0, jobCount) @f$ exactly once, and return after all calls
+         * have finished.
+         * @see @ref setDispatchCallback()
+         */
+        typedef void(*DispatchCallback)(std::size_t jobCount, JobFunction job, void* jobState, void* userData);
+
+        /**
+         * @brief Hardware thread count
+         *
+         * Count of threads that can run concurrently, including the calling
+         * thread. Never less than @cpp 1 @ce, always @cpp 1 @ce on
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        static UnsignedInt hardwareThreadCount();
+
+        /**
+         * @brief Global thread pool
+         *
+         * Used by Magnum libraries that can process data in parallel. Unless
+         * a different pool is set with @ref setGlobal(), returns a pool with
+         * zero worker threads.
+         */
+        static ThreadPool& global();
+
+        /**
+         * @brief Set the global thread pool
+         *
+         * The @p pool is expected to stay alive until a different pool is
+         * set. Passing @cpp nullptr @ce resets back to the builtin
+         * single-threaded pool. Not thread-safe, expected to be called when
+         * no other thread is using the global pool.
+         */
+        static void setGlobal(ThreadPool* pool);
+
+        /**
+         * @brief Constructor
+         * @param workerCount   Count of worker threads, not counting the
+         *      calling thread
+         *
+         * If @p workerCount is @cpp 0 @ce, no threads are created and
+         * everything is executed on the calling thread. Use
+         * @cpp hardwareThreadCount() - 1 @ce to fully utilize the machine.
+         * On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the @p workerCount
+         * is ignored and no threads are ever created.
+         */
+        explicit ThreadPool(UnsignedInt workerCount);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Move constructor */
+        ThreadPool(ThreadPool&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for the worker threads to finish. Expects that no
+         * @ref parallelFor() or @ref run() is in progress.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Move assignment */
+        ThreadPool& operator=(ThreadPool&&) noexcept;
+
+        /** @brief Worker thread count */
+        UnsignedInt workerCount() const;
+
+        /**
+         * @brief Max count of threads executing jobs at the same time
+         *
+         * The @ref workerCount() plus one for the calling thread. If a
+         * dispatch callback is set, returns @cpp 0 @ce as the concurrency
+         * is controlled by the external job system.
+         */
+        UnsignedInt concurrency() const;
+
+        /** @brief Dispatch callback */
+        DispatchCallback dispatchCallback() const;
+
+        /** @brief Dispatch callback user data */
+        void* dispatchCallbackUserData() const;
+
+        /**
+         * @brief Set a dispatch callback
+         * @return Reference to self (for method chaining)
+         *
+         * If set to a non-null function, all @ref parallelFor() and
+         * @ref run() calls are routed through it instead of the worker
+         * threads. See @ref ThreadPool-dispatch for more information.
+         */
+        ThreadPool& setDispatchCallback(DispatchCallback callback, void* userData = nullptr);
+
+        /**
+         * @brief Run a function over an index range in parallel
+         * @param count         Index count
+         * @param grainSize     Max count of indices processed in a single
+         *      call to @p function. Expected to be non-zero.
+         * @param function      Function to call
+         * @param state         State passed to @p function
+         *
+         * Splits the @f$ [0, count) @f$ range into consecutive chunks of
+         * @p grainSize indices, with the last one possibly smaller, and
+         * calls @p function for each of them. Returns after all chunks are
+         * processed. If there's just one chunk, the @p function is called
+         * directly on the calling thread, if @p count is zero, it's not
+         * called at all.
+         */
+        void parallelFor(std::size_t count, std::size_t grainSize, RangeFunction function, void* state);
+
+        /**
+         * @brief Run a functor over an index range in parallel
+         *
+         * Calls @p function with the @cpp begin @ce and @cpp end @ce indices
+         * of each chunk. See @ref parallelFor(std::size_t, std::size_t, RangeFunction, void*)
+         * for more information.
+         */
+        template<class F> void parallelFor(std::size_t count, std::size_t grainSize, F&& function) {
+            typedef typename std::remove_reference<F>::type Functor;
+            parallelFor(count, grainSize, [](void* state, std::size_t begin, std::size_t end) {
+                (*static_cast<Functor*>(state))(begin, end);
+            }, const_cast<void*>(static_cast<const void*>(&function)));
+        }
+
+        /**
+         * @brief Run a task graph
+         *
+         * Executes all tasks in @p graph, each after all its dependencies
+         * finished, and returns after all tasks are done. With zero worker
+         * threads and no dispatch callback the tasks are executed in the
+         * order they were added. With a dispatch callback the tasks are
+         * dispatched in batches of tasks that have all their dependencies
+         * satisfied.
+         */
+        void run(const TaskGraph& graph);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}
+
+#endif
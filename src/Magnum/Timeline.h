@@ -72,6 +72,9 @@ be used together with @ref Animation::Player for a more controlled behavior. In
 that case, it's recommended to never call @ref Timeline::stop() but control the
 player start/pause/stop state instead. See @ref Animation::Player documentation
 for more information.
+
+For advancing simulations in fixed time steps independently of the framerate
+use @ref TimestepScheduler instead.
 */
 class MAGNUM_EXPORT Timeline {
     public:
@@ -0,0 +1,165 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TimestepScheduler.h"
+
+#include <chrono>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum {
+
+namespace {
+
+Nanoseconds now() {
+    return Nanoseconds{Long(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())};
+}
+
+}
+
+TimestepScheduler::TimestepScheduler() = default;
+
+UnsignedInt TimestepScheduler::addRate(const Nanoseconds period, const UnsignedInt maxStepCount) {
+    CORRADE_ASSERT(period > Nanoseconds{0},
+        "TimestepScheduler::addRate(): expected a positive period, got" << period, {});
+    CORRADE_ASSERT(maxStepCount,
+        "TimestepScheduler::addRate(): expected a non-zero max step count", {});
+    arrayAppend(_rates, Rate{period, maxStepCount, 0, {}, {}, 0, 0});
+    return UnsignedInt(_rates.size() - 1);
+}
+
+Nanoseconds TimestepScheduler::period(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::period(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    return _rates[id].period;
+}
+
+UnsignedInt TimestepScheduler::maxStepCount(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::maxStepCount(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    return _rates[id].maxStepCount;
+}
+
+void TimestepScheduler::start() {
+    reset();
+    _running = true;
+    _previousFrameTime = now();
+}
+
+void TimestepScheduler::stop() {
+    reset();
+    _running = false;
+    _previousFrameTime = Nanoseconds{0};
+}
+
+void TimestepScheduler::reset() {
+    _time = Nanoseconds{0};
+    _frameDuration = Nanoseconds{0};
+    _frameJitter = Nanoseconds{0};
+    _frameCount = 0;
+    for(Rate& rate: _rates) {
+        rate.stepCount = 0;
+        rate.accumulated = Nanoseconds{0};
+        rate.dropped = Nanoseconds{0};
+        rate.totalStepCount = 0;
+        rate.overrunCount = 0;
+    }
+}
+
+void TimestepScheduler::nextFrame() {
+    if(!_running) return;
+
+    const Nanoseconds time = now();
+    /* The clock is monotonic, so this should never be negative */
+    advance(time - _previousFrameTime);
+    _previousFrameTime = time;
+}
+
+void TimestepScheduler::advance(const Nanoseconds duration) {
+    CORRADE_ASSERT(duration >= Nanoseconds{0},
+        "TimestepScheduler::advance(): expected a non-negative duration, got" << duration, );
+
+    /* Jitter is calculated only once there are two frames to compare */
+    if(_frameCount) _frameJitter = duration > _frameDuration ?
+        duration - _frameDuration : _frameDuration - duration;
+    _frameDuration = duration;
+    _time += duration;
+    ++_frameCount;
+
+    for(Rate& rate: _rates) {
+        rate.accumulated += duration;
+        const Long period = Long(rate.period);
+        const Long stepCount = Long(rate.accumulated)/period;
+
+        /* If more steps would be needed than allowed, perform just the max
+           count and drop the rest to avoid a spiral of death. The fractional
+           part of a step is kept so the phase relative to other rates isn't
+           disturbed. */
+        if(stepCount > Long(rate.maxStepCount)) {
+            rate.stepCount = rate.maxStepCount;
+            rate.dropped = rate.period*(stepCount - rate.maxStepCount);
+            ++rate.overrunCount;
+        } else {
+            rate.stepCount = UnsignedInt(stepCount);
+            rate.dropped = Nanoseconds{0};
+        }
+
+        rate.accumulated -= rate.period*stepCount;
+        rate.totalStepCount += rate.stepCount;
+    }
+}
+
+UnsignedInt TimestepScheduler::stepCount(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::stepCount(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    return _rates[id].stepCount;
+}
+
+UnsignedLong TimestepScheduler::totalStepCount(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::totalStepCount(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    return _rates[id].totalStepCount;
+}
+
+Float TimestepScheduler::alpha(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::alpha(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    const Rate& rate = _rates[id];
+    return Float(Double(Long(rate.accumulated))/Double(Long(rate.period)));
+}
+
+Nanoseconds TimestepScheduler::droppedDuration(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::droppedDuration(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    return _rates[id].dropped;
+}
+
+UnsignedLong TimestepScheduler::overrunCount(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _rates.size(),
+        "TimestepScheduler::overrunCount(): index" << id << "out of range for" << _rates.size() << "rates", {});
+    return _rates[id].overrunCount;
+}
+
+}
@@ -0,0 +1,292 @@
+#ifndef Magnum_TimestepScheduler_h
+#define Magnum_TimestepScheduler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TimestepScheduler
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Time.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Fixed-timestep scheduler
+@m_since_latest
+
+Complements @ref Timeline for simulations that need to be advanced in fixed
+time steps independently of the rendering framerate. Each subsystem registers
+its own rate using @ref addRate() and then, every frame, performs as many
+steps as @ref stepCount() says, and renders its state interpolated with
+@ref alpha(). Time is measured with a monotonic clock in @ref Nanoseconds,
+so unlike with @ref Timeline there's no precision loss over long running
+times and no accumulated rounding error.
+
+@section TimestepScheduler-usage Basic usage
+
+Register all rates on initialization and call @ref start() right before the
+first frame, similarly to @ref Timeline::start(). Then call @ref nextFrame()
+at the beginning of each frame and step each subsystem by the reported count:
+
+@snippet Magnum.cpp TimestepScheduler-usage
+
+Rendering itself isn't a fixed-step rate, it happens once per frame and is
+expected to be governed by VSync or
+@ref Platform::Sdl2Application::setMinimalLoopPeriod() "Platform::*Application::setMinimalLoopPeriod()".
+The @ref alpha() value tells how far between the last two simulation steps
+the current frame is, and can be used to interpolate the rendered state.
+
+@section TimestepScheduler-catch-up Limiting catch-up steps
+
+If a frame takes too long, for example because the application got
+suspended, or because the simulation step itself is too expensive, the
+scheduler would need to perform more and more steps each frame to catch up,
+making the next frame take even longer. To avoid this, each rate has a
+maximum step count per frame, passed to @ref addRate(). If the accumulated
+time would need more steps than that, only the maximum is performed, the
+remaining whole steps are dropped and the rate is considered to overrun in
+given frame. The dropped time is available in @ref droppedDuration() and the
+count of overrun frames in @ref overrunCount().
+
+@section TimestepScheduler-deterministic Deterministic stepping
+
+Instead of measuring frame time with the builtin clock, you can call
+@ref advance() with an externally measured or completely synthetic frame
+duration. That's useful for example for replays, offline rendering or
+testing. The scheduler doesn't need to be started in that case.
+
+@section TimestepScheduler-profiling Statistics and profiling
+
+Apart from per-rate overrun statistics, the scheduler reports duration of the
+last frame in @ref frameDuration() and its difference from the frame before in
+@ref frameJitter(). All of these can be directly plugged into
+@ref DebugTools::FrameProfiler as custom measurements:
+
+@snippet DebugTools.cpp TimestepScheduler-profiling
+
+@see @ref Animation::Player
+*/
+class MAGNUM_EXPORT TimestepScheduler {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates a stopped scheduler with no rates.
+         * @see @ref start(), @ref addRate()
+         */
+        explicit TimestepScheduler();
+
+        /**
+         * @brief Add a fixed-step rate
+         * @param period        Step period. Expected to be positive.
+         * @param maxStepCount  Max count of steps performed in a single
+         *      frame. Expected to be non-zero.
+         * @return Rate ID, to be used in @ref stepCount(), @ref alpha() and
+         *      other per-rate queries
+         *
+         * The rate starts with no accumulated time, which means that if
+         * it's added in the middle of a run, it isn't synchronized with the
+         * other rates. Use @ref reset() if that's desired.
+         */
+        UnsignedInt addRate(Nanoseconds period, UnsignedInt maxStepCount = 8);
+
+        /** @brief Count of added rates */
+        UnsignedInt rateCount() const { return UnsignedInt(_rates.size()); }
+
+        /**
+         * @brief Rate step period
+         *
+         * The @p id is expected to be less than @ref rateCount().
+         */
+        Nanoseconds period(UnsignedInt id) const;
+
+        /**
+         * @brief Max count of steps performed in a single frame
+         *
+         * The @p id is expected to be less than @ref rateCount().
+         */
+        UnsignedInt maxStepCount(UnsignedInt id) const;
+
+        /**
+         * @brief Start the scheduler
+         *
+         * Calls @ref reset() and starts measuring time for the next
+         * @ref nextFrame() call.
+         * @see @ref stop(), @ref isRunning()
+         */
+        void start();
+
+        /**
+         * @brief Stop the scheduler
+         *
+         * Calls @ref reset(), subsequent @ref nextFrame() calls do nothing.
+         * @see @ref start(), @ref isRunning()
+         */
+        void stop();
+
+        /**
+         * @brief Whether the scheduler is running
+         *
+         * @see @ref start(), @ref stop()
+         */
+        bool isRunning() const { return _running; }
+
+        /**
+         * @brief Reset all accumulated time and statistics
+         *
+         * Resets @ref time(), @ref frameDuration(), @ref frameJitter() and
+         * all per-rate state to zero. Doesn't affect whether the scheduler is
+         * running.
+         */
+        void reset();
+
+        /**
+         * @brief Advance to next frame using the builtin clock
+         *
+         * Measures time elapsed since the previous @ref nextFrame() or
+         * @ref start() call using a monotonic clock and passes it to
+         * @ref advance(). Does nothing if the scheduler is stopped.
+         */
+        void nextFrame();
+
+        /**
+         * @brief Advance to next frame by given duration
+         *
+         * Adds @p duration to the accumulated time of each rate and
+         * calculates @ref stepCount(), @ref alpha() and
+         * @ref droppedDuration() for the new frame. The @p duration is
+         * expected to not be negative. Can be called regardless of whether
+         * the scheduler is running.
+         */
+        void advance(Nanoseconds duration);
+
+        /**
+         * @brief Total advanced time
+         *
+         * Sum of all durations passed to @ref advance(), including the
+         * ones implicitly passed from @ref nextFrame(), since the last
+         * @ref reset().
+         */
+        Nanoseconds time() const { return _time; }
+
+        /**
+         * @brief Duration of the last frame
+         *
+         * Duration passed to the last @ref advance() call.
+         */
+        Nanoseconds frameDuration() const { return _frameDuration; }
+
+        /**
+         * @brief Jitter of the last frame
+         *
+         * Absolute difference between the duration of the last frame and
+         * the frame before. Zero if there was at most one frame since the
+         * last @ref reset().
+         */
+        Nanoseconds frameJitter() const { return _frameJitter; }
+
+        /**
+         * @brief Count of frames
+         *
+         * Count of @ref advance() calls since the last @ref reset().
+         */
+        UnsignedLong frameCount() const { return _frameCount; }
+
+        /**
+         * @brief Count of steps to perform in this frame
+         *
+         * Never larger than @ref maxStepCount(). The @p id is expected to be
+         * less than @ref rateCount().
+         */
+        UnsignedInt stepCount(UnsignedInt id) const;
+
+        /**
+         * @brief Total count of performed steps
+         *
+         * Sum of all @ref stepCount() values since the last @ref reset().
+         * Multiplying it with @ref period() gives the total simulated time.
+         * The @p id is expected to be less than @ref rateCount().
+         */
+        UnsignedLong totalStepCount(UnsignedInt id) const;
+
+        /**
+         * @brief Interpolation factor
+         *
+         * Time accumulated after the last step in this frame divided by
+         * @ref period(), in the @f$ [0, 1) @f$ range. Use it to interpolate
+         * between the previous and current simulation state when rendering.
+         * The @p id is expected to be less than @ref rateCount().
+         */
+        Float alpha(UnsignedInt id) const;
+
+        /**
+         * @brief Duration dropped in this frame
+         *
+         * If more than @ref maxStepCount() steps would need to be performed
+         * in this frame, contains the duration of the steps that were
+         * skipped, otherwise zero. The @p id is expected to be less than
+         * @ref rateCount().
+         * @see @ref overrunCount()
+         */
+        Nanoseconds droppedDuration(UnsignedInt id) const;
+
+        /**
+         * @brief Count of overrun frames
+         *
+         * Count of frames since the last @ref reset() in which
+         * @ref droppedDuration() was non-zero. The @p id is expected to be
+         * less than @ref rateCount().
+         */
+        UnsignedLong overrunCount(UnsignedInt id) const;
+
+    private:
+        struct Rate {
+            Nanoseconds period;
+            UnsignedInt maxStepCount;
+            UnsignedInt stepCount;
+            Nanoseconds accumulated;
+            Nanoseconds dropped;
+            UnsignedLong totalStepCount;
+            UnsignedLong overrunCount;
+        };
+
+        Containers::Array<Rate> _rates;
+        Nanoseconds _previousFrameTime;
+        Nanoseconds _time;
+        Nanoseconds _frameDuration;
+        Nanoseconds _frameJitter;
+        UnsignedLong _frameCount{};
+        bool _running = false;
+};
+
+}
+
+#endif
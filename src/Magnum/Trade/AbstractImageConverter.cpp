@@ -38,6 +38,8 @@
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/PluginStatistics.h"
+#include "Magnum/Trade/Implementation/pluginStatistics.h"
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 #include "Magnum/Trade/configure.h"
@@ -53,6 +55,21 @@ namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
+namespace {
+
+/* Input sizes recorded into PluginStatistics */
+template<class T> std::size_t imageDataSize(const T& image) {
+    return image.data().size();
+}
+
+template<class T> std::size_t imageDataSize(const Containers::ArrayView<const T> imageLevels) {
+    std::size_t size = 0;
+    for(const T& image: imageLevels) size += image.data().size();
+    return size;
+}
+
+}
+
 Containers::StringView AbstractImageConverter::pluginInterface() {
     return MAGNUM_TRADE_ABSTRACTIMAGECONVERTER_PLUGIN_INTERFACE ""_s;
 }
@@ -157,8 +174,10 @@ Containers::Optional<ImageData1D> AbstractImageConverter::convert(const ImageVie
        themselves, and since that's then a plugin-specific behavior, it should
        be a runtime error, not an assert. */
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, imageDataSize(image)};
     Containers::Optional<ImageData1D> out = doConvert(image);
     CORRADE_ASSERT(!out || !out->_data.deleter(), "Trade::AbstractImageConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->data().size());
     return out;
 }
 
@@ -173,8 +192,10 @@ Containers::Optional<ImageData2D> AbstractImageConverter::convert(const ImageVie
     /* No zero size / nullptr checks here, see convert(const ImageView1D&) for
        reasons why */
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, imageDataSize(image)};
     Containers::Optional<ImageData2D> out = doConvert(image);
     CORRADE_ASSERT(!out || !out->_data.deleter(), "Trade::AbstractImageConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->data().size());
     return out;
 }
 
@@ -221,8 +242,10 @@ Containers::Optional<ImageData3D> AbstractImageConverter::convert(const ImageVie
     /* No zero size / nullptr checks here, see convert(const ImageView1D&) for
        reasons why */
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, imageDataSize(image)};
     Containers::Optional<ImageData3D> out = doConvert(image);
     CORRADE_ASSERT(!out || !out->_data.deleter(), "Trade::AbstractImageConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->data().size());
     return out;
 }
 
@@ -237,8 +260,10 @@ Containers::Optional<ImageData1D> AbstractImageConverter::convert(const Compress
     /* No zero size / nullptr checks here, see convert(const ImageView1D&) for
        reasons why */
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, imageDataSize(image)};
     Containers::Optional<ImageData1D> out = doConvert(image);
     CORRADE_ASSERT(!out || !out->_data.deleter(), "Trade::AbstractImageConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->data().size());
     return out;
 }
 
@@ -253,8 +278,10 @@ Containers::Optional<ImageData2D> AbstractImageConverter::convert(const Compress
     /* No zero size / nullptr checks here, see convert(const ImageView1D&) for
        reasons why */
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, imageDataSize(image)};
     Containers::Optional<ImageData2D> out = doConvert(image);
     CORRADE_ASSERT(!out || !out->_data.deleter(), "Trade::AbstractImageConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->data().size());
     return out;
 }
 
@@ -269,8 +296,10 @@ Containers::Optional<ImageData3D> AbstractImageConverter::convert(const Compress
     /* No zero size / nullptr checks here, see convert(const ImageView1D&) for
        reasons why */
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, imageDataSize(image)};
     Containers::Optional<ImageData3D> out = doConvert(image);
     CORRADE_ASSERT(!out || !out->_data.deleter(), "Trade::AbstractImageConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->data().size());
     return out;
 }
 
@@ -331,8 +360,10 @@ AbstractImageConverter::convertToData(const ImageView1D& image) {
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(image)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(image);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -364,8 +395,10 @@ AbstractImageConverter::convertToData(const ImageView2D& image) {
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(image)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(image);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -404,8 +437,10 @@ AbstractImageConverter::convertToData(const ImageView3D& image) {
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(image)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(image);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -437,8 +472,10 @@ AbstractImageConverter::convertToData(const CompressedImageView1D& image) {
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(image)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(image);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -470,8 +507,10 @@ AbstractImageConverter::convertToData(const CompressedImageView2D& image) {
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(image)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(image);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -510,8 +549,10 @@ AbstractImageConverter::convertToData(const CompressedImageView3D& image) {
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(image)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(image);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -642,8 +683,10 @@ AbstractImageConverter::convertToData(const Containers::ArrayView<const ImageVie
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(imageLevels)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(imageLevels);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -681,8 +724,10 @@ AbstractImageConverter::convertToData(const Containers::ArrayView<const ImageVie
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(imageLevels)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(imageLevels);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -720,8 +765,10 @@ AbstractImageConverter::convertToData(const Containers::ArrayView<const ImageVie
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(imageLevels)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(imageLevels);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -759,8 +806,10 @@ AbstractImageConverter::convertToData(const Containers::ArrayView<const Compress
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(imageLevels)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(imageLevels);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -798,8 +847,10 @@ AbstractImageConverter::convertToData(const Containers::ArrayView<const Compress
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(imageLevels)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(imageLevels);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -837,8 +888,10 @@ AbstractImageConverter::convertToData(const Containers::ArrayView<const Compress
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, imageDataSize(imageLevels)};
     Containers::Optional<Containers::Array<char>> out = doConvertToData(imageLevels);
     CORRADE_ASSERT(!out || !out->deleter(), "Trade::AbstractImageConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(out->size());
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -871,6 +924,7 @@ bool AbstractImageConverter::convertToFile(const ImageView1D& image, const Conta
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(image)};
     return doConvertToFile(image, filename);
 }
 
@@ -905,6 +959,7 @@ bool AbstractImageConverter::convertToFile(const ImageView2D& image, const Conta
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(image)};
     return doConvertToFile(image, filename);
 }
 
@@ -945,6 +1000,7 @@ bool AbstractImageConverter::convertToFile(const ImageView3D& image, const Conta
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(image)};
     return doConvertToFile(image, filename);
 }
 
@@ -979,6 +1035,7 @@ bool AbstractImageConverter::convertToFile(const CompressedImageView1D& image, c
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(image)};
     return doConvertToFile(image, filename);
 }
 
@@ -1013,6 +1070,7 @@ bool AbstractImageConverter::convertToFile(const CompressedImageView2D& image, c
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(image)};
     return doConvertToFile(image, filename);
 }
 
@@ -1053,6 +1111,7 @@ bool AbstractImageConverter::convertToFile(const CompressedImageView3D& image, c
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(image)};
     return doConvertToFile(image, filename);
 }
 
@@ -1105,6 +1164,7 @@ bool AbstractImageConverter::convertToFile(const Containers::ArrayView<const Ima
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(imageLevels)};
     return doConvertToFile(imageLevels, filename);
 }
 
@@ -1137,6 +1197,7 @@ bool AbstractImageConverter::convertToFile(const Containers::ArrayView<const Ima
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(imageLevels)};
     return doConvertToFile(imageLevels, filename);
 }
 
@@ -1169,6 +1230,7 @@ bool AbstractImageConverter::convertToFile(const Containers::ArrayView<const Ima
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(imageLevels)};
     return doConvertToFile(imageLevels, filename);
 }
 
@@ -1201,6 +1263,7 @@ bool AbstractImageConverter::convertToFile(const Containers::ArrayView<const Com
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(imageLevels)};
     return doConvertToFile(imageLevels, filename);
 }
 
@@ -1233,6 +1296,7 @@ bool AbstractImageConverter::convertToFile(const Containers::ArrayView<const Com
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(imageLevels)};
     return doConvertToFile(imageLevels, filename);
 }
 
@@ -1265,6 +1329,7 @@ bool AbstractImageConverter::convertToFile(const Containers::ArrayView<const Com
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, imageDataSize(imageLevels)};
     return doConvertToFile(imageLevels, filename);
 }
 
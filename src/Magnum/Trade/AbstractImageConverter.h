@@ -722,6 +722,28 @@ class MAGNUM_TRADE_EXPORT AbstractImageConverter: public PluginManager::Abstract
          */
         void clearFlags(ImageConverterFlags flags);
 
+        /**
+         * @brief Plugin statistics
+         * @m_since_latest
+         *
+         * @see @ref setStatistics()
+         */
+        PluginStatistics* statistics() const { return _statistics; }
+
+        /**
+         * @brief Set plugin statistics
+         * @m_since_latest
+         *
+         * If non-null, calls to @ref convert(), @ref convertToData() and
+         * @ref convertToFile() are recorded into @p statistics.
+         * The instance is expected to stay in scope for as long as it's set.
+         * Pass @cpp nullptr @ce to stop recording, which is also the default.
+         * See @ref PluginStatistics for more information.
+         */
+        void setStatistics(PluginStatistics* statistics) {
+            _statistics = statistics;
+        }
+
         /**
          * @brief File extension
          * @m_since_latest
@@ -1947,6 +1969,7 @@ class MAGNUM_TRADE_EXPORT AbstractImageConverter: public PluginManager::Abstract
         virtual Containers::Optional<Containers::Array<char>> doConvertToData(Containers::ArrayView<const CompressedImageView3D> imageLevels);
 
         ImageConverterFlags _flags;
+        PluginStatistics* _statistics{};
 };
 
 /**
@@ -1967,7 +1990,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTIMAGECONVERTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractImageConverter/0.3.3"
+"cz.mosra.magnum.Trade.AbstractImageConverter/0.3.4"
 /* [interface] */
 
 }}
@@ -30,12 +30,16 @@
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/PluginManager/Manager.hpp>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/FileCallback.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
@@ -43,9 +47,11 @@
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/SkinData.h"
 #include "Magnum/Trade/TextureData.h"
+#include "Magnum/Trade/Implementation/pluginStatistics.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <string> /* for object2DName() etc., not going to change those */
@@ -113,11 +119,10 @@ AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& man
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager, plugin} {}
 
-#ifdef MAGNUM_BUILD_DEPRECATED
-/* These twp needed because of the Array<CachedScenes> member */
+/* These two needed because of the Pointer<CachedImage2D> and
+   Pointer<CachedScenes> members */
 AbstractImporter::AbstractImporter(AbstractImporter&&) noexcept = default;
 AbstractImporter::~AbstractImporter() = default;
-#endif
 
 void AbstractImporter::setFlags(ImporterFlags flags) {
     CORRADE_ASSERT(!isOpened(),
@@ -155,6 +160,7 @@ bool AbstractImporter::openData(Containers::ArrayView<const void> data) {
        the check doesn't be done on the plugin side) because for some file
        formats it could be valid (e.g. OBJ or JSON-based formats). */
     close();
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::OpenData, data.size()};
     doOpenData(Containers::Array<char>{const_cast<char*>(static_cast<const char*>(data.data())), data.size(), Implementation::nonOwnedArrayDeleter}, {});
     return isOpened();
 }
@@ -184,6 +190,7 @@ bool AbstractImporter::openMemory(Containers::ArrayView<const void> memory) {
        the check doesn't be done on the plugin side) because for some file
        formats it could be valid (e.g. OBJ or JSON-based formats). */
     close();
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::OpenData, memory.size()};
     doOpenData(Containers::Array<char>{const_cast<char*>(static_cast<const char*>(memory.data())), memory.size(), Implementation::nonOwnedArrayDeleter}, DataFlag::ExternallyOwned);
     return isOpened();
 }
@@ -207,6 +214,7 @@ void AbstractImporter::doOpenState(const void*, const Containers::StringView) {
 
 bool AbstractImporter::openFile(const Containers::StringView filename) {
     close();
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::OpenFile};
 
     /* If file loading callbacks are not set or the importer supports handling
        them directly, call into the implementation */
@@ -274,6 +282,9 @@ void AbstractImporter::doOpenFile(const Containers::StringView filename) {
 }
 
 void AbstractImporter::close() {
+    /* The cached image may reference data owned by the importer */
+    _cachedImage2D = nullptr;
+
     if(isOpened()) {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
@@ -1138,12 +1149,14 @@ Containers::Optional<MeshData> AbstractImporter::mesh(const UnsignedInt id, cons
         CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::mesh(): level" << level << "out of range for" << levelCount << "entries", {});
     }
     #endif
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Mesh};
     Containers::Optional<MeshData> mesh = doMesh(id, level);
     CORRADE_ASSERT(!mesh || (
         (!mesh->_indexData.deleter() || mesh->_indexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || mesh->_indexData.deleter() == ArrayAllocator<char>::deleter) &&
         (!mesh->_vertexData.deleter() || mesh->_vertexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || mesh->_vertexData.deleter() == ArrayAllocator<char>::deleter) &&
         (!mesh->_attributes.deleter() || mesh->_attributes.deleter() == static_cast<void(*)(MeshAttributeData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
         "Trade::AbstractImporter::mesh(): implementation is not allowed to use a custom Array deleter", {});
+    if(mesh) statistics.setOutputSize(mesh->indexData().size() + mesh->vertexData().size());
     return mesh;
 }
 
@@ -1151,6 +1164,118 @@ Containers::Optional<MeshData> AbstractImporter::doMesh(UnsignedInt, UnsignedInt
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::mesh(): not implemented", {});
 }
 
+namespace {
+
+/* Imports all data items using the passed function, in parallel on the
+   global thread pool if the importer allows concurrent access and no
+   statistics are being recorded, as that isn't thread-safe. Each item is
+   assumed to be expensive enough to be a job on its own. */
+template<class T, class F> Containers::Array<Containers::Optional<T>> importAll(const bool concurrent, const UnsignedInt count, F&& import) {
+    Containers::Array<Containers::Optional<T>> out{count};
+    if(concurrent) {
+        ThreadPool::global().parallelFor(count, 1, [&](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                out[i] = import(UnsignedInt(i));
+        });
+    } else for(UnsignedInt i = 0; i != count; ++i)
+        out[i] = import(i);
+
+    return out;
+}
+
+}
+
+Containers::Array<Containers::Optional<MeshData>> AbstractImporter::allMeshes() {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::allMeshes(): no file opened", {});
+    return importAll<MeshData>((doFeatures() & ImporterFeature::ConcurrentDataAccess) && !_statistics, doMeshCount(), [this](const UnsignedInt id) {
+        return mesh(id);
+    });
+}
+
+namespace {
+
+bool isMeshAttributeRequested(const Containers::ArrayView<const MeshAttribute> attributes, const MeshAttribute name) {
+    for(const MeshAttribute attribute: attributes)
+        if(attribute == name) return true;
+    return false;
+}
+
+}
+
+Containers::Optional<MeshData> AbstractImporter::mesh(const UnsignedInt id, const UnsignedInt level, const Containers::ArrayView<const MeshAttribute> attributes, const bool indices) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::mesh(): no file opened", {});
+    CORRADE_ASSERT(id < doMeshCount(), "Trade::AbstractImporter::mesh(): index" << id << "out of range for" << doMeshCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in mesh() */
+    if(level) {
+        const UnsignedInt levelCount = doMeshLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::mesh(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::mesh(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+
+    if(doFeatures() & ImporterFeature::MeshAttributeSelection) {
+        /* The fallback below goes through mesh(), which records the
+           statistics on its own */
+        Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Mesh};
+        Containers::Optional<MeshData> mesh = doMeshAttributes(id, level, attributes, indices);
+        CORRADE_ASSERT(!mesh || (
+            (!mesh->_indexData.deleter() || mesh->_indexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || mesh->_indexData.deleter() == ArrayAllocator<char>::deleter) &&
+            (!mesh->_vertexData.deleter() || mesh->_vertexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || mesh->_vertexData.deleter() == ArrayAllocator<char>::deleter) &&
+            (!mesh->_attributes.deleter() || mesh->_attributes.deleter() == static_cast<void(*)(MeshAttributeData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+            "Trade::AbstractImporter::mesh(): implementation is not allowed to use a custom Array deleter", {});
+        CORRADE_ASSERT(!mesh || indices || !mesh->isIndexed(),
+            "Trade::AbstractImporter::mesh(): implementation returned an indexed mesh but no indices were requested", {});
+        #ifndef CORRADE_NO_ASSERT
+        if(mesh) for(UnsignedInt i = 0; i != mesh->attributeCount(); ++i)
+            CORRADE_ASSERT(isMeshAttributeRequested(attributes, mesh->attributeName(i)),
+                "Trade::AbstractImporter::mesh(): implementation returned" << mesh->attributeName(i) << "which was not requested", {});
+        #endif
+        if(mesh) statistics.setOutputSize(mesh->indexData().size() + mesh->vertexData().size());
+        return mesh;
+    }
+
+    /* Not doMesh() so we get the deleter checks also */
+    Containers::Optional<MeshData> mesh = this->mesh(id, level);
+    if(!mesh) return {};
+
+    /* Pick just the requested attributes, preserving their order. The
+       attribute data are either absolute pointers into the vertex data or
+       offsets relative to it, so they stay valid when just the attribute
+       array gets replaced. */
+    std::size_t attributeCount = 0;
+    for(UnsignedInt i = 0; i != mesh->attributeCount(); ++i)
+        if(isMeshAttributeRequested(attributes, mesh->attributeName(i)))
+            ++attributeCount;
+    Containers::Array<MeshAttributeData> attributeData{attributeCount};
+    for(UnsignedInt i = 0, out = 0; i != mesh->attributeCount(); ++i)
+        if(isMeshAttributeRequested(attributes, mesh->attributeName(i)))
+            attributeData[out++] = mesh->attributeData(i);
+
+    /* Modifying the internals directly to preserve the data flags, which
+       wouldn't be possible with the public constructors without having a
+       separate branch for each combination of owned and non-owned data */
+    mesh->_attributes = Utility::move(attributeData);
+    if(!indices) {
+        mesh->_indexCount = 0;
+        mesh->_indexType = MeshIndexType{};
+        mesh->_indexStride = 0;
+        mesh->_indexDataFlags = DataFlag::Owned|DataFlag::Mutable;
+        mesh->_indices = nullptr;
+        mesh->_indexData = Containers::Array<char>{};
+    }
+
+    return mesh;
+}
+
+Containers::Optional<MeshData> AbstractImporter::mesh(const UnsignedInt id, const UnsignedInt level, const std::initializer_list<MeshAttribute> attributes, const bool indices) {
+    return mesh(id, level, Containers::arrayView(attributes), indices);
+}
+
+Containers::Optional<MeshData> AbstractImporter::doMeshAttributes(UnsignedInt, UnsignedInt, Containers::ArrayView<const MeshAttribute>, bool) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::mesh(): feature advertised but not implemented", {});
+}
+
 Containers::Optional<MeshData> AbstractImporter::mesh(const Containers::StringView name, const UnsignedInt level) {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::mesh(): no file opened", {});
     const Int id = doMeshForName(name);
@@ -1444,8 +1569,10 @@ Containers::Optional<ImageData1D> AbstractImporter::image1D(const UnsignedInt id
         CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image1D(): level" << level << "out of range for" << levelCount << "entries", {});
     }
     #endif
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Image1D};
     Containers::Optional<ImageData1D> image = doImage1D(id, level);
     CORRADE_ASSERT(!image || !image->_data.deleter() || image->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image1D(): implementation is not allowed to use a custom Array deleter", {});
+    if(image) statistics.setOutputSize(image->data().size());
     return image;
 }
 
@@ -1453,6 +1580,13 @@ Containers::Optional<ImageData1D> AbstractImporter::doImage1D(UnsignedInt, Unsig
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::image1D(): not implemented", {});
 }
 
+Containers::Array<Containers::Optional<ImageData1D>> AbstractImporter::allImages1D() {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::allImages1D(): no file opened", {});
+    return importAll<ImageData1D>((doFeatures() & ImporterFeature::ConcurrentDataAccess) && !_statistics, doImage1DCount(), [this](const UnsignedInt id) {
+        return image1D(id);
+    });
+}
+
 Containers::Optional<ImageData1D> AbstractImporter::image1D(const Containers::StringView name, const UnsignedInt level) {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image1D(): no file opened", {});
     const Int id = doImage1DForName(name);
@@ -1517,8 +1651,10 @@ Containers::Optional<ImageData2D> AbstractImporter::image2D(const UnsignedInt id
         CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image2D(): level" << level << "out of range for" << levelCount << "entries", {});
     }
     #endif
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Image2D};
     Containers::Optional<ImageData2D> image = doImage2D(id, level);
     CORRADE_ASSERT(!image || !image->_data.deleter() || image->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image2D(): implementation is not allowed to use a custom Array deleter", {});
+    if(image) statistics.setOutputSize(image->data().size());
     return image;
 }
 
@@ -1526,6 +1662,110 @@ Containers::Optional<ImageData2D> AbstractImporter::doImage2D(UnsignedInt, Unsig
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::image2D(): not implemented", {});
 }
 
+Containers::Array<Containers::Optional<ImageData2D>> AbstractImporter::allImages2D() {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::allImages2D(): no file opened", {});
+    return importAll<ImageData2D>((doFeatures() & ImporterFeature::ConcurrentDataAccess) && !_statistics, doImage2DCount(), [this](const UnsignedInt id) {
+        return image2D(id);
+    });
+}
+
+Containers::Optional<Vector2i> AbstractImporter::image2DSize(const UnsignedInt id, const UnsignedInt level) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DSize(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DSize(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image2D() */
+    if(level) {
+        const UnsignedInt levelCount = doImage2DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image2DSize(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image2DSize(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+
+    if(doFeatures() & ImporterFeature::ImageTiles)
+        return doImage2DSize(id, level);
+
+    const ImageData2D* const image = cachedImage2D(id, level);
+    if(!image) return {};
+    return image->size();
+}
+
+Containers::Optional<Vector2i> AbstractImporter::doImage2DSize(UnsignedInt, UnsignedInt) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::image2DSize(): feature advertised but not implemented", {});
+}
+
+Containers::Optional<ImageData2D> AbstractImporter::image2DTile(const UnsignedInt id, const UnsignedInt level, const Range2Di& rectangle) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DTile(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DTile(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image2D() */
+    if(level) {
+        const UnsignedInt levelCount = doImage2DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image2DTile(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image2DTile(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    CORRADE_ASSERT((rectangle.size() > Vector2i{0}).all(),
+        "Trade::AbstractImporter::image2DTile(): expected a non-empty rectangle, got" << Debug::packed << rectangle, {});
+
+    if(doFeatures() & ImporterFeature::ImageTiles) {
+        Containers::Optional<ImageData2D> tile = doImage2DTile(id, level, rectangle);
+        CORRADE_ASSERT(!tile || !tile->_data.deleter() || tile->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || tile->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image2DTile(): implementation is not allowed to use a custom Array deleter", {});
+        CORRADE_ASSERT(!tile || tile->size() == rectangle.size(),
+            "Trade::AbstractImporter::image2DTile(): implementation returned a" << Debug::packed << tile->size() << "tile but" << Debug::packed << rectangle.size() << "was requested", {});
+        return tile;
+    }
+
+    const ImageData2D* const image = cachedImage2D(id, level);
+    if(!image) return {};
+
+    if(image->isCompressed()) {
+        Error{} << "Trade::AbstractImporter::image2DTile(): tiles of compressed images are not supported";
+        return {};
+    }
+
+    if((rectangle.min() < Vector2i{0}).any() || (rectangle.max() > image->size()).any()) {
+        Error{} << "Trade::AbstractImporter::image2DTile(): rectangle" << Debug::packed << rectangle << "out of range for a" << Debug::packed << image->size() << "image";
+        return {};
+    }
+
+    /* Copy the tile out into a new image with default (four-byte aligned)
+       storage */
+    const std::size_t rowSize = ((rectangle.sizeX()*image->pixelSize() + 3)/4)*4;
+    ImageData2D tile{PixelStorage{}, image->format(), image->formatExtra(), image->pixelSize(), rectangle.size(), Containers::Array<char>{NoInit, rowSize*rectangle.sizeY()}, image->flags()};
+    Utility::copy(image->pixels().sliceSize(
+        {std::size_t(rectangle.min().y()), std::size_t(rectangle.min().x()), 0},
+        {std::size_t(rectangle.sizeY()), std::size_t(rectangle.sizeX()), image->pixelSize()}),
+        tile.mutablePixels());
+    return tile;
+}
+
+Containers::Optional<ImageData2D> AbstractImporter::doImage2DTile(UnsignedInt, UnsignedInt, const Range2Di&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::image2DTile(): feature advertised but not implemented", {});
+}
+
+struct AbstractImporter::CachedImage2D {
+    explicit CachedImage2D(UnsignedInt id, UnsignedInt level, ImageData2D&& image): id{id}, level{level}, image{Utility::move(image)} {}
+
+    UnsignedInt id;
+    UnsignedInt level;
+    ImageData2D image;
+};
+
+const ImageData2D* AbstractImporter::cachedImage2D(const UnsignedInt id, const UnsignedInt level) {
+    if(_cachedImage2D && _cachedImage2D->id == id && _cachedImage2D->level == level)
+        return &_cachedImage2D->image;
+
+    /* Discard the previous image first so two whole images aren't in memory
+       at the same time. Not doImage2D() so we get the deleter checks
+       also. */
+    _cachedImage2D = nullptr;
+    Containers::Optional<ImageData2D> image = image2D(id, level);
+    if(!image) return nullptr;
+
+    _cachedImage2D.emplace(id, level, *Utility::move(image));
+    return &_cachedImage2D->image;
+}
+
 Containers::Optional<ImageData2D> AbstractImporter::image2D(const Containers::StringView name, const UnsignedInt level) {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2D(): no file opened", {});
     const Int id = doImage2DForName(name);
@@ -1590,8 +1830,10 @@ Containers::Optional<ImageData3D> AbstractImporter::image3D(const UnsignedInt id
         CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image3D(): level" << level << "out of range for" << levelCount << "entries", {});
     }
     #endif
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Image3D};
     Containers::Optional<ImageData3D> image = doImage3D(id, level);
     CORRADE_ASSERT(!image || !image->_data.deleter() || image->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image3D(): implementation is not allowed to use a custom Array deleter", {});
+    if(image) statistics.setOutputSize(image->data().size());
     return image;
 }
 
@@ -1599,6 +1841,13 @@ Containers::Optional<ImageData3D> AbstractImporter::doImage3D(UnsignedInt, Unsig
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::image3D(): not implemented", {});
 }
 
+Containers::Array<Containers::Optional<ImageData3D>> AbstractImporter::allImages3D() {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::allImages3D(): no file opened", {});
+    return importAll<ImageData3D>((doFeatures() & ImporterFeature::ConcurrentDataAccess) && !_statistics, doImage3DCount(), [this](const UnsignedInt id) {
+        return image3D(id);
+    });
+}
+
 Containers::Optional<ImageData3D> AbstractImporter::image3D(const Containers::StringView name, const UnsignedInt level) {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3D(): no file opened", {});
     const Int id = doImage3DForName(name);
@@ -1629,6 +1878,9 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         _c(OpenData)
         _c(OpenState)
         _c(FileCallback)
+        _c(ImageTiles)
+        _c(MeshAttributeSelection)
+        _c(ConcurrentDataAccess)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1640,7 +1892,10 @@ Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "Trade::ImporterFeatures{}", {
         ImporterFeature::OpenData,
         ImporterFeature::OpenState,
-        ImporterFeature::FileCallback});
+        ImporterFeature::FileCallback,
+        ImporterFeature::ImageTiles,
+        ImporterFeature::MeshAttributeSelection,
+        ImporterFeature::ConcurrentDataAccess});
 }
 
 Debug& operator<<(Debug& debug, const ImporterFlag value) {
@@ -29,7 +29,9 @@
  * @brief Class @ref Magnum::Trade::AbstractImporter, enum @ref Magnum::Trade::ImporterFeature, enum set @ref Magnum::Trade::ImporterFeatures
  */
 
+#include <initializer_list>
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 #include <Corrade/Utility/StlForwardString.h> /** @todo remove once file callbacks are std::string-free */
 
@@ -72,7 +74,50 @@ enum class ImporterFeature: UnsignedByte {
      * See @ref Trade-AbstractImporter-usage-callbacks and particular importer
      * documentation for more information.
      */
-    FileCallback = 1 << 2
+    FileCallback = 1 << 2,
+
+    /**
+     * Importing rectangular tiles of two-dimensional images using
+     * @ref AbstractImporter::image2DTile() and querying image sizes using
+     * @relativeref{AbstractImporter,image2DSize()} without having to decode
+     * the whole image. If the importer doesn't expose this feature, the tile
+     * is cut out of a fully imported image instead, which means memory use
+     * isn't bounded by the tile size.
+     * @m_since_latest
+     */
+    ImageTiles = 1 << 3,
+
+    /**
+     * Importing just a subset of mesh attributes and optionally no index
+     * data using @ref AbstractImporter::mesh(UnsignedInt, UnsignedInt, Containers::ArrayView<const MeshAttribute>, bool).
+     * If the importer doesn't expose this feature, the whole mesh is
+     * imported and the unwanted data are discarded only afterwards, which
+     * means neither the import time nor the peak memory use is reduced.
+     * @m_since_latest
+     */
+    MeshAttributeSelection = 1 << 4,
+
+    /**
+     * Importing different data items of the same opened file concurrently
+     * from multiple threads. If the importer exposes this feature,
+     * @ref AbstractImporter::mesh() and @ref AbstractImporter::image1D() /
+     * @relativeref{AbstractImporter,image2D()} /
+     * @relativeref{AbstractImporter,image3D()} together with the
+     * corresponding count and level count queries can be called
+     * concurrently, as long as no file is opened or closed meanwhile.
+     * Made use of by @ref AbstractImporter::allMeshes() and
+     * @relativeref{AbstractImporter,allImages2D()} and related APIs. If the
+     * importer doesn't expose this feature, the importer instance can be
+     * used only from one thread at a time.
+     *
+     * Recording into @ref PluginStatistics isn't thread-safe. While
+     * statistics are set using @ref AbstractImporter::setStatistics(), the
+     * above functions are not allowed to be called concurrently, and
+     * @ref AbstractImporter::allMeshes() and related APIs import
+     * sequentially.
+     * @m_since_latest
+     */
+    ConcurrentDataAccess = 1 << 5
 };
 
 /**
@@ -400,6 +445,13 @@ base file path to pass correct paths to subsequent file callbacks. The
 @ref doSetFileCallback() can be overridden in case it's desired to respond to
 file loading callback setup, but doesn't have to be.
 
+In order to support @ref ImporterFeature::ConcurrentDataAccess, the
+@ref doMesh(), `doImage*()` implementations as well as the
+@ref doMeshCount(), @ref doMeshLevelCount(), `doImage*Count()` and
+`doImage*LevelCount()` queries are not allowed to modify any state shared
+between calls --- for example, instead of seeking a single file stream, each
+call should read from an immutable copy of the file data.
+
 For multi-data formats the file opening shouldn't take long and all parsing
 should be done in the data parsing functions instead, because the user might
 want to import only some data. This is obviously not the case for single-data
@@ -500,10 +552,10 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
            header. */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
-        #if defined(MAGNUM_BUILD_DEPRECATED) && !defined(DOXYGEN_GENERATING_OUTPUT)
-        /* These twp needed because of the Array<CachedScenes> member
-           (AnyImageImporter relies on the move), move assignment disabled by
-           AbstractPlugin already */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* These two needed because of the Pointer<CachedImage2D> and
+           Pointer<CachedScenes> members (AnyImageImporter relies on the
+           move), move assignment disabled by AbstractPlugin already */
         AbstractImporter(AbstractImporter&&) noexcept;
         ~AbstractImporter();
         #endif
@@ -555,6 +607,34 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         void clearFlags(ImporterFlags flags);
 
+        /**
+         * @brief Plugin statistics
+         * @m_since_latest
+         *
+         * @see @ref setStatistics()
+         */
+        PluginStatistics* statistics() const { return _statistics; }
+
+        /**
+         * @brief Set plugin statistics
+         * @m_since_latest
+         *
+         * If non-null, calls to @ref openData(), @ref openMemory(),
+         * @ref openFile(), @ref mesh() and @ref image1D() /
+         * @ref image2D() / @ref image3D() are recorded into @p statistics.
+         * The instance is expected to stay in scope for as long as it's set.
+         * Pass @cpp nullptr @ce to stop recording, which is also the default.
+         * Recording isn't thread-safe, so while statistics are set,
+         * @ref mesh() and @ref image1D() / @ref image2D() / @ref image3D()
+         * aren't allowed to be called from multiple threads at once even if
+         * @ref ImporterFeature::ConcurrentDataAccess is supported, and
+         * @ref allMeshes() and related APIs import sequentially. See
+         * @ref PluginStatistics for more information.
+         */
+        void setStatistics(PluginStatistics* statistics) {
+            _statistics = statistics;
+        }
+
         /**
          * @brief File opening callback function
          *
@@ -1347,6 +1427,54 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<MeshData> mesh(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Mesh with just a subset of attributes
+         * @param id            Mesh ID, from range [0, @ref meshCount()).
+         * @param level         Mesh level, from range
+         *      [0, @ref meshLevelCount())
+         * @param attributes    Attributes to import
+         * @param indices       Whether to import index data
+         * @m_since_latest
+         *
+         * Like @ref mesh(UnsignedInt, UnsignedInt), but the returned mesh
+         * contains only attributes whose name is listed in @p attributes, in
+         * the order in which they'd be returned by the full import. If a mesh
+         * contains more attributes of the same name, all of them are kept.
+         * Attributes listed in @p attributes but not present in the mesh are
+         * ignored. If @p indices is @cpp false @ce, the returned mesh is not
+         * indexed and contains just the unique vertices, which is useful for
+         * example for calculating bounds. The vertex count is unchanged in
+         * both cases.
+         *
+         * If @ref ImporterFeature::MeshAttributeSelection is supported, only
+         * the requested data are decoded. Otherwise the mesh is imported
+         * fully via @ref mesh(UnsignedInt, UnsignedInt) and the unwanted data
+         * are discarded afterwards. On failure prints a message to
+         * @relativeref{Magnum,Error} and returns @ref Containers::NullOpt.
+         * Expects that a file is opened.
+         */
+        Containers::Optional<MeshData> mesh(UnsignedInt id, UnsignedInt level, Containers::ArrayView<const MeshAttribute> attributes, bool indices = true);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        Containers::Optional<MeshData> mesh(UnsignedInt id, UnsignedInt level, std::initializer_list<MeshAttribute> attributes, bool indices = true);
+
+        /**
+         * @brief Import all meshes
+         * @m_since_latest
+         *
+         * Returns the first level of all @ref meshCount() meshes, in order.
+         * Meshes that failed to import are @ref Containers::NullOpt, with a
+         * message printed to @relativeref{Magnum,Error}. If
+         * @ref ImporterFeature::ConcurrentDataAccess is supported, the meshes
+         * are imported in parallel on @ref ThreadPool::global(), otherwise
+         * sequentially. Expects that a file is opened.
+         * @see @ref mesh(UnsignedInt, UnsignedInt), @ref allImages2D()
+         */
+        Containers::Array<Containers::Optional<MeshData>> allMeshes();
+
         /**
          * @brief Mesh attribute for given name
          * @m_since{2020,06}
@@ -1628,6 +1756,20 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData1D> image1D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Import all one-dimensional images
+         * @m_since_latest
+         *
+         * Returns the first level of all @ref image1DCount() images, in
+         * order. Images that failed to import are @ref Containers::NullOpt,
+         * with a message printed to @relativeref{Magnum,Error}. If
+         * @ref ImporterFeature::ConcurrentDataAccess is supported, the images
+         * are imported in parallel on @ref ThreadPool::global(), otherwise
+         * sequentially. Expects that a file is opened.
+         * @see @ref image1D(UnsignedInt, UnsignedInt), @ref allMeshes()
+         */
+        Containers::Array<Containers::Optional<ImageData1D>> allImages1D();
+
         /**
          * @brief Two-dimensional image count
          *
@@ -1691,6 +1833,64 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData2D> image2D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Import all two-dimensional images
+         * @m_since_latest
+         *
+         * Returns the first level of all @ref image2DCount() images, in
+         * order. Images that failed to import are @ref Containers::NullOpt,
+         * with a message printed to @relativeref{Magnum,Error}. If
+         * @ref ImporterFeature::ConcurrentDataAccess is supported, the images
+         * are imported in parallel on @ref ThreadPool::global(), otherwise
+         * sequentially. Expects that a file is opened.
+         * @see @ref image2D(UnsignedInt, UnsignedInt), @ref allMeshes()
+         */
+        Containers::Array<Containers::Optional<ImageData2D>> allImages2D();
+
+        /**
+         * @brief Two-dimensional image size
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param level     Mip level, from range [0, @ref image2DLevelCount())
+         * @m_since_latest
+         *
+         * If @ref ImporterFeature::ImageTiles is supported, the size is
+         * queried without decoding the image data. Otherwise the whole image
+         * is imported using @ref image2D() and its size returned, with the
+         * image kept in memory for a subsequent @ref image2DTile() call on
+         * the same level. On failure
+         * prints a message to @relativeref{Magnum,Error} and returns
+         * @ref Containers::NullOpt. Expects that a file is opened.
+         * @see @ref image2DTile()
+         */
+        Containers::Optional<Vector2i> image2DSize(UnsignedInt id, UnsignedInt level = 0);
+
+        /**
+         * @brief Rectangular tile of a two-dimensional image
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param level     Mip level, from range [0, @ref image2DLevelCount())
+         * @param rectangle Tile rectangle in pixels
+         * @m_since_latest
+         *
+         * Returns the pixels contained in @p rectangle as a new image with
+         * the same format and default @ref PixelStorage. If
+         * @ref ImporterFeature::ImageTiles is supported, only the data needed
+         * for the tile is decoded, which allows working with images that
+         * don't fit into memory as a whole. Otherwise the whole image is
+         * imported using @ref image2D() and the tile is copied out of it.
+         * The fallback keeps the last imported image in memory until a
+         * different image or level is requested or the file is closed, so
+         * subsequent tiles of the same level don't import it again. Tiles
+         * of compressed images aren't supported in the fallback
+         * implementation.
+         *
+         * On failure or if @p rectangle isn't contained in the image prints a
+         * message to @relativeref{Magnum,Error} and returns
+         * @ref Containers::NullOpt. Expects that a file is opened and
+         * @p rectangle is not empty.
+         * @see @ref image2DSize(), @ref ImageTileCache
+         */
+        Containers::Optional<ImageData2D> image2DTile(UnsignedInt id, UnsignedInt level, const Range2Di& rectangle);
+
         /**
          * @brief Three-dimensional image count
          *
@@ -1754,6 +1954,20 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData3D> image3D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Import all three-dimensional images
+         * @m_since_latest
+         *
+         * Returns the first level of all @ref image3DCount() images, in
+         * order. Images that failed to import are @ref Containers::NullOpt,
+         * with a message printed to @relativeref{Magnum,Error}. If
+         * @ref ImporterFeature::ConcurrentDataAccess is supported, the images
+         * are imported in parallel on @ref ThreadPool::global(), otherwise
+         * sequentially. Expects that a file is opened.
+         * @see @ref image3D(UnsignedInt, UnsignedInt), @ref allMeshes()
+         */
+        Containers::Array<Containers::Optional<ImageData3D>> allImages3D();
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -2297,6 +2511,17 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         virtual Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref mesh(UnsignedInt, UnsignedInt, Containers::ArrayView<const MeshAttribute>, bool)
+         * @m_since_latest
+         *
+         * Called only if @ref ImporterFeature::MeshAttributeSelection is
+         * supported. The implementation is expected to return only
+         * attributes listed in @p attributes and no index data if
+         * @p indices is @cpp false @ce.
+         */
+        virtual Containers::Optional<MeshData> doMeshAttributes(UnsignedInt id, UnsignedInt level, Containers::ArrayView<const MeshAttribute> attributes, bool indices);
+
         /**
          * @brief Implementation for @ref meshAttributeForName()
          * @m_since{2020,06}
@@ -2561,6 +2786,24 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref image2D() */
         virtual Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref image2DSize()
+         * @m_since_latest
+         *
+         * Called only if @ref ImporterFeature::ImageTiles is supported.
+         */
+        virtual Containers::Optional<Vector2i> doImage2DSize(UnsignedInt id, UnsignedInt level);
+
+        /**
+         * @brief Implementation for @ref image2DTile()
+         * @m_since_latest
+         *
+         * Called only if @ref ImporterFeature::ImageTiles is supported. The
+         * @p rectangle is guaranteed to be non-empty, the implementation is
+         * expected to check it against the image size.
+         */
+        virtual Containers::Optional<ImageData2D> doImage2DTile(UnsignedInt id, UnsignedInt level, const Range2Di& rectangle);
+
         /**
          * @brief Implementation for @ref image3DCount()
          *
@@ -2601,6 +2844,7 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         virtual const void* doImporterState() const;
 
         ImporterFlags _flags;
+        PluginStatistics* _statistics{};
 
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
@@ -2612,6 +2856,12 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /* GCC 4.8 complains loudly about missing initializers otherwise */
         } _fileCallbackTemplate{nullptr, nullptr};
 
+        /* Last image imported by the image2DSize() and image2DTile()
+           fallbacks, cleared in close() */
+        struct CachedImage2D;
+        Containers::Pointer<CachedImage2D> _cachedImage2D;
+        const ImageData2D* cachedImage2D(UnsignedInt id, UnsignedInt level);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         struct CachedScenes;
         Containers::Pointer<CachedScenes> _cachedScenes;
@@ -2637,7 +2887,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractImporter/0.5.2"
+"cz.mosra.magnum.Trade.AbstractImporter/0.5.3"
 /* [interface] */
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -45,9 +45,11 @@
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/SkinData.h"
 #include "Magnum/Trade/TextureData.h"
+#include "Magnum/Trade/Implementation/pluginStatistics.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 /* needed by deprecated convertToFile() that takes a std::string */
@@ -68,6 +70,27 @@ namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
+namespace {
+
+/* Input and output sizes recorded into PluginStatistics */
+std::size_t meshDataSize(const MeshData& mesh) {
+    return mesh.indexData().size() + mesh.vertexData().size();
+}
+
+std::size_t meshDataSize(const Containers::Iterable<const MeshData>& meshLevels) {
+    std::size_t size = 0;
+    for(const MeshData& mesh: meshLevels) size += meshDataSize(mesh);
+    return size;
+}
+
+template<UnsignedInt dimensions> std::size_t imageDataSize(const Containers::Iterable<const ImageData<dimensions>>& imageLevels) {
+    std::size_t size = 0;
+    for(const ImageData<dimensions>& image: imageLevels) size += image.data().size();
+    return size;
+}
+
+}
+
 SceneContents sceneContentsFor(const AbstractImporter& importer) {
     CORRADE_ASSERT(importer.isOpened(),
         "Trade::sceneContentsFor(): the importer is not opened", {});
@@ -268,12 +291,14 @@ Containers::Optional<MeshData> AbstractSceneConverter::convert(const MeshData& m
     CORRADE_ASSERT(features() & SceneConverterFeature::ConvertMesh,
         "Trade::AbstractSceneConverter::convert(): mesh conversion not supported", {});
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Convert, meshDataSize(mesh)};
     Containers::Optional<MeshData> out = doConvert(mesh);
     CORRADE_ASSERT(!out || (
         (!out->_indexData.deleter() || out->_indexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || out->_indexData.deleter() == ArrayAllocator<char>::deleter) &&
         (!out->_vertexData.deleter() || out->_vertexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || out->_vertexData.deleter() == ArrayAllocator<char>::deleter) &&
         (!out->_attributes.deleter() || out->_attributes.deleter() == static_cast<void(*)(MeshAttributeData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
         "Trade::AbstractSceneConverter::convert(): implementation is not allowed to use a custom Array deleter", {});
+    if(out) statistics.setOutputSize(meshDataSize(*out));
     return out;
 }
 
@@ -303,9 +328,11 @@ AbstractSceneConverter::convertToData(const MeshData& mesh) {
     abort();
 
     if(features() >= SceneConverterFeature::ConvertMeshToData) {
+        Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData, meshDataSize(mesh)};
         Containers::Optional<Containers::Array<char>> out = doConvertToData(mesh);
         CORRADE_ASSERT(!out || !out->deleter() || out->deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || out->deleter() == ArrayAllocator<char>::deleter,
             "Trade::AbstractSceneConverter::convertToData(): implementation is not allowed to use a custom Array deleter", {});
+        if(out) statistics.setOutputSize(out->size());
 
         /* GCC 4.8 needs an explicit conversion here */
         #ifdef MAGNUM_BUILD_DEPRECATED
@@ -335,6 +362,7 @@ bool AbstractSceneConverter::convertToFile(const MeshData& mesh, const Container
     abort();
 
     if(features() >= SceneConverterFeature::ConvertMeshToFile) {
+        Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile, meshDataSize(mesh)};
         return doConvertToFile(mesh, filename);
 
     } else if(features() & (SceneConverterFeature::ConvertMultipleToFile|SceneConverterFeature::AddMeshes)) {
@@ -500,9 +528,13 @@ Containers::Optional<Containers::Array<char>> AbstractSceneConverter::endData()
     }};
 
     if(features() >= SceneConverterFeature::ConvertMultipleToData) {
+        /* Only recorded for multi-data converters, with single-mesh
+           converters the actual conversion got recorded in add() already */
+        Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToData};
         Containers::Optional<Containers::Array<char>> out = doEndData();
         CORRADE_ASSERT(!out || !out->deleter() || out->deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || out->deleter() == ArrayAllocator<char>::deleter,
             "Trade::AbstractSceneConverter::endData(): implementation is not allowed to use a custom Array deleter", {});
+        if(out) statistics.setOutputSize(out->size());
 
         return out;
 
@@ -561,6 +593,7 @@ bool AbstractSceneConverter::endFile() {
     }};
 
     if(features() >= SceneConverterFeature::ConvertMultipleToFile) {
+        Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::ConvertToFile};
         return doEndFile(_state->filename);
 
     } else if(features() & SceneConverterFeature::ConvertMeshToFile) {
@@ -793,6 +826,8 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const MeshData& me
     CORRADE_ASSERT(_state,
         "Trade::AbstractSceneConverter::add(): no conversion in progress", {});
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, meshDataSize(mesh)};
+
     if(features() >= SceneConverterFeature::AddMeshes) {
         if(!doAdd(_state->meshCount, mesh, name)) return {};
 
@@ -841,6 +876,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     CORRADE_ASSERT(!meshLevels.isEmpty(),
         "Trade::AbstractSceneConverter::add(): at least one mesh level has to be specified", false);
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, meshDataSize(meshLevels)};
     if(doAdd(_state->meshCount, meshLevels, name))
         return _state->meshCount++;
     return {};
@@ -1006,6 +1042,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const ImageData1D&
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, image.data().size()};
     if(doAdd(_state->image1DCount, image, name))
         return _state->image1DCount++;
     return {};
@@ -1050,6 +1087,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     CORRADE_ASSERT(_state,
         "Trade::AbstractSceneConverter::add(): no conversion in progress", {});
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, imageDataSize(imageLevels)};
     if(doAdd(_state->image1DCount, imageLevels, name))
         return _state->image1DCount++;
     return {};
@@ -1107,6 +1145,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const ImageData2D&
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, image.data().size()};
     if(doAdd(_state->image2DCount, image, name))
         return _state->image2DCount++;
     return {};
@@ -1151,6 +1190,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     CORRADE_ASSERT(_state,
         "Trade::AbstractSceneConverter::add(): no conversion in progress", {});
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, imageDataSize(imageLevels)};
     if(doAdd(_state->image2DCount, imageLevels, name))
         return _state->image2DCount++;
     return {};
@@ -1208,6 +1248,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const ImageData3D&
         return {};
     #endif
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, image.data().size()};
     if(doAdd(_state->image3DCount, image, name))
         return _state->image3DCount++;
     return {};
@@ -1252,6 +1293,7 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     CORRADE_ASSERT(_state,
         "Trade::AbstractSceneConverter::add(): no conversion in progress", {});
 
+    Implementation::PluginStatisticsScope statistics{_statistics, PluginOperation::Add, imageDataSize(imageLevels)};
     if(doAdd(_state->image3DCount, imageLevels, name))
         return _state->image3DCount++;
     return {};
@@ -1748,6 +1790,7 @@ Debug& operator<<(Debug& debug, const SceneConverterFeature value) {
         _c(AddCompressedImages3D)
         _c(MeshLevels)
         _c(ImageLevels)
+        _c(StreamingOutput)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1782,7 +1825,8 @@ Debug& operator<<(Debug& debug, const SceneConverterFeatures value) {
         SceneConverterFeature::AddCompressedImages2D,
         SceneConverterFeature::AddCompressedImages3D,
         SceneConverterFeature::MeshLevels,
-        SceneConverterFeature::ImageLevels});
+        SceneConverterFeature::ImageLevels,
+        SceneConverterFeature::StreamingOutput});
 }
 
 Debug& operator<<(Debug& debug, const SceneConverterFlag value) {
@@ -261,7 +261,23 @@ enum class SceneConverterFeature: UnsignedInt {
      * supported.
      * @m_since_latest
      */
-    ImageLevels = 1 << 23
+    ImageLevels = 1 << 23,
+
+    /**
+     * Streaming output. Data passed to
+     * @relativeref{AbstractSceneConverter,add()} during a
+     * @ref AbstractSceneConverter::beginFile() conversion are written out
+     * before the function returns and no references to them or copies of
+     * them are kept until @ref AbstractSceneConverter::endFile(). The
+     * converter memory use is thus independent of the total size of the
+     * converted data and the caller is free to discard each item right after
+     * adding it. Meaningful only if
+     * @ref SceneConverterFeature::ConvertMultipleToFile is supported as well,
+     * conversion to data still has to keep the whole output in memory. See
+     * @ref Trade-AbstractSceneConverter-streaming for more information.
+     * @m_since_latest
+     */
+    StreamingOutput = 1 << 24
 };
 
 /**
@@ -698,6 +714,24 @@ duplicates from all meshes before saving them to the output:
 
 @snippet Trade.cpp AbstractSceneConverter-usage-multiple-file-selective
 
+@subsection Trade-AbstractSceneConverter-streaming Streaming output
+
+The batch interface doesn't by itself require the converter to hold all added
+data until the end --- but because many file formats need to know the total
+amount of data or offsets of particular items upfront, converters commonly
+accumulate everything until @ref endFile() or @ref endData() is called. If the
+converter advertises @ref SceneConverterFeature::StreamingOutput, each item
+passed to @ref add() during a @ref beginFile() conversion is written out
+immediately instead and nothing is retained from it. With such converters,
+importing and adding the data one by one like in the snippet above keeps the
+peak memory use proportional to the largest item instead of the total size of
+the converted file. The @ref addImporterContents() and
+@ref addSupportedImporterContents() APIs import and add the data one by one
+as well, so they're suitable for streaming conversion too.
+
+Conversion to data with @ref beginData() and @ref endData() needs to return
+the whole output at the end and thus isn't affected by this feature.
+
 <b></b>
 
 @m_class{m-note m-success}
@@ -906,6 +940,31 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         void clearFlags(SceneConverterFlags flags);
 
+        /**
+         * @brief Plugin statistics
+         * @m_since_latest
+         *
+         * @see @ref setStatistics()
+         */
+        PluginStatistics* statistics() const { return _statistics; }
+
+        /**
+         * @brief Set plugin statistics
+         * @m_since_latest
+         *
+         * If non-null, calls to @ref convert(const MeshData&),
+         * @ref convertToData(const MeshData&),
+         * @ref convertToFile(const MeshData&, Containers::StringView),
+         * @ref endData(), @ref endFile() and @ref add() of meshes and
+         * images are recorded into @p statistics.
+         * The instance is expected to stay in scope for as long as it's set.
+         * Pass @cpp nullptr @ce to stop recording, which is also the default.
+         * See @ref PluginStatistics for more information.
+         */
+        void setStatistics(PluginStatistics* statistics) {
+            _statistics = statistics;
+        }
+
         /**
          * @brief Convert a mesh
          *
@@ -2107,6 +2166,10 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          *
          * If @ref SceneConverterFeature::ConvertMultipleToData is supported,
          * default implementation delegates to @ref doBeginData().
+         * As the whole output is then produced at once in @ref doEndFile(),
+         * converters advertising @ref SceneConverterFeature::StreamingOutput
+         * are expected to implement this function and @ref doEndFile() on
+         * their own.
          *
          * It is allowed to call this function from your @ref doBeginFile()
          * implementation, for example when you only need to do format
@@ -2460,6 +2523,7 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
         MAGNUM_TRADE_LOCAL bool addImporterContentsInternal(AbstractImporter& importer, SceneContents contents, bool noLevelsIfUnsupported);
 
         SceneConverterFlags _flags;
+        PluginStatistics* _statistics{};
         Containers::Pointer<State> _state;
 };
 
@@ -2481,7 +2545,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractSceneConverter/0.2.2"
+"cz.mosra.magnum.Trade.AbstractSceneConverter/0.2.3"
 /* [interface] */
 
 }}
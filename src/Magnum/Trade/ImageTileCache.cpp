@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageTileCache.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+struct Tile {
+    Vector2i coordinates;
+    /* Value of State::useCounter at the time of last access, zero for an
+       empty slot */
+    std::size_t lastUsed;
+    Containers::Optional<ImageData2D> image;
+};
+
+}
+
+struct ImageTileCache::State {
+    explicit State(AbstractImporter& importer, UnsignedInt id, UnsignedInt level, const Vector2i& imageSize, const Vector2i& tileSize, UnsignedInt capacity): importer(importer), id{id}, level{level}, imageSize{imageSize}, tileSize{tileSize}, tileCount{(imageSize + tileSize - Vector2i{1})/tileSize}, tiles{ValueInit, capacity} {}
+
+    AbstractImporter& importer;
+    UnsignedInt id, level;
+    Vector2i imageSize, tileSize, tileCount;
+    /* The capacity is expected to be small (tens to hundreds of tiles), so
+       lookup and eviction are a linear scan instead of a hash map and a
+       linked list */
+    Containers::Array<Tile> tiles;
+    std::size_t useCounter{}, hitCount{}, missCount{};
+};
+
+ImageTileCache::ImageTileCache(AbstractImporter& importer, const UnsignedInt id, const UnsignedInt level, const Vector2i& imageSize, const Vector2i& tileSize, const UnsignedInt capacity) {
+    CORRADE_ASSERT((imageSize > Vector2i{0}).all() && (tileSize > Vector2i{0}).all() && capacity,
+        "Trade::ImageTileCache: expected non-zero image size, tile size and capacity, got" << Debug::packed << imageSize << Debug::nospace << "," << Debug::packed << tileSize << "and" << capacity, );
+
+    _state.emplace(importer, id, level, imageSize, tileSize, capacity);
+}
+
+ImageTileCache::ImageTileCache(ImageTileCache&&) noexcept = default;
+
+ImageTileCache::~ImageTileCache() = default;
+
+ImageTileCache& ImageTileCache::operator=(ImageTileCache&&) noexcept = default;
+
+AbstractImporter& ImageTileCache::importer() { return _state->importer; }
+
+UnsignedInt ImageTileCache::id() const { return _state->id; }
+
+UnsignedInt ImageTileCache::level() const { return _state->level; }
+
+Vector2i ImageTileCache::imageSize() const { return _state->imageSize; }
+
+Vector2i ImageTileCache::tileSize() const { return _state->tileSize; }
+
+Vector2i ImageTileCache::tileCount() const { return _state->tileCount; }
+
+UnsignedInt ImageTileCache::capacity() const { return _state->tiles.size(); }
+
+UnsignedInt ImageTileCache::cachedTileCount() const {
+    UnsignedInt count = 0;
+    for(const Tile& tile: _state->tiles)
+        if(tile.lastUsed) ++count;
+    return count;
+}
+
+std::size_t ImageTileCache::hitCount() const { return _state->hitCount; }
+
+std::size_t ImageTileCache::missCount() const { return _state->missCount; }
+
+void ImageTileCache::resetStatistics() {
+    _state->hitCount = 0;
+    _state->missCount = 0;
+}
+
+Range2Di ImageTileCache::tileRectangle(const Vector2i& tile) const {
+    CORRADE_ASSERT((tile >= Vector2i{0}).all() && (tile < _state->tileCount).all(),
+        "Trade::ImageTileCache::tileRectangle(): tile" << Debug::packed << tile << "out of range for" << Debug::packed << _state->tileCount << "tiles", {});
+
+    const Vector2i min = tile*_state->tileSize;
+    return {min, Math::min(min + _state->tileSize, _state->imageSize)};
+}
+
+Containers::Optional<ImageView2D> ImageTileCache::tile(const Vector2i& tile) {
+    State& state = *_state;
+    CORRADE_ASSERT((tile >= Vector2i{0}).all() && (tile < state.tileCount).all(),
+        "Trade::ImageTileCache::tile(): tile" << Debug::packed << tile << "out of range for" << Debug::packed << state.tileCount << "tiles", {});
+
+    /* Find the tile, and at the same time the least recently used slot in
+       case it's not there. Empty slots have lastUsed set to zero so they get
+       picked first. */
+    Tile* leastRecentlyUsed = &state.tiles[0];
+    for(Tile& cached: state.tiles) {
+        if(cached.lastUsed && cached.coordinates == tile) {
+            ++state.hitCount;
+            cached.lastUsed = ++state.useCounter;
+            return ImageView2D{*cached.image};
+        }
+
+        if(cached.lastUsed < leastRecentlyUsed->lastUsed)
+            leastRecentlyUsed = &cached;
+    }
+
+    ++state.missCount;
+
+    /* Discard the evicted tile before importing the new one so the memory
+       use doesn't temporarily exceed the capacity */
+    leastRecentlyUsed->lastUsed = 0;
+    leastRecentlyUsed->image = Containers::NullOpt;
+
+    Containers::Optional<ImageData2D> image = state.importer.image2DTile(state.id, state.level, tileRectangle(tile));
+    if(!image) return {};
+
+    leastRecentlyUsed->coordinates = tile;
+    leastRecentlyUsed->lastUsed = ++state.useCounter;
+    leastRecentlyUsed->image = Utility::move(image);
+    return ImageView2D{*leastRecentlyUsed->image};
+}
+
+void ImageTileCache::clear() {
+    for(Tile& tile: _state->tiles) {
+        tile.lastUsed = 0;
+        tile.image = Containers::NullOpt;
+    }
+}
+
+}}
@@ -0,0 +1,183 @@
+#ifndef Magnum_Trade_ImageTileCache_h
+#define Magnum_Trade_ImageTileCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImageTileCache
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Least-recently-used cache of two-dimensional image tiles
+@m_since_latest
+
+Splits a single level of a two-dimensional image into a grid of tiles of a
+fixed size and imports them on demand via
+@ref AbstractImporter::image2DTile(), keeping at most @ref capacity() tiles in
+memory at a time. When a tile that isn't cached is requested and the cache is
+full, the least recently used tile is discarded. Together with an importer
+supporting @ref ImporterFeature::ImageTiles this allows processing images that
+don't fit into memory, with memory use bounded by the tile size and capacity
+regardless of image size.
+
+If the importer doesn't support @ref ImporterFeature::ImageTiles, which none
+of the importers in the core repository does at the moment, the bound doesn't
+apply --- @ref AbstractImporter::image2DTile() then imports the whole level
+once and keeps it in memory until a different image or level is requested or
+the file is closed. Every tile is copied out of that image, so the cache only
+saves the copies. In that case it's more efficient to import the image with
+@ref AbstractImporter::image2D() and access its pixels directly.
+
+@snippet Trade.cpp ImageTileCache-usage
+
+Tiles on the right and bottom edge of the image are smaller if the image size
+isn't a multiple of the tile size, use @ref tileRectangle() to get the actual
+pixel range of a tile.
+@experimental
+*/
+class MAGNUM_TRADE_EXPORT ImageTileCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param importer      Importer with an opened file
+         * @param id            Image ID, from range
+         *      [0, @ref AbstractImporter::image2DCount())
+         * @param level         Image level, from range
+         *      [0, @ref AbstractImporter::image2DLevelCount())
+         * @param imageSize     Image size, for example from
+         *      @ref AbstractImporter::image2DSize()
+         * @param tileSize      Tile size
+         * @param capacity      Max count of tiles kept in memory
+         *
+         * Expects that @p imageSize, @p tileSize and @p capacity are all
+         * non-zero. The @p importer is expected to stay alive and have the
+         * file opened for the whole cache lifetime.
+         */
+        explicit ImageTileCache(AbstractImporter& importer, UnsignedInt id, UnsignedInt level, const Vector2i& imageSize, const Vector2i& tileSize, UnsignedInt capacity);
+
+        /** @brief Copying is not allowed */
+        ImageTileCache(const ImageTileCache&) = delete;
+
+        /** @brief Move constructor */
+        ImageTileCache(ImageTileCache&&) noexcept;
+
+        ~ImageTileCache();
+
+        /** @brief Copying is not allowed */
+        ImageTileCache& operator=(const ImageTileCache&) = delete;
+
+        /** @brief Move assignment */
+        ImageTileCache& operator=(ImageTileCache&&) noexcept;
+
+        /** @brief Importer */
+        AbstractImporter& importer();
+
+        /** @brief Image ID */
+        UnsignedInt id() const;
+
+        /** @brief Image level */
+        UnsignedInt level() const;
+
+        /** @brief Image size */
+        Vector2i imageSize() const;
+
+        /** @brief Tile size */
+        Vector2i tileSize() const;
+
+        /**
+         * @brief Tile count
+         *
+         * Count of tiles in each direction, i.e. the image size divided by
+         * tile size, rounded up.
+         */
+        Vector2i tileCount() const;
+
+        /** @brief Max count of tiles kept in memory */
+        UnsignedInt capacity() const;
+
+        /** @brief Count of tiles currently kept in memory */
+        UnsignedInt cachedTileCount() const;
+
+        /**
+         * @brief Count of tile requests satisfied from the cache
+         *
+         * @see @ref missCount(), @ref resetStatistics()
+         */
+        std::size_t hitCount() const;
+
+        /**
+         * @brief Count of tile requests that needed an import
+         *
+         * Includes failed imports. @see @ref hitCount(), @ref resetStatistics()
+         */
+        std::size_t missCount() const;
+
+        /**
+         * @brief Reset hit and miss counters
+         *
+         * Doesn't affect cached tiles, use @ref clear() for that.
+         */
+        void resetStatistics();
+
+        /**
+         * @brief Pixel rectangle of a tile
+         *
+         * Expects that @p tile is less than @ref tileCount().
+         */
+        Range2Di tileRectangle(const Vector2i& tile) const;
+
+        /**
+         * @brief Get a tile
+         *
+         * If the tile is cached, returns it directly, otherwise imports it
+         * using @ref AbstractImporter::image2DTile(), discarding the least
+         * recently used tile if the cache is full. If the import fails,
+         * returns @ref Containers::NullOpt and the failure isn't cached.
+         * Expects that @p tile is less than @ref tileCount(). The returned
+         * view is guaranteed to stay valid only until the next call to
+         * @ref tile() or @ref clear().
+         */
+        Containers::Optional<ImageView2D> tile(const Vector2i& tile);
+
+        /** @brief Discard all cached tiles */
+        void clear();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
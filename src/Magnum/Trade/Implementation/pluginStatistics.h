@@ -0,0 +1,67 @@
+#ifndef Magnum_Trade_Implementation_pluginStatistics_h
+#define Magnum_Trade_Implementation_pluginStatistics_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Magnum/Trade/PluginStatistics.h"
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Records a single operation into PluginStatistics on destruction. If the
+   statistics pointer is null, it does nothing, not even querying the clock. */
+class PluginStatisticsScope {
+    public:
+        explicit PluginStatisticsScope(PluginStatistics* statistics, PluginOperation operation, std::size_t inputSize = 0) noexcept: _statistics{statistics}, _operation{operation}, _inputSize{inputSize} {
+            if(statistics) _begin = std::chrono::steady_clock::now();
+        }
+
+        PluginStatisticsScope(const PluginStatisticsScope&) = delete;
+        PluginStatisticsScope& operator=(const PluginStatisticsScope&) = delete;
+
+        ~PluginStatisticsScope() {
+            if(!_statistics) return;
+
+            PluginOperationStatistics& statistics = (*_statistics)[_operation];
+            ++statistics.count;
+            statistics.duration += Nanoseconds{Long(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _begin).count())};
+            statistics.inputSize += _inputSize;
+            statistics.outputSize += _outputSize;
+        }
+
+        void setOutputSize(std::size_t size) { _outputSize = size; }
+
+    private:
+        PluginStatistics* _statistics;
+        PluginOperation _operation;
+        std::size_t _inputSize;
+        std::size_t _outputSize{};
+        std::chrono::steady_clock::time_point _begin;
+};
+
+}}}
+
+#endif
@@ -2243,7 +2243,9 @@ class MAGNUM_TRADE_EXPORT MeshData {
     private:
         /* For custom deleter checks. Not done in the constructors here because
            the restriction is pointless when used outside of plugin
-           implementations. */
+           implementations. AbstractImporter additionally replaces the
+           attribute and index data in the attribute-selective mesh() fallback
+           to preserve the data flags. */
         friend AbstractImporter;
         friend AbstractSceneConverter;
 
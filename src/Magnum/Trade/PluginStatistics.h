@@ -0,0 +1,193 @@
+#ifndef Magnum_Trade_PluginStatistics_h
+#define Magnum_Trade_PluginStatistics_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::PluginStatistics, struct @ref Magnum::Trade::PluginOperationStatistics, enum @ref Magnum::Trade::PluginOperation
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Time.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Plugin operation
+@m_since_latest
+
+Operation recorded in @ref PluginStatistics.
+@see @ref AbstractImporter::setStatistics(),
+    @ref AbstractImageConverter::setStatistics(),
+    @ref AbstractSceneConverter::setStatistics()
+*/
+enum class PluginOperation: UnsignedByte {
+    /**
+     * @ref AbstractImporter::openData() and
+     * @relativeref{AbstractImporter,openMemory()}. The input size is the
+     * size of passed data.
+     */
+    OpenData,
+
+    /**
+     * @ref AbstractImporter::openFile(). Only the duration is recorded, as
+     * the file may be read by the plugin itself.
+     */
+    OpenFile,
+
+    /**
+     * @ref AbstractImporter::mesh(). The output size is the size of index
+     * and vertex data of the imported mesh.
+     */
+    Mesh,
+
+    /**
+     * @ref AbstractImporter::image1D(). The output size is the size of the
+     * imported image data.
+     */
+    Image1D,
+
+    /**
+     * @ref AbstractImporter::image2D(). The output size is the size of the
+     * imported image data.
+     */
+    Image2D,
+
+    /**
+     * @ref AbstractImporter::image3D(). The output size is the size of the
+     * imported image data.
+     */
+    Image3D,
+
+    /**
+     * @ref AbstractImageConverter::convert() and
+     * @ref AbstractSceneConverter::convert(). The input and output sizes are
+     * sizes of the image data or of index and vertex data of the mesh.
+     */
+    Convert,
+
+    /**
+     * @ref AbstractImageConverter::convertToData(),
+     * @ref AbstractSceneConverter::convertToData() and
+     * @relativeref{AbstractSceneConverter,endData()}. The input size is the
+     * size of the input image or mesh data, if any, the output size is the
+     * size of the produced file data.
+     */
+    ConvertToData,
+
+    /**
+     * @ref AbstractImageConverter::convertToFile(),
+     * @ref AbstractSceneConverter::convertToFile() and
+     * @relativeref{AbstractSceneConverter,endFile()}. The input size is the
+     * size of the input image or mesh data, if any. The output size isn't
+     * recorded.
+     */
+    ConvertToFile,
+
+    /**
+     * @ref AbstractSceneConverter::add() of a mesh or an image. The input
+     * size is the size of the image data or of index and vertex data of the
+     * mesh.
+     */
+    Add
+};
+
+/**
+@debugoperatorenum{PluginOperation}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, PluginOperation value);
+
+/**
+@brief Statistics of a single plugin operation
+@m_since_latest
+
+All values are cumulative over all recorded calls.
+@see @ref PluginStatistics
+*/
+struct PluginOperationStatistics {
+    /** @brief Count of calls */
+    UnsignedLong count{};
+
+    /** @brief Total duration of all calls */
+    Nanoseconds duration;
+
+    /** @brief Total count of input bytes */
+    UnsignedLong inputSize{};
+
+    /** @brief Total count of output bytes */
+    UnsignedLong outputSize{};
+};
+
+/**
+@brief Plugin statistics
+@m_since_latest
+
+Records call counts, durations and sizes of inputs and outputs of
+@ref PluginOperation "operations" done by an importer or a converter plugin.
+The instance is owned by the application and passed to
+@ref AbstractImporter::setStatistics(),
+@ref AbstractImageConverter::setStatistics() or
+@ref AbstractSceneConverter::setStatistics(). As each operation is recorded
+separately, a single instance can be shared by an importer and converters to
+get an overview of a whole pipeline:
+
+@snippet Trade.cpp PluginStatistics-usage
+
+The statistics are gathered only if an instance is set, so there's no
+overhead for plugins that don't have it. Recording isn't thread-safe ---
+while statistics are set, @ref AbstractImporter::mesh() and image import
+functions aren't allowed to be called from multiple threads at once and
+@ref AbstractImporter::allMeshes() and related APIs import sequentially, even
+if @ref ImporterFeature::ConcurrentDataAccess is supported. See @ref DebugTools::FrameProfilerTrade for showing the values
+together with other per-frame measurements.
+*/
+class PluginStatistics {
+    public:
+        /** @brief Statistics for given operation */
+        PluginOperationStatistics& operator[](PluginOperation operation) {
+            return _operations[UnsignedByte(operation)];
+        }
+        /** @overload */
+        const PluginOperationStatistics& operator[](PluginOperation operation) const {
+            return _operations[UnsignedByte(operation)];
+        }
+
+        /** @brief Reset all statistics to zero */
+        void reset() {
+            for(PluginOperationStatistics& operation: _operations)
+                operation = {};
+        }
+
+    private:
+        PluginOperationStatistics _operations[UnsignedByte(PluginOperation::Add) + 1];
+};
+
+}}
+
+#endif
@@ -40,6 +40,7 @@
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 
 #include "configure.h"
 
@@ -54,6 +55,8 @@ struct AbstractImageConverterTest: TestSuite::Tester {
     void setFlags();
     void setFlagsNotImplemented();
 
+    void statistics();
+
     void thingNotSupported();
 
     void extensionMimeType();
@@ -315,6 +318,8 @@ AbstractImageConverterTest::AbstractImageConverterTest() {
               &AbstractImageConverterTest::setFlags,
               &AbstractImageConverterTest::setFlagsNotImplemented,
 
+              &AbstractImageConverterTest::statistics,
+
               &AbstractImageConverterTest::thingNotSupported,
 
               &AbstractImageConverterTest::extensionMimeType,
@@ -610,6 +615,49 @@ void AbstractImageConverterTest::setFlagsNotImplemented() {
     /* Should just work, no need to implement the function */
 }
 
+void AbstractImageConverterTest::statistics() {
+    struct: AbstractImageConverter {
+        ImageConverterFeatures doFeatures() const override { return ImageConverterFeature::Convert2D|ImageConverterFeature::Convert2DToData; }
+        Containers::Optional<ImageData2D> doConvert(const ImageView2D& image) override {
+            return ImageData2D{PixelFormat::RGBA8Unorm, image.size(), Containers::Array<char>{96}};
+        }
+        Containers::Optional<Containers::Array<char>> doConvertToData(const ImageView2D&) override {
+            return Containers::Array<char>{5};
+        }
+    } converter;
+
+    /* Not set by default, nothing gets recorded */
+    CORRADE_VERIFY(!converter.statistics());
+
+    PluginStatistics statistics;
+    converter.setStatistics(&statistics);
+    CORRADE_COMPARE(converter.statistics(), &statistics);
+
+    const ImageView2D image{PixelFormat::R8Unorm, {4, 6}, Containers::ArrayView<char>{nullptr, 24}};
+    CORRADE_VERIFY(converter.convert(image));
+    CORRADE_VERIFY(converter.convertToData(image));
+    CORRADE_VERIFY(converter.convertToData(image));
+
+    /* Remove previous file, if any */
+    Containers::String filename = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "image.out");
+    if(Utility::Path::exists(filename))
+        CORRADE_VERIFY(Utility::Path::remove(filename));
+
+    /* Delegates to doConvertToData() internally, which shouldn't be recorded
+       as a separate operation */
+    CORRADE_VERIFY(converter.convertToFile(image, filename));
+
+    CORRADE_COMPARE(statistics[PluginOperation::Convert].count, 1);
+    CORRADE_COMPARE(statistics[PluginOperation::Convert].inputSize, 24);
+    CORRADE_COMPARE(statistics[PluginOperation::Convert].outputSize, 96);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToData].count, 2);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToData].inputSize, 48);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToData].outputSize, 10);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToFile].count, 1);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToFile].inputSize, 24);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToFile].outputSize, 0);
+}
+
 void AbstractImageConverterTest::thingNotSupported() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
@@ -37,8 +38,11 @@
 
 #include "Magnum/PixelFormat.h"
 #include "Magnum/FileCallback.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
@@ -47,6 +51,7 @@
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/PhongMaterialData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/SkinData.h"
 #include "Magnum/Trade/TextureData.h"
@@ -79,6 +84,9 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFlagsFileOpened();
     void setFlagsNotImplemented();
 
+    void statistics();
+    void statisticsAllMeshesSequential();
+
     void openData();
     void openDataFailed();
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -270,6 +278,19 @@ struct AbstractImporterTest: TestSuite::Tester {
     void meshCustomVertexDataDeleter();
     void meshCustomAttributesDeleter();
 
+    void meshAttributes();
+    void meshAttributesFallback();
+    void meshAttributesFallbackNoIndices();
+    void meshAttributesFallbackNonOwned();
+    void meshAttributesFailed();
+    void meshAttributesNotImplemented();
+    void meshAttributesOutOfRange();
+    void meshAttributesIndexedButNotRequested();
+    void meshAttributesNotRequested();
+
+    void allMeshes();
+    void allMeshesConcurrent();
+
     void meshAttributeName();
     void meshAttributeNameNotImplemented();
     void meshAttributeNameNotCustom();
@@ -356,6 +377,19 @@ struct AbstractImporterTest: TestSuite::Tester {
     void image2DNonOwningDeleter();
     void image2DGrowableDeleter();
     void image2DCustomDeleter();
+    void image2DSize();
+    void image2DSizeFallback();
+    void image2DSizeNotImplemented();
+    void image2DTile();
+    void image2DTileFallback();
+    void image2DTileFallbackCached();
+    void image2DTileFallbackFailed();
+    void image2DTileFallbackOutOfRange();
+    void image2DTileFallbackCompressed();
+    void image2DTileNotImplemented();
+    void image2DTileEmptyRectangle();
+    void image2DTileWrongSize();
+    void allImages2D();
 
     void image3D();
     void image3DFailed();
@@ -403,6 +437,9 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::setFlagsFileOpened,
               &AbstractImporterTest::setFlagsNotImplemented,
 
+              &AbstractImporterTest::statistics,
+              &AbstractImporterTest::statisticsAllMeshesSequential,
+
               &AbstractImporterTest::openData,
               &AbstractImporterTest::openDataFailed,
               #ifdef MAGNUM_BUILD_DEPRECATED
@@ -603,6 +640,19 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::meshCustomVertexDataDeleter,
               &AbstractImporterTest::meshCustomAttributesDeleter,
 
+              &AbstractImporterTest::meshAttributes,
+              &AbstractImporterTest::meshAttributesFallback,
+              &AbstractImporterTest::meshAttributesFallbackNoIndices,
+              &AbstractImporterTest::meshAttributesFallbackNonOwned,
+              &AbstractImporterTest::meshAttributesFailed,
+              &AbstractImporterTest::meshAttributesNotImplemented,
+              &AbstractImporterTest::meshAttributesOutOfRange,
+              &AbstractImporterTest::meshAttributesIndexedButNotRequested,
+              &AbstractImporterTest::meshAttributesNotRequested,
+
+              &AbstractImporterTest::allMeshes,
+              &AbstractImporterTest::allMeshesConcurrent,
+
               &AbstractImporterTest::meshAttributeName,
               &AbstractImporterTest::meshAttributeNameNotImplemented,
               &AbstractImporterTest::meshAttributeNameNotCustom,
@@ -689,6 +739,19 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::image2DNonOwningDeleter,
               &AbstractImporterTest::image2DGrowableDeleter,
               &AbstractImporterTest::image2DCustomDeleter,
+              &AbstractImporterTest::image2DSize,
+              &AbstractImporterTest::image2DSizeFallback,
+              &AbstractImporterTest::image2DSizeNotImplemented,
+              &AbstractImporterTest::image2DTile,
+              &AbstractImporterTest::image2DTileFallback,
+              &AbstractImporterTest::image2DTileFallbackCached,
+              &AbstractImporterTest::image2DTileFallbackFailed,
+              &AbstractImporterTest::image2DTileFallbackOutOfRange,
+              &AbstractImporterTest::image2DTileFallbackCompressed,
+              &AbstractImporterTest::image2DTileNotImplemented,
+              &AbstractImporterTest::image2DTileEmptyRectangle,
+              &AbstractImporterTest::image2DTileWrongSize,
+              &AbstractImporterTest::allImages2D,
 
               &AbstractImporterTest::image3D,
               &AbstractImporterTest::image3DFailed,
@@ -808,6 +871,99 @@ void AbstractImporterTest::setFlagsNotImplemented() {
     /* Should just work, no need to implement the function */
 }
 
+void AbstractImporterTest::statistics() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+        void doOpenData(Containers::Array<char>&&, DataFlags) override {
+            _opened = true;
+        }
+
+        UnsignedInt doMeshCount() const override { return 2; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+            if(id == 1) return {};
+
+            Containers::Array<char> indexData{ValueInit, 3*2};
+            Containers::Array<char> vertexData{ValueInit, 3*12};
+            MeshIndexData indices{Containers::arrayCast<const UnsignedShort>(indexData)};
+            MeshAttributeData positions{MeshAttribute::Position, Containers::arrayCast<const Vector3>(vertexData)};
+            return MeshData{MeshPrimitive::Triangles,
+                Utility::move(indexData), indices,
+                Utility::move(vertexData), {positions}};
+        }
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{PixelFormat::RGBA8Unorm, {2, 2}, Containers::Array<char>{ValueInit, 2*2*4}};
+        }
+
+        bool _opened = false;
+    } importer;
+
+    /* Not set by default, nothing gets recorded */
+    CORRADE_VERIFY(!importer.statistics());
+
+    PluginStatistics statistics;
+    importer.setStatistics(&statistics);
+    CORRADE_COMPARE(importer.statistics(), &statistics);
+
+    const char data[17]{};
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(importer.mesh(0));
+    CORRADE_VERIFY(importer.mesh(0));
+    /* Failed imports are counted as well, but produce no output */
+    CORRADE_VERIFY(!importer.mesh(1));
+    CORRADE_VERIFY(importer.image2D(0));
+
+    CORRADE_COMPARE(statistics[PluginOperation::OpenData].count, 1);
+    CORRADE_COMPARE(statistics[PluginOperation::OpenData].inputSize, 17);
+    CORRADE_COMPARE(statistics[PluginOperation::OpenData].outputSize, 0);
+    CORRADE_COMPARE(statistics[PluginOperation::Mesh].count, 3);
+    CORRADE_COMPARE(statistics[PluginOperation::Mesh].inputSize, 0);
+    CORRADE_COMPARE(statistics[PluginOperation::Mesh].outputSize, 2*(6 + 36));
+    CORRADE_COMPARE(statistics[PluginOperation::Image2D].count, 1);
+    CORRADE_COMPARE(statistics[PluginOperation::Image2D].outputSize, 16);
+    CORRADE_COMPARE(statistics[PluginOperation::Image1D].count, 0);
+    CORRADE_COMPARE(statistics[PluginOperation::OpenFile].count, 0);
+
+    /* Resetting the pointer stops the recording */
+    importer.setStatistics(nullptr);
+    CORRADE_VERIFY(importer.mesh(0));
+    CORRADE_COMPARE(statistics[PluginOperation::Mesh].count, 3);
+}
+
+void AbstractImporterTest::statisticsAllMeshesSequential() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ConcurrentDataAccess; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 16; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+            /* Would be a data race if this got called from multiple threads
+               at once, which is what the statistics recording expects to not
+               happen either */
+            CORRADE_COMPARE(id, calls++);
+            return MeshData{MeshPrimitive::Points, id};
+        }
+
+        UnsignedInt calls = 0;
+    } importer;
+
+    PluginStatistics statistics;
+    importer.setStatistics(&statistics);
+
+    ThreadPool pool{3};
+    ThreadPool::setGlobal(&pool);
+    Containers::Array<Containers::Optional<MeshData>> meshes = importer.allMeshes();
+    ThreadPool::setGlobal(nullptr);
+
+    CORRADE_COMPARE(meshes.size(), 16);
+    CORRADE_COMPARE(importer.calls, 16);
+    CORRADE_COMPARE(statistics[PluginOperation::Mesh].count, 16);
+}
+
 void AbstractImporterTest::openData() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
@@ -1773,6 +1929,7 @@ void AbstractImporterTest::thingNoFile() {
 
     importer.mesh(42);
     importer.mesh("foo");
+    importer.allMeshes();
     importer.material(42);
     importer.material("foo");
     importer.texture(42);
@@ -1780,10 +1937,13 @@ void AbstractImporterTest::thingNoFile() {
 
     importer.image1D(42);
     importer.image1D("foo");
+    importer.allImages1D();
     importer.image2D(42);
     importer.image2D("foo");
+    importer.allImages2D();
     importer.image3D(42);
     importer.image3D("foo");
+    importer.allImages3D();
 
     importer.importerState();
 
@@ -1805,6 +1965,7 @@ void AbstractImporterTest::thingNoFile() {
 
         "Trade::AbstractImporter::mesh(): no file opened\n"
         "Trade::AbstractImporter::mesh(): no file opened\n"
+        "Trade::AbstractImporter::allMeshes(): no file opened\n"
         "Trade::AbstractImporter::material(): no file opened\n"
         "Trade::AbstractImporter::material(): no file opened\n"
         "Trade::AbstractImporter::texture(): no file opened\n"
@@ -1812,10 +1973,13 @@ void AbstractImporterTest::thingNoFile() {
 
         "Trade::AbstractImporter::image1D(): no file opened\n"
         "Trade::AbstractImporter::image1D(): no file opened\n"
+        "Trade::AbstractImporter::allImages1D(): no file opened\n"
         "Trade::AbstractImporter::image2D(): no file opened\n"
         "Trade::AbstractImporter::image2D(): no file opened\n"
+        "Trade::AbstractImporter::allImages2D(): no file opened\n"
         "Trade::AbstractImporter::image3D(): no file opened\n"
         "Trade::AbstractImporter::image3D(): no file opened\n"
+        "Trade::AbstractImporter::allImages3D(): no file opened\n"
 
         "Trade::AbstractImporter::importerState(): no file opened\n");
 }
@@ -5900,6 +6064,321 @@ void AbstractImporterTest::meshCustomAttributesDeleter() {
     );
 }
 
+void AbstractImporterTest::meshAttributes() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::MeshAttributeSelection; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 8; }
+        UnsignedInt doMeshLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            CORRADE_FAIL("This shouldn't be called");
+            return {};
+        }
+        Containers::Optional<MeshData> doMeshAttributes(UnsignedInt id, UnsignedInt level, Containers::ArrayView<const MeshAttribute> attributes, bool indices) override {
+            if(id == 7 && level == 2 && attributes.size() == 2 && attributes[0] == MeshAttribute::Normal && attributes[1] == MeshAttribute::Position && !indices)
+                return MeshData{MeshPrimitive::Points, nullptr, {MeshAttributeData{MeshAttribute::Position, VertexFormat::Vector3, nullptr}}, MeshData::ImplicitVertexCount, &state};
+            return {};
+        }
+    } importer;
+
+    Containers::Optional<MeshData> data = importer.mesh(7, 2, {MeshAttribute::Normal, MeshAttribute::Position}, false);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->importerState(), &state);
+}
+
+void AbstractImporterTest::meshAttributesFallback() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            Containers::Array<char> indexData{3*sizeof(UnsignedShort)};
+            Containers::Array<char> vertexData{2*sizeof(Vertex)};
+            auto indices = Containers::arrayCast<UnsignedShort>(indexData);
+            indices[0] = 1;
+            indices[1] = 0;
+            indices[2] = 1;
+            auto vertices = Containers::arrayCast<Vertex>(vertexData);
+            vertices[0] = {{1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, 1.0f}, {0.25f, 0.75f}, {0.5f, 0.5f}};
+            vertices[1] = {{4.0f, 5.0f, 6.0f}, {0.0f, 1.0f, 0.0f}, {0.5f, 1.0f}, {1.0f, 0.0f}};
+            return MeshData{MeshPrimitive::Triangles,
+                Utility::move(indexData), MeshIndexData{indices},
+                Utility::move(vertexData), {
+                    MeshAttributeData{MeshAttribute::Position, Containers::stridedArrayView(vertices).slice(&Vertex::position)},
+                    MeshAttributeData{MeshAttribute::TextureCoordinates, Containers::stridedArrayView(vertices).slice(&Vertex::textureCoordinates1)},
+                    MeshAttributeData{MeshAttribute::Normal, Containers::stridedArrayView(vertices).slice(&Vertex::normal)},
+                    MeshAttributeData{MeshAttribute::TextureCoordinates, Containers::stridedArrayView(vertices).slice(&Vertex::textureCoordinates2)},
+                }, MeshData::ImplicitVertexCount, &state};
+        }
+
+        struct Vertex {
+            Vector3 position;
+            Vector3 normal;
+            Vector2 textureCoordinates1;
+            Vector2 textureCoordinates2;
+        };
+    } importer;
+
+    /* Order of the requested attributes doesn't matter, attributes that are
+       not present are ignored, all attributes of a matching name are kept */
+    Containers::Optional<MeshData> data = importer.mesh(0, 0, {MeshAttribute::TextureCoordinates, MeshAttribute::Color, MeshAttribute::Position});
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data->importerState(), &state);
+    CORRADE_VERIFY(data->isIndexed());
+    CORRADE_COMPARE_AS(data->indices<UnsignedShort>(), Containers::arrayView<UnsignedShort>({
+        1, 0, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(data->vertexCount(), 2);
+    CORRADE_COMPARE(data->attributeCount(), 3);
+    CORRADE_COMPARE(data->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE(data->attributeName(1), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(data->attributeName(2), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data->attribute<Vector2>(MeshAttribute::TextureCoordinates, 1), Containers::arrayView<Vector2>({
+        {0.5f, 0.5f}, {1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(data->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+}
+
+void AbstractImporterTest::meshAttributesFallbackNoIndices() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            Containers::Array<char> indexData{3*sizeof(UnsignedInt)};
+            Containers::Array<char> vertexData{2*sizeof(Vector3)};
+            auto indices = Containers::arrayCast<UnsignedInt>(indexData);
+            auto vertices = Containers::arrayCast<Vector3>(vertexData);
+            vertices[0] = {1.0f, 2.0f, 3.0f};
+            vertices[1] = {4.0f, 5.0f, 6.0f};
+            return MeshData{MeshPrimitive::Triangles,
+                Utility::move(indexData), MeshIndexData{indices},
+                Utility::move(vertexData), {
+                    MeshAttributeData{MeshAttribute::Position, vertices}
+                }};
+        }
+    } importer;
+
+    Containers::Optional<MeshData> data = importer.mesh(0, 0, {MeshAttribute::Position}, false);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(!data->isIndexed());
+    CORRADE_COMPARE(data->indexData().size(), 0);
+    CORRADE_COMPARE(data->vertexCount(), 2);
+    CORRADE_COMPARE(data->attributeCount(), 1);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}
+    }), TestSuite::Compare::Container);
+
+    /* No attributes requested, the vertex count is still preserved */
+    Containers::Optional<MeshData> empty = importer.mesh(0, 0, {}, false);
+    CORRADE_VERIFY(empty);
+    CORRADE_VERIFY(!empty->isIndexed());
+    CORRADE_COMPARE(empty->attributeCount(), 0);
+    CORRADE_COMPARE(empty->vertexCount(), 2);
+}
+
+void AbstractImporterTest::meshAttributesFallbackNonOwned() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Lines,
+                DataFlag::Global, indices, MeshIndexData{Containers::arrayView(indices)},
+                DataFlag::Global, vertices, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::arrayView(vertices)},
+                    MeshAttributeData{MeshAttribute::Normal, Containers::arrayView(vertices)}
+                }};
+        }
+
+        UnsignedByte indices[2]{1, 0};
+        Vector3 vertices[2]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    } importer;
+
+    /* The data flags should be preserved, not replaced with Owned|Mutable */
+    Containers::Optional<MeshData> data = importer.mesh(0, 0, {MeshAttribute::Normal});
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->indexDataFlags(), DataFlag::Global);
+    CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::Global);
+    CORRADE_COMPARE(data->indexData().data(), static_cast<const void*>(importer.indices));
+    CORRADE_COMPARE(data->vertexData().data(), static_cast<const void*>(importer.vertices));
+    CORRADE_COMPARE(data->attributeCount(), 1);
+    CORRADE_COMPARE(data->attributeName(0), MeshAttribute::Normal);
+}
+
+void AbstractImporterTest::meshAttributesFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return {};
+        }
+    } importer;
+
+    /* The implementation is expected to print an error message on its own */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.mesh(0, 0, {MeshAttribute::Position}));
+    CORRADE_COMPARE(out.str(), "");
+}
+
+void AbstractImporterTest::meshAttributesNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::MeshAttributeSelection; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.mesh(0, 0, {MeshAttribute::Position});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::mesh(): feature advertised but not implemented\n");
+}
+
+void AbstractImporterTest::meshAttributesOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::MeshAttributeSelection; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 8; }
+        UnsignedInt doMeshLevelCount(UnsignedInt) override { return 3; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.mesh(8, 0, {MeshAttribute::Position});
+    importer.mesh(7, 3, {MeshAttribute::Position});
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::mesh(): index 8 out of range for 8 entries\n"
+        "Trade::AbstractImporter::mesh(): level 3 out of range for 3 entries\n");
+}
+
+void AbstractImporterTest::meshAttributesIndexedButNotRequested() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::MeshAttributeSelection; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMeshAttributes(UnsignedInt, UnsignedInt, Containers::ArrayView<const MeshAttribute>, bool) override {
+            return MeshData{MeshPrimitive::Points, DataFlag::Global, indices, MeshIndexData{Containers::arrayView(indices)}, 1};
+        }
+
+        UnsignedInt indices[1]{};
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.mesh(0, 0, {}, false);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::mesh(): implementation returned an indexed mesh but no indices were requested\n");
+}
+
+void AbstractImporterTest::meshAttributesNotRequested() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::MeshAttributeSelection; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMeshAttributes(UnsignedInt, UnsignedInt, Containers::ArrayView<const MeshAttribute>, bool) override {
+            return MeshData{MeshPrimitive::Points, nullptr, {
+                MeshAttributeData{MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+                MeshAttributeData{MeshAttribute::Normal, VertexFormat::Vector3, nullptr}
+            }};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.mesh(0, 0, {MeshAttribute::Position});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::mesh(): implementation returned Trade::MeshAttribute::Normal which was not requested\n");
+}
+
+void AbstractImporterTest::allMeshes() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 3; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+            if(id == 1) {
+                Error{} << "Failed on" << id;
+                return {};
+            }
+            return MeshData{MeshPrimitive::Points, id*5};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<Containers::Optional<MeshData>> meshes = importer.allMeshes();
+    CORRADE_COMPARE(meshes.size(), 3);
+    CORRADE_VERIFY(meshes[0]);
+    CORRADE_COMPARE(meshes[0]->vertexCount(), 0);
+    CORRADE_VERIFY(!meshes[1]);
+    CORRADE_VERIFY(meshes[2]);
+    CORRADE_COMPARE(meshes[2]->vertexCount(), 10);
+    CORRADE_COMPARE(out.str(), "Failed on 1\n");
+}
+
+void AbstractImporterTest::allMeshesConcurrent() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ConcurrentDataAccess; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 64; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Points, id};
+        }
+    } importer;
+
+    ThreadPool pool{3};
+    ThreadPool::setGlobal(&pool);
+    Containers::Array<Containers::Optional<MeshData>> meshes = importer.allMeshes();
+    ThreadPool::setGlobal(nullptr);
+
+    CORRADE_COMPARE(meshes.size(), 64);
+    for(UnsignedInt i = 0; i != meshes.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(meshes[i]);
+        CORRADE_COMPARE(meshes[i]->vertexCount(), i);
+    }
+}
+
 void AbstractImporterTest::meshAttributeName() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -7432,6 +7911,303 @@ void AbstractImporterTest::image2DCustomDeleter() {
         "Trade::AbstractImporter::image2D(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::image2DSize() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ImageTiles; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<Vector2i> doImage2DSize(UnsignedInt id, UnsignedInt level) override {
+            if(id == 7 && level == 2) return Vector2i{3, 4};
+            return {};
+        }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            CORRADE_FAIL("This shouldn't be called");
+            return {};
+        }
+    } importer;
+
+    CORRADE_COMPARE(importer.image2DSize(7, 2), (Vector2i{3, 4}));
+    CORRADE_VERIFY(!importer.image2DSize(6, 2));
+}
+
+void AbstractImporterTest::image2DSizeFallback() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+            if(id == 7 && level == 2) return ImageData2D{PixelFormat::RGBA8Unorm, {3, 4}, Containers::Array<char>{ValueInit, 3*4*4}};
+            return {};
+        }
+    } importer;
+
+    CORRADE_COMPARE(importer.image2DSize(7, 2), (Vector2i{3, 4}));
+    CORRADE_VERIFY(!importer.image2DSize(6, 2));
+}
+
+void AbstractImporterTest::image2DSizeNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ImageTiles; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.image2DSize(0);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DSize(): feature advertised but not implemented\n");
+}
+
+void AbstractImporterTest::image2DTile() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ImageTiles; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<ImageData2D> doImage2DTile(UnsignedInt id, UnsignedInt level, const Range2Di& rectangle) override {
+            if(id == 7 && level == 2 && rectangle == Range2Di{{1, 2}, {3, 5}})
+                return ImageData2D{PixelFormat::RGBA8Unorm, rectangle.size(), Containers::Array<char>{ValueInit, 2*3*4}, ImageFlags2D{}, &state};
+            return {};
+        }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            CORRADE_FAIL("This shouldn't be called");
+            return {};
+        }
+    } importer;
+
+    Containers::Optional<ImageData2D> tile = importer.image2DTile(7, 2, {{1, 2}, {3, 5}});
+    CORRADE_VERIFY(tile);
+    CORRADE_COMPARE(tile->size(), (Vector2i{2, 3}));
+    CORRADE_COMPARE(tile->importerState(), &state);
+
+    CORRADE_VERIFY(!importer.image2DTile(7, 2, {{0, 0}, {1, 1}}));
+}
+
+void AbstractImporterTest::image2DTileFallback() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            /* 3x4 image with three-byte pixels, rows padded to four bytes */
+            Containers::Array<char> data{NoInit, 12*4};
+            for(std::size_t i = 0; i != data.size(); ++i)
+                data[i] = char(i);
+            return ImageData2D{PixelFormat::RGB8Unorm, {3, 4}, Utility::move(data)};
+        }
+    } importer;
+
+    Containers::Optional<ImageData2D> tile = importer.image2DTile(0, 0, {{1, 1}, {3, 3}});
+    CORRADE_VERIFY(tile);
+    CORRADE_COMPARE(tile->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(tile->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(tile->storage().alignment(), 4);
+    /* Each row is six bytes, padded to eight */
+    CORRADE_COMPARE(tile->data().size(), 16);
+    CORRADE_COMPARE_AS(tile->pixels<Color3ub>()[0], Containers::arrayView<Color3ub>({
+        {15, 16, 17}, {18, 19, 20}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(tile->pixels<Color3ub>()[1], Containers::arrayView<Color3ub>({
+        {27, 28, 29}, {30, 31, 32}
+    }), TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::image2DTileFallbackCached() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return opened; }
+        void doClose() override { opened = false; }
+
+        UnsignedInt doImage2DCount() const override { return 2; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 2; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            ++importCount;
+            return ImageData2D{PixelFormat::RGBA8Unorm, {4, 4}, Containers::Array<char>{ValueInit, 4*4*4}};
+        }
+
+        bool opened = true;
+        Int importCount = 0;
+    } importer;
+
+    /* Tiles and size of the same level import the image just once */
+    CORRADE_VERIFY(importer.image2DTile(0, 0, {{}, {2, 2}}));
+    CORRADE_VERIFY(importer.image2DTile(0, 0, {{2, 2}, {4, 4}}));
+    CORRADE_COMPARE(importer.image2DSize(0, 0), (Vector2i{4, 4}));
+    CORRADE_COMPARE(importer.importCount, 1);
+
+    /* A different level or image replaces the cached one */
+    CORRADE_VERIFY(importer.image2DTile(0, 1, {{}, {2, 2}}));
+    CORRADE_COMPARE(importer.importCount, 2);
+    CORRADE_VERIFY(importer.image2DTile(1, 1, {{}, {2, 2}}));
+    CORRADE_COMPARE(importer.importCount, 3);
+    CORRADE_VERIFY(importer.image2DTile(0, 0, {{}, {2, 2}}));
+    CORRADE_COMPARE(importer.importCount, 4);
+
+    /* Closing the file discards the cached image */
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+    importer.opened = true;
+    CORRADE_VERIFY(importer.image2DTile(0, 0, {{}, {2, 2}}));
+    CORRADE_COMPARE(importer.importCount, 5);
+}
+
+void AbstractImporterTest::image2DTileFallbackFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return {};
+        }
+    } importer;
+
+    CORRADE_VERIFY(!importer.image2DTile(0, 0, {{}, {1, 1}}));
+}
+
+void AbstractImporterTest::image2DTileFallbackOutOfRange() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{PixelFormat::RGBA8Unorm, {3, 4}, Containers::Array<char>{ValueInit, 3*4*4}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!importer.image2DTile(0, 0, {{-1, 0}, {1, 1}}));
+    CORRADE_VERIFY(!importer.image2DTile(0, 0, {{2, 2}, {4, 4}}));
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::image2DTile(): rectangle {{-1, 0}, {1, 1}} out of range for a {3, 4} image\n"
+        "Trade::AbstractImporter::image2DTile(): rectangle {{2, 2}, {4, 4}} out of range for a {3, 4} image\n");
+}
+
+void AbstractImporterTest::image2DTileFallbackCompressed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, Containers::Array<char>{ValueInit, 8}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!importer.image2DTile(0, 0, {{}, {4, 4}}));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DTile(): tiles of compressed images are not supported\n");
+}
+
+void AbstractImporterTest::image2DTileNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ImageTiles; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.image2DTile(0, 0, {{}, {1, 1}});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DTile(): feature advertised but not implemented\n");
+}
+
+void AbstractImporterTest::image2DTileEmptyRectangle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.image2DTile(0, 0, {{1, 1}, {3, 1}});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DTile(): expected a non-empty rectangle, got {{1, 1}, {3, 1}}\n");
+}
+
+void AbstractImporterTest::image2DTileWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ImageTiles; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2DTile(UnsignedInt, UnsignedInt, const Range2Di&) override {
+            return ImageData2D{PixelFormat::RGBA8Unorm, {2, 2}, Containers::Array<char>{ValueInit, 2*2*4}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.image2DTile(0, 0, {{}, {3, 2}});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DTile(): implementation returned a {2, 2} tile but {3, 2} was requested\n");
+}
+
+void AbstractImporterTest::allImages2D() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 3; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt) override {
+            if(id == 1) {
+                Error{} << "Failed on" << id;
+                return {};
+            }
+            return ImageData2D{PixelFormat::RGBA8Unorm, {Int(id) + 1, 1}, Containers::Array<char>{ValueInit, (id + 1)*4}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<Containers::Optional<ImageData2D>> images = importer.allImages2D();
+    CORRADE_COMPARE(images.size(), 3);
+    CORRADE_VERIFY(images[0]);
+    CORRADE_COMPARE(images[0]->size(), (Vector2i{1, 1}));
+    CORRADE_VERIFY(!images[1]);
+    CORRADE_VERIFY(images[2]);
+    CORRADE_COMPARE(images[2]->size(), (Vector2i{3, 1}));
+    CORRADE_COMPARE(out.str(), "Failed on 1\n");
+}
+
 void AbstractImporterTest::image3D() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -51,6 +51,7 @@
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PluginStatistics.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/SkinData.h"
 #include "Magnum/Trade/TextureData.h"
@@ -75,6 +76,8 @@ struct AbstractSceneConverterTest: TestSuite::Tester {
     void setFlags();
     void setFlagsNotImplemented();
 
+    void statistics();
+
     void thingNotSupported();
     /* Certain features need a combination of flags, test them explicitly */
     void thingLevelsNotSupported();
@@ -640,6 +643,8 @@ AbstractSceneConverterTest::AbstractSceneConverterTest() {
               &AbstractSceneConverterTest::setFlags,
               &AbstractSceneConverterTest::setFlagsNotImplemented,
 
+              &AbstractSceneConverterTest::statistics,
+
               &AbstractSceneConverterTest::thingNotSupported,
               &AbstractSceneConverterTest::thingLevelsNotSupported,
 
@@ -1065,6 +1070,60 @@ void AbstractSceneConverterTest::setFlagsNotImplemented() {
     /* Should just work, no need to implement the function */
 }
 
+void AbstractSceneConverterTest::statistics() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMesh|
+                   SceneConverterFeature::ConvertMultipleToData|
+                   SceneConverterFeature::AddMeshes;
+        }
+
+        Containers::Optional<MeshData> doConvert(const MeshData&) override {
+            Containers::Array<char> vertexData{ValueInit, 2*12};
+            MeshAttributeData positions{MeshAttribute::Position, Containers::arrayCast<const Vector3>(vertexData)};
+            return MeshData{MeshPrimitive::Lines, Utility::move(vertexData), {positions}};
+        }
+
+        bool doBeginData() override { return true; }
+        bool doAdd(UnsignedInt, const MeshData&, Containers::StringView) override {
+            return true;
+        }
+        Containers::Optional<Containers::Array<char>> doEndData() override {
+            return Containers::array({'h', 'e', 'l', 'l', 'o'});
+        }
+    } converter;
+
+    /* Not set by default, nothing gets recorded */
+    CORRADE_VERIFY(!converter.statistics());
+
+    PluginStatistics statistics;
+    converter.setStatistics(&statistics);
+    CORRADE_COMPARE(converter.statistics(), &statistics);
+
+    const Vector3 positions[3]{};
+    const MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    CORRADE_VERIFY(converter.convert(mesh));
+
+    CORRADE_VERIFY(converter.beginData());
+    CORRADE_VERIFY(converter.add(mesh));
+    CORRADE_VERIFY(converter.add(mesh));
+    CORRADE_VERIFY(converter.endData());
+
+    CORRADE_COMPARE(statistics[PluginOperation::Convert].count, 1);
+    CORRADE_COMPARE(statistics[PluginOperation::Convert].inputSize, 36);
+    CORRADE_COMPARE(statistics[PluginOperation::Convert].outputSize, 24);
+    CORRADE_COMPARE(statistics[PluginOperation::Add].count, 2);
+    CORRADE_COMPARE(statistics[PluginOperation::Add].inputSize, 72);
+    CORRADE_COMPARE(statistics[PluginOperation::Add].outputSize, 0);
+    /* The input is recorded in add() already */
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToData].count, 1);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToData].inputSize, 0);
+    CORRADE_COMPARE(statistics[PluginOperation::ConvertToData].outputSize, 5);
+}
+
 void AbstractSceneConverterTest::thingNotSupported() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
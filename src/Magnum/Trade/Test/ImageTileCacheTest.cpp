@@ -0,0 +1,272 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <type_traits>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageTileCache.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ImageTileCacheTest: TestSuite::Tester {
+    explicit ImageTileCacheTest();
+
+    void construct();
+    void constructInvalid();
+    void constructMove();
+
+    void tileRectangle();
+    void tileRectangleOutOfRange();
+
+    void hit();
+    void evictLeastRecentlyUsed();
+    void importFailed();
+    void clear();
+    void tileOutOfRange();
+};
+
+ImageTileCacheTest::ImageTileCacheTest() {
+    addTests({&ImageTileCacheTest::construct,
+              &ImageTileCacheTest::constructInvalid,
+              &ImageTileCacheTest::constructMove,
+
+              &ImageTileCacheTest::tileRectangle,
+              &ImageTileCacheTest::tileRectangleOutOfRange,
+
+              &ImageTileCacheTest::hit,
+              &ImageTileCacheTest::evictLeastRecentlyUsed,
+              &ImageTileCacheTest::importFailed,
+              &ImageTileCacheTest::clear,
+              &ImageTileCacheTest::tileOutOfRange});
+}
+
+/* Records requested tiles, fills each pixel with its X and Y coordinate */
+struct TileImporter: AbstractImporter {
+    ImporterFeatures doFeatures() const override { return ImporterFeature::ImageTiles; }
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    UnsignedInt doImage2DCount() const override { return 1; }
+    Containers::Optional<ImageData2D> doImage2DTile(UnsignedInt, UnsignedInt, const Range2Di& rectangle) override {
+        ++importCount;
+        if(rectangle.min() == failingTile) return {};
+
+        ImageData2D image{PixelFormat::RG8UI, rectangle.size(), Containers::Array<char>{NoInit, std::size_t(((rectangle.sizeX()*2 + 3)/4)*4*rectangle.sizeY())}};
+        for(Int y = 0; y != rectangle.sizeY(); ++y) {
+            for(Int x = 0; x != rectangle.sizeX(); ++x)
+                image.mutablePixels<Vector2ub>()[y][x] = Vector2ub{rectangle.min() + Vector2i{x, y}};
+        }
+        return image;
+    }
+
+    Int importCount = 0;
+    Vector2i failingTile{-1};
+};
+
+void ImageTileCacheTest::construct() {
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 3};
+    CORRADE_COMPARE(&cache.importer(), &importer);
+    CORRADE_COMPARE(cache.id(), 0);
+    CORRADE_COMPARE(cache.level(), 0);
+    CORRADE_COMPARE(cache.imageSize(), (Vector2i{10, 7}));
+    CORRADE_COMPARE(cache.tileSize(), (Vector2i{4, 4}));
+    CORRADE_COMPARE(cache.tileCount(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(cache.capacity(), 3);
+    CORRADE_COMPARE(cache.cachedTileCount(), 0);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+}
+
+void ImageTileCacheTest::constructInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TileImporter importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ImageTileCache{importer, 0, 0, {0, 7}, {4, 4}, 3};
+    ImageTileCache{importer, 0, 0, {10, 7}, {4, 0}, 3};
+    ImageTileCache{importer, 0, 0, {10, 7}, {4, 4}, 0};
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImageTileCache: expected non-zero image size, tile size and capacity, got {0, 7}, {4, 4} and 3\n"
+        "Trade::ImageTileCache: expected non-zero image size, tile size and capacity, got {10, 7}, {4, 0} and 3\n"
+        "Trade::ImageTileCache: expected non-zero image size, tile size and capacity, got {10, 7}, {4, 4} and 0\n");
+}
+
+void ImageTileCacheTest::constructMove() {
+    TileImporter importer;
+    ImageTileCache a{importer, 0, 0, {10, 7}, {4, 4}, 3};
+    CORRADE_VERIFY(a.tile({1, 1}));
+
+    ImageTileCache b = Utility::move(a);
+    CORRADE_COMPARE(b.tileCount(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(b.cachedTileCount(), 1);
+
+    ImageTileCache c{importer, 0, 0, {1, 1}, {1, 1}, 1};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.tileCount(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(c.cachedTileCount(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ImageTileCache>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ImageTileCache>::value);
+}
+
+void ImageTileCacheTest::tileRectangle() {
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 3};
+    CORRADE_COMPARE(cache.tileRectangle({0, 0}), (Range2Di{{0, 0}, {4, 4}}));
+    CORRADE_COMPARE(cache.tileRectangle({1, 0}), (Range2Di{{4, 0}, {8, 4}}));
+    /* Edge tiles are clipped to the image size */
+    CORRADE_COMPARE(cache.tileRectangle({2, 0}), (Range2Di{{8, 0}, {10, 4}}));
+    CORRADE_COMPARE(cache.tileRectangle({2, 1}), (Range2Di{{8, 4}, {10, 7}}));
+}
+
+void ImageTileCacheTest::tileRectangleOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.tileRectangle({3, 0});
+    cache.tileRectangle({0, -1});
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImageTileCache::tileRectangle(): tile {3, 0} out of range for {3, 2} tiles\n"
+        "Trade::ImageTileCache::tileRectangle(): tile {0, -1} out of range for {3, 2} tiles\n");
+}
+
+void ImageTileCacheTest::hit() {
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 3};
+
+    {
+        Containers::Optional<ImageView2D> tile = cache.tile({2, 1});
+        CORRADE_VERIFY(tile);
+        CORRADE_COMPARE(tile->size(), (Vector2i{2, 3}));
+        CORRADE_COMPARE(tile->pixels<Vector2ub>()[0][0], (Vector2ub{8, 4}));
+        CORRADE_COMPARE(tile->pixels<Vector2ub>()[2][1], (Vector2ub{9, 6}));
+    } {
+        Containers::Optional<ImageView2D> tile = cache.tile({2, 1});
+        CORRADE_VERIFY(tile);
+        CORRADE_COMPARE(tile->pixels<Vector2ub>()[2][1], (Vector2ub{9, 6}));
+    }
+
+    CORRADE_COMPARE(importer.importCount, 1);
+    CORRADE_COMPARE(cache.cachedTileCount(), 1);
+    CORRADE_COMPARE(cache.hitCount(), 1);
+    CORRADE_COMPARE(cache.missCount(), 1);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.cachedTileCount(), 1);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+}
+
+void ImageTileCacheTest::evictLeastRecentlyUsed() {
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 2};
+
+    CORRADE_VERIFY(cache.tile({0, 0}));
+    CORRADE_VERIFY(cache.tile({1, 0}));
+    /* Touch the first so the second becomes the least recently used */
+    CORRADE_VERIFY(cache.tile({0, 0}));
+    CORRADE_COMPARE(importer.importCount, 2);
+
+    /* Evicts {1, 0} */
+    Containers::Optional<ImageView2D> tile = cache.tile({2, 0});
+    CORRADE_VERIFY(tile);
+    CORRADE_COMPARE(tile->pixels<Vector2ub>()[0][0], (Vector2ub{8, 0}));
+    CORRADE_COMPARE(importer.importCount, 3);
+    CORRADE_COMPARE(cache.cachedTileCount(), 2);
+
+    /* Still cached */
+    CORRADE_VERIFY(cache.tile({0, 0}));
+    CORRADE_COMPARE(importer.importCount, 3);
+
+    /* Got evicted, needs to be imported again */
+    CORRADE_VERIFY(cache.tile({1, 0}));
+    CORRADE_COMPARE(importer.importCount, 4);
+
+    CORRADE_COMPARE(cache.hitCount(), 2);
+    CORRADE_COMPARE(cache.missCount(), 4);
+}
+
+void ImageTileCacheTest::importFailed() {
+    TileImporter importer;
+    importer.failingTile = {4, 0};
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 2};
+
+    CORRADE_VERIFY(cache.tile({0, 0}));
+    CORRADE_VERIFY(!cache.tile({1, 0}));
+    CORRADE_COMPARE(cache.cachedTileCount(), 1);
+
+    /* Failures aren't cached */
+    CORRADE_VERIFY(!cache.tile({1, 0}));
+    CORRADE_COMPARE(importer.importCount, 3);
+    CORRADE_COMPARE(cache.missCount(), 3);
+}
+
+void ImageTileCacheTest::clear() {
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 3};
+
+    CORRADE_VERIFY(cache.tile({0, 0}));
+    CORRADE_VERIFY(cache.tile({1, 1}));
+    CORRADE_COMPARE(cache.cachedTileCount(), 2);
+
+    cache.clear();
+    CORRADE_COMPARE(cache.cachedTileCount(), 0);
+
+    CORRADE_VERIFY(cache.tile({0, 0}));
+    CORRADE_COMPARE(importer.importCount, 3);
+}
+
+void ImageTileCacheTest::tileOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TileImporter importer;
+    ImageTileCache cache{importer, 0, 0, {10, 7}, {4, 4}, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.tile({0, 2});
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImageTileCache::tile(): tile {0, 2} out of range for {3, 2} tiles\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageTileCacheTest)
@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Trade/PluginStatistics.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct PluginStatisticsTest: TestSuite::Tester {
+    explicit PluginStatisticsTest();
+
+    void construct();
+    void access();
+    void reset();
+
+    void debugOperation();
+    void debugOperationPacked();
+};
+
+PluginStatisticsTest::PluginStatisticsTest() {
+    addTests({&PluginStatisticsTest::construct,
+              &PluginStatisticsTest::access,
+              &PluginStatisticsTest::reset,
+
+              &PluginStatisticsTest::debugOperation,
+              &PluginStatisticsTest::debugOperationPacked});
+}
+
+using namespace Math::Literals;
+
+void PluginStatisticsTest::construct() {
+    const PluginStatistics statistics;
+
+    /* MSVC 2015 needs the {} */
+    for(PluginOperation operation: {PluginOperation::OpenData,
+                                    PluginOperation::Image2D,
+                                    PluginOperation::Add}) {
+        CORRADE_ITERATION(operation);
+        CORRADE_COMPARE(statistics[operation].count, 0);
+        CORRADE_COMPARE(statistics[operation].duration, 0_nsec);
+        CORRADE_COMPARE(statistics[operation].inputSize, 0);
+        CORRADE_COMPARE(statistics[operation].outputSize, 0);
+    }
+}
+
+void PluginStatisticsTest::access() {
+    PluginStatistics statistics;
+    statistics[PluginOperation::Mesh].count = 3;
+    statistics[PluginOperation::Mesh].duration = 150_nsec;
+    statistics[PluginOperation::Mesh].outputSize = 1024;
+    statistics[PluginOperation::ConvertToData].inputSize = 2048;
+
+    const PluginStatistics& cstatistics = statistics;
+    CORRADE_COMPARE(cstatistics[PluginOperation::Mesh].count, 3);
+    CORRADE_COMPARE(cstatistics[PluginOperation::Mesh].duration, 150_nsec);
+    CORRADE_COMPARE(cstatistics[PluginOperation::Mesh].inputSize, 0);
+    CORRADE_COMPARE(cstatistics[PluginOperation::Mesh].outputSize, 1024);
+    CORRADE_COMPARE(cstatistics[PluginOperation::ConvertToData].count, 0);
+    CORRADE_COMPARE(cstatistics[PluginOperation::ConvertToData].inputSize, 2048);
+
+    /* Other operations stay untouched */
+    CORRADE_COMPARE(cstatistics[PluginOperation::Image2D].count, 0);
+    CORRADE_COMPARE(cstatistics[PluginOperation::ConvertToFile].inputSize, 0);
+}
+
+void PluginStatisticsTest::reset() {
+    PluginStatistics statistics;
+    statistics[PluginOperation::OpenFile].count = 1;
+    statistics[PluginOperation::OpenFile].duration = 1500_nsec;
+    statistics[PluginOperation::Add].inputSize = 4096;
+
+    statistics.reset();
+    CORRADE_COMPARE(statistics[PluginOperation::OpenFile].count, 0);
+    CORRADE_COMPARE(statistics[PluginOperation::OpenFile].duration, 0_nsec);
+    CORRADE_COMPARE(statistics[PluginOperation::Add].inputSize, 0);
+}
+
+void PluginStatisticsTest::debugOperation() {
+    std::ostringstream out;
+
+    Debug{&out} << PluginOperation::ConvertToData << PluginOperation(0xbe);
+    CORRADE_COMPARE(out.str(), "Trade::PluginOperation::ConvertToData Trade::PluginOperation(0xbe)\n");
+}
+
+void PluginStatisticsTest::debugOperationPacked() {
+    std::ostringstream out;
+    /* Last is not packed, ones before should not make any flags persistent */
+    Debug{&out} << Debug::packed << PluginOperation::ConvertToData << Debug::packed << PluginOperation(0xbe) << PluginOperation::Mesh;
+    CORRADE_COMPARE(out.str(), "ConvertToData 0xbe Trade::PluginOperation::Mesh\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::PluginStatisticsTest)
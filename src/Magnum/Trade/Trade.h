@@ -82,6 +82,8 @@ typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
+class ImageTileCache;
+
 enum class LightType: UnsignedByte;
 class LightData;
 
@@ -102,6 +104,9 @@ class PbrClearCoatMaterialData;
 class PbrMetallicRoughnessMaterialData;
 class PbrSpecularGlossinessMaterialData;
 class PhongMaterialData;
+enum class PluginOperation: UnsignedByte;
+struct PluginOperationStatistics;
+class PluginStatistics;
 class TextureData;
 
 enum class SceneMappingType: UnsignedByte;
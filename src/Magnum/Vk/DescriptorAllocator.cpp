@@ -0,0 +1,242 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DescriptorAllocator.h"
+
+#include <unordered_map>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Vk/DescriptorPool.h"
+#include "Magnum/Vk/DescriptorPoolCreateInfo.h"
+#include "Magnum/Vk/DescriptorSet.h"
+
+namespace Magnum { namespace Vk {
+
+namespace {
+
+/* The resource list is referenced, not copied, so a lookup doesn't need to
+   allocate. Keys stored in the map point to Frame::keyStorage. */
+struct CacheKey {
+    VkDescriptorSetLayout layout;
+    Containers::ArrayView<const UnsignedLong> resources;
+};
+
+struct CacheKeyHash {
+    std::size_t operator()(const CacheKey& key) const {
+        /* Non-dispatchable handles are 64-bit on all platforms, so going
+           through UnsignedLong works on 32-bit as well */
+        const std::size_t resourceHash = *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(reinterpret_cast<const char*>(key.resources.data()), key.resources.size()*sizeof(UnsignedLong)).byteArray());
+        return resourceHash ^ std::size_t(UnsignedLong(key.layout));
+    }
+};
+
+struct CacheKeyEqual {
+    bool operator()(const CacheKey& a, const CacheKey& b) const {
+        if(a.layout != b.layout || a.resources.size() != b.resources.size())
+            return false;
+        for(std::size_t i = 0; i != a.resources.size(); ++i)
+            if(a.resources[i] != b.resources[i]) return false;
+        return true;
+    }
+};
+
+}
+
+struct DescriptorAllocator::State {
+    struct Frame {
+        Containers::Array<DescriptorPool> pools;
+        /* Index of the pool to allocate from next. Pools before it are
+           exhausted, pools after it were created in a previous cycle and are
+           empty. */
+        std::size_t currentPool{};
+        std::unordered_map<CacheKey, VkDescriptorSet, CacheKeyHash, CacheKeyEqual> cache;
+        /* Each key copy is a separate allocation so growing this array
+           doesn't invalidate views in the cache keys */
+        Containers::Array<Containers::Array<UnsignedLong>> keyStorage;
+    };
+
+    explicit State(Device& device, UnsignedInt frameCount, UnsignedInt setsPerPool, Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes): device(device), frames{ValueInit, frameCount}, setsPerPool{setsPerPool}, poolSizes{NoInit, poolSizes.size()} {
+        Utility::copy(poolSizes, this->poolSizes);
+    }
+
+    Device& device;
+    Containers::Array<Frame> frames;
+    UnsignedInt setsPerPool;
+    Containers::Array<Containers::Pair<DescriptorType, UnsignedInt>> poolSizes;
+
+    UnsignedInt currentFrame{};
+    UnsignedInt poolCount{};
+    UnsignedLong allocationCount{};
+    UnsignedLong cacheHitCount{};
+    UnsignedLong cacheMissCount{};
+};
+
+DescriptorAllocator::DescriptorAllocator(Device& device, const UnsignedInt frameCount, const UnsignedInt setsPerPool, const Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes) {
+    CORRADE_ASSERT(frameCount,
+        "Vk::DescriptorAllocator: there has to be at least one frame", );
+    CORRADE_ASSERT(setsPerPool,
+        "Vk::DescriptorAllocator: there has to be at least one set per pool", );
+    /* See DescriptorPoolCreateInfo for why not just !poolSizes */
+    CORRADE_ASSERT(!poolSizes.isEmpty(),
+        "Vk::DescriptorAllocator: there has to be at least one pool size", );
+
+    _state.emplace(device, frameCount, setsPerPool, poolSizes);
+}
+
+DescriptorAllocator::DescriptorAllocator(Device& device, const UnsignedInt frameCount, const UnsignedInt setsPerPool, const std::initializer_list<Containers::Pair<DescriptorType, UnsignedInt>> poolSizes): DescriptorAllocator{device, frameCount, setsPerPool, Containers::arrayView(poolSizes)} {}
+
+DescriptorAllocator::DescriptorAllocator(NoCreateT) noexcept {}
+
+DescriptorAllocator::DescriptorAllocator(DescriptorAllocator&&) noexcept = default;
+
+DescriptorAllocator::~DescriptorAllocator() = default;
+
+DescriptorAllocator& DescriptorAllocator::operator=(DescriptorAllocator&&) noexcept = default;
+
+UnsignedInt DescriptorAllocator::frameCount() const {
+    return _state ? _state->frames.size() : 0;
+}
+
+UnsignedInt DescriptorAllocator::currentFrame() const {
+    return _state ? _state->currentFrame : 0;
+}
+
+VkDescriptorSet DescriptorAllocator::allocateInternal(const char* const messagePrefix, const VkDescriptorSetLayout layout, const UnsignedInt* const variableDescriptorCount) {
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(messagePrefix);
+    #endif
+
+    State::Frame& frame = _state->frames[_state->currentFrame];
+    for(;;) {
+        bool fresh = false;
+        if(frame.currentPool == frame.pools.size()) {
+            arrayAppend(frame.pools, InPlaceInit, _state->device, DescriptorPoolCreateInfo{_state->setsPerPool, _state->poolSizes});
+            ++_state->poolCount;
+            fresh = true;
+        }
+
+        DescriptorPool& pool = frame.pools[frame.currentPool];
+        Containers::Optional<DescriptorSet> set = variableDescriptorCount ?
+            pool.tryAllocate(layout, *variableDescriptorCount) :
+            pool.tryAllocate(layout);
+        if(set) {
+            ++_state->allocationCount;
+            /* The pools are created without FreeDescriptorSet so this is
+               just to be explicit about the ownership */
+            return set->release();
+        }
+
+        /* If it didn't fit into an empty pool, it won't fit into the next
+           one either */
+        CORRADE_ASSERT(!fresh,
+            messagePrefix << "the layout doesn't fit into a single pool", {});
+        ++frame.currentPool;
+    }
+}
+
+VkDescriptorSet DescriptorAllocator::allocate(const VkDescriptorSetLayout layout) {
+    CORRADE_ASSERT(_state,
+        "Vk::DescriptorAllocator::allocate(): the allocator is not created", {});
+    return allocateInternal("Vk::DescriptorAllocator::allocate():", layout, nullptr);
+}
+
+VkDescriptorSet DescriptorAllocator::allocate(const VkDescriptorSetLayout layout, const UnsignedInt variableDescriptorCount) {
+    CORRADE_ASSERT(_state,
+        "Vk::DescriptorAllocator::allocate(): the allocator is not created", {});
+    return allocateInternal("Vk::DescriptorAllocator::allocate():", layout, &variableDescriptorCount);
+}
+
+Containers::Pair<VkDescriptorSet, bool> DescriptorAllocator::allocateCached(const VkDescriptorSetLayout layout, const Containers::ArrayView<const UnsignedLong> resources) {
+    CORRADE_ASSERT(_state,
+        "Vk::DescriptorAllocator::allocateCached(): the allocator is not created", {});
+
+    State::Frame& frame = _state->frames[_state->currentFrame];
+    const auto found = frame.cache.find(CacheKey{layout, resources});
+    if(found != frame.cache.end()) {
+        ++_state->cacheHitCount;
+        return {found->second, false};
+    }
+
+    ++_state->cacheMissCount;
+    const VkDescriptorSet set = allocateInternal("Vk::DescriptorAllocator::allocateCached():", layout, nullptr);
+    #ifdef CORRADE_GRACEFUL_ASSERT
+    if(!set) return {};
+    #endif
+
+    Containers::Array<UnsignedLong> resourcesCopy{NoInit, resources.size()};
+    Utility::copy(resources, resourcesCopy);
+    frame.cache.emplace(CacheKey{layout, resourcesCopy}, set);
+    arrayAppend(frame.keyStorage, Utility::move(resourcesCopy));
+    return {set, true};
+}
+
+Containers::Pair<VkDescriptorSet, bool> DescriptorAllocator::allocateCached(const VkDescriptorSetLayout layout, const std::initializer_list<UnsignedLong> resources) {
+    return allocateCached(layout, Containers::arrayView(resources));
+}
+
+void DescriptorAllocator::nextFrame() {
+    CORRADE_ASSERT(_state,
+        "Vk::DescriptorAllocator::nextFrame(): the allocator is not created", );
+
+    _state->currentFrame = (_state->currentFrame + 1) % _state->frames.size();
+    State::Frame& frame = _state->frames[_state->currentFrame];
+
+    /* Pools past currentPool weren't touched since their last reset */
+    for(std::size_t i = 0, end = Math::min(frame.currentPool + 1, frame.pools.size()); i != end; ++i)
+        frame.pools[i].reset();
+    frame.currentPool = 0;
+    frame.cache.clear();
+    arrayResize(frame.keyStorage, NoInit, 0); /** @todo arrayClear() */
+}
+
+UnsignedInt DescriptorAllocator::poolCount() const {
+    return _state ? _state->poolCount : 0;
+}
+
+UnsignedLong DescriptorAllocator::allocationCount() const {
+    return _state ? _state->allocationCount : 0;
+}
+
+UnsignedLong DescriptorAllocator::cacheHitCount() const {
+    return _state ? _state->cacheHitCount : 0;
+}
+
+UnsignedLong DescriptorAllocator::cacheMissCount() const {
+    return _state ? _state->cacheMissCount : 0;
+}
+
+void DescriptorAllocator::resetStatistics() {
+    if(!_state) return;
+    _state->allocationCount = 0;
+    _state->cacheHitCount = 0;
+    _state->cacheMissCount = 0;
+}
+
+}}
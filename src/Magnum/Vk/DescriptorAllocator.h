@@ -0,0 +1,250 @@
+#ifndef Magnum_Vk_DescriptorAllocator_h
+#define Magnum_Vk_DescriptorAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::DescriptorAllocator
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/visibility.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Growable descriptor set allocator
+@m_since_latest
+
+Manages a set of @ref DescriptorPool instances for each frame in flight.
+Unlike a plain @ref DescriptorPool that has to be sized upfront for the worst
+case, the allocator starts with no pools and creates a new one with the same
+parameters every time the current pool gets exhausted. When a frame is
+finished, all pools belonging to it get reset at once with @ref nextFrame()
+instead of freeing the sets individually.
+
+@section Vk-DescriptorAllocator-usage Usage
+
+The allocator takes the count of frames in flight and then the same
+parameters a @ref DescriptorPoolCreateInfo would --- maximum count of sets and
+total descriptor counts for each @ref DescriptorType, which describe a single
+pool in the chain:
+
+@snippet Vk.cpp DescriptorAllocator-usage
+
+The returned @type_vk{DescriptorSet} handles are valid until @ref nextFrame()
+cycles back to the same frame. It's the application responsibility to ensure
+the GPU is no longer using the sets from that frame, usually by waiting on a
+@ref Fence signalled by the frame's submission.
+
+@section Vk-DescriptorAllocator-cache Descriptor set cache
+
+Since there's no way to compare the contents of two descriptor sets, the cache
+accessible through @ref allocateCached() is keyed on the layout and a list of
+opaque 64-bit values identifying the resources bound to the set, such as
+@type_vk{Buffer} or @type_vk{ImageView} handles. If a set with the same key was
+already allocated in the current frame, it's returned directly and the caller
+can skip the @fn_vk{UpdateDescriptorSets} call. The cache is cleared together
+with the pools in @ref nextFrame().
+
+@section Vk-DescriptorAllocator-statistics Statistics
+
+The @ref poolCount(), @ref allocationCount(), @ref cacheHitCount() and
+@ref cacheMissCount() queries can be used to tune the pool size and to check
+the cache efficiency. All but @ref poolCount() can be reset with
+@ref resetStatistics().
+*/
+class MAGNUM_VK_EXPORT DescriptorAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param device        Vulkan device to allocate the descriptor
+         *      pools on
+         * @param frameCount    Count of frames in flight. Expected to be
+         *      non-zero.
+         * @param setsPerPool   Max count of descriptor sets allocated from a
+         *      single pool
+         * @param poolSizes     Total descriptor counts for each descriptor
+         *      type in a single pool
+         *
+         * No pools are created upfront, the first pool for each frame gets
+         * created on the first allocation. The @p setsPerPool and
+         * @p poolSizes are subject to the same restrictions as in
+         * @ref DescriptorPoolCreateInfo::DescriptorPoolCreateInfo(UnsignedInt, Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>>, DescriptorPoolCreateInfo::Flags).
+         */
+        explicit DescriptorAllocator(Device& device, UnsignedInt frameCount, UnsignedInt setsPerPool, Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes);
+
+        /** @overload */
+        explicit DescriptorAllocator(Device& device, UnsignedInt frameCount, UnsignedInt setsPerPool, std::initializer_list<Containers::Pair<DescriptorType, UnsignedInt>> poolSizes);
+
+        /**
+         * @brief Construct without creating the allocator
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit DescriptorAllocator(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        DescriptorAllocator(const DescriptorAllocator&) = delete;
+
+        /** @brief Move constructor */
+        DescriptorAllocator(DescriptorAllocator&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all descriptor pools, which implicitly frees all
+         * descriptor sets allocated from them.
+         */
+        ~DescriptorAllocator();
+
+        /** @brief Copying is not allowed */
+        DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+        /** @brief Move assignment */
+        DescriptorAllocator& operator=(DescriptorAllocator&& other) noexcept;
+
+        /** @brief Count of frames in flight */
+        UnsignedInt frameCount() const;
+
+        /**
+         * @brief Current frame
+         *
+         * Index of the frame from which the sets are allocated, in range
+         * @cpp [0, frameCount()) @ce. Initially @cpp 0 @ce, advanced by
+         * @ref nextFrame().
+         */
+        UnsignedInt currentFrame() const;
+
+        /**
+         * @brief Allocate a descriptor set
+         *
+         * Allocates from the current pool of the current frame. If the pool
+         * is exhausted, continues with the next pool in the chain, creating a
+         * new one if there's none left. It's expected that a set with
+         * @p layout fits into a freshly created pool.
+         * @see @ref DescriptorPool::tryAllocate(VkDescriptorSetLayout)
+         */
+        VkDescriptorSet allocate(VkDescriptorSetLayout layout);
+
+        /**
+         * @brief Allocate a descriptor set with a variable descriptor count
+         *
+         * Like @ref allocate(VkDescriptorSetLayout), but with
+         * @p variableDescriptorCount used for a binding that was created with
+         * @ref DescriptorSetLayoutBinding::Flag::VariableDescriptorCount.
+         * @see @ref DescriptorPool::tryAllocate(VkDescriptorSetLayout, UnsignedInt)
+         * @requires_vk_feature @ref DeviceFeature::DescriptorBindingVariableDescriptorCount
+         */
+        VkDescriptorSet allocate(VkDescriptorSetLayout layout, UnsignedInt variableDescriptorCount);
+
+        /**
+         * @brief Allocate a descriptor set or reuse a cached one
+         * @param layout        Descriptor set layout
+         * @param resources     Opaque values identifying resources bound to
+         *      the set
+         * @return The descriptor set and @cpp true @ce if it was newly
+         *      allocated and has to be written to, @cpp false @ce if it's a
+         *      set that was already returned for the same @p layout and
+         *      @p resources in the current frame.
+         *
+         * Cached sets are not shared with the sets returned from
+         * @ref allocate(), and are valid only until @ref nextFrame() cycles
+         * back to the current frame.
+         */
+        Containers::Pair<VkDescriptorSet, bool> allocateCached(VkDescriptorSetLayout layout, Containers::ArrayView<const UnsignedLong> resources);
+
+        /** @overload */
+        Containers::Pair<VkDescriptorSet, bool> allocateCached(VkDescriptorSetLayout layout, std::initializer_list<UnsignedLong> resources);
+
+        /**
+         * @brief Advance to the next frame
+         *
+         * Switches to the next frame in flight, resets all its pools and
+         * clears its descriptor set cache. The sets allocated in that frame
+         * are expected to be no longer in use by the GPU.
+         * @see @ref DescriptorPool::reset()
+         */
+        void nextFrame();
+
+        /**
+         * @brief Count of created descriptor pools
+         *
+         * Total across all frames. Pools are never destroyed before the
+         * allocator itself, so this value only grows.
+         */
+        UnsignedInt poolCount() const;
+
+        /**
+         * @brief Count of allocated descriptor sets
+         *
+         * Includes both @ref allocate() calls and @ref allocateCached() cache
+         * misses.
+         * @see @ref resetStatistics()
+         */
+        UnsignedLong allocationCount() const;
+
+        /**
+         * @brief Count of descriptor set cache hits
+         *
+         * @see @ref allocateCached(), @ref resetStatistics()
+         */
+        UnsignedLong cacheHitCount() const;
+
+        /**
+         * @brief Count of descriptor set cache misses
+         *
+         * @see @ref allocateCached(), @ref resetStatistics()
+         */
+        UnsignedLong cacheMissCount() const;
+
+        /**
+         * @brief Reset statistics
+         *
+         * Sets @ref allocationCount(), @ref cacheHitCount() and
+         * @ref cacheMissCount() to zero.
+         */
+        void resetStatistics();
+
+    private:
+        struct State;
+
+        MAGNUM_VK_LOCAL VkDescriptorSet allocateInternal(const char* messagePrefix, VkDescriptorSetLayout layout, const UnsignedInt* variableDescriptorCount);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
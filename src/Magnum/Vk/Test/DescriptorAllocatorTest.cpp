@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/DescriptorAllocator.h"
+#include "Magnum/Vk/DescriptorType.h"
+#include "Magnum/Vk/Device.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct DescriptorAllocatorTest: TestSuite::Tester {
+    explicit DescriptorAllocatorTest();
+
+    void constructNoFrames();
+    void constructNoSets();
+    void constructNoPools();
+    void constructNoCreate();
+    void constructCopy();
+    void constructMove();
+
+    void noCreateStatistics();
+    void noCreateAllocate();
+};
+
+DescriptorAllocatorTest::DescriptorAllocatorTest() {
+    addTests({&DescriptorAllocatorTest::constructNoFrames,
+              &DescriptorAllocatorTest::constructNoSets,
+              &DescriptorAllocatorTest::constructNoPools,
+              &DescriptorAllocatorTest::constructNoCreate,
+              &DescriptorAllocatorTest::constructCopy,
+              &DescriptorAllocatorTest::constructMove,
+
+              &DescriptorAllocatorTest::noCreateStatistics,
+              &DescriptorAllocatorTest::noCreateAllocate});
+}
+
+void DescriptorAllocatorTest::constructNoFrames() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* The device isn't touched before the assert fires */
+    Device device{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    DescriptorAllocator{device, 0, 8, {
+        {DescriptorType::UniformBuffer, 8}
+    }};
+    CORRADE_COMPARE(out.str(), "Vk::DescriptorAllocator: there has to be at least one frame\n");
+}
+
+void DescriptorAllocatorTest::constructNoSets() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Device device{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    DescriptorAllocator{device, 2, 0, {
+        {DescriptorType::UniformBuffer, 8}
+    }};
+    CORRADE_COMPARE(out.str(), "Vk::DescriptorAllocator: there has to be at least one set per pool\n");
+}
+
+void DescriptorAllocatorTest::constructNoPools() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Device device{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    DescriptorAllocator{device, 2, 8, {}};
+    CORRADE_COMPARE(out.str(), "Vk::DescriptorAllocator: there has to be at least one pool size\n");
+}
+
+void DescriptorAllocatorTest::constructNoCreate() {
+    {
+        DescriptorAllocator allocator{NoCreate};
+        CORRADE_COMPARE(allocator.frameCount(), 0);
+        CORRADE_COMPARE(allocator.currentFrame(), 0);
+    }
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, DescriptorAllocator>::value);
+}
+
+void DescriptorAllocatorTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<DescriptorAllocator>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<DescriptorAllocator>{});
+}
+
+void DescriptorAllocatorTest::constructMove() {
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<DescriptorAllocator>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<DescriptorAllocator>::value);
+}
+
+void DescriptorAllocatorTest::noCreateStatistics() {
+    DescriptorAllocator allocator{NoCreate};
+    CORRADE_COMPARE(allocator.poolCount(), 0);
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(allocator.cacheHitCount(), 0);
+    CORRADE_COMPARE(allocator.cacheMissCount(), 0);
+
+    /* Shouldn't crash */
+    allocator.resetStatistics();
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+}
+
+void DescriptorAllocatorTest::noCreateAllocate() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DescriptorAllocator allocator{NoCreate};
+    const UnsignedLong resources[]{0, 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    allocator.allocate({});
+    allocator.allocate({}, 3);
+    allocator.allocateCached({}, resources);
+    allocator.nextFrame();
+    CORRADE_COMPARE(out.str(),
+        "Vk::DescriptorAllocator::allocate(): the allocator is not created\n"
+        "Vk::DescriptorAllocator::allocate(): the allocator is not created\n"
+        "Vk::DescriptorAllocator::allocateCached(): the allocator is not created\n"
+        "Vk::DescriptorAllocator::nextFrame(): the allocator is not created\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::DescriptorAllocatorTest)
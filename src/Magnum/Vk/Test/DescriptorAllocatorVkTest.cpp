@@ -0,0 +1,276 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/DescriptorAllocator.h"
+#include "Magnum/Vk/DescriptorSetLayoutCreateInfo.h"
+#include "Magnum/Vk/DescriptorType.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct DescriptorAllocatorVkTest: VulkanTester {
+    explicit DescriptorAllocatorVkTest();
+
+    void construct();
+    void constructMove();
+
+    void allocate();
+    void allocateNextPool();
+    void allocateTooLarge();
+
+    void allocateCached();
+    void allocateCachedDifferentLayout();
+
+    void nextFrame();
+    void resetStatistics();
+};
+
+DescriptorAllocatorVkTest::DescriptorAllocatorVkTest() {
+    addTests({&DescriptorAllocatorVkTest::construct,
+              &DescriptorAllocatorVkTest::constructMove,
+
+              &DescriptorAllocatorVkTest::allocate,
+              &DescriptorAllocatorVkTest::allocateNextPool,
+              &DescriptorAllocatorVkTest::allocateTooLarge,
+
+              &DescriptorAllocatorVkTest::allocateCached,
+              &DescriptorAllocatorVkTest::allocateCachedDifferentLayout,
+
+              &DescriptorAllocatorVkTest::nextFrame,
+              &DescriptorAllocatorVkTest::resetStatistics});
+}
+
+void DescriptorAllocatorVkTest::construct() {
+    DescriptorAllocator allocator{device(), 3, 4, {
+        {DescriptorType::UniformBuffer, 4}
+    }};
+    CORRADE_COMPARE(allocator.frameCount(), 3);
+    CORRADE_COMPARE(allocator.currentFrame(), 0);
+    /* Pools are created lazily */
+    CORRADE_COMPARE(allocator.poolCount(), 0);
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+}
+
+void DescriptorAllocatorVkTest::constructMove() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator a{device(), 2, 4, {
+        {DescriptorType::UniformBuffer, 4}
+    }};
+    a.allocate(layout);
+
+    DescriptorAllocator b = Utility::move(a);
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(b.frameCount(), 2);
+    CORRADE_COMPARE(b.poolCount(), 1);
+
+    DescriptorAllocator c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.frameCount(), 0);
+    CORRADE_COMPARE(c.frameCount(), 2);
+    CORRADE_COMPARE(c.poolCount(), 1);
+}
+
+void DescriptorAllocatorVkTest::allocate() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 2, 4, {
+        {DescriptorType::UniformBuffer, 4}
+    }};
+
+    VkDescriptorSet a = allocator.allocate(layout);
+    VkDescriptorSet b = allocator.allocate(layout);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(a != b);
+    CORRADE_COMPARE(allocator.poolCount(), 1);
+    CORRADE_COMPARE(allocator.allocationCount(), 2);
+}
+
+void DescriptorAllocatorVkTest::allocateNextPool() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    /* Each pool fits just two sets */
+    DescriptorAllocator allocator{device(), 1, 2, {
+        {DescriptorType::UniformBuffer, 2}
+    }};
+
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_VERIFY(allocator.allocate(layout));
+    CORRADE_COMPARE(allocator.allocationCount(), 5);
+
+    CORRADE_EXPECT_FAIL_IF(device().properties().name().contains("llvmpipe"),
+        "Mesa llvmpipe never fails an allocation.");
+    CORRADE_COMPARE(allocator.poolCount(), 3);
+}
+
+void DescriptorAllocatorVkTest::allocateTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer, 4}}
+    }};
+
+    DescriptorAllocator allocator{device(), 1, 2, {
+        {DescriptorType::UniformBuffer, 2}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    allocator.allocate(layout);
+    CORRADE_EXPECT_FAIL_IF(device().properties().name().contains("llvmpipe"),
+        "Mesa llvmpipe never fails an allocation.");
+    CORRADE_COMPARE(out.str(), "Vk::DescriptorAllocator::allocate(): the layout doesn't fit into a single pool\n");
+}
+
+void DescriptorAllocatorVkTest::allocateCached() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer},
+         {1, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 2, 8, {
+        {DescriptorType::UniformBuffer, 16}
+    }};
+
+    const UnsignedLong resourcesA[]{0xdeadbeef, 0xcafebabe};
+    const UnsignedLong resourcesB[]{0xcafebabe, 0xdeadbeef};
+
+    Containers::Pair<VkDescriptorSet, bool> a = allocator.allocateCached(layout, resourcesA);
+    CORRADE_VERIFY(a.first());
+    CORRADE_VERIFY(a.second());
+
+    /* Different order of resources is a different set */
+    Containers::Pair<VkDescriptorSet, bool> b = allocator.allocateCached(layout, resourcesB);
+    CORRADE_VERIFY(b.first());
+    CORRADE_VERIFY(b.second());
+    CORRADE_VERIFY(b.first() != a.first());
+
+    /* Same resources give back the same set, and the key isn't referencing
+       the original memory */
+    const UnsignedLong resourcesACopy[]{0xdeadbeef, 0xcafebabe};
+    Containers::Pair<VkDescriptorSet, bool> c = allocator.allocateCached(layout, resourcesACopy);
+    CORRADE_COMPARE(c.first(), a.first());
+    CORRADE_VERIFY(!c.second());
+
+    CORRADE_COMPARE(allocator.allocationCount(), 2);
+    CORRADE_COMPARE(allocator.cacheHitCount(), 1);
+    CORRADE_COMPARE(allocator.cacheMissCount(), 2);
+}
+
+void DescriptorAllocatorVkTest::allocateCachedDifferentLayout() {
+    DescriptorSetLayout layoutA{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+    DescriptorSetLayout layoutB{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 1, 8, {
+        {DescriptorType::UniformBuffer, 8}
+    }};
+
+    Containers::Pair<VkDescriptorSet, bool> a = allocator.allocateCached(layoutA, {0xdeadbeef});
+    Containers::Pair<VkDescriptorSet, bool> b = allocator.allocateCached(layoutB, {0xdeadbeef});
+    CORRADE_VERIFY(a.second());
+    CORRADE_VERIFY(b.second());
+    CORRADE_VERIFY(a.first() != b.first());
+    CORRADE_COMPARE(allocator.cacheHitCount(), 0);
+    CORRADE_COMPARE(allocator.cacheMissCount(), 2);
+}
+
+void DescriptorAllocatorVkTest::nextFrame() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 2, 2, {
+        {DescriptorType::UniformBuffer, 2}
+    }};
+
+    /* Frame 0 */
+    Containers::Pair<VkDescriptorSet, bool> cached = allocator.allocateCached(layout, {0xdeadbeef});
+    CORRADE_VERIFY(cached.second());
+    for(std::size_t i = 0; i != 3; ++i) allocator.allocate(layout);
+
+    /* Frame 1 has its own pools and its own cache */
+    allocator.nextFrame();
+    CORRADE_COMPARE(allocator.currentFrame(), 1);
+    CORRADE_VERIFY(allocator.allocateCached(layout, {0xdeadbeef}).second());
+    const UnsignedInt poolCountAfterFirstCycle = allocator.poolCount();
+
+    /* Back to frame 0, the pools get reset and the cache cleared */
+    allocator.nextFrame();
+    CORRADE_COMPARE(allocator.currentFrame(), 0);
+    CORRADE_VERIFY(allocator.allocateCached(layout, {0xdeadbeef}).second());
+    for(std::size_t i = 0; i != 3; ++i) allocator.allocate(layout);
+
+    /* No new pools needed, the existing ones got reused */
+    CORRADE_COMPARE(allocator.poolCount(), poolCountAfterFirstCycle);
+    CORRADE_COMPARE(allocator.cacheHitCount(), 0);
+    CORRADE_COMPARE(allocator.cacheMissCount(), 3);
+    CORRADE_COMPARE(allocator.allocationCount(), 9);
+}
+
+void DescriptorAllocatorVkTest::resetStatistics() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 1, 4, {
+        {DescriptorType::UniformBuffer, 4}
+    }};
+
+    allocator.allocateCached(layout, {0xdeadbeef});
+    allocator.allocateCached(layout, {0xdeadbeef});
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_COMPARE(allocator.cacheHitCount(), 1);
+    CORRADE_COMPARE(allocator.cacheMissCount(), 1);
+
+    allocator.resetStatistics();
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(allocator.cacheHitCount(), 0);
+    CORRADE_COMPARE(allocator.cacheMissCount(), 0);
+    /* Pool count is not a statistic that gets reset */
+    CORRADE_COMPARE(allocator.poolCount(), 1);
+
+    /* The cache is unaffected */
+    CORRADE_VERIFY(!allocator.allocateCached(layout, {0xdeadbeef}).second());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::DescriptorAllocatorVkTest)
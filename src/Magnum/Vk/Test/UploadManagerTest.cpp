@@ -0,0 +1,98 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/UploadManager.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct UploadManagerTest: TestSuite::Tester {
+    explicit UploadManagerTest();
+
+    void constructNoCreate();
+    void constructCopy();
+    void constructMove();
+
+    void noCreate();
+};
+
+UploadManagerTest::UploadManagerTest() {
+    addTests({&UploadManagerTest::constructNoCreate,
+              &UploadManagerTest::constructCopy,
+              &UploadManagerTest::constructMove,
+
+              &UploadManagerTest::noCreate});
+}
+
+void UploadManagerTest::constructNoCreate() {
+    {
+        UploadManager manager{NoCreate};
+        CORRADE_COMPARE(manager.stagingSize(), 0);
+        CORRADE_COMPARE(manager.recordedSize(), 0);
+        CORRADE_COMPARE(manager.budget(), 0);
+    }
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, UploadManager>::value);
+}
+
+void UploadManagerTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<UploadManager>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<UploadManager>{});
+}
+
+void UploadManagerTest::constructMove() {
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<UploadManager>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<UploadManager>::value);
+}
+
+void UploadManagerTest::noCreate() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UploadManager manager{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    manager.setBudget(1024);
+    manager.uploadBuffer(nullptr, {});
+    manager.tryUploadBuffer(nullptr, {});
+    manager.submit();
+    manager.isComplete(0);
+    manager.wait(0);
+    CORRADE_COMPARE(out.str(),
+        "Vk::UploadManager::setBudget(): the manager is not created\n"
+        "Vk::UploadManager::uploadBuffer(): the manager is not created\n"
+        "Vk::UploadManager::tryUploadBuffer(): the manager is not created\n"
+        "Vk::UploadManager::submit(): the manager is not created\n"
+        "Vk::UploadManager::isComplete(): the manager is not created\n"
+        "Vk::UploadManager::wait(): the manager is not created\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::UploadManagerTest)
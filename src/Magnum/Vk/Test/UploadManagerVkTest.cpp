@@ -0,0 +1,317 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/ImageCreateInfo.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/UploadManager.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct UploadManagerVkTest: VulkanTester {
+    explicit UploadManagerVkTest();
+
+    void construct();
+    void constructZeroSize();
+
+    void uploadBuffer();
+    void uploadBufferLargerThanStaging();
+    void uploadBufferRingFull();
+    void tryUploadBufferBudget();
+    void tryUploadBufferRingFull();
+    void tryUploadBufferTooLarge();
+
+    void uploadImage();
+    void uploadImageTooLarge();
+
+    void submitNothing();
+    void isCompleteNotSubmitted();
+    void recordAcquireBarriersSameFamily();
+};
+
+using namespace Containers::Literals;
+using namespace Math::Literals;
+
+UploadManagerVkTest::UploadManagerVkTest() {
+    addTests({&UploadManagerVkTest::construct,
+              &UploadManagerVkTest::constructZeroSize,
+
+              &UploadManagerVkTest::uploadBuffer,
+              &UploadManagerVkTest::uploadBufferLargerThanStaging,
+              &UploadManagerVkTest::uploadBufferRingFull,
+              &UploadManagerVkTest::tryUploadBufferBudget,
+              &UploadManagerVkTest::tryUploadBufferRingFull,
+              &UploadManagerVkTest::tryUploadBufferTooLarge,
+
+              &UploadManagerVkTest::uploadImage,
+              &UploadManagerVkTest::uploadImageTooLarge,
+
+              &UploadManagerVkTest::submitNothing,
+              &UploadManagerVkTest::isCompleteNotSubmitted,
+              &UploadManagerVkTest::recordAcquireBarriersSameFamily});
+}
+
+void UploadManagerVkTest::construct() {
+    const UnsignedInt family = device().properties().pickQueueFamily(QueueFlag::Graphics);
+    UploadManager manager{device(), queue(), family, 1024};
+    CORRADE_COMPARE(manager.queueFamily(), family);
+    CORRADE_COMPARE(manager.destinationQueueFamily(), family);
+    CORRADE_COMPARE(manager.stagingSize(), 1024);
+    CORRADE_COMPARE(manager.budget(), ~UnsignedLong{});
+    CORRADE_COMPARE(manager.recordedSize(), 0);
+}
+
+void UploadManagerVkTest::constructZeroSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    UploadManager{device(), queue(), 0, 0};
+    CORRADE_COMPARE(out.str(), "Vk::UploadManager: staging size can't be zero\n");
+}
+
+void UploadManagerVkTest::uploadBuffer() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 10}, MemoryFlag::HostVisible};
+    Utility::copy(".........."_s, a.dedicatedMemory().map());
+
+    manager.uploadBuffer("ABCD"_s, a, 5);
+    CORRADE_COMPARE(manager.recordedSize(), 4);
+
+    const UnsignedLong ticket = manager.submit();
+    CORRADE_COMPARE(ticket, 1);
+    CORRADE_COMPARE(manager.recordedSize(), 0);
+
+    manager.wait(ticket);
+    CORRADE_VERIFY(manager.isComplete(ticket));
+    CORRADE_COMPARE(arrayView(a.dedicatedMemory().mapRead()),
+        ".....ABCD."_s);
+}
+
+void UploadManagerVkTest::uploadBufferLargerThanStaging() {
+    /* The 26 bytes get uploaded in four parts */
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 8};
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 28}, MemoryFlag::HostVisible};
+    Utility::copy("............................"_s, a.dedicatedMemory().map());
+
+    manager.uploadBuffer("abcdefghijklmnopqrstuvwxyz"_s, a, 1);
+    manager.wait(manager.submit());
+    CORRADE_COMPARE(arrayView(a.dedicatedMemory().mapRead()),
+        ".abcdefghijklmnopqrstuvwxyz."_s);
+}
+
+void UploadManagerVkTest::uploadBufferRingFull() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 16};
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 30}, MemoryFlag::HostVisible};
+    Utility::copy(".............................."_s, a.dedicatedMemory().map());
+
+    /* Two uploads don't fit into the ring at the same time, so each one
+       after the first has to submit and wait for the previous */
+    manager.uploadBuffer("0123456789"_s, a, 0);
+    manager.uploadBuffer("abcdefghij"_s, a, 10);
+    manager.uploadBuffer("ABCDEFGHIJ"_s, a, 20);
+    const UnsignedLong ticket = manager.submit();
+    CORRADE_COMPARE(ticket, 3);
+
+    manager.wait(ticket);
+    CORRADE_COMPARE(arrayView(a.dedicatedMemory().mapRead()),
+        "0123456789abcdefghijABCDEFGHIJ"_s);
+}
+
+void UploadManagerVkTest::tryUploadBufferBudget() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+    manager.setBudget(6);
+    CORRADE_COMPARE(manager.budget(), 6);
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 12}, MemoryFlag::HostVisible};
+    Utility::copy("............"_s, a.dedicatedMemory().map());
+
+    /* The first upload is allowed even if it's over budget */
+    CORRADE_VERIFY(manager.tryUploadBuffer("01234567"_s, a, 0));
+    CORRADE_VERIFY(!manager.tryUploadBuffer("AB"_s, a, 8));
+    CORRADE_COMPARE(manager.recordedSize(), 8);
+
+    /* After a submit the budget is available again */
+    manager.submit();
+    CORRADE_VERIFY(manager.tryUploadBuffer("AB"_s, a, 8));
+    CORRADE_VERIFY(manager.tryUploadBuffer("CD"_s, a, 10));
+    CORRADE_COMPARE(manager.recordedSize(), 4);
+
+    manager.wait(manager.submit());
+    CORRADE_COMPARE(arrayView(a.dedicatedMemory().mapRead()),
+        "01234567ABCD"_s);
+}
+
+void UploadManagerVkTest::tryUploadBufferRingFull() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 16};
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 16}, MemoryFlag::HostVisible};
+
+    CORRADE_VERIFY(manager.tryUploadBuffer("0123456789ab"_s, a, 0));
+    /* Doesn't fit into the remaining space and the first upload wasn't even
+       submitted yet */
+    CORRADE_VERIFY(!manager.tryUploadBuffer("cdefgh"_s, a, 10));
+
+    /* Once the first upload finishes, the space is reclaimed */
+    manager.wait(manager.submit());
+    CORRADE_VERIFY(manager.tryUploadBuffer("cdefgh"_s, a, 10));
+    manager.wait(manager.submit());
+}
+
+void UploadManagerVkTest::tryUploadBufferTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 8};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    manager.tryUploadBuffer("012345678"_s, {});
+    CORRADE_COMPARE(out.str(), "Vk::UploadManager::tryUploadBuffer(): data of 9 bytes don't fit into a staging ring of 8 bytes\n");
+}
+
+void UploadManagerVkTest::uploadImage() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    Image image{device(), ImageCreateInfo2D{
+        ImageUsage::TransferDestination|ImageUsage::TransferSource|ImageUsage::Sampled,
+        PixelFormat::RGBA8Unorm, {2, 2}, 1
+    }, MemoryFlag::DeviceLocal};
+
+    const Color4ub pixels[]{
+        0xff000000_rgba, 0x00ff0000_rgba,
+        0x0000ff00_rgba, 0x000000ff_rgba
+    };
+    manager.uploadImage(ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {2, 2}, pixels}, image);
+    CORRADE_COMPARE(manager.recordedSize(), 16);
+    manager.wait(manager.submit());
+
+    /* Read the image back */
+    CommandPool pool{device(), CommandPoolCreateInfo{
+        device().properties().pickQueueFamily(QueueFlag::Graphics)}};
+    CommandBuffer cmd = pool.allocate();
+    Buffer out{device(), BufferCreateInfo{BufferUsage::TransferDestination, 16}, MemoryFlag::HostVisible};
+    cmd.begin()
+       .pipelineBarrier(PipelineStage::AllCommands, PipelineStage::Transfer, {
+            {Access::ShaderRead, Access::TransferRead,
+             ImageLayout::ShaderReadOnly, ImageLayout::TransferSource, image}
+        })
+       .copyImageToBuffer(CopyImageToBufferInfo2D{image, ImageLayout::TransferSource, out, {
+            {0, ImageAspect::Color, 0, {{}, {2, 2}}}
+        }})
+       .pipelineBarrier(PipelineStage::Transfer, PipelineStage::Host, {
+            {Access::TransferWrite, Access::HostRead}
+        }, {}, {})
+       .end();
+    queue().submit({SubmitInfo{}.setCommandBuffers({cmd})}).wait();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(out.dedicatedMemory().mapRead()),
+        Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void UploadManagerVkTest::uploadImageTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 15};
+
+    const Color4ub pixels[4]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    manager.uploadImage(ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {2, 2}, pixels}, {});
+    manager.tryUploadImage(ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {2, 2}, pixels}, {});
+    CORRADE_COMPARE(out.str(),
+        "Vk::UploadManager::uploadImage(): image of 16 bytes doesn't fit into a staging ring of 15 bytes\n"
+        "Vk::UploadManager::tryUploadImage(): image of 16 bytes doesn't fit into a staging ring of 15 bytes\n");
+}
+
+void UploadManagerVkTest::submitNothing() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    /* Nothing submitted yet, zero ticket is always complete */
+    CORRADE_COMPARE(manager.submit(), 0);
+    CORRADE_VERIFY(manager.isComplete(0));
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 4}, MemoryFlag::HostVisible};
+    manager.uploadBuffer("ABCD"_s, a);
+    CORRADE_COMPARE(manager.submit(), 1);
+
+    /* Submitting again with nothing recorded gives back the same ticket */
+    CORRADE_COMPARE(manager.submit(), 1);
+    manager.wait(1);
+}
+
+void UploadManagerVkTest::isCompleteNotSubmitted() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    manager.isComplete(1);
+    manager.wait(1);
+    CORRADE_COMPARE(out.str(),
+        "Vk::UploadManager::isComplete(): ticket 1 wasn't submitted yet\n"
+        "Vk::UploadManager::wait(): ticket 1 wasn't submitted yet\n");
+}
+
+void UploadManagerVkTest::recordAcquireBarriersSameFamily() {
+    UploadManager manager{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    Buffer a{device(), BufferCreateInfo{BufferUsage::TransferDestination, 4}, MemoryFlag::HostVisible};
+    manager.uploadBuffer("ABCD"_s, a);
+    manager.wait(manager.submit());
+
+    /* No ownership transfer, so nothing to acquire */
+    CommandPool pool{device(), CommandPoolCreateInfo{
+        device().properties().pickQueueFamily(QueueFlag::Graphics)}};
+    CommandBuffer cmd = pool.allocate();
+    cmd.begin();
+    CORRADE_COMPARE(manager.recordAcquireBarriers(cmd), 0);
+    cmd.end();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::UploadManagerVkTest)
@@ -0,0 +1,466 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "UploadManager.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Vk/Buffer.h"
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/Image.h"
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/Queue.h"
+
+namespace Magnum { namespace Vk {
+
+namespace {
+
+struct Batch {
+    explicit Batch(Fence&& fence, CommandBuffer&& commandBuffer): fence{Utility::move(fence)}, commandBuffer{Utility::move(commandBuffer)} {}
+
+    Fence fence;
+    CommandBuffer commandBuffer;
+    UnsignedLong ticket{};
+    /* Position of the ring head at submit time. Once the batch finishes, the
+       ring tail moves here. */
+    UnsignedLong ringEnd{};
+    /* Release barriers recorded at submit time. If there's a queue family
+       ownership transfer, the same barriers are recorded again on the
+       destination queue as acquire barriers once the batch finishes. */
+    Containers::Array<BufferMemoryBarrier> bufferBarriers;
+    Containers::Array<ImageMemoryBarrier> imageBarriers;
+};
+
+UnsignedLong gcd(UnsignedLong a, UnsignedLong b) {
+    while(b) {
+        const UnsignedLong t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+}
+
+struct UploadManager::State {
+    explicit State(Device& device, Queue& queue, UnsignedInt queueFamily, UnsignedInt destinationQueueFamily, UnsignedLong stagingSize);
+    ~State();
+
+    /* Returns an offset into the ring or NullOpt if there's not enough
+       contiguous free space */
+    Containers::Optional<UnsignedLong> allocateStaging(UnsignedLong size, UnsignedLong alignment);
+    /* Makes space for an allocation of given size, submitting the current
+       batch and waiting on the oldest ones if needed */
+    UnsignedLong allocateStagingBlocking(UnsignedLong size, UnsignedLong alignment);
+    bool ringEmpty() const {
+        return inFlight.isEmpty() && !recordedSize;
+    }
+
+    Batch& recording();
+    UnsignedLong submit();
+    /* Retires finished batches from the front of inFlight, if wait is set
+       blocks until the batch with given ticket finishes */
+    void retire(UnsignedLong waitForTicket);
+
+    void copyBuffer(Containers::ArrayView<const void> data, VkBuffer destination, UnsignedLong destinationOffset, UnsignedLong stagingOffset);
+    void copyImage(const ImageView2D& image, VkImage destination, Int level, UnsignedLong stagingOffset);
+
+    Device& device;
+    Queue& queue;
+    UnsignedInt queueFamily, destinationQueueFamily;
+    /* Memory backing the buffer may be larger, so not using its size */
+    UnsignedLong stagingSize;
+
+    /* Destruction order matters -- command buffers have to go before the
+       pool, all submissions have to finish before the staging buffer goes
+       away (ensured in the destructor) */
+    Buffer staging;
+    Containers::Array<char, MemoryMapDeleter> stagingMapped;
+    CommandPool commandPool;
+
+    UnsignedLong head{}, tail{};
+    UnsignedLong budget{~UnsignedLong{}};
+    UnsignedLong recordedSize{};
+    UnsignedLong lastTicket{}, completedTicket{};
+
+    Containers::Optional<Batch> current;
+    Containers::Array<Batch> inFlight;
+    Containers::Array<Batch> free;
+
+    Containers::Array<BufferMemoryBarrier> pendingBufferAcquires;
+    Containers::Array<ImageMemoryBarrier> pendingImageAcquires;
+};
+
+UploadManager::State::State(Device& device, Queue& queue, const UnsignedInt queueFamily, const UnsignedInt destinationQueueFamily, const UnsignedLong stagingSize): device(device), queue(queue), queueFamily{queueFamily}, destinationQueueFamily{destinationQueueFamily}, stagingSize{stagingSize},
+    staging{device, BufferCreateInfo{BufferUsage::TransferSource, stagingSize}, MemoryFlag::HostVisible|MemoryFlag::HostCoherent},
+    stagingMapped{staging.dedicatedMemory().map()},
+    commandPool{device, CommandPoolCreateInfo{queueFamily, CommandPoolCreateInfo::Flag::Transient|CommandPoolCreateInfo::Flag::ResetCommandBuffer}} {}
+
+UploadManager::State::~State() {
+    /* Wait for everything in flight so the staging buffer and command
+       buffers aren't freed while in use */
+    for(Batch& batch: inFlight) batch.fence.wait();
+}
+
+Containers::Optional<UnsignedLong> UploadManager::State::allocateStaging(const UnsignedLong size, const UnsignedLong alignment) {
+    if(ringEmpty()) head = tail = 0;
+
+    const UnsignedLong aligned = (head + alignment - 1)/alignment*alignment;
+
+    /* Free space is [head, end) and [0, tail). If head == tail and the ring
+       isn't empty, it's full, which is handled by the other branch. */
+    if(head > tail || (head == tail && ringEmpty())) {
+        if(aligned + size <= stagingSize) {
+            head = aligned + size;
+            return aligned;
+        }
+        /* Wrap around, wasting the rest at the end */
+        if(size <= tail) {
+            head = size;
+            return 0;
+        }
+        return {};
+    }
+
+    /* Free space is [head, tail) */
+    if(aligned + size <= tail) {
+        head = aligned + size;
+        return aligned;
+    }
+    return {};
+}
+
+UnsignedLong UploadManager::State::allocateStagingBlocking(const UnsignedLong size, const UnsignedLong alignment) {
+    for(;;) {
+        if(Containers::Optional<UnsignedLong> offset = allocateStaging(size, alignment))
+            return *offset;
+
+        /* Submit what's recorded so its space can be eventually reclaimed as
+           well, then wait for the oldest batch */
+        submit();
+        CORRADE_INTERNAL_ASSERT(!inFlight.isEmpty());
+        retire(inFlight.front().ticket);
+    }
+}
+
+Batch& UploadManager::State::recording() {
+    if(!current) {
+        if(!free.isEmpty()) {
+            current.emplace(Utility::move(free.back()));
+            arrayRemoveSuffix(free);
+            current->fence.reset();
+        } else current.emplace(Fence{device}, commandPool.allocate());
+
+        current->commandBuffer.begin(CommandBufferBeginInfo{CommandBufferBeginInfo::Flag::OneTimeSubmit});
+    }
+
+    return *current;
+}
+
+UnsignedLong UploadManager::State::submit() {
+    if(!current) return lastTicket;
+
+    Batch& batch = *current;
+    batch.ticket = ++lastTicket;
+    batch.ringEnd = head;
+
+    /* With an ownership transfer the second synchronization scope of a
+       release barrier is ignored, the acquire barrier on the destination
+       queue takes care of that */
+    batch.commandBuffer
+        .pipelineBarrier(PipelineStage::Transfer,
+            queueFamily == destinationQueueFamily ? PipelineStage::AllCommands : PipelineStage::BottomOfPipe,
+            {}, batch.bufferBarriers, batch.imageBarriers)
+        .end();
+    queue.submit({SubmitInfo{}.setCommandBuffers({batch.commandBuffer})}, batch.fence);
+
+    arrayAppend(inFlight, Utility::move(batch));
+    current = Containers::NullOpt;
+    recordedSize = 0;
+    return lastTicket;
+}
+
+void UploadManager::State::retire(const UnsignedLong waitForTicket) {
+    std::size_t retired = 0;
+    for(; retired != inFlight.size(); ++retired) {
+        Batch& batch = inFlight[retired];
+        if(batch.ticket <= waitForTicket) batch.fence.wait();
+        else if(!batch.fence.status()) break;
+
+        tail = batch.ringEnd;
+        completedTicket = batch.ticket;
+
+        /* Turn the release barriers into acquire barriers for the
+           destination queue */
+        if(queueFamily != destinationQueueFamily) {
+            for(BufferMemoryBarrier& barrier: batch.bufferBarriers) {
+                barrier->srcAccessMask = 0;
+                barrier->dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+                arrayAppend(pendingBufferAcquires, barrier);
+            }
+            for(ImageMemoryBarrier& barrier: batch.imageBarriers) {
+                barrier->srcAccessMask = 0;
+                barrier->dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                arrayAppend(pendingImageAcquires, barrier);
+            }
+        }
+
+        arrayResize(batch.bufferBarriers, NoInit, 0);
+        arrayResize(batch.imageBarriers, NoInit, 0);
+        arrayAppend(free, Utility::move(batch));
+    }
+
+    /* Shift the remaining batches to the front */
+    if(retired) {
+        for(std::size_t i = retired; i != inFlight.size(); ++i)
+            inFlight[i - retired] = Utility::move(inFlight[i]);
+        arrayRemoveSuffix(inFlight, retired);
+    }
+}
+
+void UploadManager::State::copyBuffer(const Containers::ArrayView<const void> data, const VkBuffer destination, const UnsignedLong destinationOffset, const UnsignedLong stagingOffset) {
+    Utility::copy(Containers::arrayCast<const char>(data), stagingMapped.sliceSize(stagingOffset, data.size()));
+
+    Batch& batch = recording();
+    batch.commandBuffer.copyBuffer({staging, destination, {
+        {stagingOffset, destinationOffset, data.size()}
+    }});
+
+    BufferMemoryBarrier barrier{Access::TransferWrite,
+        queueFamily == destinationQueueFamily ? Access::MemoryRead : Accesses{},
+        destination, destinationOffset, data.size()};
+    if(queueFamily == destinationQueueFamily) {
+        barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    } else {
+        barrier->srcQueueFamilyIndex = queueFamily;
+        barrier->dstQueueFamilyIndex = destinationQueueFamily;
+    }
+    arrayAppend(batch.bufferBarriers, barrier);
+
+    recordedSize += data.size();
+}
+
+void UploadManager::State::copyImage(const ImageView2D& image, const VkImage destination, const Int level, const UnsignedLong stagingOffset) {
+    const std::size_t pixelSize = image.pixelSize();
+    const Vector2i size = image.size();
+    const std::size_t dataSize = pixelSize*size.product();
+
+    /* Copy tightly packed, independently of the image pixel storage */
+    Containers::StridedArrayView3D<char> dst{stagingMapped.sliceSize(stagingOffset, dataSize), {std::size_t(size.y()), std::size_t(size.x()), pixelSize}};
+    Utility::copy(image.pixels(), dst);
+
+    Batch& batch = recording();
+    batch.commandBuffer
+        .pipelineBarrier(PipelineStage::TopOfPipe, PipelineStage::Transfer, {
+            {Accesses{}, Access::TransferWrite,
+             ImageLayout::Undefined, ImageLayout::TransferDestination,
+             destination, ImageAspect::Color, 0, 1, UnsignedInt(level), 1}
+        })
+        .copyBufferToImage(CopyBufferToImageInfo2D{staging, destination, ImageLayout::TransferDestination, {
+            BufferImageCopy2D{stagingOffset, ImageAspect::Color, level, {{}, size}}
+        }});
+
+    ImageMemoryBarrier barrier{Access::TransferWrite,
+        queueFamily == destinationQueueFamily ? Access::ShaderRead : Accesses{},
+        ImageLayout::TransferDestination, ImageLayout::ShaderReadOnly,
+        destination, ImageAspect::Color, 0, 1, UnsignedInt(level), 1};
+    if(queueFamily == destinationQueueFamily) {
+        barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    } else {
+        barrier->srcQueueFamilyIndex = queueFamily;
+        barrier->dstQueueFamilyIndex = destinationQueueFamily;
+    }
+    arrayAppend(batch.imageBarriers, barrier);
+
+    recordedSize += dataSize;
+}
+
+UploadManager::UploadManager(Device& device, Queue& queue, const UnsignedInt queueFamily, const UnsignedInt destinationQueueFamily, const UnsignedLong stagingSize) {
+    CORRADE_ASSERT(stagingSize,
+        "Vk::UploadManager: staging size can't be zero", );
+    _state.emplace(device, queue, queueFamily, destinationQueueFamily, stagingSize);
+}
+
+UploadManager::UploadManager(NoCreateT) noexcept {}
+
+UploadManager::UploadManager(UploadManager&&) noexcept = default;
+
+UploadManager::~UploadManager() = default;
+
+UploadManager& UploadManager::operator=(UploadManager&&) noexcept = default;
+
+UnsignedInt UploadManager::queueFamily() const {
+    return _state ? _state->queueFamily : 0;
+}
+
+UnsignedInt UploadManager::destinationQueueFamily() const {
+    return _state ? _state->destinationQueueFamily : 0;
+}
+
+UnsignedLong UploadManager::stagingSize() const {
+    return _state ? _state->stagingSize : 0;
+}
+
+UnsignedLong UploadManager::budget() const {
+    return _state ? _state->budget : 0;
+}
+
+UploadManager& UploadManager::setBudget(const UnsignedLong bytes) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::setBudget(): the manager is not created", *this);
+    _state->budget = bytes;
+    return *this;
+}
+
+UnsignedLong UploadManager::recordedSize() const {
+    return _state ? _state->recordedSize : 0;
+}
+
+void UploadManager::uploadBuffer(const Containers::ArrayView<const void> data, const VkBuffer destination, const UnsignedLong destinationOffset) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::uploadBuffer(): the manager is not created", );
+
+    const Containers::ArrayView<const char> bytes = Containers::arrayCast<const char>(data);
+    const std::size_t chunkSize = _state->stagingSize;
+    for(std::size_t offset = 0; offset < bytes.size(); offset += chunkSize) {
+        const Containers::ArrayView<const char> chunk = bytes.slice(offset, Math::min(offset + chunkSize, bytes.size()));
+        const UnsignedLong stagingOffset = _state->allocateStagingBlocking(chunk.size(), 4);
+        _state->copyBuffer(chunk, destination, destinationOffset + offset, stagingOffset);
+    }
+}
+
+bool UploadManager::tryUploadBuffer(const Containers::ArrayView<const void> data, const VkBuffer destination, const UnsignedLong destinationOffset) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::tryUploadBuffer(): the manager is not created", {});
+    /* Splitting like uploadBuffer() does would mean waiting for the earlier
+       parts to finish before the ring space can be reused */
+    CORRADE_ASSERT(data.size() <= _state->stagingSize,
+        "Vk::UploadManager::tryUploadBuffer(): data of" << data.size() << "bytes don't fit into a staging ring of" << _state->stagingSize << "bytes", {});
+
+    if(data.isEmpty()) return true;
+    if(_state->recordedSize && _state->recordedSize + data.size() > _state->budget)
+        return false;
+
+    /* Reclaim what's possible without waiting */
+    _state->retire(0);
+    Containers::Optional<UnsignedLong> stagingOffset = _state->allocateStaging(data.size(), 4);
+    if(!stagingOffset) return false;
+
+    _state->copyBuffer(data, destination, destinationOffset, *stagingOffset);
+    return true;
+}
+
+namespace {
+
+/* The buffer offset for a buffer-to-image copy has to be a multiple of both
+   the texel size and 4 */
+UnsignedLong imageStagingAlignment(const UnsignedLong pixelSize) {
+    return pixelSize*4/gcd(pixelSize, 4);
+}
+
+}
+
+void UploadManager::uploadImage(const ImageView2D& image, const VkImage destination, const Int level) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::uploadImage(): the manager is not created", );
+    const UnsignedLong dataSize = image.pixelSize()*image.size().product();
+    CORRADE_ASSERT(dataSize <= _state->stagingSize,
+        "Vk::UploadManager::uploadImage(): image of" << dataSize << "bytes doesn't fit into a staging ring of" << _state->stagingSize << "bytes", );
+    if(!dataSize) return;
+
+    const UnsignedLong stagingOffset = _state->allocateStagingBlocking(dataSize, imageStagingAlignment(image.pixelSize()));
+    _state->copyImage(image, destination, level, stagingOffset);
+}
+
+bool UploadManager::tryUploadImage(const ImageView2D& image, const VkImage destination, const Int level) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::tryUploadImage(): the manager is not created", {});
+    const UnsignedLong dataSize = image.pixelSize()*image.size().product();
+    CORRADE_ASSERT(dataSize <= _state->stagingSize,
+        "Vk::UploadManager::tryUploadImage(): image of" << dataSize << "bytes doesn't fit into a staging ring of" << _state->stagingSize << "bytes", {});
+
+    if(!dataSize) return true;
+    if(_state->recordedSize && _state->recordedSize + dataSize > _state->budget)
+        return false;
+
+    _state->retire(0);
+    Containers::Optional<UnsignedLong> stagingOffset = _state->allocateStaging(dataSize, imageStagingAlignment(image.pixelSize()));
+    if(!stagingOffset) return false;
+
+    _state->copyImage(image, destination, level, *stagingOffset);
+    return true;
+}
+
+UnsignedLong UploadManager::submit() {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::submit(): the manager is not created", {});
+    return _state->submit();
+}
+
+bool UploadManager::isComplete(const UnsignedLong ticket) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::isComplete(): the manager is not created", {});
+    CORRADE_ASSERT(ticket <= _state->lastTicket,
+        "Vk::UploadManager::isComplete(): ticket" << ticket << "wasn't submitted yet", {});
+    if(ticket > _state->completedTicket) _state->retire(0);
+    return ticket <= _state->completedTicket;
+}
+
+void UploadManager::wait(const UnsignedLong ticket) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::wait(): the manager is not created", );
+    CORRADE_ASSERT(ticket <= _state->lastTicket,
+        "Vk::UploadManager::wait(): ticket" << ticket << "wasn't submitted yet", );
+    if(ticket > _state->completedTicket) _state->retire(ticket);
+}
+
+std::size_t UploadManager::recordAcquireBarriers(CommandBuffer& commandBuffer) {
+    CORRADE_ASSERT(_state,
+        "Vk::UploadManager::recordAcquireBarriers(): the manager is not created", {});
+
+    /* Pick up whatever finished in the meantime */
+    _state->retire(0);
+
+    const std::size_t count = _state->pendingBufferAcquires.size() + _state->pendingImageAcquires.size();
+    if(!count) return 0;
+
+    commandBuffer.pipelineBarrier(PipelineStage::TopOfPipe, PipelineStage::AllCommands, {}, _state->pendingBufferAcquires, _state->pendingImageAcquires);
+    arrayResize(_state->pendingBufferAcquires, NoInit, 0);
+    arrayResize(_state->pendingImageAcquires, NoInit, 0);
+    return count;
+}
+
+}}
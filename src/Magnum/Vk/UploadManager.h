@@ -0,0 +1,285 @@
+#ifndef Magnum_Vk_UploadManager_h
+#define Magnum_Vk_UploadManager_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::UploadManager
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/visibility.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Staging upload manager
+@m_since_latest
+
+Uploads buffer and image data to device-local memory through a host-visible
+staging ring, recording the copies on a dedicated transfer-capable
+@ref Queue so they don't serialize with rendering.
+
+@section Vk-UploadManager-usage Usage
+
+The manager is constructed with a queue and its family index and a size of
+the staging ring. Each @ref uploadBuffer() or @ref uploadImage() call copies
+the data to the ring and records a copy into a command buffer. Recorded copies
+get submitted with @ref submit(), which returns a ticket that can be polled
+with @ref isComplete() or waited on with @ref wait():
+
+@snippet Vk.cpp UploadManager-usage
+
+The ring space used by a submission is reclaimed once the submission
+finishes. If there's not enough free space in the ring, @ref uploadBuffer()
+and @ref uploadImage() submit what's recorded and wait for earlier submissions
+to finish. Buffer uploads larger than the ring are split into multiple copies,
+images and buffer uploads done with @ref tryUploadBuffer() are expected to fit
+into the ring as a whole.
+
+@section Vk-UploadManager-budget Per-frame budget
+
+To avoid spending too much time on uploads in a single frame, the
+@ref tryUploadBuffer() and @ref tryUploadImage() variants do nothing and return
+@cpp false @ce if the upload would exceed the budget set by @ref setBudget() or
+if it'd have to wait for ring space. The budget counts bytes recorded since
+the last @ref submit(), so calling @ref submit() once a frame makes it a
+per-frame budget. The first upload after a @ref submit() is always allowed, so
+uploads larger than the budget make progress as well. They still have to fit
+into the staging ring, larger buffers have to go through @ref uploadBuffer().
+
+@section Vk-UploadManager-ownership Queue family ownership transfer
+
+If the queue used for rendering comes from a different family than the
+transfer queue, pass its index as the @p destinationQueueFamily in the
+constructor. Each upload then ends with a queue family ownership release
+barrier, and once the submission is finished, the matching acquire barriers
+are recorded into a command buffer of the destination queue with
+@ref recordAcquireBarriers(). If the families are the same, the uploads end
+with a plain memory barrier and @ref recordAcquireBarriers() does nothing.
+
+In both cases, buffers are made available for @ref Access::MemoryRead and
+images are transitioned to @ref ImageLayout::ShaderReadOnly and made available
+for @ref Access::ShaderRead.
+*/
+class MAGNUM_VK_EXPORT UploadManager {
+    public:
+        /**
+         * @brief Constructor
+         * @param device                Vulkan device
+         * @param queue                 Queue to submit the copies to.
+         *      Expected to support @ref QueueFlag::Transfer.
+         * @param queueFamily           Family index of @p queue
+         * @param destinationQueueFamily Family index of the queue that's going
+         *      to use the uploaded resources
+         * @param stagingSize           Size of the staging ring in bytes.
+         *      Expected to be non-zero.
+         *
+         * Allocates a @ref MemoryFlag::HostVisible and
+         * @ref MemoryFlag::HostCoherent staging buffer, which stays mapped
+         * for the whole lifetime of the manager.
+         */
+        explicit UploadManager(Device& device, Queue& queue, UnsignedInt queueFamily, UnsignedInt destinationQueueFamily, UnsignedLong stagingSize);
+
+        /**
+         * @brief Construct with no queue family ownership transfer
+         *
+         * Equivalent to calling @ref UploadManager(Device&, Queue&, UnsignedInt, UnsignedInt, UnsignedLong)
+         * with @p destinationQueueFamily set to @p queueFamily.
+         */
+        explicit UploadManager(Device& device, Queue& queue, UnsignedInt queueFamily, UnsignedLong stagingSize): UploadManager{device, queue, queueFamily, queueFamily, stagingSize} {}
+
+        /**
+         * @brief Construct without creating the manager
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit UploadManager(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        UploadManager(const UploadManager&) = delete;
+
+        /** @brief Move constructor */
+        UploadManager(UploadManager&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all submitted uploads to finish and frees the staging
+         * buffer. Copies that were recorded but not submitted are discarded.
+         */
+        ~UploadManager();
+
+        /** @brief Copying is not allowed */
+        UploadManager& operator=(const UploadManager&) = delete;
+
+        /** @brief Move assignment */
+        UploadManager& operator=(UploadManager&& other) noexcept;
+
+        /** @brief Family index of the transfer queue */
+        UnsignedInt queueFamily() const;
+
+        /** @brief Family index of the queue using the uploaded resources */
+        UnsignedInt destinationQueueFamily() const;
+
+        /** @brief Staging ring size in bytes */
+        UnsignedLong stagingSize() const;
+
+        /**
+         * @brief Upload budget
+         *
+         * Initially the maximum representable value, meaning no budget.
+         */
+        UnsignedLong budget() const;
+
+        /**
+         * @brief Set upload budget
+         * @return Reference to self (for method chaining)
+         *
+         * Limits how many bytes @ref tryUploadBuffer() and
+         * @ref tryUploadImage() record between two @ref submit() calls. Has
+         * no effect on @ref uploadBuffer() and @ref uploadImage().
+         */
+        UploadManager& setBudget(UnsignedLong bytes);
+
+        /**
+         * @brief Bytes recorded since the last submit
+         *
+         * @see @ref budget(), @ref submit()
+         */
+        UnsignedLong recordedSize() const;
+
+        /**
+         * @brief Upload buffer data
+         * @param data              Data to upload
+         * @param destination       Destination buffer. Expected to be created
+         *      with @ref BufferUsage::TransferDestination.
+         * @param destinationOffset Offset in the destination buffer
+         *
+         * If there's not enough space in the staging ring, submits what's
+         * recorded and waits for earlier submissions to finish. Data larger
+         * than @ref stagingSize() are uploaded in multiple parts.
+         * @see @ref tryUploadBuffer(), @ref CommandBuffer::copyBuffer()
+         */
+        void uploadBuffer(Containers::ArrayView<const void> data, VkBuffer destination, UnsignedLong destinationOffset = 0);
+
+        /**
+         * @brief Try to upload buffer data
+         *
+         * Compared to @ref uploadBuffer(), if the upload would exceed the
+         * @ref budget() or there isn't enough free space in the staging ring,
+         * returns @cpp false @ce without doing anything. As uploading data in
+         * multiple parts would mean waiting for the earlier parts to finish,
+         * the @p data are expected to fit into @ref stagingSize(). Use
+         * @ref uploadBuffer() for larger data.
+         */
+        bool tryUploadBuffer(Containers::ArrayView<const void> data, VkBuffer destination, UnsignedLong destinationOffset = 0);
+
+        /**
+         * @brief Upload a 2D image
+         * @param image             Image to upload. The format is expected to
+         *      have a @ref ImageAspect::Color aspect and the data are expected
+         *      to fit into @ref stagingSize() when tightly packed.
+         * @param destination       Destination image. Expected to be created
+         *      with @ref ImageUsage::TransferDestination and have a matching
+         *      format.
+         * @param level             Destination mip level
+         *
+         * The previous contents of @p level are discarded. After the upload
+         * the image is in @ref ImageLayout::ShaderReadOnly. If there's not
+         * enough space in the staging ring, submits what's recorded and waits
+         * for earlier submissions to finish.
+         * @see @ref tryUploadImage(), @ref CommandBuffer::copyBufferToImage()
+         */
+        void uploadImage(const ImageView2D& image, VkImage destination, Int level = 0);
+
+        /**
+         * @brief Try to upload a 2D image
+         *
+         * Compared to @ref uploadImage(), if the upload would exceed the
+         * @ref budget() or there isn't enough free space in the staging ring,
+         * returns @cpp false @ce without doing anything.
+         */
+        bool tryUploadImage(const ImageView2D& image, VkImage destination, Int level = 0);
+
+        /**
+         * @brief Submit recorded uploads
+         * @return Ticket identifying the submission
+         *
+         * Submits the recorded copies to the queue and resets
+         * @ref recordedSize() to zero. If nothing was recorded, returns the
+         * ticket of the previous submission, or @cpp 0 @ce if there was
+         * none. A zero ticket is always complete.
+         */
+        UnsignedLong submit();
+
+        /**
+         * @brief Whether a submission is complete
+         *
+         * Doesn't block. Reclaims ring space of all finished submissions.
+         * Expects that @p ticket was returned from @ref submit().
+         * @see @ref Fence::status()
+         */
+        bool isComplete(UnsignedLong ticket);
+
+        /**
+         * @brief Wait for a submission to complete
+         *
+         * Expects that @p ticket was returned from @ref submit().
+         * @see @ref Fence::wait()
+         */
+        void wait(UnsignedLong ticket);
+
+        /**
+         * @brief Record queue family ownership acquire barriers
+         * @return Count of recorded barriers
+         *
+         * Records acquire barriers for all resources from finished
+         * submissions that weren't acquired yet into a command buffer that's
+         * going to be submitted to a queue from
+         * @ref destinationQueueFamily(). If the transfer and destination
+         * queue families are the same, does nothing and returns
+         * @cpp 0 @ce.
+         * @see @ref CommandBuffer::pipelineBarrier()
+         */
+        std::size_t recordAcquireBarriers(CommandBuffer& commandBuffer);
+
+    private:
+        struct State;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
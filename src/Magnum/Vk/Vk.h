@@ -57,6 +57,7 @@ class CopyImageToBufferInfo;
 /* Not forward-declaring CopyBufferToImageInfo1D etc right now, I see no need */
 enum class DependencyFlag: UnsignedInt;
 typedef Containers::EnumSet<DependencyFlag> DependencyFlags;
+class DescriptorAllocator;
 class DescriptorPool;
 class DescriptorPoolCreateInfo;
 class DescriptorSet;
@@ -142,6 +143,7 @@ typedef Containers::EnumSet<ShaderStage, 0x7FFFFFFF> ShaderStages;
 class SubmitInfo;
 class SubpassBeginInfo;
 class SubpassEndInfo;
+class UploadManager;
 enum class Version: UnsignedInt;
 enum class VertexFormat: Int;
 #endif
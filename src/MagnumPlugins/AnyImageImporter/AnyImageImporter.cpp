@@ -27,6 +27,8 @@
 #include "AnyImageImporter.h"
 
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/PluginManager/PluginMetadata.h>
@@ -36,6 +38,9 @@
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* lowercase() */
 
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/BlockCompression.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/Implementation/propagateConfiguration.h"
 
@@ -51,6 +56,37 @@ AnyImageImporter::AnyImageImporter(AnyImageImporter&&) noexcept = default;
 
 AnyImageImporter::~AnyImageImporter() = default;
 
+namespace {
+
+/* The transcoding options are consumed by the plugin itself, the rest is
+   passed through to the concrete implementation */
+Utility::ConfigurationGroup propagatedConfiguration(const Utility::ConfigurationGroup& configuration) {
+    Utility::ConfigurationGroup out{configuration};
+    out.removeValue("compressedFormats");
+    out.removeValue("compressionQuality");
+    return out;
+}
+
+/* Formats that TextureTools::compressBlocks() can produce, together with
+   channel count and sRGB-ness used to match them against the input */
+constexpr struct {
+    Containers::StringView name;
+    CompressedPixelFormat format;
+    UnsignedInt channelCount;
+    bool srgb;
+} CompressedFormats[]{
+    {"Bc1RGBUnorm"_s, CompressedPixelFormat::Bc1RGBUnorm, 3, false},
+    {"Bc1RGBSrgb"_s, CompressedPixelFormat::Bc1RGBSrgb, 3, true},
+    {"Bc1RGBAUnorm"_s, CompressedPixelFormat::Bc1RGBAUnorm, 4, false},
+    {"Bc1RGBASrgb"_s, CompressedPixelFormat::Bc1RGBASrgb, 4, true},
+    {"Bc3RGBAUnorm"_s, CompressedPixelFormat::Bc3RGBAUnorm, 4, false},
+    {"Bc3RGBASrgb"_s, CompressedPixelFormat::Bc3RGBASrgb, 4, true},
+    {"Bc4RUnorm"_s, CompressedPixelFormat::Bc4RUnorm, 1, false},
+    {"Bc5RGUnorm"_s, CompressedPixelFormat::Bc5RGUnorm, 2, false},
+};
+
+}
+
 ImporterFeatures AnyImageImporter::doFeatures() const {
     return ImporterFeature::OpenData|ImporterFeature::FileCallback;
 }
@@ -179,7 +215,7 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
     if(fileCallback()) importer->setFileCallback(fileCallback(), fileCallbackUserData());
 
     /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openFile():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openFile():", {}, metadata->name(), propagatedConfiguration(configuration()), importer->configuration(), !(flags() & ImporterFlag::Quiet));
 
     /* Try to open the file (error output should be printed by the plugin
        itself) */
@@ -306,7 +342,7 @@ void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
     importer->setFlags(flags());
 
     /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openData():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openData():", {}, metadata->name(), propagatedConfiguration(configuration()), importer->configuration(), !(flags() & ImporterFlag::Quiet));
 
     /* Try to open the file (error output should be printed by the plugin
        itself) */
@@ -326,7 +362,67 @@ UnsignedInt AnyImageImporter::doImage2DCount() const { return _in->image2DCount(
 
 UnsignedInt AnyImageImporter::doImage2DLevelCount(UnsignedInt id) { return _in->image2DLevelCount(id); }
 
-Containers::Optional<ImageData2D> AnyImageImporter::doImage2D(const UnsignedInt id, const UnsignedInt level) { return _in->image2D(id, level); }
+Containers::Optional<ImageData2D> AnyImageImporter::doImage2D(const UnsignedInt id, const UnsignedInt level) {
+    Containers::Optional<ImageData2D> image = _in->image2D(id, level);
+
+    /* Nothing to do if transcoding isn't requested, if the image failed to
+       import or if it's compressed already. 1D array images are passed
+       through as well, as compressBlocks() would treat them as a single 2D
+       image and mix the layers together into blocks. */
+    const Containers::String formats = configuration().value<Containers::String>("compressedFormats");
+    if(!image || image->isCompressed() || formats.isEmpty() ||
+       (image->flags() & ImageFlag2D::Array))
+        return image;
+
+    /* Only 8-bit normalized formats can be block-compressed */
+    const PixelFormat format = image->format();
+    if(isPixelFormatImplementationSpecific(format) ||
+       (pixelFormatChannelFormat(format) != PixelFormat::R8Unorm &&
+        pixelFormatChannelFormat(format) != PixelFormat::R8Srgb))
+        return image;
+    const UnsignedInt channelCount = pixelFormatChannelCount(format);
+    const bool srgb = isPixelFormatSrgb(format);
+
+    /* Pick the first requested format that matches the channel count and
+       sRGB-ness of the image */
+    Containers::Optional<CompressedPixelFormat> compressedFormat;
+    for(const Containers::StringView name: formats.splitOnWhitespaceWithoutEmptyParts()) {
+        bool found = false;
+        for(const auto& candidate: CompressedFormats) {
+            if(candidate.name != name) continue;
+            found = true;
+            if(candidate.channelCount == channelCount && candidate.srgb == srgb)
+                compressedFormat = candidate.format;
+            break;
+        }
+
+        if(!found && !(flags() & ImporterFlag::Quiet))
+            Warning{} << "Trade::AnyImageImporter::image2D(): ignoring unsupported compressed format" << name;
+        if(compressedFormat) break;
+    }
+
+    if(!compressedFormat)
+        return image;
+
+    const Containers::String qualityString = configuration().value<Containers::String>("compressionQuality");
+    TextureTools::BlockCompressionQuality quality;
+    if(qualityString == "Fast"_s)
+        quality = TextureTools::BlockCompressionQuality::Fast;
+    else if(qualityString == "Normal"_s)
+        quality = TextureTools::BlockCompressionQuality::Normal;
+    else if(qualityString == "High"_s)
+        quality = TextureTools::BlockCompressionQuality::High;
+    else {
+        Error{} << "Trade::AnyImageImporter::image2D(): invalid compression quality" << qualityString;
+        return {};
+    }
+
+    if(flags() & ImporterFlag::Verbose)
+        Debug{} << "Trade::AnyImageImporter::image2D(): encoding" << format << "as" << *compressedFormat;
+
+    CompressedImage2D compressed = TextureTools::compressBlocks(*image, *compressedFormat, quality);
+    return ImageData2D{compressed.format(), compressed.size(), compressed.release(), image->flags(), image->importerState()};
+}
 
 UnsignedInt AnyImageImporter::doImage3DCount() const { return _in->image3DCount(); }
 
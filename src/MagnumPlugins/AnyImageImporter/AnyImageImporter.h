@@ -118,9 +118,12 @@ formats that are marked as such in the list above.
     through the base @ref AbstractImporter interface. See its documentation for
     introduction and usage examples.
 
-This plugin depends on the @ref Trade library and is built if
-`MAGNUM_WITH_ANYIMAGEIMPORTER` is enabled when building Magnum. To use as a
-dynamic plugin, load @cpp "AnyImageImporter" @ce via
+This plugin depends on the @ref Trade and @ref TextureTools libraries and is
+built if `MAGNUM_WITH_ANYIMAGEIMPORTER` is enabled when building Magnum. Note
+that if Magnum is built with `MAGNUM_TARGET_GL` enabled, the @ref TextureTools
+library depends on the @ref GL library as well and thus the plugin
+transitively links to it, even though it doesn't make any GL calls. To use
+as a dynamic plugin, load @cpp "AnyImageImporter" @ce via
 @ref Corrade::PluginManager::Manager.
 
 Additionally, if you're using Magnum as a CMake subproject, do the following:
@@ -152,7 +155,8 @@ information.
 On a call to @ref openFile() / @ref openData(), a file format is detected from
 the extension / file signature and a corresponding plugin is loaded. After
 that, flags set via @ref setFlags(), file callbacks set via
-@ref setFileCallback() and options set through @ref configuration() are
+@ref setFileCallback() and options set through @ref configuration() except
+for the ones described in @ref Trade-AnyImageImporter-transcoding are
 propagated to the concrete implementation. A warning is emitted in case an
 option set is not present in the default configuration of the target plugin.
 
@@ -166,6 +170,39 @@ Besides delegating the flags, the @ref AnyImageImporter itself recognizes
 @ref ImporterFlag::Verbose, printing info about the concrete plugin being used
 when the flag is enabled. @ref ImporterFlag::Quiet is recognized as well and
 causes all warnings to be suppressed.
+
+@section Trade-AnyImageImporter-transcoding Compressed format negotiation
+
+By default, 2D images are returned in whatever format the concrete plugin
+produces. If the @cb{.ini} compressedFormats @ce option is set to a list of
+compressed formats the caller is able to consume, in order of preference,
+images that are already compressed are passed through unchanged while
+uncompressed 8-bit images are block-compressed with
+@ref TextureTools::compressBlocks() into the first listed format that matches
+their channel count and sRGB-ness. The list would typically be assembled from
+GPU capabilities, for example based on presence of the
+@gl_extension{EXT,texture_compression_s3tc} extension. Images for which no
+format matches are returned uncompressed. Images with
+@ref ImageFlag2D::Array, i.e. 1D array images, are returned uncompressed as
+well, as block-compressed formats can't represent layers that are just one
+pixel high.
+
+Compared to uploading an uncompressed image and letting the driver compress
+it, this saves GPU memory and upload bandwidth. The
+@cb{.ini} compressionQuality @ce option trades encoding speed for quality.
+Neither of the two options is propagated to the concrete implementation. With
+@ref ImporterFlag::Verbose enabled, the plugin prints the formats used for
+each encoded image.
+
+@section Trade-AnyImageImporter-configuration Plugin-specific configuration
+
+It's possible to tune the compressed format negotiation through
+@ref configuration(). See below for all options and their default values:
+
+@snippet MagnumPlugins/AnyImageImporter/AnyImageImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
 */
 class MAGNUM_ANYIMAGEIMPORTER_EXPORT AnyImageImporter: public AbstractImporter {
     public:
@@ -36,6 +36,7 @@
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -71,6 +72,10 @@ struct AnyImageImporterTest: TestSuite::Tester {
     void imageLevels2D();
     void imageLevels3D();
 
+    void transcode();
+    void transcodeUnknownFormat();
+    void transcodeInvalidQuality();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -188,6 +193,20 @@ constexpr struct {
     {"data, quiet", "rgb.tga", true, "openData", ImporterFlag::Quiet, true}
 };
 
+const struct {
+    const char* name;
+    const char* formats;
+    const char* quality;
+    Containers::Optional<CompressedPixelFormat> expectedFormat;
+} TranscodeData[]{
+    /* The rgb.tga file is RGB8Unorm */
+    {"disabled", "", "Normal", {}},
+    {"first matching", "Bc3RGBAUnorm Bc1RGBSrgb Bc1RGBUnorm Bc4RUnorm", "Normal", CompressedPixelFormat::Bc1RGBUnorm},
+    {"fast", "Bc1RGBUnorm", "Fast", CompressedPixelFormat::Bc1RGBUnorm},
+    {"high", "Bc1RGBUnorm", "High", CompressedPixelFormat::Bc1RGBUnorm},
+    {"nothing matching", "Bc4RUnorm Bc5RGUnorm Bc3RGBAUnorm", "Normal", {}},
+};
+
 AnyImageImporterTest::AnyImageImporterTest() {
     addInstancedTests({&AnyImageImporterTest::load},
         Containers::arraySize(LoadData));
@@ -224,6 +243,12 @@ AnyImageImporterTest::AnyImageImporterTest() {
               &AnyImageImporterTest::imageLevels2D,
               &AnyImageImporterTest::imageLevels3D});
 
+    addInstancedTests({&AnyImageImporterTest::transcode},
+        Containers::arraySize(TranscodeData));
+
+    addTests({&AnyImageImporterTest::transcodeUnknownFormat,
+              &AnyImageImporterTest::transcodeInvalidQuality});
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -633,6 +658,75 @@ void AnyImageImporterTest::imageLevels3D() {
     CORRADE_COMPARE(image->size(), (Vector3i{2, 1, 3}));
 }
 
+void AnyImageImporterTest::transcode() {
+    auto&& data = TranscodeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("compressedFormats", data.formats);
+    importer->configuration().setValue("compressionQuality", data.quality);
+
+    /* The options shouldn't be propagated to TgaImporter, which would cause a
+       warning */
+    std::ostringstream out;
+    {
+        Warning redirectWarning{&out};
+        CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+    }
+    CORRADE_COMPARE(out.str(), "");
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), (Vector2i{3, 2}));
+    if(data.expectedFormat) {
+        CORRADE_VERIFY(image->isCompressed());
+        CORRADE_COMPARE(image->compressedFormat(), *data.expectedFormat);
+        /* A single 4x4 block */
+        CORRADE_COMPARE(image->data().size(), 8);
+    } else {
+        CORRADE_VERIFY(!image->isCompressed());
+        CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    }
+}
+
+void AnyImageImporterTest::transcodeUnknownFormat() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("compressedFormats", "Bc7RGBAUnorm Bc1RGBUnorm");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+
+    std::ostringstream out;
+    Containers::Optional<ImageData2D> image;
+    {
+        Warning redirectWarning{&out};
+        image = importer->image2D(0);
+    }
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.str(), "Trade::AnyImageImporter::image2D(): ignoring unsupported compressed format Bc7RGBAUnorm\n");
+}
+
+void AnyImageImporterTest::transcodeInvalidQuality() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("compressedFormats", "Bc1RGBUnorm");
+    importer->configuration().setValue("compressionQuality", "Best");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(out.str(), "Trade::AnyImageImporter::image2D(): invalid compression quality Best\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AnyImageImporterTest)
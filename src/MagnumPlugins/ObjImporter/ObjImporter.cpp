@@ -25,15 +25,15 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
+#include <istream>
 #include <limits>
-#include <sstream>
 #include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once iostream is dropped */
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/String.h>
 
@@ -41,6 +41,7 @@
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Trade {
@@ -49,11 +50,44 @@ struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
     std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    Containers::Pointer<std::istream> in;
+    /* Immutable after opening so meshes can be parsed concurrently, each
+       parse has its own stream over the mesh range */
+    Containers::Array<char> data;
 };
 
 namespace {
 
+/* Read-only stream buffer over a range of characters it doesn't own, to be
+   able to parse the file data with std::istream without copying them. The
+   seeking is needed for tellg() and seekg(). */
+/** @todo drop once the iostream-based parsing is gone */
+struct ArrayStreamBuffer: std::streambuf {
+    explicit ArrayStreamBuffer(const Containers::ArrayView<const char> data) {
+        /* The buffer is never written to, std::streambuf just doesn't have a
+           const variant */
+        char* const begin = const_cast<char*>(data.begin());
+        setg(begin, begin, begin + data.size());
+    }
+
+    pos_type seekoff(const off_type offset, const std::ios_base::seekdir direction, const std::ios_base::openmode which) override {
+        if(!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        char* const position =
+            (direction == std::ios_base::beg ? eback() :
+             direction == std::ios_base::cur ? gptr() : egptr()) + offset;
+        if(position < eback() || position > egptr())
+            return pos_type(off_type(-1));
+
+        setg(eback(), position, egptr());
+        return pos_type(position - eback());
+    }
+
+    pos_type seekpos(const pos_type position, const std::ios_base::openmode which) override {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+};
+
 void ignoreLine(std::istream& in) {
     in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 }
@@ -89,34 +123,31 @@ ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, const Containe
 
 ObjImporter::~ObjImporter() = default;
 
-ImporterFeatures ObjImporter::doFeatures() const { return ImporterFeature::OpenData; }
+ImporterFeatures ObjImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::MeshAttributeSelection|ImporterFeature::ConcurrentDataAccess; }
 
 void ObjImporter::doClose() { _file.reset(); }
 
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
-void ObjImporter::doOpenFile(const Containers::StringView filename) {
-    /** @todo ARGH clean this up, won't work with UTF-8 */
-    Containers::Pointer<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
-    }
-
+void ObjImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     _file.reset(new File);
-    _file->in = Utility::move(in);
-    parseMeshNames();
-}
 
-void ObjImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
-    _file.reset(new File);
-    /** @todo ARGH MY EYES what is this cursed thing, burn it to the ground */
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+    /* Take over the existing array or copy the data if we can't */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned)) {
+        _file->data = Utility::move(data);
+    } else {
+        _file->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, _file->data);
+    }
 
     parseMeshNames();
 }
 
 void ObjImporter::parseMeshNames() {
+    /** @todo ARGH MY EYES what is this cursed thing, burn it to the ground */
+    ArrayStreamBuffer buffer{_file->data};
+    std::istream in{&buffer};
+
     /* First mesh starts at the beginning, its indices start from 1. The end
        offset will be updated to proper value later. */
     UnsignedInt positionIndexOffset = 1;
@@ -129,24 +160,24 @@ void ObjImporter::parseMeshNames() {
     bool thisIsFirstMeshAndItHasNoData = true;
     _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
+    while(in.good()) {
         /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+        const std::streampos end = in.tellg();
 
         /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
+        if(in.peek() == '#') {
+            ignoreLine(in);
             continue;
         }
 
         /* Parse the keyword */
         std::string keyword;
-        *_file->in >> keyword;
+        in >> keyword;
 
         /* Mesh name */
         if(keyword == "o") {
             std::string name;
-            std::getline(*_file->in, name);
+            std::getline(in, name);
             name = Utility::String::trim(name);
 
             /* This is the name of first mesh */
@@ -159,7 +190,7 @@ void ObjImporter::parseMeshNames() {
                 _file->meshNames.back() = Utility::move(name);
 
                 /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                std::get<0>(_file->meshes.back()) = in.tellg();
 
             /* Otherwise this is a name of new mesh */
             } else {
@@ -171,7 +202,7 @@ void ObjImporter::parseMeshNames() {
                 if(!name.empty())
                     _file->meshesForName.emplace(name, _file->meshes.size());
                 _file->meshNames.emplace_back(Utility::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                _file->meshes.emplace_back(in.tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
             }
 
             continue;
@@ -200,13 +231,13 @@ void ObjImporter::parseMeshNames() {
         }
 
         /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
+        ignoreLine(in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    in.clear();
+    in.seekg(0, std::ios::end);
+    std::get<1>(_file->meshes.back()) = in.tellg();
 }
 
 UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
@@ -236,12 +267,45 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
 
 }
 
-Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
+namespace {
+
+constexpr MeshAttribute AllAttributes[]{
+    MeshAttribute::Position,
+    MeshAttribute::Normal,
+    MeshAttribute::TextureCoordinates
+};
+
+}
+
+Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, const UnsignedInt level) {
+    return doMeshAttributes(id, level, AllAttributes, true);
+}
+
+Containers::Optional<MeshData> ObjImporter::doMeshAttributes(const UnsignedInt id, UnsignedInt, const Containers::ArrayView<const MeshAttribute> attributes, const bool indexed) {
+    /* Decide what to decode. Index tuples are always parsed in full so the
+       vertex deduplication and thus the vertex count is the same regardless
+       of which attributes are requested, the floating-point data and the
+       output are produced only for attributes that are actually wanted. */
+    bool wantPositions = false, wantNormals = false, wantTextureCoordinates = false;
+    for(const MeshAttribute attribute: attributes) {
+        if(attribute == MeshAttribute::Position)
+            wantPositions = true;
+        else if(attribute == MeshAttribute::Normal)
+            wantNormals = true;
+        else if(attribute == MeshAttribute::TextureCoordinates)
+            wantTextureCoordinates = true;
+    }
+
+    /* Set mesh parsing parameters and create a stream over just the mesh
+       range. The offsets are -1 if a mesh name was on the last line, clamp
+       them to the file size in that case. */
     std::streampos begin, end;
     UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
     std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+    const std::size_t beginOffset = Math::min(std::size_t(std::streamoff(begin)), _file->data.size());
+    const std::size_t endOffset = Math::max(Math::min(std::size_t(std::streamoff(end)), _file->data.size()), beginOffset);
+    ArrayStreamBuffer buffer{_file->data.slice(beginOffset, endOffset)};
+    std::istream in{&buffer};
 
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
@@ -250,18 +314,19 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     /* Taking a shortcut as there's fortunately nothing else than just 3 types
        of data. First positions, then normals, then texture coordinates. */
     Containers::Array<Vector3ui> indices;
+    std::size_t positionCount = 0, textureCoordinateCount = 0, normalCount = 0;
     std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
+    try { while(in.good()) {
         /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
+        if(in.peek() == '#') {
+            ignoreLine(in);
             continue;
         }
 
         /* Get the line */
         std::string line;
-        std::getline(*_file->in, line);
+        std::getline(in, line);
         line = Utility::String::trim(line);
 
         /* Ignore empty lines */
@@ -275,6 +340,9 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
 
         /* Vertex position */
         if(keyword == "v") {
+            ++positionCount;
+            if(!wantPositions) continue;
+
             Float extra{1.0f};
             const Vector3 data = extractFloatData<3>(contents, &extra);
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
@@ -286,6 +354,9 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
 
         /* Texture coordinate */
         } else if(keyword == "vt") {
+            ++textureCoordinateCount;
+            if(!wantTextureCoordinates) continue;
+
             Float extra{0.0f};
             const Vector2 data = extractFloatData<2>(contents, &extra);
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
@@ -297,6 +368,9 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
 
         /* Normal */
         } else if(keyword == "vn") {
+            ++normalCount;
+            if(!wantNormals) continue;
+
             arrayAppend(normals, Vector3{extractFloatData<3>(contents)});
 
         /* Indices */
@@ -403,17 +477,17 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     }
 
     /* There should be at least indexed position data */
-    if(positions.isEmpty() || indices.isEmpty()) {
+    if(!positionCount || indices.isEmpty()) {
         Error() << "Trade::ObjImporter::mesh(): incomplete position data";
         return Containers::NullOpt;
     }
 
     /* If there are index data, there should be also vertex data (and also the other way) */
-    if(normals.isEmpty() != (normalIndexCount == 0)) {
+    if((normalCount == 0) != (normalIndexCount == 0)) {
         Error() << "Trade::ObjImporter::mesh(): incomplete normal data";
         return Containers::NullOpt;
     }
-    if(textureCoordinates.isEmpty() != (textureCoordinateIndexCount == 0)) {
+    if((textureCoordinateCount == 0) != (textureCoordinateIndexCount == 0)) {
         Error() << "Trade::ObjImporter::mesh(): incomplete texture coordinate data";
         return Containers::NullOpt;
     }
@@ -438,13 +512,19 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
         Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
 
     /* Allocate attribute and vertex data */
-    std::size_t attributeCount = 1;
-    UnsignedInt stride = sizeof(Vector3);
-    if(normalIndexCount) {
+    const bool hasNormals = wantNormals && normalIndexCount;
+    const bool hasTextureCoordinates = wantTextureCoordinates && textureCoordinateIndexCount;
+    std::size_t attributeCount = 0;
+    UnsignedInt stride = 0;
+    if(wantPositions) {
         ++attributeCount;
         stride += sizeof(Vector3);
     }
-    if(textureCoordinateIndexCount) {
+    if(hasNormals) {
+        ++attributeCount;
+        stride += sizeof(Vector3);
+    }
+    if(hasTextureCoordinates) {
         ++attributeCount;
         stride += sizeof(Vector2);
     }
@@ -455,7 +535,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(indices)).transposed<0, 1>();
     std::size_t attributeIndex = 0;
     std::size_t offset = 0;
-    {
+    if(wantPositions) {
         Containers::StridedArrayView1D<Vector3> view{vertexData,
             reinterpret_cast<Vector3*>(vertexData.data()), vertexCount, stride};
         if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), positions, view, positionIndexOffset))
@@ -463,7 +543,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Position, view};
         offset += sizeof(Vector3);
     }
-    if(normalIndexCount) {
+    if(hasNormals) {
         Containers::StridedArrayView1D<Vector3> view{vertexData,
             reinterpret_cast<Vector3*>(vertexData.data() + offset), vertexCount, stride};
         if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), normals, view, normalIndexOffset))
@@ -471,7 +551,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Normal, view};
         offset += sizeof(Vector3);
     }
-    if(textureCoordinateIndexCount) {
+    if(hasTextureCoordinates) {
         Containers::StridedArrayView1D<Vector2> view{vertexData,
             reinterpret_cast<Vector2*>(vertexData.data() + offset), vertexCount, stride};
         if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), textureCoordinates, view, textureCoordinateIndexOffset))
@@ -481,9 +561,16 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     }
     CORRADE_INTERNAL_ASSERT(offset == stride && attributeIndex == attributeCount);
 
+    /* The vertex count is passed explicitly as there may be no attributes if
+       none of the present ones were requested */
+    if(!indexed) return MeshData{*primitive,
+        Utility::move(vertexData), Utility::move(attributeData),
+        UnsignedInt(vertexCount)};
+
     return MeshData{*primitive,
         Utility::move(indexData), Trade::MeshIndexData{indexDataI},
-        Utility::move(vertexData), Utility::move(attributeData)};
+        Utility::move(vertexData), Utility::move(attributeData),
+        UnsignedInt(vertexCount)};
 }
 
 }}
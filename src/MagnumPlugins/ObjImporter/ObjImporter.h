@@ -105,6 +105,16 @@ positions with optional @ref VertexFormat::Vector3 normals and
 @ref VertexFormat::Vector2 texture coordinates, if present in the source file.
 
 Polygons (quads etc.) and material properties are currently not supported.
+
+The importer supports @ref ImporterFeature::MeshAttributeSelection. When
+importing just a subset of attributes, only the requested vertex data are
+parsed, with no validation done for the others. The index tuples are always
+parsed in full, so the vertex count is the same as with a full import.
+
+The importer supports @ref ImporterFeature::ConcurrentDataAccess, allowing
+multiple meshes to be imported from different threads at the same time. The
+whole file is kept in memory for that purpose, with each mesh parsed from its
+own stream.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -123,13 +133,13 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
 
         MAGNUM_OBJIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_OBJIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
-        MAGNUM_OBJIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
         MAGNUM_OBJIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_OBJIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
         MAGNUM_OBJIMPORTER_LOCAL Int doMeshForName(Containers::StringView name) override;
         MAGNUM_OBJIMPORTER_LOCAL Containers::String doMeshName(UnsignedInt id) override;
         MAGNUM_OBJIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_OBJIMPORTER_LOCAL Containers::Optional<MeshData> doMeshAttributes(UnsignedInt id, UnsignedInt level, Containers::ArrayView<const MeshAttribute> attributes, bool indices) override;
 
         MAGNUM_OBJIMPORTER_LOCAL void parseMeshNames();
 
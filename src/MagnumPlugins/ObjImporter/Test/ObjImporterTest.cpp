@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -33,6 +34,7 @@
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
@@ -56,6 +58,8 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshTextureCoordinatesOptionalCoordinate();
     void meshNormals();
     void meshTextureCoordinatesNormals();
+    void meshAttributeSelection();
+    void meshAttributeSelectionNoIndices();
 
     void meshIgnoredKeyword();
 
@@ -63,6 +67,7 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshNamedFirstUnnamed();
 
     void moreMeshes();
+    void moreMeshesConcurrent();
 
     /* Technically, all invalid cases could be put into a single file, but
        because the indexing is global, it would get increasingly hard to
@@ -179,6 +184,8 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::meshTextureCoordinatesOptionalCoordinate,
               &ObjImporterTest::meshNormals,
               &ObjImporterTest::meshTextureCoordinatesNormals,
+              &ObjImporterTest::meshAttributeSelection,
+              &ObjImporterTest::meshAttributeSelectionNoIndices,
 
               &ObjImporterTest::meshIgnoredKeyword,
 
@@ -187,7 +194,8 @@ ObjImporterTest::ObjImporterTest() {
     addInstancedTests({&ObjImporterTest::meshNamedFirstUnnamed},
         Containers::arraySize(MeshNamedFirstUnnamedData));
 
-    addTests({&ObjImporterTest::moreMeshes});
+    addTests({&ObjImporterTest::moreMeshes,
+              &ObjImporterTest::moreMeshesConcurrent});
 
     addInstancedTests({&ObjImporterTest::invalid},
         Containers::arraySize(InvalidData));
@@ -431,6 +439,61 @@ void ObjImporterTest::meshTextureCoordinatesNormals() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshAttributeSelection() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->features() & ImporterFeature::MeshAttributeSelection);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-texture-coordinates-normals.obj")));
+
+    const Containers::Optional<MeshData> data = importer->mesh(0, 0, {MeshAttribute::Position});
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(data->attributeCount(), 1);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.5f, 2.0f, 3.0f},
+            {0.0f, 1.5f, 1.0f},
+            {0.5f, 2.0f, 3.0f},
+            {0.0f, 1.5f, 1.0f},
+            {0.0f, 1.5f, 1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(data->isIndexed());
+    CORRADE_COMPARE(data->indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(data->indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 1, 0, 4, 2}),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshAttributeSelectionNoIndices() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-texture-coordinates-normals.obj")));
+
+    /* Positions are not requested, the vertex count is still derived from
+       the index tuples */
+    const Containers::Optional<MeshData> data = importer->mesh(0, 0, {MeshAttribute::Normal, MeshAttribute::TextureCoordinates}, false);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Lines);
+    CORRADE_VERIFY(!data->isIndexed());
+    CORRADE_COMPARE(data->vertexCount(), 5);
+    CORRADE_COMPARE(data->attributeCount(), 2);
+    CORRADE_VERIFY(!data->hasAttribute(MeshAttribute::Position));
+    CORRADE_COMPARE_AS(data->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {1.0f, 0.5f},
+            {1.0f, 0.5f},
+            {0.5f, 1.0f},
+            {0.5f, 1.0f},
+            {0.5f, 1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            {1.0f, 0.5f, 3.5f},
+            {0.5f, 1.0f, 0.5f},
+            {0.5f, 1.0f, 0.5f},
+            {1.0f, 0.5f, 3.5f},
+            {0.5f, 1.0f, 0.5f}
+        }), TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::meshIgnoredKeyword() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-ignored-keyword.obj")));
@@ -555,6 +618,34 @@ void ObjImporterTest::moreMeshes() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::moreMeshesConcurrent() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->features() & ImporterFeature::ConcurrentDataAccess);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-multiple.obj")));
+
+    ThreadPool pool{3};
+    ThreadPool::setGlobal(&pool);
+    Containers::Array<Containers::Optional<MeshData>> meshes = importer->allMeshes();
+    ThreadPool::setGlobal(nullptr);
+
+    /* The result should be the same as when importing sequentially */
+    CORRADE_COMPARE(meshes.size(), 3);
+    for(UnsignedInt i = 0; i != meshes.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const Containers::Optional<MeshData> expected = importer->mesh(i);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(meshes[i]);
+        CORRADE_COMPARE(meshes[i]->primitive(), expected->primitive());
+        CORRADE_COMPARE(meshes[i]->attributeCount(), expected->attributeCount());
+        CORRADE_COMPARE_AS(meshes[i]->indices<UnsignedInt>(),
+            expected->indices<UnsignedInt>(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(meshes[i]->attribute<Vector3>(MeshAttribute::Position),
+            expected->attribute<Vector3>(MeshAttribute::Position),
+            TestSuite::Compare::Container);
+    }
+}
+
 void ObjImporterTest::invalid() {
     auto&& data = InvalidData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -47,7 +47,7 @@ TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, const Containe
 
 TgaImporter::~TgaImporter() = default;
 
-ImporterFeatures TgaImporter::doFeatures() const { return ImporterFeature::OpenData; }
+ImporterFeatures TgaImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::ConcurrentDataAccess; }
 
 bool TgaImporter::doIsOpened() const { return _in; }
 
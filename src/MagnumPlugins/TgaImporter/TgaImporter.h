@@ -112,6 +112,9 @@ developer area blocks at the end of the file are ignored.
 The importer recognizes @ref ImporterFlag::Verbose, printing additional info
 when the flag is enabled. @ref ImporterFlag::Quiet is recognized as well and
 causes all import warnings to be suppressed.
+
+The importer supports @ref ImporterFeature::ConcurrentDataAccess, the file
+data are only read during the import.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public: